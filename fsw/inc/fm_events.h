@@ -956,6 +956,10 @@
  *
  *  The /FM_GetDirFile command handler will not write information
  *  regarding this directory entry to the output file.
+ *
+ *  This event message is also generated when a subdirectory of a
+ *  listing with a depth cannot be opened.  The subdirectory entry is
+ *  written but its contents are not.
  */
 #define FM_GET_DIR_FILE_WARNING_EID 65
 
@@ -983,14 +987,11 @@
  *
  *  \par Cause
  *
- *  This event message is generated due to an error when writing a
- *  blank stats structure using the OS_write function.  This
- *  occurred after preliminary command argument verification tests
- *  indicated that the directory exists and the output filename
- *  is unused and appears to be valid. Verify that the output
- *  filename is reasonable.  Also, verify that the file system has
- *  sufficient free space for this operation. Then refer to the OS
- *  specific return values.
+ *  This event ID is no longer generated.  The blank stats structure
+ *  is now buffered and written together with the first directory
+ *  entries, so a failure to write it is reported by
+ *  #FM_GET_DIR_FILE_WRENTRY_ERR_EID.  The ID is reserved so that
+ *  other event IDs keep their values.
  */
 #define FM_GET_DIR_FILE_WRBLANK_ERR_EID 67
 
@@ -1038,7 +1039,7 @@
  *  \par Cause
  *
  *  This event message is generated due to an OS function error that
- *  prevents an entry from being written.  This error
+ *  prevents a block of buffered entries from being written.  This error
  *  occurred after preliminary command argument verification tests
  *  indicated that the directory exists and the output filename
  *  is unused and appears to be valid. Verify that the output
@@ -1507,690 +1508,671 @@
  */
 #define FM_DIRECTORY_ESTIMATE_ERR_EID 104
 
-/** -------------------------------------------------------------
- *  NOTE: From here on, the event IDs will take the form of a
- *  "base" EID + an offset.  This is done to allow unique event
- *  IDs to be sent from utility functions.
- ** --------------------------------------------------------------*/
-
-#define FM_FNAME_INVALID_EID_OFFSET  0
-#define FM_FNAME_DNE_EID_OFFSET      1
-#define FM_FNAME_EXIST_EID_OFFSET    1 /* mutually exclusive with DNE */
-#define FM_FNAME_ISDIR_EID_OFFSET    2
-#define FM_FNAME_ISFILE_EID_OFFSET   2 /* mutually exclusive with ISDIR */
-#define FM_FNAME_ISOPEN_EID_OFFSET   3
-#define FM_FNAME_ISCLOSED_EID_OFFSET 4
-/* Unused EID offset 5 */
-#define FM_FNAME_NUM_OFFSETS 6
-
-#define FM_CHILD_DISABLED_EID_OFFSET 0
-#define FM_CHILD_Q_FULL_EID_OFFSET   1
-#define FM_CHILD_BROKEN_EID_OFFSET   2
-#define FM_CHILD_NUM_OFFSETS         3
-
 /**
- * \brief FM Child Task Copy File Source Filename Error Base ID
+ * \brief FM Directory Manifest Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This is the base for a number of error events generated when the
- *  /FM_Copy is received with an unusable source filename.
+ *  This event message signals the successful completion of a
+ *  /FM_DirManifest command.
  */
-#define FM_COPY_SRC_BASE_EID 151
+#define FM_DIR_MANIFEST_CMD_INF_EID 105
 
 /**
- * \brief FM Child Task Copy File Source Name Invalid Event ID
+ * \brief FM Directory Manifest Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with an invalid source filename.
- *
- *  Value: 151
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with an invalid length.
  */
-#define FM_COPY_SRC_INVALID_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DIR_MANIFEST_PKT_ERR_EID 106
 
 /**
- * \brief FM Child Task Copy File Source File Does Not Exist Event ID
+ * \brief FM Directory Manifest CRC Type Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a source filename that does not exist.
- *
- *  Value: 152
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a CRC type that FM cannot compute, including
+ *  #FM_IGNORE_CRC.
  */
-#define FM_COPY_SRC_DNE_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DIR_MANIFEST_TYPE_ERR_EID 107
 
 /**
- * \brief FM Child Task Copy File Source File Name Is Directory Event ID
+ * \brief FM Directory Manifest Directory Open Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a source filename that is a directory.
- *
- *  Value: 153
+ *  This event message is generated when the /FM_DirManifest command
+ *  handler cannot open the source directory.  This error occurred after
+ *  preliminary command argument verification tests indicated that the
+ *  directory exists.
  */
-#define FM_COPY_SRC_ISDIR_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_DIR_MANIFEST_OSOPENDIR_ERR_EID 108
 
 /**
- * \brief FM Child Task Copy File Target Filename Error Base ID
+ * \brief FM Directory Manifest Output File Create Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base EID for a number of error events related to the
- *  target file in an /FM_COPY command.
- *
- *  Value: 157
+ *  This event message is generated due to an OS function error that
+ *  prevents the manifest output file from being created or the cFE
+ *  file header from being written.  Verify that the output filename is
+ *  reasonable and that the file system has sufficient free space.
  */
-#define FM_COPY_TGT_BASE_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DIR_MANIFEST_OSCREAT_ERR_EID 109
 
 /**
- * \brief FM Child Task Copy File Target Filename Invalid Event ID
+ * \brief FM Directory Manifest Output File Write Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with an invalid target filename.
- *
- *  Value: 157
+ *  This event message is generated when writing manifest statistics or
+ *  entries to the output file fails.  The output file is incomplete.
  */
-#define FM_COPY_TGT_INVALID_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DIR_MANIFEST_WRITE_ERR_EID 110
 
 /**
- * \brief FM Child Task Copy File Target File Already Exists Event ID
+ * \brief FM Directory Manifest Entries Skipped Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that already exists.
- *
- *  Value: 158
+ *  This event message is generated once at the end of a /FM_DirManifest
+ *  command if any directory entries were not written to the manifest.
+ *  Entries are skipped if they are subdirectories or open files, if the
+ *  file cannot be read, or if the combined directory and entry name is
+ *  too long.  The number of skipped entries is also recorded in the
+ *  manifest statistics.
  */
-#define FM_COPY_TGT_EXIST_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_DIR_MANIFEST_WARNING_EID 111
 
 /**
- * \brief FM Child Task Copy File Target Filename Is A Directory Event ID
+ * \brief FM CRC Worker Initialization Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that is a directory.
- *
- *  Value: 159
+ *  This event message indicates an unsuccessful attempt to create the CRC
+ *  worker semaphores or one of the CRC worker tasks.  File CRC values are
+ *  still computed, using only the workers that were created, or only the
+ *  child task if none were.
  */
-#define FM_COPY_TGT_ISDIR_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CRC_WORKER_INIT_ERR_EID 112
 
 /**
- * \brief FM Child Task Copy File Target Filename Exists As Open File Event ID
+ * \brief FM Compare Files Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that is open.
- *
- *  Value: 160
+ *  This event message signals the successful completion of a
+ *  /FM_CompareFiles command.  The compare result is reported in the
+ *  event and in the compare files telemetry packet.
  */
-#define FM_COPY_TGT_ISOPEN_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_COMPARE_FILES_CMD_INF_EID 113
 
 /**
- * \brief FM Child Task Copy File Child Task Error Base ID
+ * \brief FM Compare Files Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 163
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with an invalid length.
  */
-#define FM_COPY_CHILD_BASE_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COMPARE_FILES_PKT_ERR_EID 114
 
 /**
- * \brief FM Child Task Copy File Child Task Disabled Event ID
+ * \brief FM Compare Files OS Stat Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 163
+ *  This event message is generated when the /FM_CompareFiles command
+ *  handler cannot get the size of one of the files.  This error occurred
+ *  after preliminary command argument verification tests indicated that
+ *  the file exists.
  */
-#define FM_COPY_CHILD_DISABLED_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_COMPARE_FILES_OSSTAT_ERR_EID 115
 
 /**
- * \brief FM Child Task Copy File Child Task Queue Full Event ID
+ * \brief FM Compare Files OS Open Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 164
+ *  This event message is generated when the /FM_CompareFiles command
+ *  handler cannot open one of the files.
  */
-#define FM_COPY_CHILD_FULL_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_COMPARE_FILES_OSOPEN_ERR_EID 116
 
 /**
- * \brief FM Child Task Copy File Child Task Interface Broken Event ID
+ * \brief FM Compare Files OS Read Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 165
- *
+ *  This event message is generated when reading one of the files fails
+ *  before the end of the file, or when the files stop matching in length
+ *  because one of them was modified during the compare.
  */
-#define FM_COPY_CHILD_BROKEN_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_COMPARE_FILES_OSRD_ERR_EID 117
 
 /**
- * \brief FM Child Task Move File Source Filename Error Base ID
+ * \brief FM Sorted Directory List Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
+ *  This event message signals the successful completion of a
+ *  /FM_GetDirSorted command.
  *
- *  Value: 166
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
  */
-#define FM_MOVE_SRC_BASE_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_SORTED_CMD_INF_EID 118
 
 /**
- * \brief FM Child Task Move File Source Filename Invalid Event ID
+ * \brief FM Sorted Directory List Command Directory and Entry Too Long Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with an invalid source filename.
- *
- *  Value: 166
+ *  This event message is generated when the combined length of the
+ *  directory name plus a matching directory entry name exceeds the
+ *  maximum qualified filename length.  The entry is counted but not
+ *  listed.
  */
-#define FM_MOVE_SRC_INVALID_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_SORTED_WARNING_EID 119
 
 /**
- * \brief FM Child Task Move File Source File Does Not Exist Event ID
+ * \brief FM Sorted Directory List Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that does not exist.
- *
- *  Value: 167
+ *  This event message is generated upon receipt of a /FM_GetDirSorted
+ *  command packet with an invalid length.
  */
-#define FM_MOVE_SRC_DNE_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_SORTED_PKT_ERR_EID 120
 
 /**
- * \brief FM Child Task Move File Source Filename Is A Directory Event ID
+ * \brief FM Sorted Directory List Directory Open Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that is a directory.
- *
- *  Value: 168
+ *  This event message is generated when the /FM_GetDirSorted command
+ *  handler cannot open the directory.  The string data identifies the
+ *  name of the directory.
  */
-#define FM_MOVE_SRC_ISDIR_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_SORTED_OS_ERR_EID 121
 
 /**
- * \brief FM Child Task Move File Target Filename Error Base ID
+ * \brief FM Sorted Directory List Command Argument Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 172
+ *  This event message is generated upon receipt of a /FM_GetDirSorted
+ *  command packet with an invalid sort key or sort direction, or with a
+ *  name pattern that is not terminated.
  */
-#define FM_MOVE_TGT_BASE_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_SORTED_ARG_ERR_EID 122
 
 /**
- * \brief FM Child Task Move File Target Filename Invalid Event ID
+ * \brief FM Get Directory List to File Format Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with an invalid target filename.
- *
- *  Value: 172
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an unknown output file format or a subdirectory
+ *  depth greater than #FM_DIR_LIST_MAX_DEPTH.
  */
-#define FM_MOVE_TGT_INVALID_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_FILE_ARG_ERR_EID 123
 
 /**
- * \brief FM Child Task Move File Target File Already Exists Event ID
+ * \brief FM Get Directory List to File Next Filename Too Long Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that already exists
- *
- *  Value: 173
+ *  This event message is generated when a /FM_GetDirFile listing passes
+ *  #FM_DIR_LIST_FILE_MAX_SIZE and the name of the next output file, the
+ *  commanded filename plus a numbered suffix, is too long.  The files
+ *  already written are complete but the listing stops.
  */
-#define FM_MOVE_TGT_EXIST_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_GET_DIR_FILE_NEXT_ERR_EID 124
 
 /**
- * \brief FM Child Task Move File Target Filename Is A Directory Event ID
+ * \brief FM Directory Statistics Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is a directory.
+ *  This event message signals the successful completion of a
+ *  /FM_GetDirStats command.  The entry counts are reported in the event
+ *  and all statistics in the directory statistics telemetry packet.
  *
- *  Value: 174
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
  */
-#define FM_MOVE_TGT_ISDIR_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_STATS_CMD_INF_EID 125
 
 /**
- * \brief FM Child Task Move File Target File Exists As An Open File Event ID
+ * \brief FM Directory Statistics Entries Not Read Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is open.
- *
- *  Value: 175
+ *  This event message is generated once at the end of a /FM_GetDirStats
+ *  command when the size, time and mode of one or more entries could not
+ *  be read, either because the combined directory and entry name is too
+ *  long or because OS_stat failed.  Those entries are counted in the
+ *  packet UnreadCount and are not included in the other statistics.
  */
-#define FM_MOVE_TGT_ISOPEN_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_GET_DIR_STATS_WARNING_EID 126
 
 /**
- * \brief FM Child Task Move File Child Task Error Base ID
+ * \brief FM Directory Statistics Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 178
+ *  This event message is generated upon receipt of a /FM_GetDirStats
+ *  command packet with an invalid length.
  */
-#define FM_MOVE_CHILD_BASE_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_STATS_PKT_ERR_EID 127
 
 /**
- * \brief FM Child Task Move File Child Task Disabled Event ID
+ * \brief FM Directory Statistics Directory Open Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 178
+ *  This event message is generated when the /FM_GetDirStats command
+ *  handler cannot open the directory.  The string data identifies the
+ *  name of the directory.
  */
-#define FM_MOVE_CHILD_DISABLED_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_STATS_OS_ERR_EID 128
 
 /**
- * \brief FM Child Task Move File Child Task Queue Full Event ID
+ * \brief FM Get Directory List to Packet Mode Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 179
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with an unknown packet mode.
  */
-#define FM_MOVE_CHILD_FULL_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_PKT_ARG_ERR_EID 129
 
 /**
- * \brief FM Child Task Move File Child Task Inteface Broken Event ID
+ * \brief FM Directory Changes Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
+ *  This event message signals the successful completion of a
+ *  /FM_GetDirChanges command.  The current change sequence number of the
+ *  directory and the number of changes since the commanded sequence number
+ *  are reported in the event, the changes in the directory changes
+ *  telemetry packet.
  *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
+ */
+#define FM_GET_DIR_CHANGES_CMD_INF_EID 130
+
+/**
+ * \brief FM Directory Changes Entries Not Tracked Event ID
  *
- *  Value: 180
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
  *
+ *  This event message is generated once at the end of a /FM_GetDirChanges
+ *  command when one or more entries of the directory are not tracked,
+ *  either because the directory has more than #FM_DIR_TRACK_ENTRIES
+ *  entries, because the combined directory and entry name is too long or
+ *  because OS_stat failed.  Changes to those entries are not reported.
  */
-#define FM_MOVE_CHILD_BROKEN_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_WARNING_EID 131
 
 /**
- * \brief FM Child Task Rename File Source Filename Error Base ID
+ * \brief FM Directory Changes Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 181
+ *  This event message is generated upon receipt of a /FM_GetDirChanges
+ *  command packet with an invalid length.
  */
-#define FM_RENAME_SRC_BASE_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_CHANGES_PKT_ERR_EID 132
 
 /**
- * \brief FM Child Task Rename File Source Filename Invalid Event ID
+ * \brief FM Directory Changes Directory Open Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with an invalid source filename.
- *
- *  Value: 181
+ *  This event message is generated when the /FM_GetDirChanges command
+ *  handler cannot open the directory.  The string data identifies the
+ *  name of the directory.
  */
-#define FM_RENAME_SRC_INVALID_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_OS_ERR_EID 133
 
 /**
- * \brief FM Child Task Rename File Source File Does Not Exist Event ID
+ * \brief FM Build Directory Index Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that does not exist.
+ *  This event message signals the successful completion of a
+ *  /FM_BuildDirIndex command.  The number of entries and the total size of
+ *  the files in the index are reported in the event.
  *
- *  Value: 182
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
  */
-#define FM_RENAME_SRC_DNE_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_CMD_INF_EID 134
 
 /**
- * \brief FM Child Task Rename File Source Filename Is Directory Event ID
+ * \brief FM Build Directory Index Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that is a directory.
- *
- *  Value: 183
+ *  This event message is generated upon receipt of a /FM_BuildDirIndex
+ *  command when directory indexes are disabled, see #FM_DIR_INDEX_ENABLE.
  */
-#define FM_RENAME_SRC_ISDIR_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_DISABLED_ERR_EID 135
 
 /**
- * \brief FM Child Task Rename File Target Filename Error Base ID
+ * \brief FM Build Directory Index Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 187
+ *  This event message is generated upon receipt of a /FM_BuildDirIndex
+ *  command packet with an invalid length.
  */
-#define FM_RENAME_TGT_BASE_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_BUILD_DIR_INDEX_PKT_ERR_EID 136
 
 /**
- * \brief FM Child Task Rename File Target Filename Invalid Event ID
+ * \brief FM Build Directory Index Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with an invalid target filename.
- *
- *  Value: 187
+ *  This event message is generated when the /FM_BuildDirIndex command
+ *  handler cannot read the directory or cannot write the index file.  The
+ *  event reports the OS status and the name of the directory.
  */
-#define FM_RENAME_TGT_INVALID_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_OS_ERR_EID 137
 
 /**
- * \brief FM Child Task Rename File Target File Already Exists Event ID
+ * \brief FM Stat Cache Initialization Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that already exists.
+ *  This event message indicates an unsuccessful attempt to create the
+ *  mutex semaphore that protects the file stat cache.  FM still works,
+ *  but every file state query calls OS_stat.
+ */
+#define FM_STAT_CACHE_INIT_ERR_EID 138
+
+/**
+ * \brief FM Get Open Files Page Command Event ID
  *
- *  Value: 188
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_GetOpenFilesPage command.  The number of matching files and the
+ *  number of files in the packet are reported in the event.
  */
-#define FM_RENAME_TGT_EXIST_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_GET_OPEN_FILES_PAGE_CMD_INF_EID 139
 
 /**
- * \brief FM Child Task Rename File Target Filename Is Directory Event ID
+ * \brief FM Get Open Files Page Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is a directory.
- *
- *  Value: 189
+ *  This event message is generated upon receipt of a /FM_GetOpenFilesPage
+ *  command packet with an invalid length.
  */
-#define FM_RENAME_TGT_ISDIR_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_OPEN_FILES_PAGE_PKT_ERR_EID 140
 
 /**
- * \brief FM Child Task Rename File Target Filename Exists As Open File Event ID
+ * \brief FM Get Open Files Page Invalid Argument Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is open.
+ *  This event message is generated upon receipt of a /FM_GetOpenFilesPage
+ *  command packet with an application name or path prefix that is not
+ *  terminated.
+ */
+#define FM_GET_OPEN_FILES_PAGE_ARG_ERR_EID 141
+
+/**
+ * \brief FM Open File Age Event ID
  *
- *  Value: 190
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message is generated the first time an open files summary
+ *  finds that a file has been open for at least #FM_OPEN_FILE_AGE_LIMIT
+ *  seconds.  The file name, the application that opened it and the time
+ *  it has been open are reported.  A file held open this long may cause
+ *  delete commands to fail because the file is open.
  */
-#define FM_RENAME_TGT_ISOPEN_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_OPEN_FILE_AGE_INF_EID 142
+
+/** -------------------------------------------------------------
+ *  NOTE: From here on, the event IDs will take the form of a
+ *  "base" EID + an offset.  This is done to allow unique event
+ *  IDs to be sent from utility functions.
+ ** --------------------------------------------------------------*/
+
+#define FM_FNAME_INVALID_EID_OFFSET  0
+#define FM_FNAME_DNE_EID_OFFSET      1
+#define FM_FNAME_EXIST_EID_OFFSET    1 /* mutually exclusive with DNE */
+#define FM_FNAME_ISDIR_EID_OFFSET    2
+#define FM_FNAME_ISFILE_EID_OFFSET   2 /* mutually exclusive with ISDIR */
+#define FM_FNAME_ISOPEN_EID_OFFSET   3
+#define FM_FNAME_ISCLOSED_EID_OFFSET 4
+/* Unused EID offset 5 */
+#define FM_FNAME_NUM_OFFSETS 6
+
+#define FM_CHILD_DISABLED_EID_OFFSET 0
+#define FM_CHILD_Q_FULL_EID_OFFSET   1
+#define FM_CHILD_BROKEN_EID_OFFSET   2
+#define FM_CHILD_NUM_OFFSETS         3
 
 /**
- * \brief FM Child Task Rename File Child Task Error Base ID
+ * \brief FM Child Task Copy File Source Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 193
+ *  This is the base for a number of error events generated when the
+ *  /FM_Copy is received with an unusable source filename.
  */
-#define FM_RENAME_CHILD_BASE_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COPY_SRC_BASE_EID 151
 
 /**
- * \brief FM Child Task Rename File Child Task Disabled Event ID
+ * \brief FM Child Task Copy File Source Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid source filename.
  *
- *  Value: 193
+ *  Value: 151
  */
-#define FM_RENAME_CHILD_DISABLED_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_COPY_SRC_INVALID_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Queue Full Event ID
+ * \brief FM Child Task Copy File Source File Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a source filename that does not exist.
  *
- *  Value: 194
+ *  Value: 152
  */
-#define FM_RENAME_CHILD_FULL_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_COPY_SRC_DNE_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Copy File Source File Name Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 195
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a source filename that is a directory.
  *
+ *  Value: 153
  */
-#define FM_RENAME_CHILD_BROKEN_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_COPY_SRC_ISDIR_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source Filename Error Base ID
+ * \brief FM Child Task Copy File Target Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
+ *  This is the base EID for a number of error events related to the
+ *  target file in an /FM_COPY command.
  *
- *  Value: 196
+ *  Value: 157
  */
-#define FM_DELETE_SRC_BASE_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_COPY_TGT_BASE_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Source Filename Invalid Event ID
+ * \brief FM Child Task Copy File Target Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid target filename.
  *
- *  Value: 196
+ *  Value: 157
  */
-#define FM_DELETE_SRC_INVALID_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_COPY_TGT_INVALID_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source File Does Not Exist Event ID
+ * \brief FM Child Task Copy File Target File Already Exists Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a target filename that already exists.
  *
- *  Value: 197
+ *  Value: 158
  */
-#define FM_DELETE_SRC_DNE_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_COPY_TGT_EXIST_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source Filename Is Directory Event ID
+ * \brief FM Child Task Copy File Target Filename Is A Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a target filename that is a directory.
  *
- *  Value: 198
+ *  Value: 159
  */
-#define FM_DELETE_SRC_ISDIR_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COPY_TGT_ISDIR_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File File Is Open Event ID
+ * \brief FM Child Task Copy File Target Filename Exists As Open File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a target filename that is open.
  *
- *  Value: 199
+ *  Value: 160
  */
-#define FM_DELETE_SRC_OPEN_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_COPY_TGT_ISOPEN_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Error Base ID
+ * \brief FM Child Task Copy File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2199,12 +2181,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 202
+ *  Value: 163
  */
-#define FM_DELETE_CHILD_BASE_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COPY_CHILD_BASE_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Child Task Disabled Event ID
+ * \brief FM Child Task Copy File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2213,12 +2195,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 202
+ *  Value: 163
  */
-#define FM_DELETE_CHILD_DISABLED_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_COPY_CHILD_DISABLED_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Queue Full Event ID
+ * \brief FM Child Task Copy File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2234,12 +2216,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 203
+ *  Value: 164
  */
-#define FM_DELETE_CHILD_FULL_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_COPY_CHILD_FULL_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Copy File Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2254,56 +2236,593 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 204
+ *  Value: 165
  *
  */
-#define FM_DELETE_CHILD_BROKEN_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_COPY_CHILD_BROKEN_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Error Base ID
+ * \brief FM Child Task Move File Source Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteAll
- *  command packet with a directory name that is unusable for one
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that is unusable for one
  *  of several reasons.
  *
- *  Value: 205
+ *  Value: 166
  */
-#define FM_DELETE_ALL_SRC_BASE_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_MOVE_SRC_BASE_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete All Files Directory Name Invalid Event ID
+ * \brief FM Child Task Move File Source Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
+ *  This event message is generated upon receipt of a /FM_Move
  *  command packet with an invalid source filename.
  *
- *  Value: 205
+ *  Value: 166
  */
-#define FM_DELETE_ALL_SRC_INVALID_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_MOVE_SRC_INVALID_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Does Not Exist Event ID
+ * \brief FM Child Task Move File Source File Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteAll
- *  command packet with a directory name that does not exist.
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that does not exist.
  *
- *  Value: 206
+ *  Value: 167
  */
-#define FM_DELETE_ALL_SRC_DNE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_MOVE_SRC_DNE_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Name Is A File Event ID
+ * \brief FM Child Task Move File Source Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 168
+ */
+#define FM_MOVE_SRC_ISDIR_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 172
+ */
+#define FM_MOVE_TGT_BASE_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 172
+ */
+#define FM_MOVE_TGT_INVALID_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that already exists
+ *
+ *  Value: 173
+ */
+#define FM_MOVE_TGT_EXIST_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 174
+ */
+#define FM_MOVE_TGT_ISDIR_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target File Exists As An Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 175
+ */
+#define FM_MOVE_TGT_ISOPEN_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 178
+ */
+#define FM_MOVE_CHILD_BASE_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 178
+ */
+#define FM_MOVE_CHILD_DISABLED_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 179
+ */
+#define FM_MOVE_CHILD_FULL_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 180
+ *
+ */
+#define FM_MOVE_CHILD_BROKEN_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 181
+ */
+#define FM_RENAME_SRC_BASE_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 181
+ */
+#define FM_RENAME_SRC_INVALID_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 182
+ */
+#define FM_RENAME_SRC_DNE_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 183
+ */
+#define FM_RENAME_SRC_ISDIR_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 187
+ */
+#define FM_RENAME_TGT_BASE_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 187
+ */
+#define FM_RENAME_TGT_INVALID_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 188
+ */
+#define FM_RENAME_TGT_EXIST_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 189
+ */
+#define FM_RENAME_TGT_ISDIR_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Exists As Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 190
+ */
+#define FM_RENAME_TGT_ISOPEN_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 193
+ */
+#define FM_RENAME_CHILD_BASE_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 193
+ */
+#define FM_RENAME_CHILD_DISABLED_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 194
+ */
+#define FM_RENAME_CHILD_FULL_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 195
+ *
+ */
+#define FM_RENAME_CHILD_BROKEN_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 196
+ */
+#define FM_DELETE_SRC_BASE_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 196
+ */
+#define FM_DELETE_SRC_INVALID_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 197
+ */
+#define FM_DELETE_SRC_DNE_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 198
+ */
+#define FM_DELETE_SRC_ISDIR_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File File Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 199
+ */
+#define FM_DELETE_SRC_OPEN_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 202
+ */
+#define FM_DELETE_CHILD_BASE_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 202
+ */
+#define FM_DELETE_CHILD_DISABLED_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 203
+ */
+#define FM_DELETE_CHILD_FULL_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 204
+ *
+ */
+#define FM_DELETE_CHILD_BROKEN_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteAll
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 205
+ */
+#define FM_DELETE_ALL_SRC_BASE_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 205
+ */
+#define FM_DELETE_ALL_SRC_INVALID_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteAll
+ *  command packet with a directory name that does not exist.
+ *
+ *  Value: 206
+ */
+#define FM_DELETE_ALL_SRC_DNE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Name Is A File Event ID
  *
  *  \par Type: ERROR
  *
@@ -2312,12 +2831,959 @@
  *  This event message is generated upon receipt of a /FM_Delete
  *  command packet with a directory name that is a file.
  *
- *  Value: 207
+ *  Value: 207
+ */
+#define FM_DELETE_ALL_SRC_FILE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 211
+ */
+#define FM_DELETE_ALL_CHILD_BASE_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 211
+ */
+#define FM_DELETE_ALL_CHILD_DISABLED_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 212
+ */
+#define FM_DELETE_ALL_CHILD_FULL_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 213
+ *
+ */
+#define FM_DELETE_ALL_CHILD_BROKEN_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 214
+ */
+#define FM_DECOM_SRC_BASE_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 214
+ */
+#define FM_DECOM_SRC_INVALID_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 215
+ */
+#define FM_DECOM_SRC_DNE_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 216
+ */
+#define FM_DECOM_SRC_ISDIR_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source File Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 217
+ */
+#define FM_DECOM_SRC_OPEN_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 220
+ */
+#define FM_DECOM_TGT_BASE_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 220
+ */
+#define FM_DECOM_TGT_INVALID_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 221
+ */
+#define FM_DECOM_TGT_EXIST_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 222
+ */
+#define FM_DECOM_TGT_ISDIR_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 226
+ */
+#define FM_DECOM_CHILD_BASE_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 226
+ */
+#define FM_DECOM_CHILD_DISABLED_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 227
+ */
+#define FM_DECOM_CHILD_FULL_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 228
+ *
+ */
+#define FM_DECOM_CHILD_BROKEN_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 1 filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 229
+ */
+#define FM_CONCAT_SRC1_BASE_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid source 1 filename.
+ *
+ *  Value: 229
+ */
+#define FM_CONCAT_SRC1_INVALID_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 1 filename that does not exist.
+ *
+ *  Value: 230
+ */
+#define FM_CONCAT_SRC1_DNE_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 231
+ */
+#define FM_CONCAT_SRC1_ISDIR_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 File Already Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 232
+ */
+#define FM_CONCAT_SRC1_OPEN_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 2 filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 235
+ */
+#define FM_CONCAT_SRC2_BASE_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid source 2 filename.
+ *
+ *  Value: 235
+ */
+#define FM_CONCAT_SRC2_INVALID_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 2 filename that does not exist.
+ *
+ *  Value: 236
+ */
+#define FM_CONCAT_SRC2_DNE_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 237
+ */
+#define FM_CONCAT_SRC2_ISDIR_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 File Already Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 238
+ */
+#define FM_CONCAT_SRC2_OPEN_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 241
+ */
+#define FM_CONCAT_TGT_BASE_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 241
+ */
+#define FM_CONCAT_TGT_INVALID_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 242
+ */
+#define FM_CONCAT_TGT_EXIST_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 243
+ */
+#define FM_CONCAT_TGT_ISDIR_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 247
+ */
+#define FM_CONCAT_CHILD_BASE_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 247
+ */
+#define FM_CONCAT_CHILD_DISABLED_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 248
+ */
+#define FM_CONCAT_CHILD_FULL_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 249
+ *
+ */
+#define FM_CONCAT_CHILD_BROKEN_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 250
+ */
+#define FM_FILE_INFO_CHILD_BASE_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 250
+ */
+#define FM_FILE_INFO_CHILD_DISABLED_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 251
+ */
+#define FM_FILE_INFO_CHILD_FULL_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 252
+ *
+ */
+#define FM_FILE_INFO_CHILD_BROKEN_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory, Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 253
+ */
+#define FM_CREATE_DIR_SRC_BASE_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Create Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with an invalid directory name.
+ *
+ *  Value: 253
+ */
+#define FM_CREATE_DIR_SRC_INVALID_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with a directory name that exists as a file.
+ *
+ *  Value: 254
+ */
+#define FM_CREATE_DIR_SRC_DNE_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command pasket with a directory that already exists.
+ *
+ *  Value: 255
+ */
+#define FM_CREATE_DIR_SRC_ISDIR_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 259
+ */
+#define FM_CREATE_DIR_CHILD_BASE_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 259
+ */
+#define FM_CREATE_DIR_CHILD_DISABLED_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 260
+ */
+#define FM_CREATE_DIR_CHILD_FULL_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 261
+ *
+ */
+#define FM_CREATE_DIR_CHILD_BROKEN_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory, Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 262
+ */
+#define FM_DELETE_DIR_SRC_BASE_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with an invalid directory name.
+ *
+ *  Value: 262
+ */
+#define FM_DELETE_DIR_SRC_INVALID_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with a directory name that exists as a file.
+ *
+ *  Value: 263
+ */
+#define FM_DELETE_DIR_SRC_DNE_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 268
+ */
+#define FM_DELETE_DIR_CHILD_BASE_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete Directory Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 268
+ */
+#define FM_DELETE_DIR_CHILD_DISABLED_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 269
+ */
+#define FM_DELETE_DIR_CHILD_FULL_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 270
+ *
+ */
+#define FM_DELETE_DIR_CHILD_BROKEN_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 271
+ */
+#define FM_GET_DIR_FILE_SRC_BASE_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Directory List to File Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an invalid source directory name.
+ *
+ *  Value: 271
+ */
+#define FM_GET_DIR_FILE_SRC_INVALID_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Directory Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that does not exist.
+ *
+ *  Value: 272
+ */
+#define FM_GET_DIR_FILE_SRC_DNE_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Directory Name Is File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that is a file.
+ *
+ *  Value: 273
+ */
+#define FM_GET_DIR_FILE_SRC_ISDIR_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Target Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 277
+ */
+#define FM_GET_DIR_FILE_TGT_BASE_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Directory List to File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an invalid target file name.
+ *
+ *  Value: 277
+ */
+#define FM_GET_DIR_FILE_TGT_INVALID_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 279
  */
-#define FM_DELETE_ALL_SRC_FILE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_GET_DIR_FILE_TGT_ISDIR_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Error Base ID
+ * \brief FM Child Task Directory List to File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2326,12 +3792,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 211
+ *  Value: 283
  */
-#define FM_DELETE_ALL_CHILD_BASE_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_FILE_CHILD_BASE_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Disabled Event ID
+ * \brief FM Child Task Directory List to File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2340,12 +3806,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 211
+ *  Value: 283
  */
-#define FM_DELETE_ALL_CHILD_DISABLED_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_DISABLED_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Queue Full Event ID
+ * \brief FM Child Task Directory List to File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2361,12 +3827,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 212
+ *  Value: 284
  */
-#define FM_DELETE_ALL_CHILD_FULL_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_FULL_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Inteface Broken Event ID
+ * \brief FM Child Task Directory List to File Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2381,480 +3847,465 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 213
+ *  Value: 285
  *
  */
-#define FM_DELETE_ALL_CHILD_BROKEN_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_BROKEN_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Error Base ID
+ * \brief FM Child Task Directory List to Packet Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 214
+ *  Value: 286
  */
-#define FM_DECOM_SRC_BASE_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_PKT_SRC_BASE_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Invalid Event ID
+ * \brief FM Child Task Directory List to Packet Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with an invalid source directory name.
  *
- *  Value: 214
+ *  Value: 286
  */
-#define FM_DECOM_SRC_INVALID_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_INVALID_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Does Not Exist Event ID
+ * \brief FM Child Task Directory List to Packet Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 215
+ *  Value: 287
  */
-#define FM_DECOM_SRC_DNE_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_DNE_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Is A Directory Event ID
+ * \brief FM Child Task Directory List to Packet Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 216
+ *  Value: 288
  */
-#define FM_DECOM_SRC_ISDIR_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_ISDIR_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source File Is Open Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is already open.
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
  *
- *  Value: 217
+ *  Value: 292
  */
-#define FM_DECOM_SRC_OPEN_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_BASE_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Error Base ID
+ * \brief FM Child Task Directory List to Packet Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
  *
- *  Value: 220
+ *  Value: 292
  */
-#define FM_DECOM_TGT_BASE_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_PKT_CHILD_DISABLED_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Invalid Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with an invalid target filename.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
  *
- *  Value: 220
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 293
  */
-#define FM_DECOM_TGT_INVALID_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_FULL_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target File Already Exists Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a target filename that already exists.
- *
- *  Value: 221
- */
-#define FM_DECOM_TGT_EXIST_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
-
-/**
- * \brief FM Child Task Decompress File Target Filename Is Directory Event ID
- *
- *  \par Type: ERROR
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
  *
- *  \par Cause
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a target filename that is a directory.
+ *  Value: 294
  *
- *  Value: 222
  */
-#define FM_DECOM_TGT_ISDIR_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_BROKEN_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Error Base ID
+ * \brief FM Directory Manifest Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a source directory name that is unusable for one
+ *  of several reasons.
  *
- *  Value: 226
+ *  Value: 295
  */
-#define FM_DECOM_CHILD_BASE_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DIR_MANIFEST_SRC_BASE_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Child Task Disabled Event ID
+ * \brief FM Directory Manifest Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with an invalid source directory name.
  *
- *  Value: 226
+ *  Value: 295
  */
-#define FM_DECOM_CHILD_DISABLED_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_DIR_MANIFEST_SRC_INVALID_ERR_EID (FM_DIR_MANIFEST_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Queue Full Event ID
+ * \brief FM Directory Manifest Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 227
+ *  Value: 296
  */
-#define FM_DECOM_CHILD_FULL_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_DIR_MANIFEST_SRC_DNE_ERR_EID (FM_DIR_MANIFEST_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Inteface Broken Event ID
+ * \brief FM Directory Manifest Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 228
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a source directory name that is a file.
  *
+ *  Value: 297
  */
-#define FM_DECOM_CHILD_BROKEN_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_DIR_MANIFEST_SRC_ISFILE_ERR_EID (FM_DIR_MANIFEST_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Error Base ID
+ * \brief FM Directory Manifest Target Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 1 filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a target filename that is unusable for one of
+ *  several reasons.
  *
- *  Value: 229
+ *  Value: 301
  */
-#define FM_CONCAT_SRC1_BASE_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_DIR_MANIFEST_TGT_BASE_EID (FM_DIR_MANIFEST_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Invalid Event ID
+ * \brief FM Directory Manifest Target Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid source 1 filename.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with an invalid target filename.
  *
- *  Value: 229
+ *  Value: 301
  */
-#define FM_CONCAT_SRC1_INVALID_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DIR_MANIFEST_TGT_INVALID_ERR_EID (FM_DIR_MANIFEST_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 File Does Not Exist Event ID
+ * \brief FM Directory Manifest Target Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 1 filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a target filename that is a directory.
  *
- *  Value: 230
+ *  Value: 303
  */
-#define FM_CONCAT_SRC1_DNE_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DIR_MANIFEST_TGT_ISDIR_ERR_EID (FM_DIR_MANIFEST_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Is Directory Event ID
+ * \brief FM Directory Manifest Target Is Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_DirManifest
+ *  command packet with a target filename that is currently open.
  *
- *  Value: 231
+ *  Value: 304
  */
-#define FM_CONCAT_SRC1_ISDIR_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_DIR_MANIFEST_TGT_ISOPEN_ERR_EID (FM_DIR_MANIFEST_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 File Already Open Event ID
+ * \brief FM Directory Manifest Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is already open.
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
  *
- *  Value: 232
+ *  Value: 307
  */
-#define FM_CONCAT_SRC1_OPEN_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_DIR_MANIFEST_CHILD_BASE_EID (FM_DIR_MANIFEST_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Error Base ID
+ * \brief FM Directory Manifest Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 2 filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
  *
- *  Value: 235
+ *  Value: 307
  */
-#define FM_CONCAT_SRC2_BASE_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DIR_MANIFEST_CHILD_DISABLED_ERR_EID (FM_DIR_MANIFEST_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Invalid Event ID
+ * \brief FM Directory Manifest Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid source 2 filename.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task command queue is full.
  *
- *  Value: 235
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 308
  */
-#define FM_CONCAT_SRC2_INVALID_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DIR_MANIFEST_CHILD_FULL_ERR_EID (FM_DIR_MANIFEST_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 File Does Not Exist Event ID
+ * \brief FM Directory Manifest Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 2 filename that does not exist.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
  *
- *  Value: 236
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 309
  */
-#define FM_CONCAT_SRC2_DNE_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DIR_MANIFEST_CHILD_BROKEN_ERR_EID (FM_DIR_MANIFEST_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Is Directory Event ID
+ * \brief FM Compare Files Source 1 Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 1 filename that is unusable for one
+ *  of several reasons.
  *
- *  Value: 237
+ *  Value: 310
  */
-#define FM_CONCAT_SRC2_ISDIR_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC1_BASE_EID (FM_DIR_MANIFEST_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 2 File Already Open Event ID
+ * \brief FM Compare Files Source 1 Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with an invalid source 1 filename.
  *
- *  Value: 238
+ *  Value: 310
  */
-#define FM_CONCAT_SRC2_OPEN_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC1_INVALID_ERR_EID (FM_COMPARE_FILES_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Error Base ID
+ * \brief FM Compare Files Source 1 File Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 1 filename that does not exist.
  *
- *  Value: 241
+ *  Value: 311
  */
-#define FM_CONCAT_TGT_BASE_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COMPARE_FILES_SRC1_DNE_ERR_EID (FM_COMPARE_FILES_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Invalid Event ID
+ * \brief FM Compare Files Source 1 Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid target filename.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 1 filename that is a directory.
  *
- *  Value: 241
+ *  Value: 312
  */
-#define FM_CONCAT_TGT_INVALID_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC1_ISDIR_ERR_EID (FM_COMPARE_FILES_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Already Exists Event ID
+ * \brief FM Compare Files Source 1 File Already Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that already exists.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 1 filename that is already open.
  *
- *  Value: 242
+ *  Value: 313
  */
-#define FM_CONCAT_TGT_EXIST_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC1_OPEN_ERR_EID (FM_COMPARE_FILES_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Is Directory Event ID
+ * \brief FM Compare Files Source 2 Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 2 filename that is unusable for one
+ *  of several reasons.
  *
- *  Value: 243
+ *  Value: 316
  */
-#define FM_CONCAT_TGT_ISDIR_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC2_BASE_EID (FM_COMPARE_FILES_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Child Task Error Base ID
+ * \brief FM Compare Files Source 2 Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with an invalid source 2 filename.
  *
- *  Value: 247
+ *  Value: 316
  */
-#define FM_CONCAT_CHILD_BASE_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COMPARE_FILES_SRC2_INVALID_ERR_EID (FM_COMPARE_FILES_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Disabled Event ID
+ * \brief FM Compare Files Source 2 File Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 2 filename that does not exist.
  *
- *  Value: 247
+ *  Value: 317
  */
-#define FM_CONCAT_CHILD_DISABLED_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC2_DNE_ERR_EID (FM_COMPARE_FILES_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Queue Full Event ID
+ * \brief FM Compare Files Source 2 Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 2 filename that is a directory.
  *
- *  Value: 248
+ *  Value: 318
  */
-#define FM_CONCAT_CHILD_FULL_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC2_ISDIR_ERR_EID (FM_COMPARE_FILES_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Inteface Broken Event ID
+ * \brief FM Compare Files Source 2 File Already Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 249
+ *  This event message is generated upon receipt of a /FM_CompareFiles
+ *  command packet with a source 2 filename that is already open.
  *
+ *  Value: 319
  */
-#define FM_CONCAT_CHILD_BROKEN_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_COMPARE_FILES_SRC2_OPEN_ERR_EID (FM_COMPARE_FILES_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Error Base ID
+ * \brief FM Compare Files Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2863,12 +4314,12 @@
  *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 250
+ *  Value: 322
  */
-#define FM_FILE_INFO_CHILD_BASE_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_COMPARE_FILES_CHILD_BASE_EID (FM_COMPARE_FILES_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Get File Info Child Task Disabled Event ID
+ * \brief FM Compare Files Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2877,19 +4328,19 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 250
+ *  Value: 322
  */
-#define FM_FILE_INFO_CHILD_DISABLED_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_COMPARE_FILES_CHILD_DISABLED_ERR_EID (FM_COMPARE_FILES_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Queue Full Event ID
+ * \brief FM Compare Files Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -2898,12 +4349,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 251
+ *  Value: 323
  */
-#define FM_FILE_INFO_CHILD_FULL_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_COMPARE_FILES_CHILD_FULL_ERR_EID (FM_COMPARE_FILES_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Inteface Broken Event ID
+ * \brief FM Compare Files Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2918,70 +4369,69 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 252
- *
+ *  Value: 324
  */
-#define FM_FILE_INFO_CHILD_BROKEN_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_COMPARE_FILES_CHILD_BROKEN_ERR_EID (FM_COMPARE_FILES_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory, Directory Error Base ID
+ * \brief FM Sorted Directory List Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with a directory name that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirSorted
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 253
+ *  Value: 325
  */
-#define FM_CREATE_DIR_SRC_BASE_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_SORTED_SRC_BASE_EID (FM_COMPARE_FILES_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Create Directory Name Invalid Event ID
+ * \brief FM Sorted Directory List Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with an invalid directory name.
+ *  This event message is generated upon receipt of a /FM_GetDirSorted
+ *  command packet with an invalid source directory name.
  *
- *  Value: 253
+ *  Value: 325
  */
-#define FM_CREATE_DIR_SRC_INVALID_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_SORTED_SRC_INVALID_ERR_EID (FM_GET_DIR_SORTED_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Name Exists As File Event ID
+ * \brief FM Sorted Directory List Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with a directory name that exists as a file.
+ *  This event message is generated upon receipt of a /FM_GetDirSorted
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 254
+ *  Value: 326
  */
-#define FM_CREATE_DIR_SRC_DNE_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_SORTED_SRC_DNE_ERR_EID (FM_GET_DIR_SORTED_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Already Exists Event ID
+ * \brief FM Sorted Directory List Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command pasket with a directory that already exists.
+ *  This event message is generated upon receipt of a /FM_GetDirSorted
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 255
+ *  Value: 327
  */
-#define FM_CREATE_DIR_SRC_ISDIR_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_SORTED_SRC_ISDIR_ERR_EID (FM_GET_DIR_SORTED_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Error Base ID
+ * \brief FM Sorted Directory List Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2990,12 +4440,12 @@
  *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 259
+ *  Value: 331
  */
-#define FM_CREATE_DIR_CHILD_BASE_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_SORTED_CHILD_BASE_EID (FM_GET_DIR_SORTED_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Create Directory Child Task Disabled Event ID
+ * \brief FM Sorted Directory List Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -3004,19 +4454,19 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 259
+ *  Value: 331
  */
-#define FM_CREATE_DIR_CHILD_DISABLED_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_SORTED_CHILD_DISABLED_ERR_EID (FM_GET_DIR_SORTED_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Queue Full Event ID
+ * \brief FM Sorted Directory List Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -3025,12 +4475,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 260
+ *  Value: 332
  */
-#define FM_CREATE_DIR_CHILD_FULL_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_SORTED_CHILD_FULL_ERR_EID (FM_GET_DIR_SORTED_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Inteface Broken Event ID
+ * \brief FM Sorted Directory List Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -3045,56 +4495,69 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 261
- *
+ *  Value: 333
  */
-#define FM_CREATE_DIR_CHILD_BROKEN_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_SORTED_CHILD_BROKEN_ERR_EID (FM_GET_DIR_SORTED_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory, Directory Error Base ID
+ * \brief FM Directory Statistics Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with a directory name that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirStats
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 262
+ *  Value: 334
  */
-#define FM_DELETE_DIR_SRC_BASE_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_STATS_SRC_BASE_EID (FM_GET_DIR_SORTED_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete Directory Name Invalid Event ID
+ * \brief FM Directory Statistics Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with an invalid directory name.
+ *  This event message is generated upon receipt of a /FM_GetDirStats
+ *  command packet with an invalid source directory name.
  *
- *  Value: 262
+ *  Value: 334
  */
-#define FM_DELETE_DIR_SRC_INVALID_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_STATS_SRC_INVALID_ERR_EID (FM_GET_DIR_STATS_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Name Exists As File Event ID
+ * \brief FM Directory Statistics Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with a directory name that exists as a file.
+ *  This event message is generated upon receipt of a /FM_GetDirStats
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 263
+ *  Value: 335
  */
-#define FM_DELETE_DIR_SRC_DNE_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_STATS_SRC_DNE_ERR_EID (FM_GET_DIR_STATS_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Error Base ID
+ * \brief FM Directory Statistics Directory Is File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirStats
+ *  command packet with a source directory name that is a file.
+ *
+ *  Value: 336
+ */
+#define FM_GET_DIR_STATS_SRC_ISDIR_ERR_EID (FM_GET_DIR_STATS_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+
+/**
+ * \brief FM Directory Statistics Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -3103,12 +4566,12 @@
  *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 268
+ *  Value: 340
  */
-#define FM_DELETE_DIR_CHILD_BASE_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_STATS_CHILD_BASE_EID (FM_GET_DIR_STATS_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Disabled Event ID
+ * \brief FM Directory Statistics Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -3117,19 +4580,19 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 268
+ *  Value: 340
  */
-#define FM_DELETE_DIR_CHILD_DISABLED_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_STATS_CHILD_DISABLED_ERR_EID (FM_GET_DIR_STATS_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Queue Full Event ID
+ * \brief FM Directory Statistics Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -3138,12 +4601,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 269
+ *  Value: 341
  */
-#define FM_DELETE_DIR_CHILD_FULL_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_STATS_CHILD_FULL_ERR_EID (FM_GET_DIR_STATS_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory Child Task Inteface Broken Event ID
+ * \brief FM Directory Statistics Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -3158,127 +4621,83 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 270
- *
+ *  Value: 342
  */
-#define FM_DELETE_DIR_CHILD_BROKEN_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_STATS_CHILD_BROKEN_ERR_EID (FM_GET_DIR_STATS_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Source Filename Error Base ID
+ * \brief FM Directory Changes Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  This event message is generated upon receipt of a /FM_GetDirChanges
  *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 271
+ *  Value: 343
  */
-#define FM_GET_DIR_FILE_SRC_BASE_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_CHANGES_SRC_BASE_EID (FM_GET_DIR_STATS_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to File Directory Name Invalid Event ID
+ * \brief FM Directory Changes Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  This event message is generated upon receipt of a /FM_GetDirChanges
  *  command packet with an invalid source directory name.
  *
- *  Value: 271
+ *  Value: 343
  */
-#define FM_GET_DIR_FILE_SRC_INVALID_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_SRC_INVALID_ERR_EID (FM_GET_DIR_CHANGES_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Directory Does Not Exist Event ID
+ * \brief FM Directory Changes Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  This event message is generated upon receipt of a /FM_GetDirChanges
  *  command packet with a source directory name that does not exist.
  *
- *  Value: 272
+ *  Value: 344
  */
-#define FM_GET_DIR_FILE_SRC_DNE_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_SRC_DNE_ERR_EID (FM_GET_DIR_CHANGES_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Directory Name Is File Event ID
+ * \brief FM Directory Changes Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  This event message is generated upon receipt of a /FM_GetDirChanges
  *  command packet with a source directory name that is a file.
  *
- *  Value: 273
- */
-#define FM_GET_DIR_FILE_SRC_ISDIR_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
-
-/**
- * \brief FM Child Task Directory List to File Target Error Base ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause
- *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 277
- */
-#define FM_GET_DIR_FILE_TGT_BASE_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
-
-/**
- * \brief FM Child Task Directory List to File Target Filename Invalid Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause
- *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with an invalid target file name.
- *
- *  Value: 277
- */
-#define FM_GET_DIR_FILE_TGT_INVALID_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
-
-/**
- * \brief FM Child Task Directory List to File Target Filename Is Directory Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause
- *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a target filename that is a directory.
- *
- *  Value: 279
+ *  Value: 345
  */
-#define FM_GET_DIR_FILE_TGT_ISDIR_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_SRC_ISDIR_ERR_EID (FM_GET_DIR_CHANGES_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Error Base ID
+ * \brief FM Directory Changes Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
+ *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 283
+ *  Value: 349
  */
-#define FM_GET_DIR_FILE_CHILD_BASE_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_CHANGES_CHILD_BASE_EID (FM_GET_DIR_CHANGES_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Disabled Event ID
+ * \brief FM Directory Changes Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -3287,19 +4706,19 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 283
+ *  Value: 349
  */
-#define FM_GET_DIR_FILE_CHILD_DISABLED_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_CHILD_DISABLED_ERR_EID (FM_GET_DIR_CHANGES_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Queue Full Event ID
+ * \brief FM Directory Changes Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -3308,12 +4727,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 284
+ *  Value: 350
  */
-#define FM_GET_DIR_FILE_CHILD_FULL_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_CHILD_FULL_ERR_EID (FM_GET_DIR_CHANGES_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Inteface Broken Event ID
+ * \brief FM Directory Changes Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -3328,84 +4747,83 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 285
- *
+ *  Value: 351
  */
-#define FM_GET_DIR_FILE_CHILD_BROKEN_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_CHANGES_CHILD_BROKEN_ERR_EID (FM_GET_DIR_CHANGES_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Error Base ID
+ * \brief FM Build Directory Index Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  This event message is generated upon receipt of a /FM_BuildDirIndex
  *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 286
+ *  Value: 352
  */
-#define FM_GET_DIR_PKT_SRC_BASE_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_BUILD_DIR_INDEX_SRC_BASE_EID (FM_GET_DIR_CHANGES_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Name Invalid Event ID
+ * \brief FM Build Directory Index Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  This event message is generated upon receipt of a /FM_BuildDirIndex
  *  command packet with an invalid source directory name.
  *
- *  Value: 286
+ *  Value: 352
  */
-#define FM_GET_DIR_PKT_SRC_INVALID_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_SRC_INVALID_ERR_EID (FM_BUILD_DIR_INDEX_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Does Not Exist Event ID
+ * \brief FM Build Directory Index Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  This event message is generated upon receipt of a /FM_BuildDirIndex
  *  command packet with a source directory name that does not exist.
  *
- *  Value: 287
+ *  Value: 353
  */
-#define FM_GET_DIR_PKT_SRC_DNE_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_SRC_DNE_ERR_EID (FM_BUILD_DIR_INDEX_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Is File Event ID
+ * \brief FM Build Directory Index Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  This event message is generated upon receipt of a /FM_BuildDirIndex
  *  command packet with a source directory name that is a file.
  *
- *  Value: 288
+ *  Value: 354
  */
-#define FM_GET_DIR_PKT_SRC_ISDIR_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_SRC_ISDIR_ERR_EID (FM_BUILD_DIR_INDEX_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Error Base ID
+ * \brief FM Build Directory Index Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
+ *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 292
+ *  Value: 358
  */
-#define FM_GET_DIR_PKT_CHILD_BASE_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_BUILD_DIR_INDEX_CHILD_BASE_EID (FM_BUILD_DIR_INDEX_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Disabled Event ID
+ * \brief FM Build Directory Index Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -3414,19 +4832,19 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 292
+ *  Value: 358
  */
-#define FM_GET_DIR_PKT_CHILD_DISABLED_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_CHILD_DISABLED_ERR_EID (FM_BUILD_DIR_INDEX_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Queue Full Event ID
+ * \brief FM Build Directory Index Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -3435,12 +4853,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 293
+ *  Value: 359
  */
-#define FM_GET_DIR_PKT_CHILD_FULL_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_CHILD_FULL_ERR_EID (FM_BUILD_DIR_INDEX_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Inteface Broken Event ID
+ * \brief FM Build Directory Index Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -3455,10 +4873,9 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 294
- *
+ *  Value: 360
  */
-#define FM_GET_DIR_PKT_CHILD_BROKEN_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_BUILD_DIR_INDEX_CHILD_BROKEN_ERR_EID (FM_BUILD_DIR_INDEX_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**\}*/
 
@@ -38,6 +38,57 @@
 #define FM_NAME_IS_FILE_CLOSED 3
 #define FM_NAME_IS_DIRECTORY   4
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM compare files result definitions                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_COMPARE_IDENTICAL    0 /**< \brief Files have the same size and contents */
+#define FM_COMPARE_SIZE_DIFFERS 1 /**< \brief Files have different sizes */
+#define FM_COMPARE_DATA_DIFFERS 2 /**< \brief Files have the same size and different contents */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM sorted directory list definitions                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_SORT_BY_NAME 0 /**< \brief Order entries by name */
+#define FM_SORT_BY_TIME 1 /**< \brief Order entries by last modification time */
+#define FM_SORT_BY_SIZE 2 /**< \brief Order entries by size */
+
+#define FM_SORT_ASCENDING  0 /**< \brief First entry has the lowest name, oldest time or smallest size */
+#define FM_SORT_DESCENDING 1 /**< \brief First entry has the highest name, newest time or largest size */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory list file format definitions                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_DIR_LIST_FORMAT_STANDARD 0 /**< \brief Fixed size #FM_DirListEntry_t entries */
+#define FM_DIR_LIST_FORMAT_COMPACT  1 /**< \brief Variable length entries, see #FM_DIR_LIST_COMPACT_ENTRY_MAX */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory list packet mode definitions                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_DIR_LIST_PKT_SINGLE 0 /**< \brief One packet starting at the commanded entry */
+#define FM_DIR_LIST_PKT_STREAM 1 /**< \brief Consecutive packets from the commanded entry to the last entry */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory change type definitions                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_DIR_CHANGE_ADDED    1 /**< \brief Entry was added */
+#define FM_DIR_CHANGE_MODIFIED 2 /**< \brief Entry size or modification time changed */
+#define FM_DIR_CHANGE_REMOVED  3 /**< \brief Entry was removed */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM free space table entry state definitions                     */
@@ -64,4 +115,19 @@
 
 #define FM_IGNORE_CRC 0
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM file integrity algorithms in addition to the cFE CRC types   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_CRC_TYPE_CRC32C   4 /**< \brief CRC-32C (Castagnoli), 4 byte digest */
+#define FM_CRC_TYPE_XXHASH64 5 /**< \brief xxHash64 non-cryptographic hash (seed 0), 8 byte digest */
+#define FM_CRC_TYPE_SHA256   6 /**< \brief SHA-256 cryptographic hash, 32 byte digest */
+
+/**
+ * \brief Largest file digest reported by FM (SHA-256)
+ */
+#define FM_MAX_DIGEST_SIZE 32
+
 #endif /* FM_EXTERN_TYPEDEFS_H */
\ No newline at end of file
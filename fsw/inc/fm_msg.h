@@ -276,7 +276,9 @@ typedef struct
     char  Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
     char  Filename[OS_MAX_PATH_LEN];  /**< \brief Filename */
     uint8 GetSizeTimeMode;            /**< \brief Option to query size, time, and mode of files (CPU intensive) */
-    uint8 Spare01[3];                 /**< \brief Padding to 32 bit boundary */
+    uint8 ListFormat;                 /**< \brief Output file format, #FM_DIR_LIST_FORMAT_STANDARD or compact */
+    uint8 MaxDepth;                   /**< \brief Subdirectory levels to list, 0 lists the directory only */
+    uint8 Spare01[1];                 /**< \brief Padding to 32 bit boundary */
 } FM_GetDirectoryToFile_Payload_t;
 
 /**
@@ -302,7 +304,8 @@ typedef struct
     char   Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
     uint32 DirListOffset;              /**< \brief Index of 1st dir entry to put in packet */
     uint8  GetSizeTimeMode;            /**< \brief Option to query size, time, and mode of files (CPU intensive) */
-    uint8  Spare01[3];                 /**< \brief Padding to 32 bit boundary */
+    uint8  PacketMode;                 /**< \brief #FM_DIR_LIST_PKT_SINGLE or #FM_DIR_LIST_PKT_STREAM */
+    uint8  Spare01[2];                 /**< \brief Padding to 32 bit boundary */
 } FM_GetDirectoryToPkt_Payload_t;
 
 /**
@@ -373,6 +376,183 @@ typedef struct
     FM_FilenameAndMode_Payload_t Payload;
 } FM_SetPermissionsCmd_t;
 
+/**
+ *  \brief Directory manifest command payload structure
+ *
+ *  Contains a directory, output file name and CRC method
+ *  Used by #FM_DIR_MANIFEST_CC
+ */
+typedef struct
+{
+    char   Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+    char   Filename[OS_MAX_PATH_LEN];  /**< \brief Output filename */
+    uint32 FileInfoCRC;                /**< \brief CRC or hash method for each file */
+} FM_DirManifest_Payload_t;
+
+/**
+ *  \brief Directory Manifest command packet structure
+ *
+ *  For command details see #FM_DIR_MANIFEST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_DirManifest_Payload_t Payload; /**< \brief Command Payload */
+} FM_DirManifestCmd_t;
+
+/**
+ *  \brief Compare files command payload structure
+ *
+ *  Contains the names of the two files to compare
+ *  Used by #FM_COMPARE_FILES_CC
+ */
+typedef struct
+{
+    char Source1[OS_MAX_PATH_LEN]; /**< \brief First file */
+    char Source2[OS_MAX_PATH_LEN]; /**< \brief Second file */
+} FM_CompareFiles_Payload_t;
+
+/**
+ *  \brief Compare Files command packet structure
+ *
+ *  For command details see #FM_COMPARE_FILES_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_CompareFiles_Payload_t Payload; /**< \brief Command Payload */
+} FM_CompareFilesCmd_t;
+
+/**
+ *  \brief Get sorted directory listing command payload
+ *
+ * Contains a directory, name pattern, sort order and entry limit
+ * Used by #FM_GET_DIR_LIST_SORTED_CC
+ */
+typedef struct
+{
+    char   Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+    char   Pattern[OS_MAX_FILE_NAME];  /**< \brief Entry name pattern ('*' and '?' wildcards), empty for all */
+    uint32 MaxEntries;                 /**< \brief Number of entries to list, 0 for a full packet */
+    uint8  SortKey;                    /**< \brief Sort key (#FM_SORT_BY_NAME, #FM_SORT_BY_TIME, #FM_SORT_BY_SIZE) */
+    uint8  SortDirection;              /**< \brief Sort direction (#FM_SORT_ASCENDING, #FM_SORT_DESCENDING) */
+    uint8  GetSizeTimeMode;            /**< \brief Option to query size, time, and mode of files (CPU intensive) */
+    uint8  Spare01[1];                 /**< \brief Padding to 32 bit boundary */
+} FM_GetDirListSorted_Payload_t;
+
+/**
+ *  \brief Get Sorted DIR List to Packet command packet structure
+ *
+ *  For command details see #FM_GET_DIR_LIST_SORTED_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_GetDirListSorted_Payload_t Payload; /**< \brief Command Payload */
+} FM_GetDirListSortedCmd_t;
+
+/**
+ *  \brief Get directory statistics command payload
+ *
+ *  Contains the name of the directory to summarize
+ *  Used by #FM_GET_DIR_STATS_CC
+ */
+typedef struct
+{
+    char Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+} FM_GetDirStats_Payload_t;
+
+/**
+ *  \brief Get Directory Statistics command packet structure
+ *
+ *  For command details see #FM_GET_DIR_STATS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_GetDirStats_Payload_t Payload; /**< \brief Command Payload */
+} FM_GetDirStatsCmd_t;
+
+/**
+ *  \brief Get directory changes command payload
+ *
+ *  Contains the name of the directory and the change sequence number
+ *  already known to the caller
+ *  Used by #FM_GET_DIR_CHANGES_CC
+ */
+typedef struct
+{
+    char   Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+    uint32 SinceSequence;              /**< \brief Report changes after this sequence number, 0 for every entry */
+    uint32 ChangeOffset;               /**< \brief Index of 1st change to put in packet */
+} FM_GetDirChanges_Payload_t;
+
+/**
+ *  \brief Get Directory Changes command packet structure
+ *
+ *  For command details see #FM_GET_DIR_CHANGES_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_GetDirChanges_Payload_t Payload; /**< \brief Command Payload */
+} FM_GetDirChangesCmd_t;
+
+/**
+ *  \brief Build directory index command payload
+ *
+ *  Contains the name of the directory to index
+ *  Used by #FM_BUILD_DIR_INDEX_CC
+ */
+typedef struct
+{
+    char Directory[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+} FM_BuildDirIndex_Payload_t;
+
+/**
+ *  \brief Build Directory Index command packet structure
+ *
+ *  For command details see #FM_BUILD_DIR_INDEX_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_BuildDirIndex_Payload_t Payload; /**< \brief Command Payload */
+} FM_BuildDirIndexCmd_t;
+
+/**
+ *  \brief Get open files page command payload
+ *
+ *  Contains the open file filters and the page to report
+ *  Used by #FM_GET_OPEN_FILES_PAGE_CC
+ */
+typedef struct
+{
+    char   AppName[OS_MAX_API_NAME];    /**< \brief Application that opened the files, empty for all */
+    char   PathPrefix[OS_MAX_PATH_LEN]; /**< \brief Leading part of the file names, empty for all */
+    uint32 FileOffset;                  /**< \brief Index of 1st matching file to put in packet */
+    uint32 MaxFiles;                    /**< \brief Number of files to put in packet, 0 for as many as fit */
+    uint32 MinOpenSecs;                 /**< \brief Seconds a file has been open, 0 for all */
+} FM_GetOpenFilesPage_Payload_t;
+
+/**
+ *  \brief Get Open Files Page command packet structure
+ *
+ *  For command details see #FM_GET_OPEN_FILES_PAGE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_GetOpenFilesPage_Payload_t Payload; /**< \brief Command Payload */
+} FM_GetOpenFilesPageCmd_t;
+
 /**\}*/
 
 /**
@@ -391,7 +571,7 @@ typedef struct
  */
 typedef struct
 {
-    char   EntryName[OS_MAX_PATH_LEN]; /**< \brief Directory Listing Filename */
+    char   EntryName[OS_MAX_PATH_LEN]; /**< \brief Directory Listing Filename, relative to the listed directory */
     uint32 EntrySize;                  /**< \brief Directory Listing File Size */
     uint32 ModifyTime;                 /**< \brief Directory Listing File Last Modification Times */
     uint32 Mode;                       /**< \brief Mode of the file (Permissions from #OS_FILESTAT_MODE) */
@@ -403,9 +583,12 @@ typedef struct
 typedef struct
 {
     char              DirName[OS_MAX_PATH_LEN];          /**< \brief Directory Name */
-    uint32            TotalFiles;                        /**< \brief Number of files in the directory */
+    uint32            TotalFiles;                        /**< \brief Files in directory, or read so far if streamed */
     uint32            PacketFiles;                       /**< \brief Number of files in this packet */
     uint32            FirstFile;                         /**< \brief Index into directory files of first packet file */
+    uint32            PacketSequence;                    /**< \brief Packet number within a streamed listing, from 0 */
+    uint8             LastPacket;                        /**< \brief Packet holds the last directory entry */
+    uint8             Spare01[3];                        /**< \brief Padding to 32 bit boundary */
     FM_DirListEntry_t FileList[FM_DIR_LIST_PKT_ENTRIES]; /**< \brief Directory listing file data */
 } FM_DirListPkt_Payload_t;
 
@@ -435,6 +618,62 @@ typedef struct
     uint32 FileEntries;              /**< \brief Number of entries written to output file */
 } FM_DirListFileStats_t;
 
+/**
+ *  \brief Compact Directory Listing file entry maximum length
+ *
+ *  Files written with #FM_DIR_LIST_FORMAT_COMPACT use the header sub-type
+ *  #FM_DIR_LIST_COMPACT_FILE_SUBTYPE.  The cFE file header and the
+ *  #FM_DirListFileStats_t structure are the same as in the standard format,
+ *  they are followed by one variable length entry per file, byte by byte:
+ *
+ *  - Name length N (varint, one byte for names shorter than 128 bytes)
+ *  - Entry name relative to the listed directory (N bytes, not terminated)
+ *  - File size (varint)
+ *  - Modification time minus the time of the previous entry (zigzag varint),
+ *    the first entry is relative to zero
+ *  - Mode (varint)
+ *
+ *  A varint holds 7 bits per byte, least significant group first, with the
+ *  high bit set on every byte except the last.  A 32 bit value takes 1 to 5
+ *  bytes.  The time difference D is computed modulo 2^32 and stored as
+ *  (D << 1) ^ (D >> 31) with an arithmetic shift, so it is decoded with
+ *  D = (U >> 1) ^ -(U & 1) and added modulo 2^32 to the previous time.
+ *  Multi-byte values therefore do not depend on the processor byte order.
+ */
+#define FM_DIR_LIST_COMPACT_ENTRY_MAX (5 + OS_MAX_PATH_LEN + (3 * 5))
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- directory manifest file structures                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Directory Manifest file statistics structure
+ */
+typedef struct
+{
+    char   DirName[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+    uint32 TypeCRC;                  /**< \brief CRC or hash method used for every entry */
+    uint32 DirEntries;               /**< \brief Number of entries in the directory */
+    uint32 FileEntries;              /**< \brief Number of entries written to output file */
+    uint32 SkippedEntries;           /**< \brief Entries not written (open, unreadable or name too long) */
+} FM_DirManifestStats_t;
+
+/**
+ *  \brief Directory Manifest file entry structure
+ */
+typedef struct
+{
+    char   EntryName[OS_MAX_PATH_LEN]; /**< \brief File name (without directory) */
+    uint32 EntrySize;                  /**< \brief File size */
+    uint32 ModifyTime;                 /**< \brief File last modification time */
+    uint32 CRC;                        /**< \brief CRC value, or first four digest bytes for hashes */
+    uint8  DigestSize;                 /**< \brief Number of valid bytes in Digest */
+    uint8  Spare[3];                   /**< \brief Padding to 32 bit boundary */
+    uint8  Digest[FM_MAX_DIGEST_SIZE]; /**< \brief Full digest, most significant byte first */
+} FM_DirManifestEntry_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- get file information telemetry structure                  */
@@ -446,14 +685,16 @@ typedef struct
  */
 typedef struct
 {
-    uint8  FileStatus;                /**< \brief Status indicating whether the file is open or closed */
-    uint8  CRC_Computed;              /**< \brief Flag indicating whether a CRC was computed or not */
-    uint8  Spare[2];                  /**< \brief Structure padding */
-    uint32 CRC;                       /**< \brief CRC value if computed */
-    uint32 FileSize;                  /**< \brief File Size */
-    uint32 LastModifiedTime;          /**< \brief Last Modification Time of File */
-    uint32 Mode;                      /**< \brief Mode of the file (Permissions) */
-    char   Filename[OS_MAX_PATH_LEN]; /**< \brief Name of File */
+    uint8  FileStatus;                 /**< \brief Status indicating whether the file is open or closed */
+    uint8  CRC_Computed;               /**< \brief Flag indicating whether a CRC was computed or not */
+    uint8  DigestSize;                 /**< \brief Number of valid bytes in Digest, zero if not computed */
+    uint8  Spare;                      /**< \brief Structure padding */
+    uint32 CRC;                        /**< \brief CRC value if computed, first 4 digest bytes for hashes */
+    uint32 FileSize;                   /**< \brief File Size */
+    uint32 LastModifiedTime;           /**< \brief Last Modification Time of File */
+    uint32 Mode;                       /**< \brief Mode of the file (Permissions) */
+    char   Filename[OS_MAX_PATH_LEN];  /**< \brief Name of File */
+    uint8  Digest[FM_MAX_DIGEST_SIZE]; /**< \brief Full CRC or hash value, most significant byte first */
 } FM_FileInfoPkt_Payload_t;
 
 /**
@@ -466,6 +707,131 @@ typedef struct
     FM_FileInfoPkt_Payload_t Payload; /**< \brief Telemetry Payload */
 } FM_FileInfoPkt_t;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- compare files telemetry structure                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Compare Files telemetry payload
+ */
+typedef struct
+{
+    uint8  Result;                     /**< \brief Compare result, see #FM_COMPARE_IDENTICAL */
+    uint8  Spare[3];                   /**< \brief Structure padding */
+    uint32 FirstDiffOffset;            /**< \brief Offset of first differing byte, zero unless data differs */
+    uint32 FileSize1;                  /**< \brief Size of first file */
+    uint32 FileSize2;                  /**< \brief Size of second file */
+    char   Filename1[OS_MAX_PATH_LEN]; /**< \brief Name of first file */
+    char   Filename2[OS_MAX_PATH_LEN]; /**< \brief Name of second file */
+} FM_CompareFilesPkt_Payload_t;
+
+/**
+ *  \brief Compare Files telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_CompareFilesPkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_CompareFilesPkt_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- directory statistics telemetry structure                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Number of file size histogram bins in the directory statistics packet
+ *
+ *  Bin 0 counts empty files and bin N counts files of 2^(N-1) to 2^N - 1
+ *  bytes, so the last bin holds sizes of 2GB and up.
+ */
+#define FM_DIR_STATS_SIZE_BINS 33
+
+/**
+ *  \brief Directory Statistics telemetry payload
+ *
+ *  File statistics cover the entries that are not directories.  Times
+ *  are file system modification times, as in #FM_DirListEntry_t.
+ */
+typedef struct
+{
+    char   DirName[OS_MAX_PATH_LEN];              /**< \brief Directory name */
+    uint32 TotalEntries;                          /**< \brief Number of entries in the directory */
+    uint32 FileCount;                             /**< \brief Number of entries that are files */
+    uint32 DirCount;                              /**< \brief Number of entries that are subdirectories */
+    uint32 UnreadCount;                           /**< \brief Number of entries whose size and time were not read */
+    uint64 TotalBytes;                            /**< \brief Sum of the file sizes */
+    uint32 OldestTime;                            /**< \brief Oldest file modification time, zero if no files */
+    uint32 NewestTime;                            /**< \brief Newest file modification time, zero if no files */
+    uint32 SizeHistogram[FM_DIR_STATS_SIZE_BINS]; /**< \brief File counts by power of two size */
+    uint32 LargestSize;                           /**< \brief Size of the largest file */
+    char   LargestName[OS_MAX_PATH_LEN];          /**< \brief Name of the largest file, empty if no files */
+} FM_DirStatsPkt_Payload_t;
+
+/**
+ *  \brief Directory Statistics telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_DirStatsPkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_DirStatsPkt_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- directory changes telemetry structure                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Directory Changes entry structure
+ */
+typedef struct
+{
+    char   EntryName[OS_MAX_PATH_LEN]; /**< \brief Entry name, relative to the directory */
+    uint32 EntrySize;                  /**< \brief Entry size, zero if removed */
+    uint32 ModifyTime;                 /**< \brief Entry last modification time, zero if removed */
+    uint32 Sequence;                   /**< \brief Change sequence number of the change */
+    uint8  ChangeType;                 /**< \brief Change type, see #FM_DIR_CHANGE_ADDED */
+    uint8  Spare[3];                   /**< \brief Padding to 32 bit boundary */
+} FM_DirChangeEntry_t;
+
+/**
+ *  \brief Directory Changes telemetry payload
+ *
+ *  Changed entries are listed in name order, followed by removed entries.
+ *  When FullListing is set the changes since SinceSequence are not known
+ *  and every entry of the directory is listed as added.
+ */
+typedef struct
+{
+    char                DirName[OS_MAX_PATH_LEN];            /**< \brief Directory name */
+    uint32              Sequence;                            /**< \brief Current change sequence number */
+    uint32              SinceSequence;                       /**< \brief Commanded change sequence number */
+    uint32              TotalChanges;                        /**< \brief Number of changes since SinceSequence */
+    uint32              PacketChanges;                       /**< \brief Number of changes in this packet */
+    uint32              FirstChange;                         /**< \brief Index into changes of first packet change */
+    uint8               FullListing;                         /**< \brief Every entry is listed as added */
+    uint8               Incomplete;                          /**< \brief Some directory entries are not tracked */
+    uint8               Spare[2];                            /**< \brief Padding to 32 bit boundary */
+    FM_DirChangeEntry_t ChangeList[FM_DIR_LIST_PKT_ENTRIES]; /**< \brief Directory changes */
+} FM_DirChangesPkt_Payload_t;
+
+/**
+ *  \brief Directory Changes telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_DirChangesPkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_DirChangesPkt_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- get open files list telemetry structures                  */
@@ -500,6 +866,41 @@ typedef struct
     FM_OpenFilesPkt_Payload_t Payload; /**< \brief Telemetry Payload */
 } FM_OpenFilesPkt_t;
 
+/**
+ *  \brief Get Open Files Page list entry structure
+ */
+typedef struct
+{
+    char   LogicalName[OS_MAX_PATH_LEN]; /**< \brief Logical filename */
+    char   AppName[OS_MAX_API_NAME];     /**< \brief Application that opened file */
+    uint32 OpenSecs;                     /**< \brief Seconds since FM first found the file open */
+} FM_OpenFilesPageEntry_t;
+
+/**
+ *  \brief Get Open Files Page telemetry payload
+ *
+ *  Only the first PacketFiles entries of OpenFilesList are sent, the
+ *  packet length is set to end after the last of them.
+ */
+typedef struct
+{
+    uint32                  TotalOpenFiles;                       /**< \brief Number of files opened via cFE */
+    uint32                  MatchingFiles;                        /**< \brief Number of open files matching filters */
+    uint32                  FirstFile;                            /**< \brief Index of 1st file in matching files */
+    uint32                  PacketFiles;                          /**< \brief Number of files in this packet */
+    FM_OpenFilesPageEntry_t OpenFilesList[OS_MAX_NUM_OPEN_FILES]; /**< \brief Matching open files */
+} FM_OpenFilesPagePkt_Payload_t;
+
+/**
+ *  \brief Get Open Files Page telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_OpenFilesPagePkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_OpenFilesPagePkt_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- monitor filesystem telemetry structures                   */
@@ -651,13 +1052,30 @@ typedef struct
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+/**
+ *  \brief Most file state checks that one command can pass to the child task
+ */
+#define FM_CHILD_VERIFY_COUNT 3
+
+/**
+ *  \brief Child Task Interface deferred file state check
+ */
+typedef struct
+{
+    const char *CmdText;               /**< \brief Command name for the error event */
+    uint32      EventID;               /**< \brief Command-specific base error event ID */
+    uint32      State;                 /**< \brief Required state, one of FM_File_States */
+    char        Name[OS_MAX_PATH_LEN]; /**< \brief File or directory name to check */
+} FM_ChildVerify_t;
+
 /**
  *  \brief Child Task Interface command queue entry structure
  */
 typedef struct
 {
     CFE_MSG_FcnCode_t CommandCode;              /**< \brief Command code - identifies the command */
-    uint16            Padding1;                 /**< \brief Structure padding to align to 32-bit boundaries */
+    uint8             MaxDepth;                 /**< \brief Subdirectory levels for dir list to file commands */
+    uint8             PacketMode;               /**< \brief Packet mode for dir list to packet commands */
     uint32            DirListOffset;            /**< \brief Starting entry for dir list commands */
     uint32            FileInfoState;            /**< \brief File info state */
     uint32            FileInfoSize;             /**< \brief File info size */
@@ -667,8 +1085,14 @@ typedef struct
     char              Source2[OS_MAX_PATH_LEN]; /**< \brief Second source filename command argument */
     char              Target[OS_MAX_PATH_LEN];  /**< \brief Target filename command argument */
     uint8             GetSizeTimeMode; /**< \brief Whether to invoke stat call for size and time (CPU intensive) */
-    uint8             Padding2[3];     /**< \brief Structure padding to align to 32-bit boundaries */
+    uint8             SortKey;         /**< \brief Sort key for sorted dir list commands */
+    uint8             SortDirection;   /**< \brief Sort direction for sorted dir list commands */
+    uint8             ListFormat;      /**< \brief Output file format for dir list to file commands */
     uint32            Mode;            /**< \brief File Mode */
+    uint32            MaxEntries;      /**< \brief Entry limit for sorted dir list commands */
+    uint32            SinceSequence;   /**< \brief Known change sequence for dir changes commands */
+    uint32            VerifyCount;     /**< \brief Number of file state checks deferred to the child task */
+    FM_ChildVerify_t  Verify[FM_CHILD_VERIFY_COUNT]; /**< \brief File state checks to run before the command */
 } FM_ChildQueueEntry_t;
 
 #endif
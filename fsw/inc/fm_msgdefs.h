@@ -533,6 +533,18 @@
  *       The file information data also includes a CRC, file size,
  *       last modify time and the source name.
  *
+ *       The CRC type selects CRC-8/SMBUS (#CFE_ES_CrcType_CRC_8),
+ *       CRC-16/ARC (#CFE_ES_CrcType_CRC_16), CRC-32/ISO-HDLC
+ *       (#CFE_ES_CrcType_CRC_32), CRC-32C (#FM_CRC_TYPE_CRC32C),
+ *       xxHash64 (#FM_CRC_TYPE_XXHASH64) or SHA-256 (#FM_CRC_TYPE_SHA256),
+ *       or #FM_IGNORE_CRC to skip the CRC.  The complete result is reported
+ *       in the Digest field of the telemetry packet, and the CRC field holds
+ *       the CRC value or the first four bytes of a hash.
+ *
+ *       Recent results are cached (see #FM_DIGEST_CACHE_ENTRIES).  If the
+ *       file name, size, modify time and CRC type all match a cached result
+ *       the file is not read again.
+ *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
  *       collecting the status data and calculating the CRC will be performed by
@@ -723,6 +735,22 @@
  *       The command will overwrite a previous copy of the target
  *       file, if one exists.
  *
+ *       The listing is written with fixed size #FM_DirListEntry_t entries
+ *       unless the command selects #FM_DIR_LIST_FORMAT_COMPACT, which writes
+ *       length prefixed names and time differences instead (see
+ *       #FM_DIR_LIST_COMPACT_ENTRY_MAX) and uses the file header sub-type
+ *       #FM_DIR_LIST_COMPACT_FILE_SUBTYPE.
+ *
+ *       Every directory entry is written.  A listing that would make the
+ *       output file larger than #FM_DIR_LIST_FILE_MAX_SIZE continues in
+ *       files named after the target file with the suffix ".1", ".2", etc.
+ *
+ *       A non-zero MaxDepth also lists the contents of subdirectories, up to
+ *       MaxDepth levels below the source directory and no more than
+ *       #FM_DIR_LIST_MAX_DEPTH.  Entries are then named relative to the
+ *       source directory (e.g. "sub/file") and the size, time and mode of
+ *       every entry are read regardless of the command's GetSizeTimeMode.
+ *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
  *       reading the directory will be performed by a lower priority child task.
@@ -740,6 +768,7 @@
  *
  *  \par Command Warning Conditions
  *       - Combined directory and entry name is too long
+ *       - Subdirectory cannot be opened
  *
  *  \par Command Warning Verification
  *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter will increment
@@ -747,20 +776,23 @@
  *
  *  \par Command Error Conditions
  *       - Invalid command packet length
+ *       - Invalid output file format or listing depth
  *       - Invalid source directory name
  *       - Source directory does not exist
  *       - Directory name + separator is too long
  *       - Directory name + directory entry is too long
  *       - Invalid target filename
  *       - Target file is already open
+ *       - Target filename too long for the next output file
  *       - Failure of OS function (OS_opendir, OS_creat, OS_write)
  *
  *  \par Command Failure Verification
  *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
  *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
  *       - Error event #FM_GET_DIR_FILE_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_FILE_ARG_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_FILE_NEXT_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_FILE_OSOPENDIR_ERR_EID may be sent
- *       - Error event #FM_GET_DIR_FILE_WRBLANK_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_FILE_WRHDR_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_FILE_OSCREAT_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_FILE_WRENTRY_ERR_EID may be sent
@@ -803,6 +835,14 @@
  *       The number of entries per packet #FM_DIR_LIST_PKT_ENTRIES
  *       is a platform configuration definition.
  *
+ *       With the packet mode #FM_DIR_LIST_PKT_STREAM the command lists
+ *       every entry from the first entry index to the end of the directory
+ *       in one directory pass, sending consecutive packets no faster than
+ *       #FM_DIR_LIST_PKT_STREAM_RATE packets per second.  Each packet
+ *       carries its sequence number in the listing, and the last packet
+ *       is flagged.  Until the last packet the total file count is the
+ *       number of entries read so far.
+ *
  *       Because of the possibility that this command might take a very long time
  *       to complete, command argument validation will be done immediately but
  *       reading the directory will be performed by a lower priority child task.
@@ -834,12 +874,14 @@
  *       - OS error received requesting directory size
  *       - OS error received closing directory
  *       - Invalid directory pathname received
+ *       - Invalid packet mode
  *       - Command packet length not as expected
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
  *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
  *       - Error event #FM_GET_DIR_PKT_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_PKT_ARG_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_PKT_OS_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_PKT_SRC_INVALID_ERR_EID may be sent
  *       - Error event #FM_GET_DIR_PKT_SRC_DNE_ERR_EID may be sent
@@ -965,6 +1007,487 @@
  */
 #define FM_SET_PERMISSIONS_CC 19
 
+/**
+ * \brief Write Directory Checksum Manifest to a File
+ *
+ *  \par Description
+ *       This command computes the selected CRC or hash for every closed file
+ *       in the source directory and writes a manifest to the target file.
+ *       The manifest contains a cFE file header, a #FM_DirManifestStats_t
+ *       statistics structure and one #FM_DirManifestEntry_t per file with
+ *       the file name, size, last modify time and digest.
+ *       If the target filename buffer is empty, then the default
+ *       target filename #FM_DIR_MANIFEST_FILE_DEFNAME is used.
+ *       The command will overwrite a previous copy of the target
+ *       file, if one exists.
+ *
+ *       The CRC type may be any type accepted by #FM_GET_FILE_INFO_CC except
+ *       #FM_IGNORE_CRC.  Results for unchanged files are taken from the digest
+ *       cache (see #FM_DIGEST_CACHE_ENTRIES) and new results are added to it.
+ *       Manifest entries are collected in a #FM_CHILD_WRITE_BUFFER_SIZE buffer
+ *       and written to the target file in large sequential blocks.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory and files will be performed by a lower priority
+ *       child task.  As such, the return value for this function only refers to
+ *       the result of command argument verification and being able to place the
+ *       command on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_DirManifestCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_DIR_MANIFEST_CMD_INF_EID will be sent
+ *
+ *  \par Command Warning Conditions
+ *       - Directory entries that are open files, subdirectories, cannot be read
+ *         or have a combined directory and entry name that is too long are not
+ *         written to the manifest
+ *
+ *  \par Command Warning Verification
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter will increment
+ *       - Informational event #FM_DIR_MANIFEST_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid source directory name
+ *       - Source directory does not exist
+ *       - Invalid target filename
+ *       - Target file is already open
+ *       - Invalid CRC type
+ *       - Failure of OS function (OS_DirectoryOpen, OS_OpenCreate, OS_write)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_DIR_MANIFEST_PKT_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_TYPE_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_OSOPENDIR_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_OSCREAT_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_WRITE_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_SRC_ISFILE_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_TGT_INVALID_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_TGT_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_TGT_ISOPEN_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_DIR_MANIFEST_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Computing the digest of every file in a large directory may consume
+ *       more CPU resource than anticipated.
+ *
+ *  \sa #FM_GET_FILE_INFO_CC, #FM_GET_DIR_LIST_FILE_CC
+ */
+#define FM_DIR_MANIFEST_CC 20
+
+/**
+ * \brief Compare Two Files
+ *
+ *  \par Description
+ *       This command compares the contents of two files and reports the
+ *       result in a single #FM_CompareFilesPkt_t telemetry packet.  The file
+ *       sizes are compared first; if they differ the result is
+ *       #FM_COMPARE_SIZE_DIFFERS and neither file is read.  Otherwise both
+ *       files are read in #FM_CHILD_COMPARE_BLOCK_SIZE blocks and the
+ *       comparison stops at the first block that differs.  The result is
+ *       #FM_COMPARE_DATA_DIFFERS with the offset of the first differing byte,
+ *       or #FM_COMPARE_IDENTICAL if the whole files match.  A file that
+ *       changes size while it is read is reported as #FM_COMPARE_SIZE_DIFFERS
+ *       when the common data matches.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the files will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_CompareFilesCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_COMPARE_FILES_CMD_INF_EID will be sent
+ *       - Telemetry packet #FM_CompareFilesPkt_t will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid source filename
+ *       - Source file does not exist
+ *       - Source filename is a directory
+ *       - Source file is open
+ *       - Failure of OS function (OS_stat, OS_OpenCreate, OS_read)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_COMPARE_FILES_PKT_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_OSSTAT_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_OSOPEN_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_OSRD_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC1_INVALID_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC1_DNE_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC1_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC1_OPEN_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC2_INVALID_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC2_DNE_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC2_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_SRC2_OPEN_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_COMPARE_FILES_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Comparing two large identical files reads both files completely and
+ *       may consume more CPU resource than anticipated.
+ *
+ *  \sa #FM_GET_FILE_INFO_CC, #FM_CONCAT_FILES_CC
+ */
+#define FM_COMPARE_FILES_CC 21
+
+/**
+ * \brief Get Sorted Directory Listing to Packet
+ *
+ *  \par Description
+ *       This command selects entries of a directory and sends them in a
+ *       single #FM_DirListPkt_t telemetry packet, ordered by name, last
+ *       modification time or size.  Only entries whose names match the
+ *       command pattern are selected; the pattern may use '*' to match any
+ *       number of characters and '?' to match one character, and an empty
+ *       pattern matches every entry.  The packet holds the first
+ *       MaxEntries entries in the requested order, or a full packet of
+ *       #FM_DIR_LIST_PKT_ENTRIES if MaxEntries is zero or larger.  For
+ *       example, sorting by time in descending order with a limit of 10
+ *       reports the 10 newest files however large the directory is.
+ *
+ *       The directory is read once and only the selected entries are kept,
+ *       so memory use does not depend on the size of the directory.  The
+ *       packet TotalFiles field reports the number of entries that matched
+ *       the pattern and FirstFile is always zero.  Sorting by time or size
+ *       reads the size, time and mode of every matching entry; sorting by
+ *       name reads them only for the listed entries, and only if the
+ *       GetSizeTimeMode option is set.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_GetDirListSortedCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_GET_DIR_SORTED_CMD_INF_EID will be sent
+ *       - Telemetry packet #FM_DirListPkt_t will be sent
+ *
+ *  \par Command Warning Conditions
+ *       - Combined directory and entry name is too long
+ *
+ *  \par Command Warning Verification
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter may increment
+ *       - Informational event #FM_GET_DIR_SORTED_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid sort key or sort direction
+ *       - Name pattern is not terminated
+ *       - Invalid source directory name
+ *       - Source directory does not exist
+ *       - Source directory name is a file
+ *       - Failure of OS function (OS_DirectoryOpen)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_GET_DIR_SORTED_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_ARG_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_OS_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_SORTED_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Sorting a large directory by time or size reads the size and time
+ *       of every matching entry and may consume more CPU resource than
+ *       anticipated.
+ *
+ *  \sa #FM_GET_DIR_LIST_PKT_CC, #FM_GET_DIR_LIST_FILE_CC
+ */
+#define FM_GET_DIR_LIST_SORTED_CC 22
+
+/**
+ * \brief Get Directory Statistics
+ *
+ *  \par Description
+ *       This command reads a directory once and reports summary statistics in
+ *       a single #FM_DirStatsPkt_t telemetry packet: the number of entries,
+ *       files and subdirectories, the total size of the files, a histogram of
+ *       file sizes by power of two (see #FM_DIR_STATS_SIZE_BINS), the oldest
+ *       and newest file modification times, and the name and size of the
+ *       largest file.  No listing is produced, so even a very large directory
+ *       is summarized by one command and one packet.
+ *
+ *       The size, time and mode of every entry are read, pausing for
+ *       #FM_CHILD_STAT_SLEEP_MS after each #FM_CHILD_STAT_SLEEP_FILECOUNT
+ *       entries like the directory listing commands.  Entries that cannot be
+ *       read are counted in UnreadCount only.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_GetDirStatsCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_GET_DIR_STATS_CMD_INF_EID will be sent
+ *       - Telemetry packet #FM_DirStatsPkt_t will be sent
+ *
+ *  \par Command Warning Conditions
+ *       - Combined directory and entry name is too long
+ *       - Failure of OS function (OS_stat)
+ *
+ *  \par Command Warning Verification
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter may increment
+ *       - Informational event #FM_GET_DIR_STATS_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid source directory name
+ *       - Source directory does not exist
+ *       - Source directory name is a file
+ *       - Failure of OS function (OS_DirectoryOpen)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_GET_DIR_STATS_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_OS_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_STATS_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Reading the size and time of every entry of a large directory may
+ *       consume more CPU resource than anticipated.
+ *
+ *  \sa #FM_GET_DIR_LIST_SORTED_CC, #FM_MONITOR_FILESYSTEM_SPACE_CC
+ */
+#define FM_GET_DIR_STATS_CC 23
+
+/**
+ * \brief Get Directory Changes
+ *
+ *  \par Description
+ *       This command reports the entries of a directory that were added,
+ *       modified or removed since a change sequence number returned by an
+ *       earlier command, in a #FM_DirChangesPkt_t telemetry packet.  A ground
+ *       system that keeps a copy of a large directory listing can keep it up
+ *       to date without listing the whole directory again.
+ *
+ *       Up to #FM_DIR_TRACK_DIRS directories are tracked, the command is
+ *       rejected as an invalid command code when it is 0.  The first command
+ *       for a directory, a SinceSequence of zero, or a SinceSequence that is
+ *       unknown or older than the removed entries remembered (see
+ *       #FM_DIR_TRACK_REMOVED) results in a full listing, with FullListing
+ *       set and every entry reported as added.  The packet Sequence is the
+ *       value to command next time.  Sequence numbers start from the time
+ *       the directory became tracked, so a number from before the directory
+ *       was tracked again does not match.
+ *
+ *       The changes are found by reading the directory and comparing size and
+ *       modify time with the previous read, or only after an inotify event
+ *       (see #FM_DIR_TRACK_INOTIFY).  Changes are reported in name order
+ *       followed by removed entries, up to #FM_DIR_LIST_PKT_ENTRIES per
+ *       packet starting from ChangeOffset.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_GetDirChangesCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_GET_DIR_CHANGES_CMD_INF_EID will be sent
+ *       - Telemetry packet #FM_DirChangesPkt_t will be sent
+ *
+ *  \par Command Warning Conditions
+ *       - Directory has more than #FM_DIR_TRACK_ENTRIES entries
+ *       - Combined directory and entry name is too long
+ *       - Failure of OS function (OS_stat)
+ *
+ *  \par Command Warning Verification
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter may increment
+ *       - Informational event #FM_GET_DIR_CHANGES_WARNING_EID may be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid source directory name
+ *       - Source directory does not exist
+ *       - Source directory name is a file
+ *       - Failure of OS function (OS_DirectoryOpen)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_GET_DIR_CHANGES_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_OS_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_GET_DIR_CHANGES_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Without inotify every command reads the size and time of every entry
+ *       of the directory, which may consume more CPU resource than
+ *       anticipated for a large directory.
+ *
+ *  \sa #FM_GET_DIR_LIST_PKT_CC, #FM_GET_DIR_STATS_CC
+ */
+#define FM_GET_DIR_CHANGES_CC 24
+
+/**
+ * \brief Build Directory Index
+ *
+ *  \par Description
+ *       This command writes a persistent index file for a directory to
+ *       #FM_DIR_INDEX_PATH, replacing any previous index of the directory.
+ *       The index holds the name, size, modify time and mode of every entry
+ *       of the directory sorted by name, along with the modify time of the
+ *       directory itself.
+ *
+ *       Once a directory has an index, the Get Directory Listing (to packet)
+ *       command and the directory space estimate of the monitor table read
+ *       the index rather than the directory while the directory modify time
+ *       matches the index.  Entries that FM itself copies, moves, renames,
+ *       deletes, decompresses, concatenates or creates are updated in the
+ *       index as part of those commands.  An index left stale by any other
+ *       change is not used, the directory is read instead, until this
+ *       command is sent again.  Deleting the directory, or deleting files
+ *       with Delete All Files, removes its index.
+ *
+ *       The entries are sorted #FM_DIR_INDEX_SORT_ENTRIES at a time in
+ *       memory and merged in work files, so there is no limit on the number
+ *       of entries of the directory.
+ *
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_BuildDirIndexCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_BUILD_DIR_INDEX_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Directory index disabled (#FM_DIR_INDEX_ENABLE)
+ *       - Invalid source directory name
+ *       - Source directory does not exist
+ *       - Source directory name is a file
+ *       - Failure of OS function (OS_stat, OS_DirectoryOpen, OS_OpenCreate, OS_write, OS_read, OS_rename)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_BUILD_DIR_INDEX_PKT_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_OS_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_BUILD_DIR_INDEX_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Building the index reads the size and time of every entry of the
+ *       directory and writes the records several times, which may consume
+ *       more CPU resource and file system space than anticipated for a large
+ *       directory.
+ *
+ *  \sa #FM_GET_DIR_LIST_PKT_CC
+ */
+#define FM_BUILD_DIR_INDEX_CC 25
+
+/**
+ * \brief Get Open Files Page
+ *
+ *  \par Description
+ *       This command reports a page of the open files in a
+ *       #FM_OpenFilesPagePkt_t telemetry packet.  Only the files opened by
+ *       the application named by AppName and whose names start with
+ *       PathPrefix are listed, an empty filter matches every file.  A
+ *       non-zero MinOpenSecs lists only the files that have been open at
+ *       least that long, to find the applications holding files open.  The
+ *       matching files are listed from FileOffset, up to MaxFiles of them,
+ *       each with the number of seconds since FM first found it open.
+ *
+ *       The packet is sent with only the listed entries, so a query that
+ *       matches a few files costs a few entries of telemetry rather than a
+ *       full #FM_OpenFilesPkt_t.  TotalOpenFiles and MatchingFiles let the
+ *       ground tell whether more pages remain.
+ *
+ *  \par Command Packet Structure
+ *       #FM_GetOpenFilesPageCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - Informational event #FM_GET_OPEN_FILES_PAGE_CMD_INF_EID will be sent
+ *       - Telemetry packet #FM_OpenFilesPagePkt_t will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Application name or path prefix is not terminated
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_GET_OPEN_FILES_PAGE_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_OPEN_FILES_PAGE_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - There are no critical issues related to this command.
+ *
+ *  \sa #FM_GET_OPEN_FILES_CC
+ */
+#define FM_GET_OPEN_FILES_PAGE_CC 26
+
 /**\}*/
 
 #endif
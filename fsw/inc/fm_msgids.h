@@ -40,11 +40,15 @@
  * \{
  */
 
-#define FM_HK_TLM_MID         0x088A /** < \brief FM housekeeping */
-#define FM_FILE_INFO_TLM_MID  0x088B /** < \brief FM get file info */
-#define FM_DIR_LIST_TLM_MID   0x088C /** < \brief FM get dir list */
-#define FM_OPEN_FILES_TLM_MID 0x088D /** < \brief FM get open files */
-#define FM_FREE_SPACE_TLM_MID 0x088E /** < \brief FM get free space */
+#define FM_HK_TLM_MID              0x088A /** < \brief FM housekeeping */
+#define FM_FILE_INFO_TLM_MID       0x088B /** < \brief FM get file info */
+#define FM_DIR_LIST_TLM_MID        0x088C /** < \brief FM get dir list */
+#define FM_OPEN_FILES_TLM_MID      0x088D /** < \brief FM get open files */
+#define FM_FREE_SPACE_TLM_MID      0x088E /** < \brief FM get free space */
+#define FM_COMPARE_FILES_TLM_MID   0x088F /** < \brief FM compare files */
+#define FM_DIR_STATS_TLM_MID       0x0890 /** < \brief FM get directory statistics */
+#define FM_DIR_CHANGES_TLM_MID     0x0891 /** < \brief FM get directory changes */
+#define FM_OPEN_FILES_PAGE_TLM_MID 0x0892 /** < \brief FM get open files page */
 
 /**\}*/
 
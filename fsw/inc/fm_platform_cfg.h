@@ -123,23 +123,45 @@
 #define FM_DIR_LIST_FILE_DEFNAME "/ram/fm_dirlist.out"
 
 /**
- * \brief Maximum Directory List Output File Entries
+ * \brief Maximum Directory List Output File Size
  *
  *  \par Description:
- *       This definition sets the upper limit for the number of directory
- *       entries that may be written to a Directory List output file.
- *       Directory List files are variable length, based on the number of
- *       directory entries actually written to the file.  There may zero
- *       entries written to the file if the directory is empty.  For most
- *       environments, this definition will play no role at all, as it
- *       will be set to a number much larger than the count of files that
- *       will ever exist in any directory at one time.
+ *       This definition sets the size in bytes at which a Directory List
+ *       output file is closed and the listing continues in a new file.
+ *       Every directory entry is written, so the listing of a very large
+ *       directory is split into the commanded file followed by files with
+ *       the same name and the suffix ".1", ".2", etc.  Each file has its
+ *       own cFE file header and statistics structure.  Once the directory
+ *       has been read, the statistics of every file are updated with the
+ *       number of entries in the whole directory.  Set this parameter to
+ *       zero to write the whole listing to one file.
  *
  *  \par Limits:
- *       The FM application limits this value to be no less than 100 and
- *       no greater than 10000.
+ *       The FM application limits this value to be zero or no less than
+ *       1024 bytes.  A value of 262144 keeps each file near the size of
+ *       the former 3000 entry listing limit.
  */
-#define FM_DIR_LIST_FILE_ENTRIES 3000
+#define FM_DIR_LIST_FILE_MAX_SIZE 0
+
+/**
+ * \brief Maximum Directory List Output File Depth
+ *
+ *  \par Description:
+ *       This definition sets the largest number of subdirectory levels a
+ *       single Get Directory List to File command may descend into.  The
+ *       child task keeps one open directory handle for every level being
+ *       listed, so a listing of this depth uses this value plus one of the
+ *       OS_MAX_NUM_OPEN_DIRS directory handles.  The Get Directory List to
+ *       Packet cursor may hold one more, see #FM_DIR_LIST_CURSOR_TTL.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 16, and less than OS_MAX_NUM_OPEN_DIRS when defined.
+ *       When FM_DIR_LIST_CURSOR_TTL is not zero, this value plus one must
+ *       also be less than OS_MAX_NUM_OPEN_DIRS.  The default of 2 leaves a
+ *       handle for other applications with the OSAL default of 4.
+ */
+#define FM_DIR_LIST_MAX_DEPTH 2
 
 /**
  * \brief Directory List Output File Header Sub-Type
@@ -154,6 +176,52 @@
  */
 #define FM_DIR_LIST_FILE_SUBTYPE 12345
 
+/**
+ * \brief Compact Directory List Output File Header Sub-Type
+ *
+ *  \par Description:
+ *       This definition sets the cFE File Header sub-type value for FM
+ *       Directory List data files written in the compact format
+ *       (#FM_DIR_LIST_FORMAT_COMPACT).  The value must differ from
+ *       #FM_DIR_LIST_FILE_SUBTYPE so that ground tools can select the
+ *       decoder from the file header.
+ *
+ *  \par Limits:
+ *       The FM application places no limits on this unsigned 32 bit value.
+ */
+#define FM_DIR_LIST_COMPACT_FILE_SUBTYPE 12347
+
+/**
+ * \brief Default Directory Manifest Output Filename
+ *
+ *  \par Description:
+ *       This definition is the default output filename used by the Directory
+ *       Manifest command handler when the output filename is not provided.
+ *       The default filename is used whenever the commanded output filename
+ *       is the empty string.
+ *
+ *  \par Limits:
+ *       The FM application does not place a limit on this configuration
+ *       parameter, however the symbol must be defined and the name will
+ *       be subject to the same verification tests as a commanded output
+ *       filename.  Set this parameter to the empty string if no default
+ *       filename is desired.
+ */
+#define FM_DIR_MANIFEST_FILE_DEFNAME "/ram/fm_manifest.out"
+
+/**
+ * \brief Directory Manifest Output File Header Sub-Type
+ *
+ *  \par Description:
+ *       This definition sets the cFE File Header sub-type value for FM
+ *       Directory Manifest data files.  The value may be used to differentiate
+ *       FM Directory Manifest files from other data files.
+ *
+ *  \par Limits:
+ *       The FM application places no limits on this unsigned 32 bit value.
+ */
+#define FM_DIR_MANIFEST_FILE_SUBTYPE 12346
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - TLM packet definitions   */
@@ -179,6 +247,212 @@
  */
 #define FM_DIR_LIST_PKT_ENTRIES 20
 
+/**
+ * \brief Directory List Telemetry Packet Stream Rate
+ *
+ *  \par Description:
+ *       This definition sets the maximum number of Directory List
+ *       telemetry packets per second sent by a Get Directory List to
+ *       Packet command in #FM_DIR_LIST_PKT_STREAM mode.  The child task
+ *       waits 1000 / FM_DIR_LIST_PKT_STREAM_RATE milliseconds after each
+ *       packet that is followed by another, so that a large listing does
+ *       not flood the telemetry link.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and
+ *       no greater than 100.
+ */
+#define FM_DIR_LIST_PKT_STREAM_RATE 4
+
+/**
+ * \brief Get Directory List to Packet Cursor Lifetime
+ *
+ *  \par Description:
+ *       When a Get Directory List to Packet command does not list every entry
+ *       of a directory, the directory is kept open after the entries have
+ *       been counted.  A later command for the same directory continues
+ *       reading from where the previous packet stopped, so paging through a
+ *       directory reads it about twice instead of once per packet.  Entries
+ *       are always listed in directory order.  Only one directory is held
+ *       open, and it is closed once its last entry has been listed or when
+ *       the cursor expires, whether or not another command arrives.
+ *
+ *       FM_DIR_LIST_CURSOR_TTL defines the maximum age in seconds of the
+ *       cursor.  The cursor is also discarded when the directory modify time
+ *       changes.  Modify times have a resolution of one second, so entries
+ *       added or removed within the second the directory was counted may not
+ *       be seen until the cursor expires.
+ *
+ *  \par Limits:
+ *       FM_DIR_LIST_CURSOR_TTL must be no greater than 3600, zero closes the
+ *       directory after every command.  A non-zero value holds one of the
+ *       OS_MAX_NUM_OPEN_DIRS directory handles, see #FM_DIR_LIST_MAX_DEPTH.
+ */
+#define FM_DIR_LIST_CURSOR_TTL 30
+
+/**
+ * \brief Directory Change Tracking
+ *
+ *  \par Description:
+ *       The Get Directory Changes command keeps a record of the entries of up
+ *       to FM_DIR_TRACK_DIRS directories, the least recently used record is
+ *       replaced when another directory is commanded.  Each record holds up
+ *       to FM_DIR_TRACK_ENTRIES entries and remembers the last
+ *       FM_DIR_TRACK_REMOVED removed entries, an older sequence number than
+ *       the removed entries cover results in a full listing.
+ *
+ *       Every command reads the directory again and compares it with the
+ *       record.  When FM_DIR_TRACK_INOTIFY is set to 1 on Linux, an inotify
+ *       watch is kept on each tracked directory and the directory is only
+ *       read again after the watch has reported an event.  When set to 0, or
+ *       on other platforms, the directory is always read again.
+ *
+ *       The records and a scan buffer of FM_DIR_TRACK_ENTRIES entries are
+ *       statically allocated, in all (FM_DIR_TRACK_DIRS * (FM_DIR_TRACK_ENTRIES
+ *       + FM_DIR_TRACK_REMOVED) + FM_DIR_TRACK_ENTRIES) entries of
+ *       OS_MAX_FILE_NAME plus 16 bytes.  Setting FM_DIR_TRACK_DIRS to 0 leaves
+ *       the command and this memory out of the build.
+ *
+ *  \par Limits:
+ *       FM_DIR_TRACK_DIRS must be no less than 0 and no greater than 32.
+ *       FM_DIR_TRACK_ENTRIES must be no less than #FM_DIR_LIST_PKT_ENTRIES
+ *       and no greater than 4096.  FM_DIR_TRACK_REMOVED must be no less than
+ *       1 and no greater than 1024.  FM_DIR_TRACK_INOTIFY must be 0 or 1.
+ */
+#define FM_DIR_TRACK_DIRS    2
+#define FM_DIR_TRACK_ENTRIES 64
+#define FM_DIR_TRACK_REMOVED 32
+#define FM_DIR_TRACK_INOTIFY 0
+
+/**
+ *  \brief Persistent Directory Index Settings
+ *
+ *  \par Description:
+ *       The Build Directory Index command writes an index file for a
+ *       directory to FM_DIR_INDEX_PATH.  The index holds the name, size,
+ *       modify time and mode of every entry, sorted by name, and the modify
+ *       time of the directory when it was written.  While that time matches
+ *       the directory, Get Directory Listing (to packet) and the directory
+ *       space estimate of the monitor table are served from the index
+ *       instead of reading the directory.  Listings served from an index are
+ *       in name order, others in directory order.  FM updates the index when
+ *       its own commands add, change or remove an entry of the directory;
+ *       any other change leaves the index stale, and a stale index is not
+ *       used until the next Build Directory Index command.  Delete Directory
+ *       and Delete All Files remove the index of the directory.
+ *
+ *       The index is built by sorting FM_DIR_INDEX_SORT_ENTRIES entries at
+ *       a time in memory and merging the sorted runs in two work files, so
+ *       there is no limit on the number of entries.  FM_DIR_INDEX_PATH is
+ *       created by the first Build Directory Index command.
+ *
+ *       FM keeps the names of up to FM_DIR_INDEX_DIRS index files in memory
+ *       so commands on other directories do not look for an index file.
+ *       With more index files than that, every command that changes a
+ *       directory entry opens the index file of the directory if it exists.
+ *
+ *       Set FM_DIR_INDEX_ENABLE to 1 to enable the feature.  When it is 0 the
+ *       command is rejected and no index file is used.
+ *
+ *  \par Limits:
+ *       FM_DIR_INDEX_ENABLE must be 0 or 1.  FM_DIR_INDEX_PATH must be a
+ *       directory name without a trailing separator.
+ *       FM_DIR_INDEX_SORT_ENTRIES must be no less than 48 and no greater
+ *       than 65536.  FM_DIR_INDEX_DIRS must be no less than 1 and no
+ *       greater than 256.
+ */
+#define FM_DIR_INDEX_ENABLE       0
+#define FM_DIR_INDEX_PATH         "/cf/fm_index"
+#define FM_DIR_INDEX_SORT_ENTRIES 384
+#define FM_DIR_INDEX_DIRS         16
+
+/**
+ *  \brief Open File Set Refresh Count
+ *
+ *  \par Description:
+ *       Delete All Files checks whether each file is open against a set of
+ *       the open file names taken from OSAL, rather than searching every
+ *       OSAL object for each file.  The set is taken again after this many
+ *       directory entries have been checked, so a file opened by another
+ *       application during a long command is seen within that many entries.
+ *
+ *  \par Limits:
+ *       This value must be no less than 1 and no greater than 65536.  A value
+ *       of 1 searches OSAL for every entry, as FM did before the set.
+ */
+#define FM_OPEN_FILE_SET_REFRESH 64
+
+/**
+ *  \brief Open Files Summary Refresh Count
+ *
+ *  \par Description:
+ *       Housekeeping reports the number of open files from a summary of the
+ *       OSAL open file table, rather than searching every OSAL object on
+ *       each request.  The summary is taken again after this many
+ *       housekeeping requests, and on the next request after a child task
+ *       command that opens, creates or deletes files.  Files opened or
+ *       closed by other applications are seen in the count within this many
+ *       requests.  Housekeeping only counts the open streams, file and
+ *       application names are read by the Get Open Files commands, which
+ *       always take a new summary.
+ *
+ *  \par Limits:
+ *       This value must be no less than 1 and no greater than 3600.  A value
+ *       of 1 searches OSAL for every housekeeping request, as FM did before
+ *       the summary.
+ */
+#define FM_OPEN_FILES_REFRESH_HK 4
+
+/**
+ *  \brief Open File Age Limit
+ *
+ *  \par Description:
+ *       Each open files summary remembers when every open stream was first
+ *       found open, so the time a file has been held open is known without
+ *       taking snapshots from the ground.  A stream open for at least this
+ *       many seconds is reported once by event #FM_OPEN_FILE_AGE_INF_EID,
+ *       naming the file and the application that opened it.  The Get Open
+ *       Files Page command can also list only the files open this long.
+ *
+ *       Ages are sampled when the summary is refreshed, see
+ *       #FM_OPEN_FILES_REFRESH_HK.  Set to 0 to send no events.
+ *
+ *  \par Limits:
+ *       This value must be no greater than 604800 (one week).
+ */
+#define FM_OPEN_FILE_AGE_LIMIT 600
+
+/**
+ *  \brief File Stat Cache Settings
+ *
+ *  \par Description:
+ *       The file state checks of single name commands look up file
+ *       status through a small cache, so that the main task and a deferred
+ *       child task check do not stat the same names again and again.  File
+ *       Info, Compare, directory scans and the directory space estimate of
+ *       the monitor table always call OS_stat, so the sizes and times they
+ *       report are current.
+ *
+ *       FM_STAT_CACHE_ENTRIES defines the number of names kept.  When the
+ *       cache is full the least recently used name is replaced.
+ *
+ *       FM_STAT_CACHE_TTL_MS defines how long (in milli-secs) a status is
+ *       used before OS_stat is called again.  FM removes the names that its
+ *       own commands change from the cache, so the TTL only bounds how
+ *       late a change made by another application is seen.  Set to 0 to
+ *       call OS_stat every time.
+ *
+ *       FM_STAT_CACHE_SEM_NAME is the cFE object name of the mutex that
+ *       lets the main task and the child task share the cache.
+ *
+ *  \par Limits:
+ *       FM_STAT_CACHE_ENTRIES must be no less than 1 and no greater than
+ *       256.  FM_STAT_CACHE_TTL_MS must be no greater than 60000.
+ */
+#define FM_STAT_CACHE_ENTRIES  16
+#define FM_STAT_CACHE_TTL_MS   1000
+#define FM_STAT_CACHE_SEM_NAME "FM_STAT_SEM"
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - child task definitions   */
@@ -229,6 +503,38 @@
 #define FM_CHILD_FILE_LOOP_COUNT 16
 #define FM_CHILD_FILE_SLEEP_MS   20
 
+/**
+ * \brief Child Task Output File Write Buffer Size
+ *
+ *  \par Description:
+ *       Size in bytes of the global memory buffer the FM child task uses to
+ *       collect small records (such as directory manifest entries) before
+ *       writing them to an output file.  Writing fewer, larger blocks reduces
+ *       the number of file system calls for directories with many entries.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 256 bytes
+ *       and no greater than 32KB.  Records larger than the buffer are written
+ *       directly.
+ */
+#define FM_CHILD_WRITE_BUFFER_SIZE 8192
+
+/**
+ * \brief Child Task File Compare Block Size
+ *
+ *  \par Description:
+ *       Size in bytes of each block of file data read from both files by the
+ *       Compare Files command.  The child task has one buffer of this size for
+ *       each file in global memory.  Larger blocks mean fewer file system calls
+ *       and longer memory comparisons between task delays, see
+ *       #FM_CHILD_FILE_LOOP_COUNT.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 256 bytes
+ *       and no greater than 32KB.
+ */
+#define FM_CHILD_COMPARE_BLOCK_SIZE 8192
+
 /**
  * \brief Child file stat sleep
  *
@@ -265,6 +571,55 @@
 #define FM_CHILD_STAT_SLEEP_MS        0
 #define FM_CHILD_STAT_SLEEP_FILECOUNT 0
 
+/**
+ * \brief Child Task Native Directory Scan
+ *
+ *  \par Description:
+ *       When set to 1 on Linux, the Delete All Files, Sorted Directory List
+ *       and Directory Statistics commands read directories with the host C
+ *       library instead of OSAL.  The entry type reported by readdir tells
+ *       files from directories without an OS_stat call, and entries that do
+ *       need a stat are looked up with fstatat relative to the open
+ *       directory rather than by resolving the full path again, which saves
+ *       most of the path lookup cost on deep mount points.  The directory
+ *       name is translated with OS_TranslatePath; a directory that cannot be
+ *       opened this way is read through OSAL as before.
+ *
+ *       When set to 0, or on other platforms, directories are always read
+ *       through OSAL.
+ *
+ *  \par Limits:
+ *       Must be 0 or 1.  The native scan needs a C library that provides
+ *       dirent d_type, dirfd and fstatat.  The mode reported for an entry
+ *       read this way holds the owner's permissions.
+ */
+#define FM_CHILD_NATIVE_DIR_SCAN 0
+
+/**
+ * \brief Child Task Deferred File State Checks
+ *
+ *  \par Description:
+ *       When set to 1, commands that are run by the child task are accepted
+ *       by the main task after only the argument checks.  The file state
+ *       checks (does the source exist, is it open, is the target in use)
+ *       need an OS_stat and a search of the open files, and are passed to
+ *       the child task to run just before the command itself.  This keeps
+ *       the main task command latency independent of the file system, so
+ *       a slow disk cannot back up the command pipe or delay housekeeping.
+ *
+ *       A deferred check that fails sends the same error event as before,
+ *       but the command is counted as a child task error rather than a main
+ *       task command error, and ChildPreviousCC holds its command code.
+ *
+ *       When set to 0 the main task checks the file state before it puts
+ *       the command in the child task queue.
+ *
+ *  \par Limits:
+ *       Must be 0 or 1.  The Get File Info and Set Permissions commands
+ *       always check the name on the main task.
+ */
+#define FM_CHILD_DEFER_VERIFY 0
+
 /**
  * \brief Child Task Command Queue Entry Count
  *
@@ -352,6 +707,111 @@
  */
 #define FM_CHILD_SEM_NAME "FM_CHILD_SEM"
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM platform configuration parameters - file CRC definitions     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ * \brief CRC-32 Hardware Acceleration
+ *
+ *  \par Description:
+ *       When set to 1, FM includes CRC-32 implementations that use the
+ *       x86 PCLMULQDQ carry-less multiply or ARMv8 CRC32 instructions, and
+ *       selects one at startup if the processor reports support for it.
+ *       When set to 0, only the portable table driven implementation is
+ *       built.  All implementations produce identical CRC values.
+ *
+ *  \par Limits:
+ *       Must be 0 or 1.  Hardware implementations are only built with GCC
+ *       compatible compilers; other toolchains always use the portable
+ *       implementation.
+ */
+#define FM_CRC_HW_ACCELERATION 1
+
+/**
+ * \brief File CRC Result Cache Entries
+ *
+ *  \par Description:
+ *       Number of recent Get File Info CRC and hash results that FM keeps in
+ *       memory.  A request for the same file, size, modify time and algorithm
+ *       is answered from the cache without reading the file again.  When the
+ *       cache is full the least recently used result is replaced.
+ *
+ *  \par Limits:
+ *       Must be at least 1 and no more than 256.  Each entry uses roughly
+ *       OS_MAX_PATH_LEN + 56 bytes.  File modify times have a resolution of
+ *       one second, so a file rewritten with the same size within the same
+ *       second as a cached CRC was computed will not be detected.
+ */
+#define FM_DIGEST_CACHE_ENTRIES 8
+
+/**
+ * \brief File CRC Worker Tasks
+ *
+ *  \par Description:
+ *       Number of tasks created in addition to the child task to help compute
+ *       the CRC of large files for the Get File Info command.  The file is
+ *       split into one segment per worker plus one for the child task, the
+ *       segment CRC values are computed concurrently and then combined into
+ *       the CRC of the whole file.  Workers run at the child task priority
+ *       with the child task stack size.  xxHash64 and SHA-256 digests cannot
+ *       be combined and are always computed by the child task alone.  Files
+ *       larger than 2 GB (INT32_MAX bytes) cannot be split, since segment
+ *       offsets are passed to OS_lseek, and are also computed by the child
+ *       task alone.
+ *
+ *  \par Limits:
+ *       Must be no less than 0 and no greater than 8.  The default of 0
+ *       creates no workers, semaphores or buffers and computes every CRC in
+ *       the child task; only enable workers on multi-processor platforms.
+ *       Each worker also adds FM_CHILD_FILE_BLOCK_SIZE bytes of file I/O
+ *       buffer.
+ */
+#define FM_CRC_WORKER_COUNT 0
+
+/**
+ * \brief File CRC Worker Minimum File Size
+ *
+ *  \par Description:
+ *       Files smaller than this number of bytes are processed by the child
+ *       task alone, since splitting a small file costs more in task switches
+ *       and file opens than it saves.
+ *
+ *  \par Limits:
+ *       Must be no less than 65536.
+ */
+#define FM_CRC_WORKER_MIN_FILE_SIZE (16 * 1024 * 1024)
+
+/**
+ * \brief File CRC Worker Task Name - cFE object name
+ *
+ *  \par Description:
+ *       This definition sets the prefix of the CRC worker task object names.
+ *       The worker number is appended to make each name unique.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, and that the prefix plus one
+ *       digit fit within the cFE object name length.
+ */
+#define FM_CRC_WORKER_TASK_NAME "FM_CRC_WORKER"
+
+/**
+ * \brief File CRC Worker Semaphore Names - cFE object names
+ *
+ *  \par Description:
+ *       These definitions set the object names of the semaphores used to
+ *       hand out file segments to the CRC workers and to collect the results.
+ *
+ *  \par Limits:
+ *       FM requires that these names be defined, but otherwise places
+ *       no limits on the definition.
+ */
+#define FM_CRC_WORK_SEM_NAME  "FM_CRC_WORK_SEM"
+#define FM_CRC_DONE_SEM_NAME  "FM_CRC_DONE_SEM"
+#define FM_CRC_JOB_MUTEX_NAME "FM_CRC_JOB_SEM"
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - table definitions        */
@@ -39,9 +39,11 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_crc.h"
 #include "fm_dispatch.h"
 #include "fm_events.h"
 #include "fm_perfids.h"
+#include "fm_stat_cache.h"
 #include "fm_platform_cfg.h"
 #include "fm_version.h"
 #include "fm_verify.h"
@@ -173,6 +175,18 @@ CFE_Status_t FM_AppInit(void)
     /* Initialize global data  */
     memset(&FM_GlobalData, 0, sizeof(FM_GlobalData));
 
+    /* File state checks may be run by the child task, see FM_CHILD_DEFER_VERIFY */
+    FM_GlobalData.DeferVerify = (FM_CHILD_DEFER_VERIFY == 1);
+
+    /* Directory listing files may be split, see FM_DIR_LIST_FILE_MAX_SIZE */
+    FM_GlobalData.DirListFileMaxSize = FM_DIR_LIST_FILE_MAX_SIZE;
+
+    /* Directory indexes are optional, see FM_DIR_INDEX_ENABLE */
+    FM_GlobalData.DirIndexEnable = (FM_DIR_INDEX_ENABLE == 1);
+
+    /* The first housekeeping request searches OSAL for open files */
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Register for event services */
     Result = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
 
@@ -225,6 +239,12 @@ CFE_Status_t FM_AppInit(void)
             }
             else
             {
+                /* Generate CRC lookup tables before the child task can use them */
+                FM_CrcInit();
+
+                /* File status is shared with the child task */
+                FM_StatCacheInit();
+
                 /* Create low priority child task */
                 FM_ChildInit();
 
@@ -264,7 +284,7 @@ void FM_SendHkCmd(const CFE_SB_Buffer_t *BufPtr)
     PayloadPtr->CommandCounter    = FM_GlobalData.CommandCounter;
     PayloadPtr->CommandErrCounter = FM_GlobalData.CommandErrCounter;
 
-    PayloadPtr->NumOpenFiles = FM_GetOpenFilesData(NULL);
+    PayloadPtr->NumOpenFiles = FM_GetOpenFilesCount();
 
     /* Report child task command counters */
     PayloadPtr->ChildCmdCounter     = FM_GlobalData.ChildCmdCounter;
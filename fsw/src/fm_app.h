@@ -26,7 +26,11 @@
 
 #include "cfe.h"
 #include "fm_msg.h"
+#include "fm_child.h"
 #include "fm_compression.h"
+#include "fm_digest.h"
+#include "fm_dir_index.h"
+#include "fm_stat_cache.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -85,8 +89,12 @@ typedef struct
 
     FM_DirListFileStats_t DirListFileStats; /**< \brief Get dir list to file statistics structure */
 
+    FM_DirManifestStats_t DirManifestStats; /**< \brief Directory manifest statistics structure */
+
     FM_DirListPkt_t DirListPkt; /**< \brief Get dir list to packet telemetry packet */
 
+    FM_DirListCursor_t DirListCursor; /**< \brief Get dir list to packet directory cursor (child task) */
+
     FM_MonitorReportPkt_t
         MonitorReportPkt; /**< \brief Telemetry packet reporting status of items in the monitor table */
 
@@ -94,12 +102,56 @@ typedef struct
 
     FM_OpenFilesPkt_t OpenFilesPkt; /**< \brief Get open files telemetry packet */
 
+    FM_OpenFilesPagePkt_t OpenFilesPagePkt; /**< \brief Get open files page telemetry packet */
+
+    FM_CompareFilesPkt_t CompareFilesPkt; /**< \brief Compare files telemetry packet */
+
+    FM_DirStatsPkt_t DirStatsPkt; /**< \brief Directory statistics telemetry packet */
+
+#if FM_DIR_TRACK_DIRS > 0
+    FM_DirChangesPkt_t DirChangesPkt; /**< \brief Directory changes telemetry packet */
+#endif
+
     FM_HousekeepingPkt_t HousekeepingPkt; /**< \brief Application housekeeping telemetry packet */
 
     char ChildBuffer[FM_CHILD_FILE_BLOCK_SIZE]; /**< \brief Child task file I/O buffer */
 
+    char ChildCompareBuffer[2][FM_CHILD_COMPARE_BLOCK_SIZE]; /**< \brief Child task compare files read buffers */
+
+    FM_ChildWriter_t ChildWriter;        /**< \brief Child task buffered output file writer */
+    uint32           DirListFileMaxSize; /**< \brief Directory list output file size limit, 0 if none */
+
     FM_ChildQueueEntry_t ChildQueue[FM_CHILD_QUEUE_DEPTH]; /**< \brief Child task command queue */
 
+    bool             DeferVerify;                        /**< \brief Pass file state checks to the child task */
+    uint32           ChildVerifyCount;                   /**< \brief File state checks staged by the command */
+    FM_ChildVerify_t ChildVerify[FM_CHILD_VERIFY_COUNT]; /**< \brief Staged checks for the next child queue entry */
+
+    FM_DigestCacheEntry_t DigestCache[FM_DIGEST_CACHE_ENTRIES]; /**< \brief Recent file CRC results (child task) */
+    uint32                DigestCacheUseCount;                  /**< \brief Digest cache replacement counter */
+
+#if FM_DIR_TRACK_DIRS > 0
+    FM_DirTrack_t      DirTrack[FM_DIR_TRACK_DIRS];        /**< \brief Tracked directories (child task) */
+    FM_DirTrackEntry_t DirTrackScan[FM_DIR_TRACK_ENTRIES]; /**< \brief Directory entries read by the latest scan */
+    uint32             DirTrackUseCount;                   /**< \brief Tracked directory replacement counter */
+#endif
+
+    bool              DirIndexEnable;                          /**< \brief Directory index in use */
+    FM_DirIndexList_t DirIndexList;                            /**< \brief Known index files (child task) */
+    FM_DirListEntry_t DirIndexSort[FM_DIR_INDEX_SORT_ENTRIES]; /**< \brief Directory index sort buffer (child task) */
+
+    FM_OpenFileSet_t ChildOpenFiles; /**< \brief Files open at the last check of a child task batch */
+
+    FM_OpenFilesSummary_t OpenFilesSummary; /**< \brief Open files reported by housekeeping (main task) */
+
+    FM_StatCache_t StatCache; /**< \brief Recent file status results (main and child task) */
+
+    osal_id_t   CrcWorkSem;     /**< \brief CRC worker wakeup counting semaphore */
+    osal_id_t   CrcDoneSem;     /**< \brief CRC segment completion counting semaphore */
+    osal_id_t   CrcJobMutex;    /**< \brief CRC job segment index mutex semaphore */
+    uint32      CrcWorkerCount; /**< \brief Number of CRC worker tasks running */
+    FM_CrcJob_t CrcJob;         /**< \brief File CRC job shared with the CRC workers */
+
     /**
      * \brief State of the embedded decompression routine
      * This depends on the decompression option and may be NULL
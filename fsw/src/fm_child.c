@@ -31,12 +31,39 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_crc.h"
+#include "fm_digest.h"
+#include "fm_dir_index.h"
 #include "fm_perfids.h"
+#include "fm_stat_cache.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
 
+#include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 
+/*
+** Native directory scan uses the host C library directly, see FM_CHILD_NATIVE_DIR_SCAN
+*/
+#if (FM_CHILD_NATIVE_DIR_SCAN == 1) && defined(__linux__)
+#define FM_CHILD_HAVE_NATIVE_SCAN
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+/*
+** Directory change tracking uses inotify as a hint, see FM_DIR_TRACK_INOTIFY
+*/
+#if (FM_DIR_TRACK_INOTIFY == 1) && defined(__linux__)
+#define FM_CHILD_HAVE_DIR_WATCH
+#include <errno.h>
+#include <limits.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 /************************************************************************
 ** OSAL Compatibility for directory name access
 ** New OSAL version has an access macro to get the string. If that
@@ -91,6 +118,11 @@ CFE_Status_t FM_ChildInit(void)
                 strncpy(TaskText, "create task failed", TaskTextLen - 1);
                 TaskText[TaskTextLen - 1] = '\0';
             }
+            else if (FM_CRC_WORKER_COUNT > 0)
+            {
+                /* Create the tasks that help compute large file CRC values */
+                FM_ChildCrcWorkerInit();
+            }
         }
     }
 
@@ -137,18 +169,34 @@ void FM_ChildTask(void)
 
 void FM_ChildLoop(void)
 {
-    const char * TaskText = "Child Task termination error: ";
-    CFE_Status_t Result   = CFE_SUCCESS;
+    const char * TaskText   = "Child Task termination error: ";
+    CFE_Status_t Result     = CFE_SUCCESS;
+    uint32       CursorWait = 0;
 
     while (Result == CFE_SUCCESS)
     {
+        /* A directory list cursor is released when it expires, even if no command arrives */
+        CursorWait = FM_ChildDirListCursorExpire();
+
         /* Pend on the "handshake" semaphore */
-        Result = OS_CountSemTake(FM_GlobalData.ChildSemaphore);
+        if (CursorWait == 0)
+        {
+            Result = OS_CountSemTake(FM_GlobalData.ChildSemaphore);
+        }
+        else
+        {
+            Result = OS_CountSemTimedWait(FM_GlobalData.ChildSemaphore, CursorWait);
+        }
 
         /* Mark the period when this task is active */
         CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
 
-        if (Result == CFE_SUCCESS)
+        if (Result == OS_SEM_TIMEOUT)
+        {
+            /* No command arrived before the cursor expired */
+            Result = CFE_SUCCESS;
+        }
+        else if (Result == CFE_SUCCESS)
         {
             /* Make sure the parent/child handshake is not broken */
             if (FM_GlobalData.ChildQueueCount == 0)
@@ -195,6 +243,13 @@ void FM_ChildProcess(void)
     const char *          TaskText = "Child Task";
     FM_ChildQueueEntry_t *CmdArgs  = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildReadIndex];
 
+    /* Deferred file state checks run first, a command that fails them is not run */
+    if (FM_ChildVerifyCmd(CmdArgs) == false)
+    {
+        FM_ChildQueueNext();
+        return;
+    }
+
     /* Invoke the command-specific handler */
     switch (CmdArgs->CommandCode)
     {
@@ -250,6 +305,32 @@ void FM_ChildProcess(void)
             FM_ChildSetPermissionsCmd(CmdArgs);
             break;
 
+        case FM_DIR_MANIFEST_CC:
+            FM_ChildDirManifestCmd(CmdArgs);
+            break;
+
+        case FM_COMPARE_FILES_CC:
+            FM_ChildCompareFilesCmd(CmdArgs);
+            break;
+
+        case FM_GET_DIR_LIST_SORTED_CC:
+            FM_ChildDirListSortedCmd(CmdArgs);
+            break;
+
+        case FM_GET_DIR_STATS_CC:
+            FM_ChildDirStatsCmd(CmdArgs);
+            break;
+
+#if FM_DIR_TRACK_DIRS > 0
+        case FM_GET_DIR_CHANGES_CC:
+            FM_ChildDirChangesCmd(CmdArgs);
+            break;
+#endif
+
+        case FM_BUILD_DIR_INDEX_CC:
+            FM_ChildBuildDirIndexCmd(CmdArgs);
+            break;
+
         default:
             FM_GlobalData.ChildCmdErrCounter++;
             CFE_EVS_SendEvent(FM_CHILD_EXE_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -257,6 +338,17 @@ void FM_ChildProcess(void)
             break;
     }
 
+    FM_ChildQueueNext();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- release handshake queue entry                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildQueueNext(void)
+{
     /* Update the handshake queue read index */
     FM_GlobalData.ChildReadIndex++;
 
@@ -271,6 +363,330 @@ void FM_ChildProcess(void)
     OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- deferred file state checks                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildVerifyCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    bool   CommandResult = true;
+    uint32 i;
+
+    for (i = 0; (i < CmdArgs->VerifyCount) && (i < FM_CHILD_VERIFY_COUNT) && (CommandResult == true); i++)
+    {
+        /* The check sends the command-specific error event */
+        CommandResult = FM_VerifyDeferredFileState(&CmdArgs->Verify[i]);
+    }
+
+    if (CommandResult == false)
+    {
+        /* The command was accepted by the main task, so it fails here */
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+        FM_GlobalData.ChildCurrentCC  = 0;
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- CRC worker initialization                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcWorkerInit(void)
+{
+    char            TaskName[OS_MAX_API_NAME];
+    CFE_ES_TaskId_t TaskId;
+    CFE_Status_t    Result = CFE_SUCCESS;
+    int32           i;
+
+    FM_GlobalData.CrcWorkerCount = 0;
+
+    /* Counting semaphores to wake the workers and to collect finished segments */
+    Result = OS_CountSemCreate(&FM_GlobalData.CrcWorkSem, FM_CRC_WORK_SEM_NAME, 0, 0);
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = OS_CountSemCreate(&FM_GlobalData.CrcDoneSem, FM_CRC_DONE_SEM_NAME, 0, 0);
+    }
+
+    /* Mutex semaphore (protect access to the next job segment index) */
+    if (Result == CFE_SUCCESS)
+    {
+        Result = OS_MutSemCreate(&FM_GlobalData.CrcJobMutex, FM_CRC_JOB_MUTEX_NAME, 0);
+    }
+
+    for (i = 0; (i < FM_CRC_WORKER_COUNT) && (Result == CFE_SUCCESS); i++)
+    {
+        snprintf(TaskName, sizeof(TaskName), "%s%u", FM_CRC_WORKER_TASK_NAME, (unsigned int)i);
+
+        Result = CFE_ES_CreateChildTask(&TaskId, TaskName, FM_ChildCrcWorkerTask, 0, FM_CHILD_TASK_STACK_SIZE,
+                                        FM_CHILD_TASK_PRIORITY, 0);
+
+        if (Result == CFE_SUCCESS)
+        {
+            FM_GlobalData.CrcWorkerCount++;
+        }
+    }
+
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(FM_CRC_WORKER_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CRC worker initialization error: workers = %d, result = %d",
+                          (int)FM_GlobalData.CrcWorkerCount, (int)Result);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- CRC worker task entry point                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcWorkerTask(void)
+{
+    /* CRC worker process loop */
+    FM_ChildCrcWorkerLoop();
+
+    /* This call allows cFE to clean-up system resources */
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- CRC worker main process loop                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcWorkerLoop(void)
+{
+    int32 Result = OS_SUCCESS;
+
+    while (Result == OS_SUCCESS)
+    {
+        /* Pend until the child task posts a file CRC job */
+        Result = OS_CountSemTake(FM_GlobalData.CrcWorkSem);
+
+        if (Result == OS_SUCCESS)
+        {
+            FM_ChildCrcRunSegments();
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- process file CRC job segments                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcRunSegments(void)
+{
+    FM_CrcJob_t *JobPtr       = &FM_GlobalData.CrcJob;
+    uint32       SegmentIndex = 0;
+    uint32       SegmentCount = 0;
+
+    do
+    {
+        /* Take the next segment, the child task and all workers share the job */
+        OS_MutSemTake(FM_GlobalData.CrcJobMutex);
+        SegmentIndex = JobPtr->NextSegment;
+        SegmentCount = JobPtr->SegmentCount;
+        if (SegmentIndex < SegmentCount)
+        {
+            JobPtr->NextSegment++;
+        }
+        OS_MutSemGive(FM_GlobalData.CrcJobMutex);
+
+        if (SegmentIndex < SegmentCount)
+        {
+            FM_ChildCrcSegment(JobPtr->Filename, JobPtr->TypeCRC, &JobPtr->Segment[SegmentIndex]);
+
+            OS_CountSemGive(FM_GlobalData.CrcDoneSem);
+        }
+    } while (SegmentIndex < SegmentCount);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- compute CRC of one file segment                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcSegment(const char *Filename, uint32 TypeCRC, FM_CrcSegment_t *SegmentPtr)
+{
+    osal_id_t FileHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    BytesLeft  = SegmentPtr->Length;
+    uint32    BytesWant  = 0;
+    int32     BytesRead  = 0;
+    int32     LoopCount  = 0;
+    int32     Status     = OS_SUCCESS;
+
+    SegmentPtr->Crc = 0;
+
+    /* Each task opens the file itself so the file positions are independent */
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (Status == OS_SUCCESS)
+    {
+        BytesRead = OS_lseek(FileHandle, SegmentPtr->Offset, OS_SEEK_SET);
+
+        if (BytesRead < 0)
+        {
+            Status = BytesRead;
+        }
+
+        while ((Status == OS_SUCCESS) && (BytesLeft > 0))
+        {
+            BytesWant = (BytesLeft < sizeof(SegmentPtr->Buffer)) ? BytesLeft : sizeof(SegmentPtr->Buffer);
+            BytesRead = OS_read(FileHandle, SegmentPtr->Buffer, BytesWant);
+
+            if (BytesRead < 0)
+            {
+                Status = BytesRead;
+            }
+            else if (BytesRead == 0)
+            {
+                /* File is shorter than when the segments were assigned */
+                Status = OS_ERROR;
+            }
+            else
+            {
+                SegmentPtr->Crc = FM_CalculateCRC(SegmentPtr->Buffer, BytesRead, SegmentPtr->Crc, TypeCRC);
+                BytesLeft -= BytesRead;
+
+                /* Avoid CPU hogging */
+                LoopCount++;
+                if (LoopCount == FM_CHILD_FILE_LOOP_COUNT)
+                {
+                    OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
+                    LoopCount = 0;
+                }
+            }
+        }
+
+        OS_close(FileHandle);
+    }
+
+    SegmentPtr->Status = Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- compute file CRC with the CRC workers          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildParallelCRC(const char *Filename, uint32 TypeCRC, uint32 *CrcPtr, uint32 *FileSizePtr)
+{
+    os_fstat_t FileStatus;
+    uint32     FileSize = 0;
+    uint32     Crc      = 0;
+    int32      Status   = OS_SUCCESS;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
+    /* Size the segments from the file as it is now, not as it was when the command was verified */
+    Status = OS_stat(Filename, &FileStatus);
+
+    if ((Status == OS_SUCCESS) && (OS_FILESTAT_SIZE(FileStatus) > INT32_MAX))
+    {
+        /* Segment offsets are passed to OS_lseek, which cannot seek this far */
+        Status = OS_ERR_OUTPUT_TOO_LARGE;
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        FileSize = OS_FILESTAT_SIZE(FileStatus);
+        Status   = FM_ChildParallelCRCJob(Filename, FileSize, TypeCRC, &Crc);
+    }
+
+    *CrcPtr      = Crc;
+    *FileSizePtr = FileSize;
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- run a file CRC job with the CRC workers        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildParallelCRCJob(const char *Filename, uint32 FileSize, uint32 TypeCRC, uint32 *CrcPtr)
+{
+    FM_CrcJob_t *JobPtr        = &FM_GlobalData.CrcJob;
+    uint32       SegmentLength = 0;
+    uint32       Offset        = 0;
+    uint32       Crc           = 0;
+    int32        Status        = OS_SUCCESS;
+    uint32       i;
+
+    /* Workers may still be looking for work from the previous job */
+    OS_MutSemTake(FM_GlobalData.CrcJobMutex);
+
+    snprintf(JobPtr->Filename, sizeof(JobPtr->Filename), "%s", Filename);
+    JobPtr->TypeCRC      = TypeCRC;
+    JobPtr->SegmentCount = FM_GlobalData.CrcWorkerCount + 1;
+    JobPtr->NextSegment  = 0;
+
+    /* Equal segments of whole file blocks, the last segment also gets the remainder */
+    SegmentLength = ((FileSize / JobPtr->SegmentCount) / FM_CHILD_FILE_BLOCK_SIZE) * FM_CHILD_FILE_BLOCK_SIZE;
+
+    for (i = 0; i < JobPtr->SegmentCount; i++)
+    {
+        JobPtr->Segment[i].Offset = Offset;
+        JobPtr->Segment[i].Length = (i == (JobPtr->SegmentCount - 1)) ? (FileSize - Offset) : SegmentLength;
+        JobPtr->Segment[i].Crc    = 0;
+        JobPtr->Segment[i].Status = OS_SUCCESS;
+
+        Offset += JobPtr->Segment[i].Length;
+    }
+
+    OS_MutSemGive(FM_GlobalData.CrcJobMutex);
+
+    /* Wake the workers, then process segments here until none are left */
+    for (i = 0; i < FM_GlobalData.CrcWorkerCount; i++)
+    {
+        OS_CountSemGive(FM_GlobalData.CrcWorkSem);
+    }
+
+    FM_ChildCrcRunSegments();
+
+    /* Wait for the segments still being processed by the workers */
+    for (i = 0; i < JobPtr->SegmentCount; i++)
+    {
+        OS_CountSemTake(FM_GlobalData.CrcDoneSem);
+    }
+
+    /* Merge the segment CRC values in file order */
+    for (i = 0; (i < JobPtr->SegmentCount) && (Status == OS_SUCCESS); i++)
+    {
+        if (JobPtr->Segment[i].Status != OS_SUCCESS)
+        {
+            Status = JobPtr->Segment[i].Status;
+            Crc    = 0;
+        }
+        else if (i == 0)
+        {
+            Crc = JobPtr->Segment[i].Crc;
+        }
+        else
+        {
+            Crc = FM_CrcCombine(Crc, JobPtr->Segment[i].Crc, JobPtr->Segment[i].Length, TypeCRC);
+        }
+    }
+
+    *CrcPtr = Crc;
+
+    return Status;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task command handler -- Copy File                      */
@@ -282,9 +698,14 @@ void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
     const char *CmdText   = "Copy File";
     int32       OS_Status = OS_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate;
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Target);
+
     /* Note the order of the arguments to OS_cp (src,tgt) */
     OS_Status = OS_cp(CmdArgs->Source1, CmdArgs->Target);
 
@@ -306,6 +727,13 @@ void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
                           CmdArgs->Source1, CmdArgs->Target);
     }
 
+    /* Later file state checks must see the new status of the changed names */
+    FM_StatCacheInvalidate(CmdArgs->Target);
+    FM_DirIndexCommit(&IndexUpdate);
+
+    /* Housekeeping counts the open files again */
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -322,9 +750,15 @@ void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
     const char *CmdText   = "Move File";
     int32       OS_Status = OS_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate[2];
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate[0], CmdArgs->Source1);
+    FM_DirIndexPrepare(&IndexUpdate[1], CmdArgs->Target);
+
     OS_Status = OS_mv(CmdArgs->Source1, CmdArgs->Target);
 
     if (OS_Status != OS_SUCCESS)
@@ -345,6 +779,13 @@ void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
                           CmdArgs->Source1, CmdArgs->Target);
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Source1);
+    FM_StatCacheInvalidate(CmdArgs->Target);
+    FM_DirIndexCommit(&IndexUpdate[0]);
+    FM_DirIndexCommit(&IndexUpdate[1]);
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -361,9 +802,15 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
     const char *CmdText   = "Rename File";
     int32       OS_Status = OS_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate[2];
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate[0], CmdArgs->Source1);
+    FM_DirIndexPrepare(&IndexUpdate[1], CmdArgs->Target);
+
     OS_Status = OS_rename(CmdArgs->Source1, CmdArgs->Target);
 
     if (OS_Status != OS_SUCCESS)
@@ -384,6 +831,11 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
                           CmdText, CmdArgs->Source1, CmdArgs->Target);
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Source1);
+    FM_StatCacheInvalidate(CmdArgs->Target);
+    FM_DirIndexCommit(&IndexUpdate[0]);
+    FM_DirIndexCommit(&IndexUpdate[1]);
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -400,9 +852,14 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
     const char *CmdText   = "Delete File";
     int32       OS_Status = OS_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate;
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Source1);
+
     OS_Status = OS_remove(CmdArgs->Source1);
 
     if (OS_Status != OS_SUCCESS)
@@ -423,6 +880,11 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
                           CmdArgs->Source1);
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Source1);
+    FM_DirIndexCommit(&IndexUpdate);
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -436,16 +898,14 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
 
 void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText = "Delete All Files";
-    osal_id_t   DirId   = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t DirEntry;
-    int32       OS_Status                     = OS_SUCCESS;
-    uint32      FilenameState                 = FM_NAME_IS_INVALID;
-    uint32      NameLength                    = 0;
-    uint32      DeleteCount                   = 0;
-    uint32      FilesNotDeletedCount          = 0;
-    uint32      DirectoriesSkippedCount       = 0;
-    char        Filename[2 * OS_MAX_PATH_LEN] = "";
+    const char *   CmdText = "Delete All Files";
+    FM_ChildScan_t Scan;
+    int32          OS_Status               = OS_SUCCESS;
+    uint32         FilenameState           = FM_NAME_IS_INVALID;
+    uint32         DeleteCount             = 0;
+    uint32         FilesNotDeletedCount    = 0;
+    uint32         DirectoriesSkippedCount = 0;
+    uint32         EntriesTillRefresh      = 0;
 
     /*
     ** Command argument usage for this command:
@@ -457,13 +917,11 @@ void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
     char *Directory  = CmdArgs->Source1;
     char *DirWithSep = CmdArgs->Source2;
 
-    memset(&DirEntry, 0, sizeof(DirEntry));
-
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
     /* Open directory so that we can read from it */
-    OS_Status = OS_DirectoryOpen(&DirId, Directory);
+    OS_Status = FM_ChildScanOpen(&Scan, Directory, DirWithSep);
 
     if (OS_Status != OS_SUCCESS)
     {
@@ -477,83 +935,85 @@ void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
     {
         /* Read each directory entry and delete the files */
 
-        while (OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS)
+        /* The scan skips the "." and ".." directory entries */
+        while (FM_ChildScanRead(&Scan) == OS_SUCCESS)
         {
-            /*
-            ** Ignore the "." and ".." directory entries
-            */
-            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+            /* Search the OSAL object table once for a number of entries rather than for each one */
+            if (EntriesTillRefresh == 0)
             {
-                /* Construct full path filename */
-                NameLength = snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, OS_DIRENTRY_NAME(DirEntry));
+                FM_OpenFileSetLoad(&FM_GlobalData.ChildOpenFiles);
+                EntriesTillRefresh = FM_OPEN_FILE_SET_REFRESH;
+            }
 
-                if (NameLength >= OS_MAX_PATH_LEN)
-                {
+            EntriesTillRefresh--;
+
+            /* What kind of directory entry is this? */
+            FilenameState = FM_ChildScanState(&Scan, &FM_GlobalData.ChildOpenFiles);
+
+            /* FilenameState cannot have a value beyond five macros in cases below */
+            switch (FilenameState)
+            {
+                case FM_NAME_IS_INVALID:
                     FilesNotDeletedCount++;
-                }
-                else
-                {
-                    /* What kind of directory entry is this? */
-                    FilenameState = FM_GetFilenameState(Filename, OS_MAX_PATH_LEN, false);
+                    break;
 
-                    /* FilenameState cannot have a value beyond five macros in cases below */
-                    switch (FilenameState)
-                    {
-                        case FM_NAME_IS_INVALID:
-                            FilesNotDeletedCount++;
-                            break;
-
-                        case FM_NAME_IS_NOT_IN_USE:
-
-                            /* This result is very unlikely - the */
-                            /*   name existed a moment ago when   */
-                            /*   the directory entry was read but */
-                            /*   now the call to OS_stat() failed */
-                            /*   implying that the entry is gone  */
-                            FilesNotDeletedCount++;
-                            break;
-
-                        case FM_NAME_IS_DIRECTORY:
-                            DirectoriesSkippedCount++;
-                            break;
-
-                        case FM_NAME_IS_FILE_OPEN:
-                            FilesNotDeletedCount++;
-                            break;
-
-                        case FM_NAME_IS_FILE_CLOSED:
-                            if ((OS_Status = OS_remove(Filename)) == OS_SUCCESS)
-                            {
-                                /*
-                                ** After deleting the file, rewind the directory
-                                ** to keep the file system from getting confused
-                                */
-                                OS_DirectoryRewind(DirId);
-
-                                /* Increment delete count */
-                                DeleteCount++;
-                            }
-                            else
-                            {
-                                FilesNotDeletedCount++;
-                            }
-
-                            break;
-                        default:
-                            FilesNotDeletedCount++;
-                            break;
-                    } /* end switch statement */
-                }
-            } /* end if "." or ".." directory entries */
-        }     /* End while OS_ReadDirectory */
+                case FM_NAME_IS_NOT_IN_USE:
 
-        OS_DirectoryClose(DirId);
+                    /* This result is very unlikely - the */
+                    /*   name existed a moment ago when   */
+                    /*   the directory entry was read but */
+                    /*   now the call to OS_stat() failed */
+                    /*   implying that the entry is gone  */
+                    FilesNotDeletedCount++;
+                    break;
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_DELETE_ALL_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "%s command: deleted %d files: dir = %s", CmdText, (int)DeleteCount, Directory);
-        FM_GlobalData.ChildCmdCounter++;
+                case FM_NAME_IS_DIRECTORY:
+                    DirectoriesSkippedCount++;
+                    break;
+
+                case FM_NAME_IS_FILE_OPEN:
+                    FilesNotDeletedCount++;
+                    break;
+
+                case FM_NAME_IS_FILE_CLOSED:
+                    if ((OS_Status = OS_remove(Scan.Path)) == OS_SUCCESS)
+                    {
+                        /*
+                        ** After deleting the file, rewind the directory
+                        ** to keep the file system from getting confused
+                        */
+                        FM_ChildScanRewind(&Scan);
+
+                        /* Increment delete count */
+                        DeleteCount++;
+                    }
+                    else
+                    {
+                        FilesNotDeletedCount++;
+                    }
+
+                    break;
+                default:
+                    FilesNotDeletedCount++;
+                    break;
+            } /* end switch statement */
+        }     /* End while FM_ChildScanRead */
+
+        FM_ChildScanClose(&Scan);
+
+        /* Deleted files and the directory time are read again */
+        FM_StatCacheInvalidate(Directory);
+
+        /* Entries are not updated one by one, an index of the emptied directory is of no further use */
+        if (DeleteCount > 0)
+        {
+            FM_DirIndexRemove(Directory);
+        }
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DELETE_ALL_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: deleted %d files: dir = %s", CmdText, (int)DeleteCount, Directory);
+        FM_GlobalData.ChildCmdCounter++;
 
         if (FilesNotDeletedCount > 0)
         {
@@ -574,6 +1034,8 @@ void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
 
     } /* end if OS_Status != OS_SUCCESS */
 
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -590,9 +1052,14 @@ void FM_ChildDecompressFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
     const char * CmdText    = "Decompress File";
     CFE_Status_t CFE_Status = CFE_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate;
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Target);
+
     /* Decompress source file into target file */
     CFE_Status = FM_Decompress_Impl(FM_GlobalData.DecompressorStatePtr, CmdArgs->Source1, CmdArgs->Target);
 
@@ -614,6 +1081,11 @@ void FM_ChildDecompressFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
                           CmdText, CmdArgs->Source1, CmdArgs->Target);
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Target);
+    FM_DirIndexCommit(&IndexUpdate);
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -637,9 +1109,14 @@ void FM_ChildConcatFilesCmd(const FM_ChildQueueEntry_t *CmdArgs)
     int32       BytesRead      = 0;
     int32       BytesWritten   = 0;
 
+    FM_DirIndexUpdate_t IndexUpdate;
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Target);
+
     /* Copy source file #1 to the target file */
     OS_Status = OS_cp(CmdArgs->Source1, CmdArgs->Target);
 
@@ -757,6 +1234,11 @@ void FM_ChildConcatFilesCmd(const FM_ChildQueueEntry_t *CmdArgs)
         }
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Target);
+    FM_DirIndexCommit(&IndexUpdate);
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -773,12 +1255,14 @@ void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
     const char *CmdText    = "Get File Info";
     bool        GettingCRC = false;
     uint32      CurrentCRC = 0;
+    uint32      FileSize   = 0;
     int32       LoopCount  = 0;
     int32       BytesRead  = 0;
     osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
     int32       Status     = 0;
 
     FM_FileInfoPkt_Payload_t *ReportPtr;
+    FM_DigestContext_t        Digest;
 
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
@@ -821,8 +1305,7 @@ void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
 
             CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
         }
-        else if ((CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_8) && (CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_16) &&
-                 (CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_32))
+        else if (FM_DigestIsSupported(CmdArgs->FileInfoCRC) == false)
         {
             /* Can only calculate CRC using known algorithms */
             FM_GlobalData.ChildCmdWarnCounter++;
@@ -838,22 +1321,65 @@ void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
     /* Compute CRC */
     if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
     {
-        Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-
-        if (Status != OS_SUCCESS)
+        if (FM_DigestCacheLookup(CmdArgs->Source1, CmdArgs->FileInfoSize, CmdArgs->FileInfoTime, CmdArgs->FileInfoCRC,
+                                 &CurrentCRC, ReportPtr->Digest, &ReportPtr->DigestSize) == true)
         {
-            FM_GlobalData.ChildCmdWarnCounter++;
+            /* File is unchanged since the CRC was last computed */
+            ReportPtr->CRC_Computed = true;
+            GettingCRC              = false;
+        }
+        else if ((FM_GlobalData.CrcWorkerCount > 0) && (CmdArgs->FileInfoSize >= FM_CRC_WORKER_MIN_FILE_SIZE) &&
+                 (FM_CrcImplSupported(CmdArgs->FileInfoCRC, FM_CRC_IMPL_TABLE) == true) &&
+                 ((Status = FM_ChildParallelCRC(CmdArgs->Source1, CmdArgs->FileInfoCRC, &CurrentCRC, &FileSize)) !=
+                  OS_ERR_OUTPUT_TOO_LARGE))
+        {
+            /* Large file and a CRC type that can be combined, the file was split across the CRC workers */
+            if (Status == OS_SUCCESS)
+            {
+                /* Report the full digest the same way as a sequential calculation */
+                FM_DigestInit(&Digest, CmdArgs->FileInfoCRC);
+                Digest.Crc              = CurrentCRC;
+                CurrentCRC              = FM_DigestFinal(&Digest, ReportPtr->Digest, &ReportPtr->DigestSize);
+                ReportPtr->CRC_Computed = true;
 
-            /* Send CRC failure event (warning) */
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s warning: unable to compute CRC: OS_OpenCreate result = %d, file = %s", CmdText,
-                              (int)Status, CmdArgs->Source1);
+                /* A file that changed size since it was verified would be cached under the wrong size */
+                if (FileSize == CmdArgs->FileInfoSize)
+                {
+                    FM_DigestCacheStore(CmdArgs->Source1, CmdArgs->FileInfoSize, CmdArgs->FileInfoTime,
+                                        CmdArgs->FileInfoCRC, CurrentCRC, ReportPtr->Digest, ReportPtr->DigestSize);
+                }
+            }
+            else
+            {
+                /* Send CRC failure event (warning) */
+                FM_GlobalData.ChildCmdWarnCounter++;
+                CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s warning: unable to compute CRC: segment read result = %d, file = %s", CmdText,
+                                  (int)Status, CmdArgs->Source1);
+            }
 
             GettingCRC = false;
         }
         else
         {
-            GettingCRC = true;
+            Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+            if (Status != OS_SUCCESS)
+            {
+                FM_GlobalData.ChildCmdWarnCounter++;
+
+                /* Send CRC failure event (warning) */
+                CFE_EVS_SendEvent(FM_GET_FILE_INFO_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s warning: unable to compute CRC: OS_OpenCreate result = %d, file = %s", CmdText,
+                                  (int)Status, CmdArgs->Source1);
+
+                GettingCRC = false;
+            }
+            else
+            {
+                FM_DigestInit(&Digest, CmdArgs->FileInfoCRC);
+                GettingCRC = true;
+            }
         }
 
         while (GettingCRC)
@@ -866,9 +1392,17 @@ void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
                 GettingCRC = false;
                 OS_close(FileHandle);
 
-                /* Add CRC to telemetry packet */
+                /* Add CRC (or hash summary) and full digest to telemetry packet */
+                CurrentCRC              = FM_DigestFinal(&Digest, ReportPtr->Digest, &ReportPtr->DigestSize);
                 ReportPtr->CRC_Computed = true;
                 ReportPtr->CRC          = CurrentCRC;
+
+                /* Remember the result in case the unchanged file is requested again */
+                if (FileSize == CmdArgs->FileInfoSize)
+                {
+                    FM_DigestCacheStore(CmdArgs->Source1, CmdArgs->FileInfoSize, CmdArgs->FileInfoTime,
+                                        CmdArgs->FileInfoCRC, CurrentCRC, ReportPtr->Digest, ReportPtr->DigestSize);
+                }
             }
             else if (BytesRead < 0)
             {
@@ -886,8 +1420,8 @@ void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
             else
             {
                 /* Continue CRC calculation */
-                CurrentCRC =
-                    CFE_ES_CalculateCRC(FM_GlobalData.ChildBuffer, BytesRead, CurrentCRC, CmdArgs->FileInfoCRC);
+                FM_DigestUpdate(&Digest, FM_GlobalData.ChildBuffer, BytesRead);
+                FileSize += BytesRead;
             }
 
             /* Avoid CPU hogging */
@@ -918,6 +1452,8 @@ void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
     CFE_EVS_SendEvent(FM_GET_FILE_INFO_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s", CmdText,
                       CmdArgs->Source1);
 
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -934,9 +1470,14 @@ void FM_ChildCreateDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
     const char *CmdText   = "Create Directory";
     int32       OS_Status = OS_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate;
+
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Source1);
+
     OS_Status = OS_mkdir(CmdArgs->Source1, 0);
 
     if (OS_Status != OS_SUCCESS)
@@ -957,6 +1498,9 @@ void FM_ChildCreateDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
                           CmdArgs->Source1);
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Source1);
+    FM_DirIndexCommit(&IndexUpdate);
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -976,11 +1520,23 @@ void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
     os_dirent_t DirEntry;
     int32       OS_Status = OS_SUCCESS;
 
+    FM_DirIndexUpdate_t IndexUpdate;
+
     memset(&DirEntry, 0, sizeof(DirEntry));
 
     /* Report current child task activity */
     FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
 
+    /* Entries of an indexed directory are updated in its index */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Source1);
+
+    /* A directory held open for Get Dir List Pkt paging cannot be removed on some file systems */
+    if (strncmp(FM_GlobalData.DirListCursor.DirName, CmdArgs->Source1, sizeof(FM_GlobalData.DirListCursor.DirName)) ==
+        0)
+    {
+        FM_ChildDirListCursorClose();
+    }
+
     /* Open the dir so we can see if it is empty */
     OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
 
@@ -1027,6 +1583,9 @@ void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
         }
         else
         {
+            /* The index of a removed directory is not left behind */
+            FM_DirIndexRemove(CmdArgs->Source1);
+
             /* Send command completion event (info) */
             CFE_EVS_SendEvent(FM_DELETE_DIR_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s", CmdText,
                               CmdArgs->Source1);
@@ -1035,6 +1594,9 @@ void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
         }
     }
 
+    FM_StatCacheInvalidate(CmdArgs->Source1);
+    FM_DirIndexCommit(&IndexUpdate);
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -1064,6 +1626,8 @@ void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
     **  CmdArgs->Source1     = directory name
     **  CmdArgs->Source2     = directory name plus separator
     **  CmdArgs->Target      = output filename
+    **  CmdArgs->ListFormat  = output file format
+    **  CmdArgs->MaxDepth    = subdirectory levels to list
     */
 
     /* Open directory for reading directory list */
@@ -1080,12 +1644,12 @@ void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
     else
     {
         /* Create output file, write placeholder for statistics, etc. */
-        Result = FM_ChildDirListFileInit(&FileHandle, CmdArgs->Source1, CmdArgs->Target);
+        Result = FM_ChildDirListFileInit(&FileHandle, CmdArgs->Source1, CmdArgs->Target, CmdArgs->ListFormat);
         if (Result == true)
         {
             /* Read directory listing and write contents to output file */
             FM_ChildDirListFileLoop(DirId, FileHandle, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target,
-                                    CmdArgs->GetSizeTimeMode);
+                                    CmdArgs->GetSizeTimeMode, CmdArgs->ListFormat, CmdArgs->MaxDepth);
 
             /* Close output file */
             OS_close(FileHandle);
@@ -1095,6 +1659,8 @@ void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
         OS_DirectoryClose(DirId);
     }
 
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
     /* Report previous child task activity */
     FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
     FM_GlobalData.ChildCurrentCC  = 0;
@@ -1108,19 +1674,27 @@ void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
 
 void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *       CmdText                      = "Directory List to Packet";
-    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
-    bool               StillProcessing              = true;
-    osal_id_t          DirId                        = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t        DirEntry;
-    int32              ListIndex      = 0;
-    FM_DirListEntry_t *ListEntry      = NULL;
-    size_t             PathLength     = 0;
-    size_t             EntryLength    = 0;
-    int32              FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
-    int32              Status;
+    const char * CmdText         = "Directory List to Packet";
+    bool         StillProcessing = true;
+    bool         UseCursor       = false;
+    bool         UseIndex        = false;
+    osal_id_t    DirId           = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t    IndexHandle     = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t  DirEntry;
+    uint32       EntryIndex     = 0;
+    uint32       ReadCount      = 0;
+    uint32       i              = 0;
+    uint32       DirSize        = 0;
+    uint32       DirTime        = 0;
+    uint32       DirMode        = 0;
+    int32        FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    int32        Status         = OS_SUCCESS;
+    int32        DirTimeStatus  = OS_ERROR;
 
     FM_DirListPkt_Payload_t *ReportPtr;
+    FM_DirListCursor_t *     CursorPtr = &FM_GlobalData.DirListCursor;
+    FM_DirListEntry_t *      ListEntry;
+    FM_DirIndexHeader_t      IndexHeader;
 
     memset(&DirEntry, 0, sizeof(DirEntry));
 
@@ -1134,21 +1708,39 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
     **  CmdArgs->Source1       = directory name
     **  CmdArgs->Source2       = directory name plus separator
     **  CmdArgs->DirListOffset = index of 1st reported dir entry
+    **  CmdArgs->PacketMode    = one packet or a stream of packets
     */
-    PathLength = OS_strnlen(CmdArgs->Source2, OS_MAX_PATH_LEN);
 
-    /* Open source directory for reading directory list */
-    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+    /* A directory with a current index is listed from the index, a stale index is left for the build command */
+    UseIndex = FM_DirIndexOpen(CmdArgs->Source1, true, &IndexHandle, &IndexHeader);
 
-    if (Status != OS_SUCCESS)
+    /* Later packets for the same directory continue from where the last one stopped */
+    if (UseIndex == false)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        UseCursor = FM_ChildDirListCursorValid(CmdArgs->Source1);
+    }
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_PKT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    if ((UseIndex == false) && (UseCursor == false))
+    {
+        FM_ChildDirListCursorClose();
+
+        /* Directory time is taken first so changes made while reading are detected */
+        DirTimeStatus = FM_ChildSizeTimeMode(CmdArgs->Source1, &DirSize, &DirTime, &DirMode);
+
+        /* Open source directory for reading directory list */
+        Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+        if (Status != OS_SUCCESS)
+        {
+            FM_GlobalData.ChildCmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_PKT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+        }
     }
-    else
+
+    if (Status == OS_SUCCESS)
     {
         /* Initialize the directory list telemetry packet */
         CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_DIR_LIST_TLM_MID),
@@ -1159,64 +1751,151 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
         snprintf(ReportPtr->DirName, OS_MAX_PATH_LEN, "%s", CmdArgs->Source1);
         ReportPtr->FirstFile = CmdArgs->DirListOffset;
 
-        StillProcessing = true;
-        while (StillProcessing == true)
+        /* Index of the next entry that would go in the packet */
+        EntryIndex = ReportPtr->FirstFile;
+
+        if (UseIndex == true)
         {
-            /* Read next directory entry */
-            Status = OS_DirectoryRead(DirId, &DirEntry);
+            /* Index records go straight into the packet, entries before the offset are not read */
+            ReportPtr->TotalFiles = IndexHeader.EntryCount;
 
-            if (Status != OS_SUCCESS)
-            {
-                /* Stop reading directory - no more entries */
-                StillProcessing = false;
-            }
-            else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                     (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+            while ((EntryIndex < ReportPtr->TotalFiles) && ((ReportPtr->PacketFiles < FM_DIR_LIST_PKT_ENTRIES) ||
+                                                            (CmdArgs->PacketMode == FM_DIR_LIST_PKT_STREAM)))
             {
-                /* Do not count the "." and ".." directory entries */
-                ReportPtr->TotalFiles++;
+                if (ReportPtr->PacketFiles == FM_DIR_LIST_PKT_ENTRIES)
+                {
+                    /* Streamed listing continues in the next packet */
+                    FM_ChildDirListPktNext(ReportPtr, EntryIndex);
+                }
 
-                /* Start collecting directory entries at command-specified offset */
-                /* Stop collecting directory entries when telemetry packet is full */
-                if ((ReportPtr->TotalFiles > ReportPtr->FirstFile) &&
-                    (ReportPtr->PacketFiles < FM_DIR_LIST_PKT_ENTRIES))
+                ReadCount = ReportPtr->TotalFiles - EntryIndex;
+
+                if (ReadCount > (FM_DIR_LIST_PKT_ENTRIES - ReportPtr->PacketFiles))
                 {
-                    /* Create a shorthand access to the packet list entry */
-                    ListIndex = ReportPtr->PacketFiles;
-                    ListEntry = &ReportPtr->FileList[ListIndex];
+                    ReadCount = FM_DIR_LIST_PKT_ENTRIES - ReportPtr->PacketFiles;
+                }
 
-                    EntryLength = OS_strnlen(OS_DIRENTRY_NAME(DirEntry), OS_MAX_FILE_NAME);
+                ListEntry = &ReportPtr->FileList[ReportPtr->PacketFiles];
+                ReadCount = FM_DirIndexRead(IndexHandle, EntryIndex, ReadCount, ListEntry);
 
-                    /* Verify combined directory plus filename length */
-                    if ((PathLength + EntryLength) < sizeof(LogicalName))
-                    {
-                        /* Add filename to directory listing telemetry packet */
-                        snprintf(ListEntry->EntryName, sizeof(ListEntry->EntryName), "%s", OS_DIRENTRY_NAME(DirEntry));
+                if (ReadCount == 0)
+                {
+                    /* Index cannot be read, the listing ends here */
+                    ReportPtr->TotalFiles = EntryIndex;
+                }
+
+                for (i = 0; (i < ReadCount) && (CmdArgs->GetSizeTimeMode == false); i++)
+                {
+                    ListEntry[i].EntrySize  = 0;
+                    ListEntry[i].ModifyTime = 0;
+                    ListEntry[i].Mode       = 0;
+                }
+
+                ReportPtr->PacketFiles += ReadCount;
+                EntryIndex += ReadCount;
+            }
+
+            OS_close(IndexHandle);
+        }
+        else if (UseCursor == true)
+        {
+            /* Entry count is known from the first packet, the directory has not changed since */
+            ReportPtr->TotalFiles = CursorPtr->TotalFiles;
+
+            if (EntryIndex < CursorPtr->NextEntry)
+            {
+                /* Page is before the cursor - read the directory again from the start */
+                OS_DirectoryRewind(CursorPtr->DirId);
+                CursorPtr->NextEntry = 0;
+            }
 
-                        /* Build filename - Directory already has path separator */
-                        memcpy(LogicalName, CmdArgs->Source2, PathLength);
-                        memcpy(&LogicalName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
-                        LogicalName[PathLength + EntryLength] = '\0';
+            while ((EntryIndex < ReportPtr->TotalFiles) && ((ReportPtr->PacketFiles < FM_DIR_LIST_PKT_ENTRIES) ||
+                                                            (CmdArgs->PacketMode == FM_DIR_LIST_PKT_STREAM)))
+            {
+                /* Read next directory entry */
+                Status = OS_DirectoryRead(CursorPtr->DirId, &DirEntry);
 
-                        FM_ChildSleepStat(LogicalName, ListEntry, &FilesTillSleep, CmdArgs->GetSizeTimeMode);
+                if (Status != OS_SUCCESS)
+                {
+                    /* Directory ended early, the listing ends here */
+                    ReportPtr->TotalFiles = CursorPtr->NextEntry;
+                }
+                else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                         (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+                {
+                    /* Entries between the cursor and the command-specified offset are skipped */
+                    if (CursorPtr->NextEntry == EntryIndex)
+                    {
+                        if (ReportPtr->PacketFiles == FM_DIR_LIST_PKT_ENTRIES)
+                        {
+                            /* Streamed listing continues in the next packet */
+                            FM_ChildDirListPktNext(ReportPtr, EntryIndex);
+                        }
 
-                        /* Add another entry to the telemetry packet */
-                        ReportPtr->PacketFiles++;
+                        FM_ChildDirListPktEntry(CmdArgs, OS_DIRENTRY_NAME(DirEntry), ReportPtr, &FilesTillSleep);
+                        EntryIndex++;
                     }
-                    else
+
+                    CursorPtr->NextEntry++;
+                }
+            }
+        }
+        else
+        {
+            StillProcessing = true;
+            while (StillProcessing == true)
+            {
+                /* Read next directory entry */
+                Status = OS_DirectoryRead(DirId, &DirEntry);
+
+                if (Status != OS_SUCCESS)
+                {
+                    /* Stop reading directory - no more entries */
+                    StillProcessing = false;
+                }
+                else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                         (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+                {
+                    /* Do not count the "." and ".." directory entries */
+                    ReportPtr->TotalFiles++;
+
+                    /* Start collecting directory entries at command-specified offset */
+                    /* Stop collecting directory entries when telemetry packet is full, unless streaming */
+                    if ((ReportPtr->TotalFiles > EntryIndex) && ((ReportPtr->PacketFiles < FM_DIR_LIST_PKT_ENTRIES) ||
+                                                                 (CmdArgs->PacketMode == FM_DIR_LIST_PKT_STREAM)))
                     {
-                        FM_GlobalData.ChildCmdWarnCounter++;
+                        if (ReportPtr->PacketFiles == FM_DIR_LIST_PKT_ENTRIES)
+                        {
+                            /* Streamed listing continues in the next packet */
+                            FM_ChildDirListPktNext(ReportPtr, EntryIndex);
+                        }
 
-                        /* Send command warning event (info) */
-                        CFE_EVS_SendEvent(FM_GET_DIR_PKT_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                          "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText,
-                                          CmdArgs->Source2, OS_DIRENTRY_NAME(DirEntry));
+                        FM_ChildDirListPktEntry(CmdArgs, OS_DIRENTRY_NAME(DirEntry), ReportPtr, &FilesTillSleep);
+                        EntryIndex = ReportPtr->TotalFiles;
                     }
                 }
             }
+
+            if ((FM_DIR_LIST_CURSOR_TTL > 0) && (DirTimeStatus == OS_SUCCESS) && (EntryIndex < ReportPtr->TotalFiles))
+            {
+                /* Keep the directory open for the packets that follow */
+                FM_ChildDirListCursorOpen(DirId, CmdArgs->Source1, DirTime, ReportPtr->TotalFiles);
+                UseCursor = true;
+            }
+            else
+            {
+                OS_DirectoryClose(DirId);
+            }
         }
 
-        OS_DirectoryClose(DirId);
+        /* No entries were left out of this packet for lack of room */
+        ReportPtr->LastPacket = (EntryIndex >= ReportPtr->TotalFiles);
+
+        if ((UseCursor == true) && (ReportPtr->LastPacket == true))
+        {
+            /* The whole directory has been listed */
+            FM_ChildDirListCursorClose();
+        }
 
         /* Timestamp and send directory listing telemetry packet */
         CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader));
@@ -1224,7 +1903,8 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
 
         /* Send command completion event (info) */
         CFE_EVS_SendEvent(FM_GET_DIR_PKT_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "%s command: offset = %d, dir = %s", CmdText, (int)CmdArgs->DirListOffset, CmdArgs->Source1);
+                          "%s command: offset = %d, packets = %d, dir = %s", CmdText, (int)CmdArgs->DirListOffset,
+                          (int)(ReportPtr->PacketSequence + 1), CmdArgs->Source1);
 
         FM_GlobalData.ChildCmdCounter++;
     }
@@ -1236,32 +1916,144 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Set File Permissions           */
+/* FM child task command handler -- Get Sorted Directory List      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+
+void FM_ChildDirListSortedCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    int32       OS_Status = OS_SUCCESS;
-    const char *CmdText   = "Set Permissions";
+    const char *       CmdText                      = "Sorted Directory List";
+    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
+    bool               StillProcessing              = true;
+    bool               StatEntries                  = false;
+    FM_ChildScan_t     Scan;
+    FM_DirListEntry_t  Candidate;
+    FM_DirListEntry_t *ListEntry      = NULL;
+    size_t             PathLength     = 0;
+    size_t             EntryLength    = 0;
+    uint32             i              = 0;
+    int32              FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    int32              Status;
 
-    OS_Status = OS_chmod(CmdArgs->Source1, CmdArgs->Mode);
+    FM_DirListPkt_Payload_t *ReportPtr;
 
-    if (OS_Status == OS_SUCCESS)
+    /* Report current child task activity */
+    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode     = FM_GET_DIR_LIST_SORTED_CC
+    **  CmdArgs->Source1         = directory name
+    **  CmdArgs->Source2         = directory name plus separator
+    **  CmdArgs->Target          = entry name pattern, empty for all entries
+    **  CmdArgs->MaxEntries      = number of entries to list (1 to FM_DIR_LIST_PKT_ENTRIES)
+    **  CmdArgs->SortKey         = sort key
+    **  CmdArgs->SortDirection   = sort direction
+    **  CmdArgs->GetSizeTimeMode = get size, time and mode of listed entries
+    */
+    PathLength = OS_strnlen(CmdArgs->Source2, OS_MAX_PATH_LEN);
+
+    /* Entries can only be ordered by time or size once each one has been read */
+    StatEntries = (CmdArgs->SortKey != FM_SORT_BY_NAME);
+
+    /* Open source directory for reading directory list */
+    Status = FM_ChildScanOpen(&Scan, CmdArgs->Source1, CmdArgs->Source2);
+
+    if (Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdCounter++;
+        FM_GlobalData.ChildCmdErrCounter++;
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_SET_PERM_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s, access = %d",
-                          CmdText, CmdArgs->Source1, (int)CmdArgs->Mode);
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_SORTED_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
     }
     else
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        /* Initialize the directory list telemetry packet */
+        CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_DIR_LIST_TLM_MID),
+                     sizeof(FM_DirListPkt_t));
 
-        /* Send OS error message */
-        CFE_EVS_SendEvent(FM_SET_PERM_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s command: OS_chmod error, RC=0x%08X, file = %s, access = %d", CmdText,
-                          (unsigned int)OS_Status, CmdArgs->Source1, (int)CmdArgs->Mode);
+        ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+
+        snprintf(ReportPtr->DirName, OS_MAX_PATH_LEN, "%s", CmdArgs->Source1);
+
+        /* The packet entry list holds the entries selected so far, as a heap */
+        while (StillProcessing == true)
+        {
+            /* Read next directory entry */
+            Status = FM_ChildScanRead(&Scan);
+
+            if (Status != OS_SUCCESS)
+            {
+                /* Stop reading directory - no more entries */
+                StillProcessing = false;
+            }
+            else if (FM_ChildPatternMatch(CmdArgs->Target, OS_DIRENTRY_NAME(Scan.DirEntry)) == true)
+            {
+                /* Count every matching entry, listed or not */
+                ReportPtr->TotalFiles++;
+
+                if (Scan.PathValid == true)
+                {
+                    memset(&Candidate, 0, sizeof(Candidate));
+                    snprintf(Candidate.EntryName, sizeof(Candidate.EntryName), "%s", OS_DIRENTRY_NAME(Scan.DirEntry));
+
+                    if (StatEntries == true)
+                    {
+                        FM_ChildScanStat(&Scan, &Candidate, &FilesTillSleep);
+                    }
+
+                    FM_ChildDirListHeapAdd(ReportPtr->FileList, &ReportPtr->PacketFiles, CmdArgs->MaxEntries,
+                                           &Candidate, CmdArgs->SortKey, CmdArgs->SortDirection);
+                }
+                else
+                {
+                    FM_GlobalData.ChildCmdWarnCounter++;
+
+                    /* Send command warning event (info) */
+                    CFE_EVS_SendEvent(FM_GET_DIR_SORTED_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                      "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText,
+                                      CmdArgs->Source2, OS_DIRENTRY_NAME(Scan.DirEntry));
+                }
+            }
+        }
+
+        FM_ChildScanClose(&Scan);
+
+        /* The sorted listing is always a single packet */
+        ReportPtr->LastPacket = true;
+
+        /* Put the selected entries in listing order */
+        FM_ChildDirListHeapSort(ReportPtr->FileList, ReportPtr->PacketFiles, CmdArgs->SortKey,
+                                CmdArgs->SortDirection);
+
+        /* Name order only needs the size, time and mode of the listed entries */
+        if (StatEntries == false)
+        {
+            for (i = 0; i < ReportPtr->PacketFiles; i++)
+            {
+                ListEntry   = &ReportPtr->FileList[i];
+                EntryLength = OS_strnlen(ListEntry->EntryName, sizeof(ListEntry->EntryName));
+
+                memcpy(LogicalName, CmdArgs->Source2, PathLength);
+                memcpy(&LogicalName[PathLength], ListEntry->EntryName, EntryLength);
+                LogicalName[PathLength + EntryLength] = '\0';
+
+                FM_ChildSleepStat(LogicalName, ListEntry, &FilesTillSleep, CmdArgs->GetSizeTimeMode);
+            }
+        }
+
+        /* Timestamp and send directory listing telemetry packet */
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader), true);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_GET_DIR_SORTED_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: matched = %d, listed = %d, dir = %s", CmdText, (int)ReportPtr->TotalFiles,
+                          (int)ReportPtr->PacketFiles, CmdArgs->Source1);
+
+        FM_GlobalData.ChildCmdCounter++;
     }
 
     /* Report previous child task activity */
@@ -1271,282 +2063,2733 @@ void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- create dir list output file   */
+/* FM child task command handler -- Get Directory Statistics       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename)
+void FM_ChildDirStatsCmd(const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *    CmdText       = "Directory List to File";
-    bool            CommandResult = true;
-    CFE_FS_Header_t FileHeader;
+    const char *      CmdText         = "Directory Statistics";
+    bool              StillProcessing = true;
+    FM_ChildScan_t    Scan;
+    FM_DirListEntry_t DirListData;
+    uint32            SizeBin        = 0;
+    uint32            FileSize       = 0;
+    int32             FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    int32             Status;
+
+    FM_DirStatsPkt_Payload_t *ReportPtr;
+
+    /* Report current child task activity */
+    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_GET_DIR_STATS_CC
+    **  CmdArgs->Source1     = directory name
+    **  CmdArgs->Source2     = directory name plus separator
+    */
+
+    /* Open source directory for reading directory entries */
+    Status = FM_ChildScanOpen(&Scan, CmdArgs->Source1, CmdArgs->Source2);
+
+    if (Status != OS_SUCCESS)
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_STATS_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* Initialize the directory statistics telemetry packet */
+        CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.DirStatsPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_DIR_STATS_TLM_MID),
+                     sizeof(FM_DirStatsPkt_t));
+
+        ReportPtr = &FM_GlobalData.DirStatsPkt.Payload;
+
+        snprintf(ReportPtr->DirName, OS_MAX_PATH_LEN, "%s", CmdArgs->Source1);
+
+        /* Each entry is added to the packet totals as it is read */
+        while (StillProcessing == true)
+        {
+            /* Read next directory entry */
+            Status = FM_ChildScanRead(&Scan);
+
+            if (Status != OS_SUCCESS)
+            {
+                /* Stop reading directory - no more entries */
+                StillProcessing = false;
+            }
+            else
+            {
+                ReportPtr->TotalEntries++;
+
+                /* Entries whose full name is too long are counted as unread */
+                Status = FM_ChildScanStat(&Scan, &DirListData, &FilesTillSleep);
+
+                if (Status != OS_SUCCESS)
+                {
+                    ReportPtr->UnreadCount++;
+                }
+                else if ((DirListData.Mode & OS_FILESTAT_MODE_DIR) != 0)
+                {
+                    ReportPtr->DirCount++;
+                }
+                else
+                {
+                    FileSize = DirListData.EntrySize;
+
+                    /* The first file sets both time limits */
+                    if ((ReportPtr->FileCount == 0) || (DirListData.ModifyTime < ReportPtr->OldestTime))
+                    {
+                        ReportPtr->OldestTime = DirListData.ModifyTime;
+                    }
+                    if ((ReportPtr->FileCount == 0) || (DirListData.ModifyTime > ReportPtr->NewestTime))
+                    {
+                        ReportPtr->NewestTime = DirListData.ModifyTime;
+                    }
+
+                    if ((ReportPtr->FileCount == 0) || (FileSize > ReportPtr->LargestSize))
+                    {
+                        ReportPtr->LargestSize = FileSize;
+                        snprintf(ReportPtr->LargestName, sizeof(ReportPtr->LargestName), "%s",
+                                 OS_DIRENTRY_NAME(Scan.DirEntry));
+                    }
+
+                    /* Histogram bin is the number of significant bits in the size */
+                    SizeBin = 0;
+                    while (FileSize != 0)
+                    {
+                        SizeBin++;
+                        FileSize >>= 1;
+                    }
+                    ReportPtr->SizeHistogram[SizeBin]++;
+
+                    ReportPtr->TotalBytes += DirListData.EntrySize;
+                    ReportPtr->FileCount++;
+                }
+            }
+        }
+
+        FM_ChildScanClose(&Scan);
+
+        if (ReportPtr->UnreadCount != 0)
+        {
+            FM_GlobalData.ChildCmdWarnCounter++;
+
+            /* Send one command warning event (info) for all unread entries */
+            CFE_EVS_SendEvent(FM_GET_DIR_STATS_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: size and time not read: entries = %d, dir = %s", CmdText,
+                              (int)ReportPtr->UnreadCount, CmdArgs->Source1);
+        }
+
+        /* Timestamp and send directory statistics telemetry packet */
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.DirStatsPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.DirStatsPkt.TelemetryHeader), true);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_GET_DIR_STATS_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: entries = %d, files = %d, dirs = %d, dir = %s", CmdText,
+                          (int)ReportPtr->TotalEntries, (int)ReportPtr->FileCount, (int)ReportPtr->DirCount,
+                          CmdArgs->Source1);
+
+        FM_GlobalData.ChildCmdCounter++;
+    }
+
+    /* Report previous child task activity */
+    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+    FM_GlobalData.ChildCurrentCC  = 0;
+}
+
+#if FM_DIR_TRACK_DIRS > 0
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get Directory Changes          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirChangesCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *   CmdText  = "Directory Changes";
+    FM_DirTrack_t *TrackPtr = NULL;
+    int32          Status   = OS_SUCCESS;
+
+    FM_DirChangesPkt_Payload_t *ReportPtr;
+
+    /* Report current child task activity */
+    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode   = FM_GET_DIR_CHANGES_CC
+    **  CmdArgs->Source1       = directory name
+    **  CmdArgs->Source2       = directory name plus separator
+    **  CmdArgs->SinceSequence = change sequence number known to the caller
+    **  CmdArgs->DirListOffset = index of 1st change to put in packet
+    */
+
+    TrackPtr = FM_ChildDirTrackGet(CmdArgs->Source1);
+
+    /* The directory is only read again if it may have changed */
+    if (FM_ChildDirTrackChanged(TrackPtr, CmdArgs->Source1) == true)
+    {
+        Status = FM_ChildDirTrackScan(TrackPtr, CmdArgs);
+    }
+
+    if (Status != OS_SUCCESS)
+    {
+        /* A directory that cannot be read is no longer tracked */
+        FM_ChildDirTrackRelease(TrackPtr);
+
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_CHANGES_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        if (TrackPtr->UntrackedCount != 0)
+        {
+            FM_GlobalData.ChildCmdWarnCounter++;
+
+            /* Send one command warning event (info) for all untracked entries */
+            CFE_EVS_SendEvent(FM_GET_DIR_CHANGES_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: entries not tracked: entries = %d, dir = %s", CmdText,
+                              (int)TrackPtr->UntrackedCount, CmdArgs->Source1);
+        }
+
+        FM_ChildDirChangesReport(TrackPtr, CmdArgs);
+
+        ReportPtr = &FM_GlobalData.DirChangesPkt.Payload;
+
+        /* Timestamp and send directory changes telemetry packet */
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.DirChangesPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.DirChangesPkt.TelemetryHeader), true);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_GET_DIR_CHANGES_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: sequence = %d, changes = %d, dir = %s", CmdText, (int)ReportPtr->Sequence,
+                          (int)ReportPtr->TotalChanges, CmdArgs->Source1);
+
+        FM_GlobalData.ChildCmdCounter++;
+    }
+
+    /* Report previous child task activity */
+    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+    FM_GlobalData.ChildCurrentCC  = 0;
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Build Directory Index          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildBuildDirIndexCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText   = "Build Directory Index";
+    int32       OS_Status = OS_SUCCESS;
+
+    FM_DirIndexHeader_t Header;
+
+    memset(&Header, 0, sizeof(Header));
+
+    /* Report current child task activity */
+    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode   = FM_BUILD_DIR_INDEX_CC
+    **  CmdArgs->Source1       = directory name
+    **  CmdArgs->Source2       = directory name plus separator
+    */
+
+    OS_Status = FM_DirIndexBuild(CmdArgs->Source1, CmdArgs->Source2, &Header);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_BUILD_DIR_INDEX_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: index not written: result = %d, dir = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
+    }
+    else
+    {
+        FM_GlobalData.ChildCmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_BUILD_DIR_INDEX_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: entries = %d, files = %d, bytes = %llu, dir = %s", CmdText,
+                          (int)Header.EntryCount, (int)Header.FileCount, (unsigned long long)Header.TotalBytes,
+                          CmdArgs->Source1);
+    }
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
+    /* Report previous child task activity */
+    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+    FM_GlobalData.ChildCurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Set File Permissions           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    int32       OS_Status = OS_SUCCESS;
+    const char *CmdText   = "Set Permissions";
+
+    FM_DirIndexUpdate_t IndexUpdate;
+
+    /* A mode change does not change the directory time, so the index is updated here */
+    FM_DirIndexPrepare(&IndexUpdate, CmdArgs->Source1);
+
+    OS_Status = OS_chmod(CmdArgs->Source1, CmdArgs->Mode);
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        FM_GlobalData.ChildCmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_SET_PERM_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s, access = %d",
+                          CmdText, CmdArgs->Source1, (int)CmdArgs->Mode);
+    }
+    else
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send OS error message */
+        CFE_EVS_SendEvent(FM_SET_PERM_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s command: OS_chmod error, RC=0x%08X, file = %s, access = %d", CmdText,
+                          (unsigned int)OS_Status, CmdArgs->Source1, (int)CmdArgs->Mode);
+    }
+
+    FM_StatCacheInvalidate(CmdArgs->Source1);
+    FM_DirIndexCommit(&IndexUpdate);
+
+    /* Report previous child task activity */
+    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+    FM_GlobalData.ChildCurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Directory Manifest             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirManifestCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText    = "Directory Manifest";
+    bool        Result     = false;
+    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t   DirId      = OS_OBJECT_ID_UNDEFINED;
+    int32       Status     = 0;
+
+    /* Report current child task activity */
+    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_DIR_MANIFEST_CC
+    **  CmdArgs->Source1     = directory name
+    **  CmdArgs->Source2     = directory name plus separator
+    **  CmdArgs->Target      = output filename
+    **  CmdArgs->FileInfoCRC = CRC or hash algorithm
+    */
+
+    /* Open directory for reading directory list */
+    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (Status != OS_SUCCESS)
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DIR_MANIFEST_OSOPENDIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* Create output file, write placeholder for statistics, etc. */
+        Result = FM_ChildDirManifestInit(&FileHandle, CmdArgs->Source1, CmdArgs->Target, CmdArgs->FileInfoCRC);
+        if (Result == true)
+        {
+            /* Compute file digests and write manifest entries to output file */
+            FM_ChildDirManifestLoop(DirId, FileHandle, CmdArgs);
+
+            /* Close output file */
+            OS_close(FileHandle);
+        }
+
+        /* Close directory list access handle */
+        OS_DirectoryClose(DirId);
+    }
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
+    /* Report previous child task activity */
+    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+    FM_GlobalData.ChildCurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Compare Files                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCompareFilesCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText       = "Compare Files";
+    bool        CompareResult = false;
+    int32       OS_Status     = OS_SUCCESS;
+    osal_id_t   FileHandle1   = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t   FileHandle2   = OS_OBJECT_ID_UNDEFINED;
+    uint32      FileTime      = 0;
+    uint32      FileMode      = 0;
+
+    FM_CompareFilesPkt_Payload_t *ReportPtr;
+
+    /* Report current child task activity */
+    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_COMPARE_FILES_CC
+    **  CmdArgs->Source1     = name of first file
+    **  CmdArgs->Source2     = name of second file
+    */
+
+    /* Initialize compare files packet (set all data to zero) */
+    CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.CompareFilesPkt.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(FM_COMPARE_FILES_TLM_MID), sizeof(FM_CompareFilesPkt_t));
+
+    ReportPtr = &FM_GlobalData.CompareFilesPkt.Payload;
+
+    snprintf(ReportPtr->Filename1, OS_MAX_PATH_LEN, "%s", CmdArgs->Source1);
+    snprintf(ReportPtr->Filename2, OS_MAX_PATH_LEN, "%s", CmdArgs->Source2);
+
+    /* Get the size of both files before reading any file data */
+    OS_Status = FM_ChildSizeTimeMode(CmdArgs->Source1, &ReportPtr->FileSize1, &FileTime, &FileMode);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_COMPARE_FILES_OSSTAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_stat failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
+    }
+    else
+    {
+        OS_Status = FM_ChildSizeTimeMode(CmdArgs->Source2, &ReportPtr->FileSize2, &FileTime, &FileMode);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            FM_GlobalData.ChildCmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_COMPARE_FILES_OSSTAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_stat failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source2);
+        }
+    }
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        if (ReportPtr->FileSize1 != ReportPtr->FileSize2)
+        {
+            /* Files cannot match - no need to read them */
+            ReportPtr->Result = FM_COMPARE_SIZE_DIFFERS;
+            CompareResult     = true;
+        }
+        else
+        {
+            OS_Status = OS_OpenCreate(&FileHandle1, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+            if (OS_Status != OS_SUCCESS)
+            {
+                FM_GlobalData.ChildCmdErrCounter++;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_COMPARE_FILES_OSOPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                                  CmdArgs->Source1);
+            }
+            else
+            {
+                OS_Status = OS_OpenCreate(&FileHandle2, CmdArgs->Source2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+                if (OS_Status != OS_SUCCESS)
+                {
+                    FM_GlobalData.ChildCmdErrCounter++;
+
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(FM_COMPARE_FILES_OSOPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText,
+                                      (int)OS_Status, CmdArgs->Source2);
+                }
+                else
+                {
+                    /* Compare file contents, stopping at the first difference */
+                    CompareResult = FM_ChildCompareFilesLoop(FileHandle1, FileHandle2, CmdArgs, ReportPtr);
+
+                    OS_close(FileHandle2);
+                }
+
+                OS_close(FileHandle1);
+            }
+        }
+    }
+
+    if (CompareResult == true)
+    {
+        FM_GlobalData.ChildCmdCounter++;
+
+        /* Timestamp and send compare files telemetry packet */
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.CompareFilesPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.CompareFilesPkt.TelemetryHeader), true);
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_COMPARE_FILES_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: result = %d, offset = %u, src1 = %s, src2 = %s", CmdText,
+                          (int)ReportPtr->Result, (unsigned int)ReportPtr->FirstDiffOffset, CmdArgs->Source1,
+                          CmdArgs->Source2);
+    }
+
+    FM_GlobalData.OpenFilesSummary.Changed = true;
+
+    /* Report previous child task activity */
+    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
+    FM_GlobalData.ChildCurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- create dir list output file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, uint8 ListFormat)
+{
+    const char *    CmdText       = "Directory List to File";
+    bool            CommandResult = true;
+    CFE_FS_Header_t FileHeader;
+    osal_id_t       FileHandle   = OS_OBJECT_ID_UNDEFINED;
+    int32           BytesWritten = 0;
+    int32           Status       = 0;
+
+    /* Initialize the standard cFE File Header for the Directory Listing File */
+    if (ListFormat == FM_DIR_LIST_FORMAT_COMPACT)
+    {
+        CFE_FS_InitHeader(&FileHeader, CmdText, FM_DIR_LIST_COMPACT_FILE_SUBTYPE);
+    }
+    else
+    {
+        CFE_FS_InitHeader(&FileHeader, CmdText, FM_DIR_LIST_FILE_SUBTYPE);
+    }
+
+    /* Create directory listing output file */
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    FM_StatCacheInvalidate(Filename);
+
+    if (Status == OS_SUCCESS)
+    {
+        /* Write the standard CFE file header */
+        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+        if (BytesWritten == sizeof(CFE_FS_Header_t))
+        {
+            /* Initialize directory statistics structure */
+            memset(&FM_GlobalData.DirListFileStats, 0, sizeof(FM_GlobalData.DirListFileStats));
+            strncpy(FM_GlobalData.DirListFileStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
+            FM_GlobalData.DirListFileStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+
+            /* Buffer blank FM directory statistics structure as a placeholder (written with the first entries) */
+            FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FileHandle);
+            FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, &FM_GlobalData.DirListFileStats,
+                                sizeof(FM_DirListFileStats_t));
+
+            /* Return output file handle */
+            *FileHandlePtr = FileHandle;
+        }
+        else
+        {
+            CommandResult = false;
+            FM_GlobalData.ChildCmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
+                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+        }
+
+        /* Close output file after write error */
+        if (CommandResult == false)
+        {
+            OS_close(FileHandle);
+        }
+    }
+    else
+    {
+        CommandResult = false;
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write to dir list output file */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
+                             const char *Filename, uint8 getSizeTimeMode, uint8 ListFormat, uint8 MaxDepth)
+{
+    const char *      CmdText                   = "Directory List to File";
+    const void *      WriteData                 = NULL;
+    const char *      PartName                  = Filename;
+    size_t            WriteLength               = 0;
+    size_t            FileSize                  = 0;
+    bool              ReadingDirectory          = true;
+    bool              CommandResult             = true;
+    bool              PartOwned                 = false;
+    bool              StatEntries               = false;
+    uint32            DirEntries                = 0;
+    uint32            FileEntries               = 0;
+    uint32            PartEntries               = 0;
+    uint32            PartCount                 = 1;
+    uint32            LastTime                  = 0;
+    uint32            Depth                     = 0;
+    size_t            EntryLength               = 0;
+    size_t            PathLength                = 0;
+    size_t            RootLength                = 0;
+    int32             FilesTillSleep            = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    int32             Status                    = 0;
+    osal_id_t         PartHandle                = FileHandle;
+    osal_id_t         CurrentDirId              = DirId;
+    osal_id_t         SubDirId                  = OS_OBJECT_ID_UNDEFINED;
+    char              TempName[OS_MAX_PATH_LEN] = "\0";
+    char              NextName[OS_MAX_PATH_LEN] = "\0";
+    uint8             CompactData[FM_DIR_LIST_COMPACT_ENTRY_MAX];
+    osal_id_t         ParentDirId[FM_DIR_LIST_MAX_DEPTH];
+    size_t            ParentLength[FM_DIR_LIST_MAX_DEPTH];
+    os_dirent_t       DirEntry;
+    FM_DirListEntry_t DirListData;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* TempName always starts with the path of the directory being read */
+    PathLength = OS_strnlen(DirWithSep, OS_MAX_PATH_LEN);
+    memcpy(TempName, DirWithSep, PathLength);
+    RootLength = PathLength;
+
+    /* Subdirectories are found from the entry mode, so a listing with depth reads every entry mode */
+    StatEntries = ((getSizeTimeMode != 0) || (MaxDepth != 0));
+
+    /* Until end of directory entries or output file write error */
+    while ((CommandResult == true) && (ReadingDirectory == true))
+    {
+        Status = OS_DirectoryRead(CurrentDirId, &DirEntry);
+
+        if ((Status != OS_SUCCESS) && (Depth > 0))
+        {
+            /* End of a subdirectory - continue with the rest of its parent */
+            OS_DirectoryClose(CurrentDirId);
+            Depth--;
+            CurrentDirId = ParentDirId[Depth];
+            PathLength   = ParentLength[Depth];
+        }
+        else if (Status != OS_SUCCESS)
+        {
+            /* Normal loop end - no more directory entries */
+            ReadingDirectory = false;
+        }
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            /* Do not count the "." and ".." files */
+            DirEntries++;
+
+            EntryLength = OS_strnlen(OS_DIRENTRY_NAME(DirEntry), OS_MAX_FILE_NAME);
+
+            /*
+             * DirListData.EntryName and TempName are both OS_MAX_PATH_LEN, DirEntry name is OS_MAX_FILE_NAME,
+             * so limiting test is PathLength and EntryLength together
+             */
+            if ((PathLength + EntryLength) < sizeof(TempName))
+            {
+                /* Build qualified directory entry name */
+                memcpy(&TempName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
+                TempName[PathLength + EntryLength] = '\0';
+
+                /*
+                 * Populate directory list file entry with the name relative to the listed directory -
+                 * Note this is guaranteed to be null-terminated due to the memset()
+                 * this will leave at least one null char after the string.
+                 */
+                memset(&DirListData, 0, sizeof(DirListData));
+                strncpy(DirListData.EntryName, &TempName[RootLength], sizeof(DirListData.EntryName) - 1);
+
+                FM_ChildSleepStat(TempName, &DirListData, &FilesTillSleep, StatEntries);
+
+                /* Compact entries are encoded after any change of output file, so allow for the longest one */
+                WriteLength = (ListFormat == FM_DIR_LIST_FORMAT_COMPACT) ? FM_DIR_LIST_COMPACT_ENTRY_MAX
+                                                                         : sizeof(FM_DirListEntry_t);
+                FileSize    = sizeof(CFE_FS_Header_t) + FM_GlobalData.ChildWriter.Written +
+                              FM_GlobalData.ChildWriter.Length;
+
+                /* Continue the listing in the next output file before this one passes the size limit */
+                if ((FM_GlobalData.DirListFileMaxSize != 0) && (PartEntries != 0) &&
+                    ((FileSize + WriteLength) > FM_GlobalData.DirListFileMaxSize))
+                {
+                    CommandResult = FM_ChildDirListFileStats(PartHandle, PartName, DirEntries - 1, PartEntries);
+
+                    /* Close a continuation file, the first output file belongs to the caller */
+                    if (PartOwned == true)
+                    {
+                        OS_close(PartHandle);
+                        PartOwned = false;
+                    }
+
+                    if (CommandResult == true)
+                    {
+                        CommandResult = FM_ChildDirListFileNext(&PartHandle, Directory, Filename, NextName,
+                                                                PartCount, ListFormat);
+                    }
+
+                    if (CommandResult == true)
+                    {
+                        PartName    = NextName;
+                        PartOwned   = true;
+                        PartEntries = 0;
+                        LastTime    = 0;
+                        PartCount++;
+                    }
+                }
+
+                /* Collect directory list file entry in the write buffer */
+                if (CommandResult == true)
+                {
+                    if (ListFormat == FM_DIR_LIST_FORMAT_COMPACT)
+                    {
+                        WriteLength = FM_ChildDirListCompactEntry(CompactData, &DirListData, &LastTime);
+                        WriteData   = CompactData;
+                    }
+                    else
+                    {
+                        WriteData = &DirListData;
+                    }
+
+                    CommandResult = FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, WriteData, WriteLength);
+
+                    if (CommandResult == true)
+                    {
+                        FileEntries++;
+                        PartEntries++;
+                    }
+                    else
+                    {
+                        FM_GlobalData.ChildCmdErrCounter++;
+
+                        /* Send command failure event (error) */
+                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "%s error: OS_write entries failed: result = %d, file = %s", CmdText,
+                                          (int)FM_GlobalData.ChildWriter.Status, PartName);
+                    }
+                }
+
+                /* List the contents of a subdirectory before the rest of this directory */
+                if ((CommandResult == true) && (Depth < MaxDepth) && ((DirListData.Mode & OS_FILESTAT_MODE_DIR) != 0))
+                {
+                    Status = OS_ERR_NAME_TOO_LONG;
+
+                    if ((PathLength + EntryLength + 1) < sizeof(TempName))
+                    {
+                        Status = OS_DirectoryOpen(&SubDirId, TempName);
+                    }
+
+                    if (Status == OS_SUCCESS)
+                    {
+                        ParentDirId[Depth]  = CurrentDirId;
+                        ParentLength[Depth] = PathLength;
+                        Depth++;
+
+                        /* Entries of the subdirectory are named after it */
+                        CurrentDirId = SubDirId;
+                        PathLength += EntryLength;
+                        TempName[PathLength] = '/';
+                        PathLength++;
+                    }
+                    else
+                    {
+                        FM_GlobalData.ChildCmdWarnCounter++;
+
+                        /* Send command warning event (info) */
+                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                          "%s warning: subdirectory not listed: result = %d, dir = %s", CmdText,
+                                          (int)Status, TempName);
+                    }
+                }
+            }
+            else
+            {
+                FM_GlobalData.ChildCmdWarnCounter++;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s error: combined directory and entry name too long: dir = %s, entry = %s",
+                                  CmdText, Directory, OS_DIRENTRY_NAME(DirEntry));
+            }
+        }
+    }
+
+    /* Close the subdirectories still open after an output file error */
+    while (Depth > 0)
+    {
+        OS_DirectoryClose(CurrentDirId);
+        Depth--;
+        CurrentDirId = ParentDirId[Depth];
+    }
+
+    /* Write the remaining entries and the statistics of the last output file */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_ChildDirListFileStats(PartHandle, PartName, DirEntries, PartEntries);
+    }
+
+    /* Close the output file opened for the last part of the listing */
+    if (PartOwned == true)
+    {
+        OS_close(PartHandle);
+    }
+
+    /* Earlier output files were completed before the whole directory had been read */
+    if ((CommandResult == true) && (PartCount > 1))
+    {
+        CommandResult = FM_ChildDirListFileTotals(FileHandle, Filename, PartCount, DirEntries);
+    }
+
+    /* Send command completion event (info) */
+    if (CommandResult == true)
+    {
+        FM_GlobalData.ChildCmdCounter++;
+
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: wrote %d of %d names in %d files: dir = %s, filename = %s", CmdText,
+                          (int)FileEntries, (int)DirEntries, (int)PartCount, Directory, Filename);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- finish dir list output file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListFileStats(osal_id_t FileHandle, const char *Filename, uint32 DirEntries, uint32 FileEntries)
+{
+    const char *CmdText       = "Directory List to File";
+    size_t      WriteLength   = sizeof(FM_DirListFileStats_t);
+    bool        CommandResult = true;
+    bool        StatsUpdated  = false;
+    int32       BytesWritten  = 0;
+
+    if (DirEntries != 0)
+    {
+        /* Update entries found in directory vs entries written to file */
+        FM_GlobalData.DirListFileStats.DirEntries  = DirEntries;
+        FM_GlobalData.DirListFileStats.FileEntries = FileEntries;
+
+        /* A short listing is still in the buffer with its placeholder */
+        StatsUpdated = FM_ChildWriterUpdate(&FM_GlobalData.ChildWriter, 0, &FM_GlobalData.DirListFileStats,
+                                            sizeof(FM_DirListFileStats_t));
+    }
+
+    /* Write any buffered entries to the output file */
+    CommandResult = FM_ChildWriterFlush(&FM_GlobalData.ChildWriter);
+
+    if (CommandResult == false)
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_write entries failed: result = %d, file = %s", CmdText,
+                          (int)FM_GlobalData.ChildWriter.Status, Filename);
+    }
+
+    /* Update directory statistics in output file */
+    if ((CommandResult == true) && (DirEntries != 0) && (StatsUpdated == false))
+    {
+        /* Back up to the start of the statistics data */
+        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+        /* Write an updated version of the statistics data */
+        BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, WriteLength);
+
+        if (BytesWritten != WriteLength)
+        {
+            CommandResult = false;
+            FM_GlobalData.ChildCmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
+                              (int)BytesWritten, (int)WriteLength);
+        }
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- start next dir list file      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListFileNext(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, char *NextName,
+                             uint32 PartCount, uint8 ListFormat)
+{
+    const char *CmdText       = "Directory List to File";
+    bool        CommandResult = false;
+    int         NameLength    = 0;
+
+    /* Later parts of the listing are named after the first output file */
+    NameLength = snprintf(NextName, OS_MAX_PATH_LEN, "%s.%u", Filename, (unsigned int)PartCount);
+
+    if ((NameLength > 0) && (NameLength < OS_MAX_PATH_LEN))
+    {
+        CommandResult = FM_ChildDirListFileInit(FileHandlePtr, Directory, NextName, ListFormat);
+    }
+    else
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_NEXT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: next output filename too long: file = %s, part = %u", CmdText, Filename,
+                          (unsigned int)PartCount);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- total earlier dir list files  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListFileTotals(osal_id_t FileHandle, const char *Filename, uint32 PartCount, uint32 DirEntries)
+{
+    const char *CmdText                   = "Directory List to File";
+    size_t      WriteLength               = sizeof(DirEntries);
+    bool        CommandResult             = true;
+    uint32      Part                      = 0;
+    int32       BytesWritten              = 0;
+    int32       Status                    = OS_SUCCESS;
+    osal_id_t   PartHandle                = FileHandle;
+    char        PartName[OS_MAX_PATH_LEN] = "\0";
+
+    /* The last file was completed with the total, the others with the entries read before them */
+    for (Part = 0; (Part < (PartCount - 1)) && (CommandResult == true); Part++)
+    {
+        if (Part > 0)
+        {
+            /* Same name as given by FM_ChildDirListFileNext, known to fit */
+            snprintf(PartName, sizeof(PartName), "%s.%u", Filename, (unsigned int)Part);
+
+            Status = OS_OpenCreate(&PartHandle, PartName, OS_FILE_FLAG_NONE, OS_READ_WRITE);
+
+            if (Status != OS_SUCCESS)
+            {
+                CommandResult = false;
+                FM_GlobalData.ChildCmdErrCounter++;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_OpenCreate update stats failed: result = %d, file = %s", CmdText,
+                                  (int)Status, PartName);
+            }
+        }
+
+        if (CommandResult == true)
+        {
+            /* Only the directory entry count changes */
+            OS_lseek(PartHandle, sizeof(CFE_FS_Header_t) + offsetof(FM_DirListFileStats_t, DirEntries),
+                     OS_SEEK_SET);
+
+            BytesWritten = OS_write(PartHandle, &DirEntries, WriteLength);
+
+            if (BytesWritten != WriteLength)
+            {
+                CommandResult = false;
+                FM_GlobalData.ChildCmdErrCounter++;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
+                                  (int)BytesWritten, (int)WriteLength);
+            }
+
+            if (Part > 0)
+            {
+                OS_close(PartHandle);
+            }
+        }
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- create manifest output file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirManifestInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, uint32 TypeCRC)
+{
+    const char *    CmdText       = "Directory Manifest";
+    bool            CommandResult = true;
+    CFE_FS_Header_t FileHeader;
     osal_id_t       FileHandle   = OS_OBJECT_ID_UNDEFINED;
     int32           BytesWritten = 0;
     int32           Status       = 0;
 
-    /* Initialize the standard cFE File Header for the Directory Listing File */
-    CFE_FS_InitHeader(&FileHeader, CmdText, FM_DIR_LIST_FILE_SUBTYPE);
+    /* Initialize the standard cFE File Header for the Directory Manifest File */
+    CFE_FS_InitHeader(&FileHeader, CmdText, FM_DIR_MANIFEST_FILE_SUBTYPE);
+
+    /* Create manifest output file */
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    FM_StatCacheInvalidate(Filename);
+
+    if (Status == OS_SUCCESS)
+    {
+        /* Write the standard CFE file header */
+        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+        if (BytesWritten == sizeof(CFE_FS_Header_t))
+        {
+            /* Initialize manifest statistics structure */
+            memset(&FM_GlobalData.DirManifestStats, 0, sizeof(FM_GlobalData.DirManifestStats));
+            strncpy(FM_GlobalData.DirManifestStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
+            FM_GlobalData.DirManifestStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+            FM_GlobalData.DirManifestStats.TypeCRC                      = TypeCRC;
+
+            /* Buffer blank statistics structure as a placeholder (written with the first entries) */
+            FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FileHandle);
+            FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, &FM_GlobalData.DirManifestStats,
+                                sizeof(FM_DirManifestStats_t));
+
+            /* Return output file handle */
+            *FileHandlePtr = FileHandle;
+        }
+        else
+        {
+            CommandResult = false;
+            FM_GlobalData.ChildCmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_DIR_MANIFEST_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
+                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+
+            /* Close output file after write error */
+            OS_close(FileHandle);
+        }
+    }
+    else
+    {
+        CommandResult = false;
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DIR_MANIFEST_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write manifest output file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirManifestLoop(osal_id_t DirId, osal_id_t FileHandle, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *           CmdText                   = "Directory Manifest";
+    bool                   ReadingDirectory          = true;
+    bool                   CommandResult             = true;
+    bool                   EntryComplete             = false;
+    bool                   StatsUpdated              = false;
+    size_t                 EntryLength               = 0;
+    size_t                 PathLength                = 0;
+    int32                  BytesWritten              = 0;
+    int32                  WriteStatus               = OS_SUCCESS;
+    int32                  LoopCount                 = 0;
+    int32                  Status                    = 0;
+    char                   TempName[OS_MAX_PATH_LEN] = "\0";
+    FM_DirManifestStats_t *StatsPtr                  = &FM_GlobalData.DirManifestStats;
+    os_dirent_t            DirEntry;
+    FM_DirManifestEntry_t  ManifestEntry;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    PathLength = OS_strnlen(CmdArgs->Source2, OS_MAX_PATH_LEN);
+
+    /* Until end of directory entries or output file write error */
+    while ((CommandResult == true) && (ReadingDirectory == true))
+    {
+        Status = OS_DirectoryRead(DirId, &DirEntry);
+
+        /* Normal loop end - no more directory entries */
+        if (Status != OS_SUCCESS)
+        {
+            ReadingDirectory = false;
+        }
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            /* Do not count the "." and ".." files */
+            StatsPtr->DirEntries++;
+            EntryComplete = false;
+
+            EntryLength = OS_strnlen(OS_DIRENTRY_NAME(DirEntry), OS_MAX_FILE_NAME);
+
+            if ((PathLength + EntryLength) < sizeof(TempName))
+            {
+                /* Build qualified directory entry name */
+                memcpy(TempName, CmdArgs->Source2, PathLength);
+                memcpy(&TempName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
+                TempName[PathLength + EntryLength] = '\0';
+
+                memset(&ManifestEntry, 0, sizeof(ManifestEntry));
+                strncpy(ManifestEntry.EntryName, OS_DIRENTRY_NAME(DirEntry), sizeof(ManifestEntry.EntryName) - 1);
+
+                EntryComplete = FM_ChildDirManifestEntry(TempName, CmdArgs->FileInfoCRC, &ManifestEntry, &LoopCount);
+            }
+
+            if (EntryComplete == true)
+            {
+                /* Collect manifest entry in the write buffer */
+                CommandResult = FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, &ManifestEntry, sizeof(ManifestEntry));
+
+                if (CommandResult == true)
+                {
+                    StatsPtr->FileEntries++;
+                }
+            }
+            else
+            {
+                /* Subdirectory, open file, unreadable file or name too long */
+                StatsPtr->SkippedEntries++;
+            }
+
+            /* Avoid CPU hogging when the directory holds many small files */
+            LoopCount++;
+            if (LoopCount >= FM_CHILD_FILE_LOOP_COUNT)
+            {
+                /* Give up the CPU */
+                CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+                OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
+                CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+                LoopCount = 0;
+            }
+        }
+    }
+
+    /* A short manifest is still in the buffer with its placeholder */
+    if ((CommandResult == true) && (StatsPtr->DirEntries != 0))
+    {
+        StatsUpdated = FM_ChildWriterUpdate(&FM_GlobalData.ChildWriter, 0, StatsPtr, sizeof(FM_DirManifestStats_t));
+    }
+
+    /* Write any buffered entries to the output file */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_ChildWriterFlush(&FM_GlobalData.ChildWriter);
+    }
+
+    WriteStatus = FM_GlobalData.ChildWriter.Status;
+
+    /* Update manifest statistics in output file */
+    if ((CommandResult == true) && (StatsPtr->DirEntries != 0) && (StatsUpdated == false))
+    {
+        /* Back up to the start of the statistics data */
+        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+        /* Write an updated version of the statistics data */
+        BytesWritten = OS_write(FileHandle, StatsPtr, sizeof(FM_DirManifestStats_t));
+
+        if (BytesWritten != sizeof(FM_DirManifestStats_t))
+        {
+            CommandResult = false;
+            WriteStatus   = BytesWritten;
+        }
+    }
+
+    if (CommandResult == false)
+    {
+        FM_GlobalData.ChildCmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DIR_MANIFEST_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_write failed: result = %d, file = %s", CmdText, (int)WriteStatus,
+                          CmdArgs->Target);
+    }
+    else
+    {
+        if (StatsPtr->SkippedEntries != 0)
+        {
+            FM_GlobalData.ChildCmdWarnCounter++;
+
+            /* Send command warning event (info) */
+            CFE_EVS_SendEvent(FM_DIR_MANIFEST_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: skipped %d entries that are not readable closed files: dir = %s", CmdText,
+                              (int)StatsPtr->SkippedEntries, CmdArgs->Source1);
+        }
+
+        FM_GlobalData.ChildCmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DIR_MANIFEST_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: wrote %d of %d entries: dir = %s, filename = %s", CmdText,
+                          (int)StatsPtr->FileEntries, (int)StatsPtr->DirEntries, CmdArgs->Source1, CmdArgs->Target);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- compute manifest entry digest */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirManifestEntry(const char *Filename, uint32 TypeCRC, FM_DirManifestEntry_t *EntryPtr,
+                              int32 *LoopCountPtr)
+{
+    bool               EntryComplete = false;
+    bool               GettingCRC    = false;
+    uint32             FileMode      = 0;
+    int32              BytesRead     = 0;
+    int32              Status        = 0;
+    osal_id_t          FileHandle    = OS_OBJECT_ID_UNDEFINED;
+    FM_DigestContext_t Digest;
+
+    /* Only closed files are included, FileInfoCmd is false so the main task stat data is unchanged */
+    if (FM_GetFilenameState(Filename, OS_MAX_PATH_LEN, false) == FM_NAME_IS_FILE_CLOSED)
+    {
+        Status = FM_ChildSizeTimeMode(Filename, &EntryPtr->EntrySize, &EntryPtr->ModifyTime, &FileMode);
+
+        if (Status != OS_SUCCESS)
+        {
+            /* File was removed after the directory was read */
+            EntryComplete = false;
+        }
+        else if (FM_DigestCacheLookup(Filename, EntryPtr->EntrySize, EntryPtr->ModifyTime, TypeCRC, &EntryPtr->CRC,
+                                      EntryPtr->Digest, &EntryPtr->DigestSize) == true)
+        {
+            /* File is unchanged since the digest was last computed */
+            EntryComplete = true;
+        }
+        else
+        {
+            Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+            if (Status == OS_SUCCESS)
+            {
+                FM_DigestInit(&Digest, TypeCRC);
+                GettingCRC = true;
+            }
+        }
+
+        while (GettingCRC == true)
+        {
+            BytesRead = OS_read(FileHandle, FM_GlobalData.ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE);
+
+            if (BytesRead == 0)
+            {
+                /* Finished reading file */
+                GettingCRC = false;
+                OS_close(FileHandle);
+
+                EntryPtr->CRC = FM_DigestFinal(&Digest, EntryPtr->Digest, &EntryPtr->DigestSize);
+                EntryComplete = true;
+
+                /* Remember the result for the next manifest or Get File Info command */
+                FM_DigestCacheStore(Filename, EntryPtr->EntrySize, EntryPtr->ModifyTime, TypeCRC, EntryPtr->CRC,
+                                    EntryPtr->Digest, EntryPtr->DigestSize);
+            }
+            else if (BytesRead < 0)
+            {
+                /* Error reading file */
+                GettingCRC = false;
+                OS_close(FileHandle);
+            }
+            else
+            {
+                /* Continue digest calculation */
+                FM_DigestUpdate(&Digest, FM_GlobalData.ChildBuffer, BytesRead);
+
+                /* Avoid CPU hogging */
+                (*LoopCountPtr)++;
+                if (*LoopCountPtr >= FM_CHILD_FILE_LOOP_COUNT)
+                {
+                    /* Give up the CPU */
+                    CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+                    OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
+                    CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+                    *LoopCountPtr = 0;
+                }
+            }
+        }
+    }
+
+    return EntryComplete;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- add entry to dir list packet  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListPktEntry(const FM_ChildQueueEntry_t *CmdArgs, const char *EntryName,
+                             FM_DirListPkt_Payload_t *ReportPtr, int32 *FilesTillSleep)
+{
+    const char *       CmdText                      = "Directory List to Packet";
+    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
+    FM_DirListEntry_t *ListEntry                    = NULL;
+    size_t             PathLength                   = 0;
+    size_t             EntryLength                  = 0;
+
+    PathLength  = OS_strnlen(CmdArgs->Source2, OS_MAX_PATH_LEN);
+    EntryLength = OS_strnlen(EntryName, OS_MAX_FILE_NAME);
+
+    /* Create a shorthand access to the packet list entry */
+    ListEntry = &ReportPtr->FileList[ReportPtr->PacketFiles];
+
+    /* Verify combined directory plus filename length */
+    if ((PathLength + EntryLength) < sizeof(LogicalName))
+    {
+        /* Add filename to directory listing telemetry packet */
+        snprintf(ListEntry->EntryName, sizeof(ListEntry->EntryName), "%s", EntryName);
+
+        /* Build filename - Directory already has path separator */
+        memcpy(LogicalName, CmdArgs->Source2, PathLength);
+        memcpy(&LogicalName[PathLength], EntryName, EntryLength);
+        LogicalName[PathLength + EntryLength] = '\0';
+
+        FM_ChildSleepStat(LogicalName, ListEntry, FilesTillSleep, CmdArgs->GetSizeTimeMode);
+
+        /* Add another entry to the telemetry packet */
+        ReportPtr->PacketFiles++;
+    }
+    else
+    {
+        FM_GlobalData.ChildCmdWarnCounter++;
+
+        /* Send command warning event (info) */
+        CFE_EVS_SendEvent(FM_GET_DIR_PKT_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText, CmdArgs->Source2,
+                          EntryName);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- send streamed dir list packet */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListPktNext(FM_DirListPkt_Payload_t *ReportPtr, uint32 NextEntry)
+{
+    /* Timestamp and send the full directory listing telemetry packet */
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader), true);
+
+    /* Keep the stream within its packet rate */
+    CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+    OS_TaskDelay(1000 / FM_DIR_LIST_PKT_STREAM_RATE);
+    CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+
+    /* The next packet starts with the next entry */
+    memset(ReportPtr->FileList, 0, sizeof(ReportPtr->FileList));
+    ReportPtr->FirstFile   = NextEntry;
+    ReportPtr->PacketFiles = 0;
+    ReportPtr->PacketSequence++;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- keep dir list cursor          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListCursorOpen(osal_id_t DirId, const char *Directory, uint32 DirTime, uint32 TotalFiles)
+{
+    FM_DirListCursor_t *CursorPtr = &FM_GlobalData.DirListCursor;
+    OS_time_t           LocalTime;
+
+    memset(&LocalTime, 0, sizeof(LocalTime));
+
+    /* Counting the entries read the whole directory, the next packet starts from the beginning */
+    OS_DirectoryRewind(DirId);
+
+    OS_GetLocalTime(&LocalTime);
+
+    CursorPtr->DirId      = DirId;
+    CursorPtr->DirTime    = DirTime;
+    CursorPtr->OpenTime   = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+    CursorPtr->NextEntry  = 0;
+    CursorPtr->TotalFiles = TotalFiles;
+
+    snprintf(CursorPtr->DirName, sizeof(CursorPtr->DirName), "%s", Directory);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- release dir list cursor       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListCursorClose(void)
+{
+    FM_DirListCursor_t *CursorPtr = &FM_GlobalData.DirListCursor;
+
+    if (CursorPtr->DirName[0] != '\0')
+    {
+        OS_DirectoryClose(CursorPtr->DirId);
+
+        CursorPtr->DirName[0] = '\0';
+        CursorPtr->DirId      = OS_OBJECT_ID_UNDEFINED;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- expire dir list cursor        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildDirListCursorExpire(void)
+{
+    FM_DirListCursor_t *CursorPtr = &FM_GlobalData.DirListCursor;
+    uint32              WaitTime  = 0;
+    uint32              Now       = 0;
+    OS_time_t           LocalTime;
+
+    memset(&LocalTime, 0, sizeof(LocalTime));
+
+    if (CursorPtr->DirName[0] != '\0')
+    {
+        OS_GetLocalTime(&LocalTime);
+        Now = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+
+        if ((Now >= CursorPtr->OpenTime) && ((Now - CursorPtr->OpenTime) < FM_DIR_LIST_CURSOR_TTL))
+        {
+            WaitTime = (FM_DIR_LIST_CURSOR_TTL - (Now - CursorPtr->OpenTime)) * 1000;
+        }
+        else
+        {
+            /* Ground did not ask for the next page in time, give the directory handle back */
+            FM_ChildDirListCursorClose();
+        }
+    }
+
+    return WaitTime;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- check dir list cursor         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListCursorValid(const char *Directory)
+{
+    FM_DirListCursor_t *CursorPtr = &FM_GlobalData.DirListCursor;
+    bool                Valid     = false;
+    uint32              DirSize   = 0;
+    uint32              DirTime   = 0;
+    uint32              DirMode   = 0;
+    uint32              Now       = 0;
+    OS_time_t           LocalTime;
+
+    memset(&LocalTime, 0, sizeof(LocalTime));
+
+    if ((CursorPtr->DirName[0] != '\0') && (strncmp(CursorPtr->DirName, Directory, sizeof(CursorPtr->DirName)) == 0))
+    {
+        OS_GetLocalTime(&LocalTime);
+        Now = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+
+        /* Cursor expires after the configured time, or if the clock goes backwards */
+        if ((Now >= CursorPtr->OpenTime) && ((Now - CursorPtr->OpenTime) < FM_DIR_LIST_CURSOR_TTL))
+        {
+            /* Adding, removing or renaming an entry changes the directory modify time */
+            if ((FM_ChildSizeTimeMode(Directory, &DirSize, &DirTime, &DirMode) == OS_SUCCESS) &&
+                (DirTime == CursorPtr->DirTime))
+            {
+                Valid = true;
+            }
+        }
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- match entry name to pattern   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPatternMatch(const char *Pattern, const char *Name)
+{
+    const char *StarPattern = NULL;
+    const char *StarName    = NULL;
+    bool        Mismatch    = false;
+
+    /* An empty pattern selects every entry */
+    if (Pattern[0] != '\0')
+    {
+        while ((*Name != '\0') && (Mismatch == false))
+        {
+            if (*Pattern == '*')
+            {
+                /* Remember the star, it first matches no characters */
+                Pattern++;
+                StarPattern = Pattern;
+                StarName    = Name;
+            }
+            else if ((*Pattern == '?') || (*Pattern == *Name))
+            {
+                Pattern++;
+                Name++;
+            }
+            else if (StarPattern != NULL)
+            {
+                /* Let the most recent star match one more character and retry */
+                StarName++;
+                Pattern = StarPattern;
+                Name    = StarName;
+            }
+            else
+            {
+                Mismatch = true;
+            }
+        }
+
+        /* Trailing stars match the empty rest of the name */
+        while (*Pattern == '*')
+        {
+            Pattern++;
+        }
+
+        if (*Pattern != '\0')
+        {
+            Mismatch = true;
+        }
+    }
+
+    return (Mismatch == false);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- compare dir list entry order  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListBefore(const FM_DirListEntry_t *Entry1, const FM_DirListEntry_t *Entry2, uint8 SortKey,
+                           uint8 SortDirection)
+{
+    int32 Order = 0;
+
+    if (SortKey == FM_SORT_BY_TIME)
+    {
+        Order = (Entry1->ModifyTime > Entry2->ModifyTime) - (Entry1->ModifyTime < Entry2->ModifyTime);
+    }
+    else if (SortKey == FM_SORT_BY_SIZE)
+    {
+        Order = (Entry1->EntrySize > Entry2->EntrySize) - (Entry1->EntrySize < Entry2->EntrySize);
+    }
+
+    /* Equal keys are ordered by name so the listing does not depend on directory order */
+    if (Order == 0)
+    {
+        Order = strcmp(Entry1->EntryName, Entry2->EntryName);
+    }
+
+    if (SortDirection == FM_SORT_DESCENDING)
+    {
+        Order = -Order;
+    }
+
+    return (Order < 0);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- restore dir list heap order   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_ChildDirListHeapSift(FM_DirListEntry_t *Heap, uint32 Index, uint32 HeapCount, uint8 SortKey,
+                                    uint8 SortDirection)
+{
+    FM_DirListEntry_t Temp;
+    uint32            Last  = Index;
+    uint32            Child = 0;
+    bool              Done  = false;
+
+    /* Move the entry down until no child is listed after it */
+    while (Done == false)
+    {
+        Child = (2 * Index) + 1;
+
+        if ((Child < HeapCount) && (FM_ChildDirListBefore(&Heap[Last], &Heap[Child], SortKey, SortDirection) == true))
+        {
+            Last = Child;
+        }
+
+        Child++;
+
+        if ((Child < HeapCount) && (FM_ChildDirListBefore(&Heap[Last], &Heap[Child], SortKey, SortDirection) == true))
+        {
+            Last = Child;
+        }
+
+        if (Last == Index)
+        {
+            Done = true;
+        }
+        else
+        {
+            Temp        = Heap[Index];
+            Heap[Index] = Heap[Last];
+            Heap[Last]  = Temp;
+            Index       = Last;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- add entry to dir list heap    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListHeapAdd(FM_DirListEntry_t *Heap, uint32 *HeapCount, uint32 HeapLimit,
+                            const FM_DirListEntry_t *Entry, uint8 SortKey, uint8 SortDirection)
+{
+    FM_DirListEntry_t Temp;
+    uint32            Index  = 0;
+    uint32            Parent = 0;
+
+    if (*HeapCount < HeapLimit)
+    {
+        /* Add the entry at the bottom and move it up past every parent listed before it */
+        Index       = *HeapCount;
+        Heap[Index] = *Entry;
+        (*HeapCount)++;
+
+        while (Index > 0)
+        {
+            Parent = (Index - 1) / 2;
+
+            if (FM_ChildDirListBefore(&Heap[Parent], &Heap[Index], SortKey, SortDirection) == true)
+            {
+                Temp         = Heap[Index];
+                Heap[Index]  = Heap[Parent];
+                Heap[Parent] = Temp;
+                Index        = Parent;
+            }
+            else
+            {
+                Index = 0;
+            }
+        }
+    }
+    else if ((HeapLimit > 0) && (FM_ChildDirListBefore(Entry, &Heap[0], SortKey, SortDirection) == true))
+    {
+        /* Heap is full - the entry replaces the one that would be listed last */
+        Heap[0] = *Entry;
+        FM_ChildDirListHeapSift(Heap, 0, *HeapCount, SortKey, SortDirection);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- sort dir list heap            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListHeapSort(FM_DirListEntry_t *Heap, uint32 HeapCount, uint8 SortKey, uint8 SortDirection)
+{
+    FM_DirListEntry_t Temp;
+    uint32            Last = HeapCount;
+
+    /* Move the entry listed last to the end, then restore the heap for the rest */
+    while (Last > 1)
+    {
+        Last--;
+
+        Temp       = Heap[0];
+        Heap[0]    = Heap[Last];
+        Heap[Last] = Temp;
+
+        FM_ChildDirListHeapSift(Heap, 0, Last, SortKey, SortDirection);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- compare file contents         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCompareFilesLoop(osal_id_t FileHandle1, osal_id_t FileHandle2, const FM_ChildQueueEntry_t *CmdArgs,
+                              FM_CompareFilesPkt_Payload_t *ReportPtr)
+{
+    const char * CmdText           = "Compare Files";
+    bool         CompareInProgress = true;
+    bool         CompareComplete   = false;
+    int32        LoopCount         = 0;
+    int32        BytesRead1        = 0;
+    int32        BytesRead2        = 0;
+    int32        BytesCompared     = 0;
+    uint32       FileOffset        = 0;
+    uint32       BlockOffset       = 0;
+    const uint8 *Buffer1           = (const uint8 *)FM_GlobalData.ChildCompareBuffer[0];
+    const uint8 *Buffer2           = (const uint8 *)FM_GlobalData.ChildCompareBuffer[1];
+
+    while (CompareInProgress)
+    {
+        BytesRead1 = FM_ChildCompareFilesRead(FileHandle1, FM_GlobalData.ChildCompareBuffer[0]);
+        BytesRead2 = FM_ChildCompareFilesRead(FileHandle2, FM_GlobalData.ChildCompareBuffer[1]);
+
+        /* Full blocks are only shorter at the end of a file, compare what both files have */
+        BytesCompared = (BytesRead1 < BytesRead2) ? BytesRead1 : BytesRead2;
+
+        if ((BytesRead1 < 0) || (BytesRead2 < 0))
+        {
+            CompareInProgress = false;
+            FM_GlobalData.ChildCmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_COMPARE_FILES_OSRD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_read failed: result1 = %d, result2 = %d, offset = %u, src1 = %s", CmdText,
+                              (int)BytesRead1, (int)BytesRead2, (unsigned int)FileOffset, CmdArgs->Source1);
+        }
+        else if (memcmp(Buffer1, Buffer2, BytesCompared) != 0)
+        {
+            /* Only the block that differs is searched byte by byte */
+            BlockOffset = 0;
+            while (Buffer1[BlockOffset] == Buffer2[BlockOffset])
+            {
+                BlockOffset++;
+            }
+
+            CompareInProgress          = false;
+            CompareComplete            = true;
+            ReportPtr->Result          = FM_COMPARE_DATA_DIFFERS;
+            ReportPtr->FirstDiffOffset = FileOffset + BlockOffset;
+        }
+        else if (BytesRead1 != BytesRead2)
+        {
+            /* One file ended before the other, a file changed size after it was stat'ed */
+            CompareInProgress = false;
+            CompareComplete   = true;
+            ReportPtr->Result = FM_COMPARE_SIZE_DIFFERS;
+        }
+        else if (BytesRead1 == 0)
+        {
+            /* Reached the end of both files without finding a difference */
+            CompareInProgress = false;
+            CompareComplete   = true;
+            ReportPtr->Result = FM_COMPARE_IDENTICAL;
+        }
+        else
+        {
+            FileOffset += BytesRead1;
+
+            /* Avoid CPU hogging */
+            LoopCount++;
+            if (LoopCount == FM_CHILD_FILE_LOOP_COUNT)
+            {
+                /* Give up the CPU */
+                CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+                OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
+                CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+                LoopCount = 0;
+            }
+        }
+    }
+
+    return CompareComplete;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read one compare block        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildCompareFilesRead(osal_id_t FileHandle, char *Buffer)
+{
+    int32 BytesRead  = 0;
+    int32 BlockBytes = 0;
+
+    /* A read may return less than asked for before the end of the file, keep reading until the block is full */
+    do
+    {
+        BytesRead = OS_read(FileHandle, &Buffer[BlockBytes], FM_CHILD_COMPARE_BLOCK_SIZE - BlockBytes);
+
+        if (BytesRead > 0)
+        {
+            BlockBytes += BytesRead;
+        }
+    } while ((BytesRead > 0) && (BlockBytes < FM_CHILD_COMPARE_BLOCK_SIZE));
+
+    if (BytesRead < 0)
+    {
+        BlockBytes = BytesRead;
+    }
+
+    return BlockBytes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- start buffered file writer    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildWriterInit(FM_ChildWriter_t *WriterPtr, osal_id_t FileHandle)
+{
+    WriterPtr->FileHandle = FileHandle;
+    WriterPtr->Status     = OS_SUCCESS;
+    WriterPtr->Written    = 0;
+    WriterPtr->Length     = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- add record to buffered writer */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildWriterWrite(FM_ChildWriter_t *WriterPtr, const void *DataPtr, size_t DataLength)
+{
+    int32 BytesWritten = 0;
+
+    /* Make room for the record */
+    if ((WriterPtr->Length + DataLength) > sizeof(WriterPtr->Buffer))
+    {
+        FM_ChildWriterFlush(WriterPtr);
+    }
+
+    if (WriterPtr->Status == OS_SUCCESS)
+    {
+        if (DataLength > sizeof(WriterPtr->Buffer))
+        {
+            /* Record will never fit in the buffer */
+            BytesWritten = OS_write(WriterPtr->FileHandle, DataPtr, DataLength);
+
+            if (BytesWritten != DataLength)
+            {
+                WriterPtr->Status = (BytesWritten < 0) ? BytesWritten : OS_ERROR;
+            }
+            else
+            {
+                WriterPtr->Written += DataLength;
+            }
+        }
+        else
+        {
+            memcpy(&WriterPtr->Buffer[WriterPtr->Length], DataPtr, DataLength);
+            WriterPtr->Length += DataLength;
+        }
+    }
+
+    return (WriterPtr->Status == OS_SUCCESS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write buffered writer data    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildWriterFlush(FM_ChildWriter_t *WriterPtr)
+{
+    int32 BytesWritten = 0;
+
+    if ((WriterPtr->Status == OS_SUCCESS) && (WriterPtr->Length != 0))
+    {
+        BytesWritten = OS_write(WriterPtr->FileHandle, WriterPtr->Buffer, WriterPtr->Length);
+
+        if (BytesWritten != WriterPtr->Length)
+        {
+            /* Keep the OS error code, a short write has no error code of its own */
+            WriterPtr->Status = (BytesWritten < 0) ? BytesWritten : OS_ERROR;
+        }
+        else
+        {
+            WriterPtr->Written += WriterPtr->Length;
+        }
+    }
+
+    /* Buffered data is discarded after a write failure */
+    WriterPtr->Length = 0;
+
+    return (WriterPtr->Status == OS_SUCCESS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- replace buffered writer data  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildWriterUpdate(FM_ChildWriter_t *WriterPtr, size_t Offset, const void *DataPtr, size_t DataLength)
+{
+    bool Updated = false;
+
+    /* Only data that is still in the buffer can be replaced */
+    if ((WriterPtr->Status == OS_SUCCESS) && (Offset >= WriterPtr->Written) &&
+        ((Offset - WriterPtr->Written + DataLength) <= WriterPtr->Length))
+    {
+        memcpy(&WriterPtr->Buffer[Offset - WriterPtr->Written], DataPtr, DataLength);
+        Updated = true;
+    }
+
+    return Updated;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- store compact integer value   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static size_t FM_ChildPutVarint(uint8 *Buffer, uint32 Value)
+{
+    size_t Length = 0;
+
+    /* Seven bits per byte, high bit set when more bytes follow */
+    while (Value >= 0x80)
+    {
+        Buffer[Length] = (uint8)((Value & 0x7F) | 0x80);
+        Value >>= 7;
+        Length++;
+    }
+
+    Buffer[Length] = (uint8)Value;
+    Length++;
+
+    return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- encode compact dir list entry */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+size_t FM_ChildDirListCompactEntry(uint8 *Buffer, const FM_DirListEntry_t *EntryPtr, uint32 *LastTimePtr)
+{
+    size_t NameLength = OS_strnlen(EntryPtr->EntryName, OS_MAX_PATH_LEN - 1);
+    size_t Length     = 0;
+    uint32 TimeDiff   = EntryPtr->ModifyTime - *LastTimePtr;
+    uint32 ZigZag     = TimeDiff << 1;
+
+    /* Fold the sign into the low bit so small negative differences stay short */
+    if ((TimeDiff & 0x80000000) != 0)
+    {
+        ZigZag = ~ZigZag;
+    }
+
+    /* A varint length keeps one byte for names under 128 bytes, and any OS_MAX_PATH_LEN is supported */
+    Length += FM_ChildPutVarint(&Buffer[Length], (uint32)NameLength);
+    memcpy(&Buffer[Length], EntryPtr->EntryName, NameLength);
+    Length += NameLength;
+
+    Length += FM_ChildPutVarint(&Buffer[Length], EntryPtr->EntrySize);
+    Length += FM_ChildPutVarint(&Buffer[Length], ZigZag);
+    Length += FM_ChildPutVarint(&Buffer[Length], EntryPtr->Mode);
+
+    *LastTimePtr = EntryPtr->ModifyTime;
+
+    return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- get dir entry size and time   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode)
+{
+    int32      Result = OS_SUCCESS;
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
+    Result = OS_stat(Filename, &FileStatus);
+
+    if (Result != OS_SUCCESS)
+    {
+        *FileSize = 0;
+        *FileTime = 0;
+        *FileMode = 0;
+    }
+    else
+    {
+        *FileTime = OS_FILESTAT_TIME(FileStatus);
+        *FileSize = OS_FILESTAT_SIZE(FileStatus);
+        *FileMode = OS_FILESTAT_MODE(FileStatus);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- count down to stat sleep      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_ChildStatThrottle(int32 *FilesTillSleep)
+{
+    if (*FilesTillSleep <= 0)
+    {
+        CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+        OS_TaskDelay(FM_CHILD_STAT_SLEEP_MS);
+        CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+        *FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    }
+
+    (*FilesTillSleep)--;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- sleep between OS_stat on files*/
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
+                        bool getSizeTimeMode)
+{
+    int32 Result = OS_SUCCESS;
+
+    /* Check if command requested size and time */
+    if (getSizeTimeMode == true)
+    {
+        FM_ChildStatThrottle(FilesTillSleep);
+
+        /* Get file size, date, and mode */
+        Result = FM_ChildSizeTimeMode(Filename, &(DirListData->EntrySize), &(DirListData->ModifyTime),
+                                      &(DirListData->Mode));
+    }
+    else
+    {
+        DirListData->EntrySize  = 0;
+        DirListData->ModifyTime = 0;
+        DirListData->Mode       = 0;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- open directory scan           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildScanOpen(FM_ChildScan_t *ScanPtr, const char *Directory, const char *DirWithSep)
+{
+    int32 Status = OS_ERROR;
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    char LocalPath[OS_MAX_LOCAL_PATH_LEN];
+#endif
+
+    memset(ScanPtr, 0, sizeof(*ScanPtr));
+    ScanPtr->DirId = OS_OBJECT_ID_UNDEFINED;
+
+    /* Each entry name is placed after the directory name and separator */
+    snprintf(ScanPtr->Path, sizeof(ScanPtr->Path), "%s", DirWithSep);
+    ScanPtr->PathLength = OS_strnlen(ScanPtr->Path, sizeof(ScanPtr->Path));
+
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    if (OS_TranslatePath(Directory, LocalPath) == OS_SUCCESS)
+    {
+        ScanPtr->NativeDir = opendir(LocalPath);
+    }
+
+    if (ScanPtr->NativeDir != NULL)
+    {
+        Status = OS_SUCCESS;
+    }
+    else
+#endif
+    {
+        Status = OS_DirectoryOpen(&ScanPtr->DirId, Directory);
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read directory scan entry     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildScanRead(FM_ChildScan_t *ScanPtr)
+{
+    int32  Status      = OS_SUCCESS;
+    bool   NameValid   = true;
+    size_t EntryLength = 0;
+    char * EntryName   = OS_DIRENTRY_NAME(ScanPtr->DirEntry);
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    struct dirent *NativeEntry;
+#endif
+
+    do
+    {
+        ScanPtr->EntryType = FM_CHILD_SCAN_TYPE_UNKNOWN;
+
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+        if (ScanPtr->NativeDir != NULL)
+        {
+            NativeEntry = readdir((DIR *)ScanPtr->NativeDir);
+
+            if (NativeEntry == NULL)
+            {
+                Status = OS_ERROR;
+            }
+            else
+            {
+                /* The entry type saves a stat on file systems that report it */
+                if (NativeEntry->d_type == DT_DIR)
+                {
+                    ScanPtr->EntryType = FM_CHILD_SCAN_TYPE_DIR;
+                }
+                else if (NativeEntry->d_type == DT_REG)
+                {
+                    ScanPtr->EntryType = FM_CHILD_SCAN_TYPE_FILE;
+                }
+
+                EntryLength = OS_strnlen(NativeEntry->d_name, sizeof(NativeEntry->d_name));
+                NameValid   = (EntryLength < sizeof(OS_DIRENTRY_NAME(ScanPtr->DirEntry)));
+
+                snprintf(EntryName, sizeof(OS_DIRENTRY_NAME(ScanPtr->DirEntry)), "%s", NativeEntry->d_name);
+            }
+        }
+        else
+#endif
+        {
+            Status = OS_DirectoryRead(ScanPtr->DirId, &ScanPtr->DirEntry);
+        }
+
+        /* Ignore the "." and ".." directory entries */
+    } while ((Status == OS_SUCCESS) &&
+             ((strcmp(EntryName, FM_THIS_DIRECTORY) == 0) || (strcmp(EntryName, FM_PARENT_DIRECTORY) == 0)));
+
+    if (Status == OS_SUCCESS)
+    {
+        EntryLength = OS_strnlen(EntryName, OS_MAX_FILE_NAME);
+
+        /* Verify combined directory plus filename length */
+        ScanPtr->PathValid = (NameValid == true) && ((ScanPtr->PathLength + EntryLength) < sizeof(ScanPtr->Path));
+
+        if (ScanPtr->PathValid == true)
+        {
+            memcpy(&ScanPtr->Path[ScanPtr->PathLength], EntryName, EntryLength);
+            ScanPtr->Path[ScanPtr->PathLength + EntryLength] = '\0';
+        }
+        else
+        {
+            ScanPtr->Path[ScanPtr->PathLength] = '\0';
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- stat directory scan entry     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildScanStat(FM_ChildScan_t *ScanPtr, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep)
+{
+    int32 Status = OS_SUCCESS;
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    struct stat NativeStatus;
+#endif
+
+    if (ScanPtr->PathValid == false)
+    {
+        DirListData->EntrySize  = 0;
+        DirListData->ModifyTime = 0;
+        DirListData->Mode       = 0;
+
+        Status = OS_ERR_NAME_TOO_LONG;
+    }
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    else if (ScanPtr->NativeDir != NULL)
+    {
+        FM_ChildStatThrottle(FilesTillSleep);
+
+        /* Look the entry up relative to the open directory instead of by full path */
+        if (fstatat(dirfd((DIR *)ScanPtr->NativeDir), OS_DIRENTRY_NAME(ScanPtr->DirEntry), &NativeStatus, 0) != 0)
+        {
+            DirListData->EntrySize  = 0;
+            DirListData->ModifyTime = 0;
+            DirListData->Mode       = 0;
+
+            Status = OS_ERROR;
+        }
+        else
+        {
+            DirListData->EntrySize  = (uint32)NativeStatus.st_size;
+            DirListData->ModifyTime = (uint32)NativeStatus.st_mtime;
+            DirListData->Mode       = 0;
+
+            if (S_ISDIR(NativeStatus.st_mode))
+            {
+                DirListData->Mode |= OS_FILESTAT_MODE_DIR;
+            }
+            if ((NativeStatus.st_mode & S_IRUSR) != 0)
+            {
+                DirListData->Mode |= OS_FILESTAT_MODE_READ;
+            }
+            if ((NativeStatus.st_mode & S_IWUSR) != 0)
+            {
+                DirListData->Mode |= OS_FILESTAT_MODE_WRITE;
+            }
+            if ((NativeStatus.st_mode & S_IXUSR) != 0)
+            {
+                DirListData->Mode |= OS_FILESTAT_MODE_EXEC;
+            }
+        }
+    }
+#endif
+    else
+    {
+        Status = FM_ChildSleepStat(ScanPtr->Path, DirListData, FilesTillSleep, true);
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- directory scan entry state    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildScanState(FM_ChildScan_t *ScanPtr, const FM_OpenFileSet_t *SetPtr)
+{
+    uint32 FilenameState = FM_NAME_IS_INVALID;
+    bool   FileIsOpen    = false;
+
+    if (ScanPtr->PathValid == false)
+    {
+        FilenameState = FM_NAME_IS_INVALID;
+    }
+    else if (ScanPtr->EntryType == FM_CHILD_SCAN_TYPE_DIR)
+    {
+        FilenameState = FM_NAME_IS_DIRECTORY;
+    }
+    else if (ScanPtr->EntryType == FM_CHILD_SCAN_TYPE_FILE)
+    {
+        /* Entry type is known, only the open file check is left */
+        if (SetPtr != NULL)
+        {
+            FileIsOpen = FM_OpenFileSetFind(SetPtr, ScanPtr->Path);
+        }
+        else
+        {
+            FileIsOpen = FM_IsFileOpen(ScanPtr->Path);
+        }
+
+        if (FileIsOpen == true)
+        {
+            FilenameState = FM_NAME_IS_FILE_OPEN;
+        }
+        else
+        {
+            FilenameState = FM_NAME_IS_FILE_CLOSED;
+        }
+    }
+    else
+    {
+        FilenameState = FM_GetBatchFilenameState(ScanPtr->Path, OS_MAX_PATH_LEN, SetPtr);
+    }
+
+    return FilenameState;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- rewind directory scan         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildScanRewind(FM_ChildScan_t *ScanPtr)
+{
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    if (ScanPtr->NativeDir != NULL)
+    {
+        rewinddir((DIR *)ScanPtr->NativeDir);
+    }
+    else
+#endif
+    {
+        OS_DirectoryRewind(ScanPtr->DirId);
+    }
+}
 
-    /* Create directory listing output file */
-    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- close directory scan          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    if (Status == OS_SUCCESS)
+void FM_ChildScanClose(FM_ChildScan_t *ScanPtr)
+{
+#ifdef FM_CHILD_HAVE_NATIVE_SCAN
+    if (ScanPtr->NativeDir != NULL)
     {
-        /* Write the standard CFE file header */
-        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
-        if (BytesWritten == sizeof(CFE_FS_Header_t))
-        {
-            /* Initialize directory statistics structure */
-            memset(&FM_GlobalData.DirListFileStats, 0, sizeof(FM_GlobalData.DirListFileStats));
-            strncpy(FM_GlobalData.DirListFileStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
-            FM_GlobalData.DirListFileStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+        closedir((DIR *)ScanPtr->NativeDir);
+        ScanPtr->NativeDir = NULL;
+    }
+    else
+#endif
+    {
+        OS_DirectoryClose(ScanPtr->DirId);
+        ScanPtr->DirId = OS_OBJECT_ID_UNDEFINED;
+    }
+}
 
-            /* Write blank FM directory statistics structure as a placeholder */
-            BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, sizeof(FM_DirListFileStats_t));
-            if (BytesWritten == sizeof(FM_DirListFileStats_t))
-            {
-                /* Return output file handle */
-                *FileHandlePtr = FileHandle;
-            }
-            else
-            {
-                CommandResult = false;
-                FM_GlobalData.ChildCmdErrCounter++;
+#if FM_DIR_TRACK_DIRS > 0
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- find tracked directory        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                /* Send command failure event (error) */
-                CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRBLANK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: OS_write blank stats failed: result = %d, expected = %u", CmdText,
-                                  (int)BytesWritten, (unsigned int)sizeof(FM_DirListFileStats_t));
-            }
+FM_DirTrack_t *FM_ChildDirTrackGet(const char *Directory)
+{
+    FM_DirTrack_t *TrackPtr = &FM_GlobalData.DirTrack[0];
+    bool           SameDir  = false;
+    OS_time_t      LocalTime;
+    uint32         i;
+
+    /* Use the record for this directory, else an unused record, else the least recently used */
+    for (i = 0; (i < FM_DIR_TRACK_DIRS) && (SameDir == false); i++)
+    {
+        if ((FM_GlobalData.DirTrack[i].DirName[0] != '\0') &&
+            (strncmp(FM_GlobalData.DirTrack[i].DirName, Directory, OS_MAX_PATH_LEN) == 0))
+        {
+            TrackPtr = &FM_GlobalData.DirTrack[i];
+            SameDir  = true;
         }
-        else
+        else if ((TrackPtr->DirName[0] != '\0') &&
+                 ((FM_GlobalData.DirTrack[i].DirName[0] == '\0') ||
+                  (FM_GlobalData.DirTrack[i].LastUsed < TrackPtr->LastUsed)))
         {
-            CommandResult = false;
-            FM_GlobalData.ChildCmdErrCounter++;
-
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRHDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
-                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+            TrackPtr = &FM_GlobalData.DirTrack[i];
         }
+    }
 
-        /* Close output file after write error */
-        if (CommandResult == false)
+    if (SameDir == false)
+    {
+        FM_ChildDirTrackRelease(TrackPtr);
+
+        snprintf(TrackPtr->DirName, sizeof(TrackPtr->DirName), "%s", Directory);
+
+        /* Starting from the clock keeps numbers from an earlier record of the directory from matching */
+        OS_GetLocalTime(&LocalTime);
+        TrackPtr->Sequence    = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+        TrackPtr->RemovedBase = TrackPtr->Sequence;
+    }
+
+    FM_GlobalData.DirTrackUseCount++;
+    TrackPtr->LastUsed = FM_GlobalData.DirTrackUseCount;
+
+    return TrackPtr;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- release tracked directory     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirTrackRelease(FM_DirTrack_t *TrackPtr)
+{
+#ifdef FM_CHILD_HAVE_DIR_WATCH
+    if ((TrackPtr->DirName[0] != '\0') && (TrackPtr->WatchFd >= 0))
+    {
+        close(TrackPtr->WatchFd);
+    }
+#endif
+
+    memset(TrackPtr, 0, sizeof(*TrackPtr));
+    TrackPtr->WatchFd = -1;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- check tracked dir for change  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirTrackChanged(FM_DirTrack_t *TrackPtr, const char *Directory)
+{
+    bool Changed = true;
+#ifdef FM_CHILD_HAVE_DIR_WATCH
+    char    LocalPath[OS_MAX_LOCAL_PATH_LEN];
+    char    EventBuffer[sizeof(struct inotify_event) + NAME_MAX + 1];
+    ssize_t ReadLength;
+
+    if (TrackPtr->WatchFd < 0)
+    {
+        /* The watch is added before the directory is read so no change in between is missed */
+        if (OS_TranslatePath(Directory, LocalPath) == OS_SUCCESS)
         {
-            OS_close(FileHandle);
+            TrackPtr->WatchFd = inotify_init1(IN_NONBLOCK);
+
+            if ((TrackPtr->WatchFd >= 0) &&
+                (inotify_add_watch(TrackPtr->WatchFd, LocalPath,
+                                   IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO |
+                                       IN_DELETE_SELF | IN_MOVE_SELF) < 0))
+            {
+                close(TrackPtr->WatchFd);
+                TrackPtr->WatchFd = -1;
+            }
         }
     }
     else
     {
-        CommandResult = false;
-        FM_GlobalData.ChildCmdErrCounter++;
+        /* Any event, including a queue overflow, means the directory must be read again */
+        Changed = false;
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+        do
+        {
+            ReadLength = read(TrackPtr->WatchFd, EventBuffer, sizeof(EventBuffer));
+
+            if (ReadLength > 0)
+            {
+                Changed = true;
+            }
+        } while (ReadLength > 0);
+
+        if ((ReadLength == 0) || (errno != EAGAIN))
+        {
+            Changed = true;
+        }
     }
+#else
+    /* Without a watch the directory is always read again */
+    (void)TrackPtr;
+    (void)Directory;
+#endif
 
-    return CommandResult;
+    return Changed;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- write to dir list output file */
+/* FM child task utility function -- order tracked entry names     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 getSizeTimeMode)
+static int FM_ChildDirTrackCompare(const void *Entry1, const void *Entry2)
 {
-    const char *      CmdText                   = "Directory List to File";
-    size_t            WriteLength               = sizeof(FM_DirListEntry_t);
-    bool              ReadingDirectory          = true;
-    bool              CommandResult             = true;
-    uint32            DirEntries                = 0;
-    uint32            FileEntries               = 0;
-    size_t            EntryLength               = 0;
-    size_t            PathLength                = 0;
-    int32             BytesWritten              = 0;
-    int32             FilesTillSleep            = FM_CHILD_STAT_SLEEP_FILECOUNT;
-    int32             Status                    = 0;
-    char              TempName[OS_MAX_PATH_LEN] = "\0";
-    os_dirent_t       DirEntry;
-    FM_DirListEntry_t DirListData;
+    return strncmp(((const FM_DirTrackEntry_t *)Entry1)->Name, ((const FM_DirTrackEntry_t *)Entry2)->Name,
+                   OS_MAX_FILE_NAME);
+}
 
-    memset(&DirEntry, 0, sizeof(DirEntry));
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- read tracked directory        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    PathLength = OS_strnlen(DirWithSep, OS_MAX_PATH_LEN);
+int32 FM_ChildDirTrackScan(FM_DirTrack_t *TrackPtr, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_DirTrackEntry_t *ScanList        = FM_GlobalData.DirTrackScan;
+    FM_DirTrackEntry_t *OldPtr          = NULL;
+    FM_DirTrackEntry_t *NewPtr          = NULL;
+    bool                StillProcessing = true;
+    bool                Changed         = false;
+    uint32              ScanCount       = 0;
+    uint32              OldIndex        = 0;
+    uint32              NewIndex        = 0;
+    uint32              NewSequence     = TrackPtr->Sequence + 1;
+    int32               FilesTillSleep  = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    int                 Compare         = 0;
+    FM_ChildScan_t      Scan;
+    FM_DirListEntry_t   DirListData;
+    int32               Status;
+
+    Status = FM_ChildScanOpen(&Scan, CmdArgs->Source1, CmdArgs->Source2);
 
-    /* Until end of directory entries or output file write error */
-    while ((CommandResult == true) && (ReadingDirectory == true))
+    if (Status == OS_SUCCESS)
     {
-        Status = OS_DirectoryRead(DirId, &DirEntry);
+        TrackPtr->UntrackedCount = 0;
 
-        /* Normal loop end - no more directory entries */
-        if (Status != OS_SUCCESS)
-        {
-            ReadingDirectory = false;
-        }
-        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        while (StillProcessing == true)
         {
-            /* Do not count the "." and ".." files */
-            DirEntries++;
-
-            /* Count all files - write limited number */
-            if (FileEntries < FM_DIR_LIST_FILE_ENTRIES)
+            if (FM_ChildScanRead(&Scan) != OS_SUCCESS)
+            {
+                /* Stop reading directory - no more entries */
+                StillProcessing = false;
+            }
+            else if ((ScanCount >= FM_DIR_TRACK_ENTRIES) ||
+                     (FM_ChildScanStat(&Scan, &DirListData, &FilesTillSleep) != OS_SUCCESS))
             {
-                EntryLength = OS_strnlen(OS_DIRENTRY_NAME(DirEntry), OS_MAX_FILE_NAME);
+                TrackPtr->UntrackedCount++;
+            }
+            else
+            {
+                NewPtr = &ScanList[ScanCount];
 
-                /*
-                 * DirListData.EntryName and TempName are both OS_MAX_PATH_LEN, DirEntry name is OS_MAX_FILE_NAME,
-                 * so limiting test is PathLength and EntryLength together
-                 */
-                if ((PathLength + EntryLength) < sizeof(TempName))
-                {
-                    /* Build qualified directory entry name */
-                    memcpy(TempName, DirWithSep, PathLength);
-                    memcpy(&TempName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
-                    TempName[PathLength + EntryLength] = '\0';
+                snprintf(NewPtr->Name, sizeof(NewPtr->Name), "%s", OS_DIRENTRY_NAME(Scan.DirEntry));
+                NewPtr->Size       = DirListData.EntrySize;
+                NewPtr->ModifyTime = DirListData.ModifyTime;
 
-                    /*
-                     * Populate directory list file entry -
-                     * Note this is guaranteed to be null-terminated due to the memset()
-                     * this will leave at least one null char after the string.
-                     */
-                    memset(&DirListData, 0, sizeof(DirListData));
-                    strncpy(DirListData.EntryName, OS_DIRENTRY_NAME(DirEntry), sizeof(DirListData.EntryName) - 1);
+                ScanCount++;
+            }
+        }
 
-                    FM_ChildSleepStat(TempName, &DirListData, &FilesTillSleep, getSizeTimeMode);
+        FM_ChildScanClose(&Scan);
 
-                    /* Write directory list file entry to output file */
-                    BytesWritten = OS_write(FileHandle, &DirListData, WriteLength);
+        qsort(ScanList, ScanCount, sizeof(ScanList[0]), FM_ChildDirTrackCompare);
 
-                    if (BytesWritten == WriteLength)
-                    {
-                        FileEntries++;
-                    }
-                    else
-                    {
-                        CommandResult = false;
-                        FM_GlobalData.ChildCmdErrCounter++;
+        /* Walk both name ordered lists together to find the added, modified and removed entries */
+        while ((OldIndex < TrackPtr->EntryCount) || (NewIndex < ScanCount))
+        {
+            OldPtr = &TrackPtr->Entries[OldIndex];
+            NewPtr = &ScanList[NewIndex];
 
-                        /* Send command failure event (error) */
-                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "%s error: OS_write entry failed: result = %d, expected = %d", CmdText,
-                                          (int)BytesWritten, (int)WriteLength);
-                    }
+            if (OldIndex >= TrackPtr->EntryCount)
+            {
+                Compare = 1;
+            }
+            else if (NewIndex >= ScanCount)
+            {
+                Compare = -1;
+            }
+            else
+            {
+                Compare = FM_ChildDirTrackCompare(OldPtr, NewPtr);
+            }
+
+            if (Compare < 0)
+            {
+                FM_ChildDirTrackRemove(TrackPtr, OldPtr->Name, NewSequence);
+                Changed = true;
+                OldIndex++;
+            }
+            else if (Compare > 0)
+            {
+                NewPtr->Sequence      = NewSequence;
+                NewPtr->AddedSequence = NewSequence;
+                Changed               = true;
+                NewIndex++;
+            }
+            else
+            {
+                NewPtr->AddedSequence = OldPtr->AddedSequence;
+
+                if ((NewPtr->Size != OldPtr->Size) || (NewPtr->ModifyTime != OldPtr->ModifyTime))
+                {
+                    NewPtr->Sequence = NewSequence;
+                    Changed          = true;
                 }
                 else
                 {
-                    FM_GlobalData.ChildCmdWarnCounter++;
-
-                    /* Send command failure event (error) */
-                    CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                      "%s error: combined directory and entry name too long: dir = %s, entry = %s",
-                                      CmdText, Directory, OS_DIRENTRY_NAME(DirEntry));
+                    NewPtr->Sequence = OldPtr->Sequence;
                 }
+
+                OldIndex++;
+                NewIndex++;
             }
         }
-    }
-
-    /* Update directory statistics in output file */
-    if ((CommandResult == true) && (DirEntries != 0))
-    {
-        /* Update entries found in directory vs entries written to file */
-        FM_GlobalData.DirListFileStats.DirEntries  = DirEntries;
-        FM_GlobalData.DirListFileStats.FileEntries = FileEntries;
-
-        /* Back up to the start of the statistics data */
-        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
 
-        /* Write an updated version of the statistics data */
-        WriteLength  = sizeof(FM_DirListFileStats_t);
-        BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, WriteLength);
+        memcpy(TrackPtr->Entries, ScanList, ScanCount * sizeof(ScanList[0]));
+        TrackPtr->EntryCount = ScanCount;
 
-        if (BytesWritten != WriteLength)
+        if (Changed == true)
         {
-            CommandResult = false;
-            FM_GlobalData.ChildCmdErrCounter++;
-
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
-                              (int)BytesWritten, (int)WriteLength);
+            TrackPtr->Sequence = NewSequence;
         }
     }
 
-    /* Send command completion event (info) */
-    if (CommandResult == true)
-    {
-        FM_GlobalData.ChildCmdCounter++;
-
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "%s command: wrote %d of %d names: dir = %s, filename = %s", CmdText, (int)FileEntries,
-                          (int)DirEntries, Directory, Filename);
-    }
+    return Status;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- get dir entry size and time   */
+/* FM child task utility function -- record removed entry          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode)
+void FM_ChildDirTrackRemove(FM_DirTrack_t *TrackPtr, const char *Name, uint32 Sequence)
 {
-    int32      Result = OS_SUCCESS;
-    os_fstat_t FileStatus;
-
-    memset(&FileStatus, 0, sizeof(FileStatus));
-
-    Result = OS_stat(Filename, &FileStatus);
+    FM_DirTrackEntry_t *RemovedPtr = NULL;
+    uint32              i;
 
-    if (Result != OS_SUCCESS)
+    /* An entry removed again only needs a new removal sequence number */
+    for (i = 0; (i < TrackPtr->RemovedCount) && (RemovedPtr == NULL); i++)
     {
-        *FileSize = 0;
-        *FileTime = 0;
-        *FileMode = 0;
+        if (strncmp(TrackPtr->Removed[i].Name, Name, OS_MAX_FILE_NAME) == 0)
+        {
+            RemovedPtr = &TrackPtr->Removed[i];
+        }
     }
-    else
+
+    if (RemovedPtr == NULL)
     {
-        *FileTime = OS_FILESTAT_TIME(FileStatus);
-        *FileSize = OS_FILESTAT_SIZE(FileStatus);
-        *FileMode = OS_FILESTAT_MODE(FileStatus);
+        RemovedPtr = &TrackPtr->Removed[TrackPtr->RemovedNext];
+
+        if (TrackPtr->RemovedCount < FM_DIR_TRACK_REMOVED)
+        {
+            TrackPtr->RemovedCount++;
+        }
+        else if (RemovedPtr->Sequence > TrackPtr->RemovedBase)
+        {
+            /* Removals up to the one overwritten are no longer all known */
+            TrackPtr->RemovedBase = RemovedPtr->Sequence;
+        }
+
+        TrackPtr->RemovedNext = (TrackPtr->RemovedNext + 1) % FM_DIR_TRACK_REMOVED;
+
+        snprintf(RemovedPtr->Name, sizeof(RemovedPtr->Name), "%s", Name);
     }
 
-    return Result;
+    RemovedPtr->Size          = 0;
+    RemovedPtr->ModifyTime    = 0;
+    RemovedPtr->Sequence      = Sequence;
+    RemovedPtr->AddedSequence = Sequence;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- sleep between OS_stat on files*/
+/* FM child task utility function -- fill dir changes packet       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool getSizeTimeMode)
+void FM_ChildDirChangesReport(const FM_DirTrack_t *TrackPtr, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    /* Check if command requested size and time */
-    if (getSizeTimeMode == true)
+    FM_DirChangesPkt_Payload_t *ReportPtr     = &FM_GlobalData.DirChangesPkt.Payload;
+    const FM_DirTrackEntry_t *  EntryPtr      = NULL;
+    uint32                      SinceSequence = CmdArgs->SinceSequence;
+    uint32                      i;
+
+    /* Initialize the directory changes telemetry packet */
+    CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.DirChangesPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_DIR_CHANGES_TLM_MID),
+                 sizeof(FM_DirChangesPkt_t));
+
+    snprintf(ReportPtr->DirName, OS_MAX_PATH_LEN, "%s", CmdArgs->Source1);
+    ReportPtr->Sequence      = TrackPtr->Sequence;
+    ReportPtr->SinceSequence = SinceSequence;
+    ReportPtr->TotalChanges  = 0;
+    ReportPtr->PacketChanges = 0;
+    ReportPtr->FirstChange   = CmdArgs->DirListOffset;
+    ReportPtr->Incomplete    = (TrackPtr->UntrackedCount != 0);
+
+    /* Removals before RemovedBase may be lost and an unknown number cannot be compared */
+    ReportPtr->FullListing = (SinceSequence == 0) || (SinceSequence < TrackPtr->RemovedBase) ||
+                             (SinceSequence > TrackPtr->Sequence);
+
+    for (i = 0; i < TrackPtr->EntryCount; i++)
     {
-        if (*FilesTillSleep <= 0)
+        EntryPtr = &TrackPtr->Entries[i];
+
+        if ((ReportPtr->FullListing == true) || (EntryPtr->AddedSequence > SinceSequence))
         {
-            CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-            OS_TaskDelay(FM_CHILD_STAT_SLEEP_MS);
-            CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-            *FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+            FM_ChildDirChangesAdd(ReportPtr, EntryPtr, FM_DIR_CHANGE_ADDED);
         }
+        else if (EntryPtr->Sequence > SinceSequence)
+        {
+            FM_ChildDirChangesAdd(ReportPtr, EntryPtr, FM_DIR_CHANGE_MODIFIED);
+        }
+    }
 
-        /* Get file size, date, and mode */
-        FM_ChildSizeTimeMode(Filename, &(DirListData->EntrySize), &(DirListData->ModifyTime), &(DirListData->Mode));
+    /* A removed entry that has been added again is already listed as added */
+    for (i = 0; (i < TrackPtr->RemovedCount) && (ReportPtr->FullListing == false); i++)
+    {
+        EntryPtr = &TrackPtr->Removed[i];
 
-        (*FilesTillSleep)--;
+        if ((EntryPtr->Sequence > SinceSequence) &&
+            (bsearch(EntryPtr, TrackPtr->Entries, TrackPtr->EntryCount, sizeof(TrackPtr->Entries[0]),
+                     FM_ChildDirTrackCompare) == NULL))
+        {
+            FM_ChildDirChangesAdd(ReportPtr, EntryPtr, FM_DIR_CHANGE_REMOVED);
+        }
     }
-    else
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- add dir changes packet entry  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirChangesAdd(FM_DirChangesPkt_Payload_t *ReportPtr, const FM_DirTrackEntry_t *EntryPtr,
+                           uint8 ChangeType)
+{
+    FM_DirChangeEntry_t *ChangePtr;
+
+    /* Only changes from the commanded offset that fit in the packet are listed, all are counted */
+    if ((ReportPtr->TotalChanges >= ReportPtr->FirstChange) && (ReportPtr->PacketChanges < FM_DIR_LIST_PKT_ENTRIES))
     {
-        DirListData->EntrySize  = 0;
-        DirListData->ModifyTime = 0;
-        DirListData->Mode       = 0;
+        ChangePtr = &ReportPtr->ChangeList[ReportPtr->PacketChanges];
+
+        snprintf(ChangePtr->EntryName, sizeof(ChangePtr->EntryName), "%s", EntryPtr->Name);
+        ChangePtr->EntrySize  = EntryPtr->Size;
+        ChangePtr->ModifyTime = EntryPtr->ModifyTime;
+        ChangePtr->Sequence   = EntryPtr->Sequence;
+        ChangePtr->ChangeType = ChangeType;
+
+        ReportPtr->PacketChanges++;
     }
+
+    ReportPtr->TotalChanges++;
 }
+#endif
@@ -26,6 +26,137 @@
 
 #include "cfe.h"
 #include "fm_msg.h"
+#include "fm_cmd_utils.h"
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ *  \brief Child task buffered output file writer
+ *
+ *  Small records are collected in Buffer and written to the output file
+ *  in blocks of up to #FM_CHILD_WRITE_BUFFER_SIZE bytes.
+ */
+typedef struct
+{
+    osal_id_t FileHandle;                         /**< \brief Output file handle */
+    int32     Status;                             /**< \brief Result of first failed write, else OS_SUCCESS */
+    size_t    Written;                            /**< \brief Number of bytes written to the file by this writer */
+    size_t    Length;                             /**< \brief Number of bytes waiting in Buffer */
+    uint8     Buffer[FM_CHILD_WRITE_BUFFER_SIZE]; /**< \brief Data not yet written to the file */
+} FM_ChildWriter_t;
+
+/**
+ *  \brief File CRC segment
+ *
+ *  One part of a file whose CRC is computed by the child task or a CRC worker.
+ */
+typedef struct
+{
+    uint32 Offset;                           /**< \brief Offset of the first segment byte in the file */
+    uint32 Length;                           /**< \brief Number of bytes in the segment */
+    uint32 Crc;                              /**< \brief CRC of the segment, starting from zero */
+    int32  Status;                           /**< \brief Result of the first failed file call, else OS_SUCCESS */
+    uint8  Buffer[FM_CHILD_FILE_BLOCK_SIZE]; /**< \brief File I/O buffer of the task processing the segment */
+} FM_CrcSegment_t;
+
+/**
+ *  \brief File CRC job shared by the child task and the CRC workers
+ *
+ *  NextSegment is protected by the CRC job mutex, the remaining fields are
+ *  set by the child task before any segment is handed out and not changed
+ *  until every segment has been completed.
+ */
+typedef struct
+{
+    char            Filename[OS_MAX_PATH_LEN];        /**< \brief File being processed */
+    uint32          TypeCRC;                          /**< \brief CRC algorithm selection */
+    uint32          SegmentCount;                     /**< \brief Number of segments in use */
+    uint32          NextSegment;                      /**< \brief Index of the next segment to process */
+    FM_CrcSegment_t Segment[FM_CRC_WORKER_COUNT + 1]; /**< \brief File segments in file order */
+} FM_CrcJob_t;
+
+/**
+ *  \brief Get Dir List to Packet directory cursor
+ *
+ *  The directory of a listing that did not fit in one packet is kept open so
+ *  the next packet continues reading where the previous one stopped.
+ */
+typedef struct
+{
+    char      DirName[OS_MAX_PATH_LEN]; /**< \brief Directory name, empty if no directory is held open */
+    osal_id_t DirId;                    /**< \brief Open directory handle */
+    uint32    DirTime;                  /**< \brief Directory modify time before the entries were counted */
+    uint32    OpenTime;                 /**< \brief Local time in seconds when the entries were counted */
+    uint32    NextEntry;                /**< \brief Index of the entry the next read returns, not counting "." and ".." */
+    uint32    TotalFiles;               /**< \brief Number of entries, not counting "." and ".." */
+} FM_DirListCursor_t;
+
+/**
+ *  \name Directory scan entry types
+ *  \{
+ */
+#define FM_CHILD_SCAN_TYPE_UNKNOWN 0 /**< \brief Entry type not reported, a stat is needed */
+#define FM_CHILD_SCAN_TYPE_FILE    1 /**< \brief Entry is a regular file */
+#define FM_CHILD_SCAN_TYPE_DIR     2 /**< \brief Entry is a directory */
+/**\}*/
+
+/**
+ *  \brief Child task directory scan
+ *
+ *  Reads the entries of one directory, through OSAL or natively (see
+ *  #FM_CHILD_NATIVE_DIR_SCAN).  Path holds the directory name and separator
+ *  once, and each entry name read is placed after it.
+ */
+typedef struct
+{
+    osal_id_t   DirId;                 /**< \brief OSAL directory handle when read through OSAL */
+    void *      NativeDir;             /**< \brief Host directory stream when read natively, else NULL */
+    size_t      PathLength;            /**< \brief Length of the directory name and separator in Path */
+    bool        PathValid;             /**< \brief Path holds the full name of the current entry */
+    uint8       EntryType;             /**< \brief Type of the current entry, see #FM_CHILD_SCAN_TYPE_UNKNOWN */
+    os_dirent_t DirEntry;              /**< \brief Current entry */
+    char        Path[OS_MAX_PATH_LEN]; /**< \brief Directory name and separator followed by the current entry name */
+} FM_ChildScan_t;
+
+/**
+ *  \brief Tracked directory entry
+ *
+ *  Sequence is the change sequence number of the last change to the entry,
+ *  AddedSequence the change sequence number of the change that added it.
+ *  For a removed entry both hold the sequence number of the removal.
+ */
+typedef struct
+{
+    char   Name[OS_MAX_FILE_NAME]; /**< \brief Entry name */
+    uint32 Size;                   /**< \brief Entry size */
+    uint32 ModifyTime;             /**< \brief Entry last modification time */
+    uint32 Sequence;               /**< \brief Change sequence number of the last change */
+    uint32 AddedSequence;          /**< \brief Change sequence number of the addition */
+} FM_DirTrackEntry_t;
+
+/**
+ *  \brief Get Directory Changes tracked directory
+ *
+ *  Entries holds the directory entries seen by the latest scan in name
+ *  order.  Removed is a ring of the most recently removed entries, changes
+ *  with a sequence number after RemovedBase are all recorded in it.
+ */
+typedef struct
+{
+    char               DirName[OS_MAX_PATH_LEN];        /**< \brief Directory name, empty if the record is unused */
+    uint32             Sequence;                        /**< \brief Change sequence number of the latest change */
+    uint32             RemovedBase;                     /**< \brief Oldest sequence number removals are known after */
+    uint32             LastUsed;                        /**< \brief Replacement counter value when last used */
+    uint32             EntryCount;                      /**< \brief Number of entries in Entries */
+    uint32             RemovedCount;                    /**< \brief Number of entries in Removed */
+    uint32             RemovedNext;                     /**< \brief Index in Removed of the next removal */
+    uint32             UntrackedCount;                  /**< \brief Entries the latest scan could not track */
+    int32              WatchFd;                         /**< \brief inotify descriptor, -1 if not watched */
+    FM_DirTrackEntry_t Entries[FM_DIR_TRACK_ENTRIES];   /**< \brief Directory entries, sorted by name */
+    FM_DirTrackEntry_t Removed[FM_DIR_TRACK_REMOVED];   /**< \brief Recently removed entries */
+} FM_DirTrack_t;
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -101,6 +232,168 @@ void FM_ChildLoop(void);
  */
 void FM_ChildProcess(void);
 
+/**
+ *  \brief Child Task Command Queue Release Function
+ *
+ *  \par Description
+ *       This function updates the queue access variables to point to the
+ *       next queue entry, once the current command has been handled or
+ *       has failed its deferred file state checks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \sa #FM_ChildProcess
+ */
+void FM_ChildQueueNext(void);
+
+/**
+ *  \brief Child Task Deferred File State Check Function
+ *
+ *  \par Description
+ *       This function runs the file state checks that the main task left
+ *       for the child task, in the order the command handler made them.
+ *       The first failed check sends the command-specific error event and
+ *       the command is counted as a child task command error.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Commands that were checked by the main task carry no checks.
+ *
+ *  \param [in]  CmdArgs Pointer to the child queue entry
+ *
+ *  \return Boolean deferred check response
+ *  \retval true  All deferred checks passed, the command may run
+ *  \retval false A deferred check failed
+ *
+ *  \sa #FM_VerifyDeferredFileState, #FM_CHILD_DEFER_VERIFY
+ */
+bool FM_ChildVerifyCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief CRC Worker Initialization Function
+ *
+ *  \par Description
+ *       This function is invoked by #FM_ChildInit to create the semaphores and
+ *       the #FM_CRC_WORKER_COUNT tasks that help the child task compute the
+ *       CRC of large files.  Failures are reported but are not fatal; the
+ *       child task computes CRC values with whichever workers were created.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \sa #FM_ChildParallelCRC, #FM_ChildCrcWorkerTask
+ */
+void FM_ChildCrcWorkerInit(void);
+
+/**
+ *  \brief CRC Worker Task Entry Point Function
+ *
+ *  \par Description
+ *       This function is the entry point for the FM CRC worker tasks.  It runs
+ *       the worker main loop and deletes the task should the loop return.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \sa #FM_ChildCrcWorkerLoop
+ */
+void FM_ChildCrcWorkerTask(void);
+
+/**
+ *  \brief CRC Worker Main Loop Function
+ *
+ *  \par Description
+ *       This function waits for the child task to post a file CRC job and then
+ *       computes the CRC of job segments until none remain.  The loop ends if
+ *       the wakeup semaphore cannot be taken.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \sa #FM_ChildCrcRunSegments
+ */
+void FM_ChildCrcWorkerLoop(void);
+
+/**
+ *  \brief Run CRC Job Segments Function
+ *
+ *  \par Description
+ *       This function takes segments of the current file CRC job one at a time
+ *       and computes their CRC until every segment has been taken.  The CRC
+ *       done semaphore is given once per completed segment.  It is run by the
+ *       child task and by each woken CRC worker.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \sa #FM_ChildCrcSegment
+ */
+void FM_ChildCrcRunSegments(void);
+
+/**
+ *  \brief Compute File Segment CRC Function
+ *
+ *  \par Description
+ *       This function opens the file, seeks to the start of the segment and
+ *       computes the CRC of the segment data, giving up the CPU every
+ *       #FM_CHILD_FILE_LOOP_COUNT blocks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A segment that ends early because the file became shorter fails
+ *       with #OS_ERROR.
+ *
+ *  \param [in]     Filename   Name of the file.
+ *  \param [in]     TypeCRC    CRC algorithm selection.
+ *  \param [in,out] SegmentPtr Pointer to the segment, see #FM_CrcSegment_t.
+ */
+void FM_ChildCrcSegment(const char *Filename, uint32 TypeCRC, FM_CrcSegment_t *SegmentPtr);
+
+/**
+ *  \brief Parallel File CRC Function
+ *
+ *  \par Description
+ *       This function measures the file with #OS_stat and computes the
+ *       CRC of that many bytes with #FM_ChildParallelCRCJob.  The size is
+ *       returned so the caller can tell whether the file changed after the
+ *       command was verified.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only CRC types supported by #FM_CrcCombine may be used.  Segment
+ *       offsets are given to #OS_lseek, so a file larger than INT32_MAX
+ *       bytes is not split and the caller computes its CRC in order.
+ *
+ *  \param [in]  Filename    Name of the file.
+ *  \param [in]  TypeCRC     CRC algorithm selection.
+ *  \param [out] CrcPtr      CRC of the whole file.
+ *  \param [out] FileSizePtr Number of bytes covered by the CRC.
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *  \retval #OS_ERR_OUTPUT_TOO_LARGE File is too large to split
+ *
+ *  \sa #FM_ChildParallelCRCJob
+ */
+int32 FM_ChildParallelCRC(const char *Filename, uint32 TypeCRC, uint32 *CrcPtr, uint32 *FileSizePtr);
+
+/**
+ *  \brief Parallel File CRC Job Function
+ *
+ *  \par Description
+ *       This function splits a file into one segment per CRC worker plus one
+ *       for the child task, wakes the workers and processes segments itself
+ *       until all are taken, then waits for the remaining segments and merges
+ *       the segment CRC values with #FM_CrcCombine.  The result is identical
+ *       to the CRC computed by reading the file in order.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only CRC types supported by #FM_CrcCombine may be used.  The file
+ *       size must be the current size of the file.
+ *
+ *  \param [in]  Filename Name of the file.
+ *  \param [in]  FileSize Size of the file in bytes.
+ *  \param [in]  TypeCRC  CRC algorithm selection.
+ *  \param [out] CrcPtr   CRC of the whole file.
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 FM_ChildParallelCRCJob(const char *Filename, uint32 FileSize, uint32 TypeCRC, uint32 *CrcPtr);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task command handlers                                  */
@@ -311,6 +604,84 @@ void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs);
  */
 void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs);
 
+/**
+ *  \brief Child Task Get Sorted Dir List to Packet Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a get sorted directory listing to a packet command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The directory is read once.  The packet entry list is used as a
+ *       heap that holds the entries selected so far, so no other storage
+ *       is needed however many entries the directory has.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetDirListSortedCmd_t
+ */
+void FM_ChildDirListSortedCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Get Directory Statistics Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a get directory statistics command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The directory is read once and each entry is added to the totals in
+ *       the telemetry packet as it is read, so no entry storage is needed.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetDirStatsCmd_t, #FM_DirStatsPkt_t
+ */
+void FM_ChildDirStatsCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Get Directory Changes Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a get directory changes command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The directory is read again unless its inotify watch shows that
+ *       nothing changed.  A directory that cannot be read is no longer
+ *       tracked.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetDirChangesCmd_t, #FM_DirChangesPkt_t
+ */
+void FM_ChildDirChangesCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Build Directory Index Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a build directory index command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The previous index of the directory is replaced only once the new
+ *       index is complete.
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_BuildDirIndexCmd_t
+ */
+void FM_ChildBuildDirIndexCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
 /**
  *  \brief Child Task Set Permissions Command Handler
  *
@@ -328,6 +699,44 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs);
  */
 void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs);
 
+/**
+ *  \brief Child Task Directory Manifest Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a directory manifest command.  The selected CRC or hash is
+ *       computed for each closed file in the directory and written, with the file
+ *       name, size and modify time, to the output file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_DirManifestCmd_t
+ */
+void FM_ChildDirManifestCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Compare Files Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a compare files command.  The file sizes are compared first and
+ *       the file contents are only read if the sizes match.  The result is sent in
+ *       the compare files telemetry packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_CompareFilesCmd_t, #FM_CompareFilesPkt_t
+ */
+void FM_ChildCompareFilesCmd(const FM_ChildQueueEntry_t *CmdArgs);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task utility functions                                 */
@@ -349,11 +758,12 @@ void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *       contain the newly created output file handle.
  *  \param [in] Directory      A pointer to a buffer containing the directory name.
  *  \param [in] Filename       A pointer to a buffer containing the output filename.
+ *  \param [in] ListFormat     Output file format, selects the file header sub-type.
  *
  *  \return Execution status, see \ref CFEReturnCodes and \ref OSReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  */
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename);
+bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, uint8 ListFormat);
 
 /**
  *  \brief Child Task Get Dir List to File Loop Processor Function
@@ -363,6 +773,9 @@ bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, co
  *       size and mode for each entry, and writes the entry data to the output file.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Subdirectories are listed after their own entry, up to MaxDepth levels,
+ *       with entry names relative to the listed directory.  The walk keeps the
+ *       open parent directories on an explicit stack rather than recursing.
  *
  *  \param [in] DirId           Directory ID, a handle used to read directory entries.
  *  \param [in] FileHandle      Output file handle.
@@ -370,9 +783,501 @@ bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, co
  *  \param [in] DirWithSep      Pointer to directory name with path separator appended.
  *  \param [in] Filename        Pointer to a buffer containing the output filename.
  *  \param [in] GetSizeTimeMode Option to call OS_stat for size, time, mode of files
+ *  \param [in] ListFormat      Output file format, #FM_DIR_LIST_FORMAT_STANDARD or compact
+ *  \param [in] MaxDepth        Subdirectory levels to list, 0 lists the directory only
  */
 void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 GetSizeTimeMode);
+                             const char *Filename, uint8 GetSizeTimeMode, uint8 ListFormat, uint8 MaxDepth);
+
+/**
+ *  \brief Child Task Get Dir List to File Statistics Function
+ *
+ *  \par Description
+ *       This function completes a directory list output file.  The statistics
+ *       replace the placeholder while it is still buffered, then the buffered
+ *       entries are written.  The statistics are rewritten in the file if the
+ *       placeholder was already written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The placeholder statistics are not changed for an empty directory.
+ *
+ *  \param [in] FileHandle  Output file handle.
+ *  \param [in] Filename    Pointer to a buffer containing the output filename.
+ *  \param [in] DirEntries  Number of directory entries read.
+ *  \param [in] FileEntries Number of entries written to this output file.
+ *
+ *  \return Boolean write response
+ *  \retval true  Output file complete
+ *  \retval false Write error, event sent
+ */
+bool FM_ChildDirListFileStats(osal_id_t FileHandle, const char *Filename, uint32 DirEntries, uint32 FileEntries);
+
+/**
+ *  \brief Child Task Get Dir List to Next File Function
+ *
+ *  \par Description
+ *       This function creates the next output file of a listing that has
+ *       passed #FM_DIR_LIST_FILE_MAX_SIZE.  The file is named after the
+ *       commanded output file with the part number as a suffix, and is
+ *       started with #FM_ChildDirListFileInit.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [out] FileHandlePtr Pointer to the new output file handle.
+ *  \param [in]  Directory     Pointer to a buffer containing the directory name.
+ *  \param [in]  Filename      Pointer to a buffer containing the commanded output filename.
+ *  \param [out] NextName      Buffer of #OS_MAX_PATH_LEN characters for the new output filename.
+ *  \param [in]  PartCount     Number of output files written so far, used as the suffix.
+ *  \param [in]  ListFormat    Output file format.
+ *
+ *  \return Boolean create response
+ *  \retval true  Next output file created
+ *  \retval false Filename too long or create error, event sent
+ */
+bool FM_ChildDirListFileNext(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, char *NextName,
+                             uint32 PartCount, uint8 ListFormat);
+
+/**
+ *  \brief Child Task Get Dir List Update Earlier Files Function
+ *
+ *  \par Description
+ *       This function writes the number of entries in the whole directory
+ *       to the statistics of every output file but the last one of a split
+ *       listing.  Those files were completed before the directory had been
+ *       read to the end.  The first file is still open, the others are
+ *       opened again by name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] FileHandle Handle of the first output file.
+ *  \param [in] Filename   Pointer to a buffer containing the commanded output filename.
+ *  \param [in] PartCount  Number of output files written.
+ *  \param [in] DirEntries Number of entries in the directory.
+ *
+ *  \return Boolean update response
+ *  \retval true  Statistics updated
+ *  \retval false Open or write error, event sent
+ */
+bool FM_ChildDirListFileTotals(osal_id_t FileHandle, const char *Filename, uint32 PartCount, uint32 DirEntries);
+
+/**
+ *  \brief Child Task Directory Manifest Initialization Function
+ *
+ *  \par Description
+ *       This function creates the manifest output file, writes the CFE file header
+ *       and starts the buffered writer with a blank copy of the manifest statistics
+ *       structure.  At the end of the command, software will re-write the statistics
+ *       structure, this time with up to date values.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [out] FileHandlePtr A pointer to a file handle variable which is modified to
+ *       contain the newly created output file handle.
+ *  \param [in] Directory      A pointer to a buffer containing the directory name.
+ *  \param [in] Filename       A pointer to a buffer containing the output filename.
+ *  \param [in] TypeCRC        CRC or hash algorithm selection.
+ *
+ *  \return Boolean output file created response
+ *  \retval true  Output file created
+ *  \retval false Output file not created
+ */
+bool FM_ChildDirManifestInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, uint32 TypeCRC);
+
+/**
+ *  \brief Child Task Directory Manifest Loop Processor Function
+ *
+ *  \par Description
+ *       This function reads each directory entry, computes the digest of each
+ *       closed file, and writes the manifest entries to the output file.  The
+ *       statistics structure is updated after the last entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] DirId      Directory ID, a handle used to read directory entries.
+ *  \param [in] FileHandle Output file handle.
+ *  \param [in] CmdArgs    A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ */
+void FM_ChildDirManifestLoop(osal_id_t DirId, osal_id_t FileHandle, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Directory Manifest Entry Function
+ *
+ *  \par Description
+ *       This function fills in the size, modify time and digest of one manifest
+ *       entry.  The digest is taken from the digest cache when the file is
+ *       unchanged, otherwise the file is read and the result added to the cache.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only closed files are processed.  The child task gives up the CPU every
+ *       #FM_CHILD_FILE_LOOP_COUNT file blocks.
+ *
+ *  \param [in]     Filename     Pointer to the combined directory and entry names.
+ *  \param [in]     TypeCRC      CRC or hash algorithm selection.
+ *  \param [out]    EntryPtr     Pointer to the manifest entry to fill in.
+ *  \param [in,out] LoopCountPtr Pointer to the count of blocks since the last task delay.
+ *
+ *  \return Boolean entry complete response
+ *  \retval true  Entry complete
+ *  \retval false Entry is not a closed file or the file could not be read
+ */
+bool FM_ChildDirManifestEntry(const char *Filename, uint32 TypeCRC, FM_DirManifestEntry_t *EntryPtr,
+                              int32 *LoopCountPtr);
+
+/**
+ *  \brief Child Task Compare Files Loop Processor Function
+ *
+ *  \par Description
+ *       This function reads both files one block at a time and compares the
+ *       blocks with memcmp.  The loop stops at the first block that differs
+ *       and only that block is searched for the offset of the first differing
+ *       byte.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Both files are open and had the same size when they were stat'ed.  A
+ *       file that ends before the other with no difference in the common
+ *       data is reported as #FM_COMPARE_SIZE_DIFFERS.  A read error ends the
+ *       compare with an error event.
+ *
+ *  \param [in]  FileHandle1 First file handle.
+ *  \param [in]  FileHandle2 Second file handle.
+ *  \param [in]  CmdArgs     A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *  \param [out] ReportPtr   Compare files telemetry payload, Result and FirstDiffOffset
+ *       are set when the compare completes.
+ *
+ *  \return Boolean compare complete response
+ *  \retval true  Compare completed, result is valid
+ *  \retval false Compare ended by a read error
+ */
+bool FM_ChildCompareFilesLoop(osal_id_t FileHandle1, osal_id_t FileHandle2, const FM_ChildQueueEntry_t *CmdArgs,
+                              FM_CompareFilesPkt_Payload_t *ReportPtr);
+
+/**
+ *  \brief Child Task Compare Files Block Read Function
+ *
+ *  \par Description
+ *       This function reads up to #FM_CHILD_COMPARE_BLOCK_SIZE bytes into the
+ *       buffer, repeating short reads until the block is full or the end of
+ *       the file is reached.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The buffer must hold #FM_CHILD_COMPARE_BLOCK_SIZE bytes.
+ *
+ *  \param [in]  FileHandle File handle.
+ *  \param [out] Buffer     Block buffer.
+ *
+ *  \return Number of bytes in the block, less than a full block only at the
+ *          end of the file, or the OS_read error code
+ */
+int32 FM_ChildCompareFilesRead(osal_id_t FileHandle, char *Buffer);
+
+/**
+ *  \brief Child Task Directory List Packet Stream Function
+ *
+ *  \par Description
+ *       This function sends a full directory listing telemetry packet of a
+ *       streamed listing and empties it for the entries that follow.  The
+ *       child task then waits so that packets are sent no faster than
+ *       #FM_DIR_LIST_PKT_STREAM_RATE.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The packet is full and at least one more entry will be listed.
+ *
+ *  \param [in,out] ReportPtr Directory listing telemetry payload.
+ *  \param [in]     NextEntry Index of the first entry of the next packet.
+ */
+void FM_ChildDirListPktNext(FM_DirListPkt_Payload_t *ReportPtr, uint32 NextEntry);
+
+/**
+ *  \brief Child Task Directory List Packet Entry Function
+ *
+ *  \par Description
+ *       This function adds one directory entry to the directory listing
+ *       telemetry packet.  The entry name is combined with the directory
+ *       name so that the entry size, time and mode can be added.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The packet is not full.  An entry that is too long to combine with
+ *       the directory name is skipped with a warning event.
+ *
+ *  \param [in]     CmdArgs        A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *  \param [in]     EntryName      Directory entry name.
+ *  \param [in,out] ReportPtr      Directory listing telemetry payload.
+ *  \param [in,out] FilesTillSleep Number of stat calls left before the child task sleeps.
+ */
+void FM_ChildDirListPktEntry(const FM_ChildQueueEntry_t *CmdArgs, const char *EntryName,
+                             FM_DirListPkt_Payload_t *ReportPtr, int32 *FilesTillSleep);
+
+/**
+ *  \brief Child Task Directory List Cursor Open Function
+ *
+ *  \par Description
+ *       This function keeps an open directory for later Get Dir List Pkt
+ *       commands.  The directory is rewound, a packet at a later offset
+ *       reads forward from the cursor instead of reading and counting the
+ *       whole directory again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cursor takes over the directory handle.  Any previous cursor
+ *       must have been closed with #FM_ChildDirListCursorClose.
+ *
+ *  \param [in] DirId      Open directory handle.
+ *  \param [in] Directory  Directory name.
+ *  \param [in] DirTime    Directory modify time taken before the entries were counted.
+ *  \param [in] TotalFiles Number of entries, not counting "." and "..".
+ *
+ *  \sa #FM_ChildDirListCursorValid, #FM_ChildDirListCursorClose
+ */
+void FM_ChildDirListCursorOpen(osal_id_t DirId, const char *Directory, uint32 DirTime, uint32 TotalFiles);
+
+/**
+ *  \brief Child Task Directory List Cursor Close Function
+ *
+ *  \par Description
+ *       This function closes the directory held by the directory list
+ *       cursor, if any.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \sa #FM_ChildDirListCursorOpen
+ */
+void FM_ChildDirListCursorClose(void);
+
+/**
+ *  \brief Child Task Directory List Cursor Expire Function
+ *
+ *  \par Description
+ *       This function closes the directory held by the directory list
+ *       cursor once it is #FM_DIR_LIST_CURSOR_TTL seconds old, and returns
+ *       how long the child task may wait for a command before the cursor
+ *       expires.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the child task before it waits for the next command, so
+ *       the directory handle is not kept open when the ground never asks
+ *       for the next page.
+ *
+ *  \return Time in milli-secs until the cursor expires, zero if no cursor is held
+ *
+ *  \sa #FM_ChildDirListCursorValid, #FM_ChildLoop
+ */
+uint32 FM_ChildDirListCursorExpire(void);
+
+/**
+ *  \brief Child Task Directory List Cursor Check Function
+ *
+ *  \par Description
+ *       This function checks whether the directory list cursor can be
+ *       used for a directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cursor is used when it was opened on the same directory less
+ *       than #FM_DIR_LIST_CURSOR_TTL seconds ago and the directory modify
+ *       time has not changed since.
+ *
+ *  \param [in] Directory Directory name.
+ *
+ *  \return Boolean cursor valid response
+ *  \retval true  Cursor can be used
+ *  \retval false Directory must be opened and counted again
+ *
+ *  \sa #FM_ChildDirListCursorOpen
+ */
+bool FM_ChildDirListCursorValid(const char *Directory);
+
+/**
+ *  \brief Child Task Entry Name Pattern Match Function
+ *
+ *  \par Description
+ *       This function checks a directory entry name against a name pattern.
+ *       In the pattern '*' matches any number of characters and '?' matches
+ *       exactly one character; every other character matches itself.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An empty pattern matches every name.
+ *
+ *  \param [in] Pattern Name pattern.
+ *  \param [in] Name    Directory entry name.
+ *
+ *  \return Boolean match response
+ *  \retval true  Name matches the pattern
+ *  \retval false Name does not match the pattern
+ */
+bool FM_ChildPatternMatch(const char *Pattern, const char *Name);
+
+/**
+ *  \brief Child Task Directory List Entry Order Function
+ *
+ *  \par Description
+ *       This function checks whether one directory list entry is listed
+ *       before another for a sort key and direction.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Entries with equal times or sizes are ordered by name, in the
+ *       requested direction.
+ *
+ *  \param [in] Entry1        First directory list entry.
+ *  \param [in] Entry2        Second directory list entry.
+ *  \param [in] SortKey       Sort key (#FM_SORT_BY_NAME, #FM_SORT_BY_TIME, #FM_SORT_BY_SIZE).
+ *  \param [in] SortDirection Sort direction (#FM_SORT_ASCENDING, #FM_SORT_DESCENDING).
+ *
+ *  \return Boolean order response
+ *  \retval true  Entry1 is listed before Entry2
+ *  \retval false Entry1 is listed after Entry2, or the entries are equal
+ */
+bool FM_ChildDirListBefore(const FM_DirListEntry_t *Entry1, const FM_DirListEntry_t *Entry2, uint8 SortKey,
+                           uint8 SortDirection);
+
+/**
+ *  \brief Child Task Directory List Heap Add Function
+ *
+ *  \par Description
+ *       This function offers a directory list entry to a heap that keeps the
+ *       first HeapLimit entries in listing order.  The root of the heap is
+ *       the kept entry that would be listed last.  While the heap is not
+ *       full the entry is added; once it is full the entry replaces the root
+ *       only if it is listed before it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each entry costs O(log HeapLimit) comparisons.
+ *
+ *  \param [in,out] Heap          Heap storage, at least HeapLimit entries.
+ *  \param [in,out] HeapCount     Number of entries in the heap.
+ *  \param [in]     HeapLimit     Maximum number of entries to keep.
+ *  \param [in]     Entry         Directory list entry to offer.
+ *  \param [in]     SortKey       Sort key.
+ *  \param [in]     SortDirection Sort direction.
+ *
+ *  \sa #FM_ChildDirListHeapSort
+ */
+void FM_ChildDirListHeapAdd(FM_DirListEntry_t *Heap, uint32 *HeapCount, uint32 HeapLimit,
+                            const FM_DirListEntry_t *Entry, uint8 SortKey, uint8 SortDirection);
+
+/**
+ *  \brief Child Task Directory List Heap Sort Function
+ *
+ *  \par Description
+ *       This function sorts the entries of a heap built with
+ *       #FM_ChildDirListHeapAdd into listing order, in place.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Heap          Heap storage.
+ *  \param [in]     HeapCount     Number of entries in the heap.
+ *  \param [in]     SortKey       Sort key.
+ *  \param [in]     SortDirection Sort direction.
+ */
+void FM_ChildDirListHeapSort(FM_DirListEntry_t *Heap, uint32 HeapCount, uint8 SortKey, uint8 SortDirection);
+
+/**
+ *  \brief Child Task Buffered Writer Initialization Function
+ *
+ *  \par Description
+ *       This function prepares a buffered writer for an open output file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [out] WriterPtr  Pointer to the writer.
+ *  \param [in]  FileHandle Output file handle.
+ *
+ *  \sa #FM_ChildWriterWrite, #FM_ChildWriterFlush
+ */
+void FM_ChildWriterInit(FM_ChildWriter_t *WriterPtr, osal_id_t FileHandle);
+
+/**
+ *  \brief Child Task Buffered Writer Write Function
+ *
+ *  \par Description
+ *       This function adds a record to the writer buffer.  The buffer is written
+ *       to the output file when the record does not fit.  Records larger than
+ *       the buffer are written directly.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       After a write fails no more data is written; the failure is reported
+ *       by this and all later calls.
+ *
+ *  \param [in,out] WriterPtr  Pointer to the writer.
+ *  \param [in]     DataPtr    Pointer to the record.
+ *  \param [in]     DataLength Number of bytes in the record.
+ *
+ *  \return Boolean write success response
+ *  \retval true  Record accepted
+ *  \retval false An output file write has failed, see #FM_ChildWriter_t.Status
+ *
+ *  \sa #FM_ChildWriterFlush
+ */
+bool FM_ChildWriterWrite(FM_ChildWriter_t *WriterPtr, const void *DataPtr, size_t DataLength);
+
+/**
+ *  \brief Child Task Buffered Writer Flush Function
+ *
+ *  \par Description
+ *       This function writes any buffered data to the output file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the output file is closed or repositioned.
+ *
+ *  \param [in,out] WriterPtr Pointer to the writer.
+ *
+ *  \return Boolean write success response
+ *  \retval true  All data written
+ *  \retval false An output file write has failed, see #FM_ChildWriter_t.Status
+ *
+ *  \sa #FM_ChildWriterWrite
+ */
+bool FM_ChildWriterFlush(FM_ChildWriter_t *WriterPtr);
+
+/**
+ *  \brief Child Task Buffered Writer Update Function
+ *
+ *  \par Description
+ *       This function replaces data that was given to the writer and has not
+ *       been written to the output file yet.  A file header that is completed
+ *       after the records that follow it, such as a statistics structure,
+ *       can then be written once instead of being rewritten with a seek.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is replaced unless the whole range is still buffered; the
+ *       caller must then flush the writer and rewrite the data in the file.
+ *
+ *  \param [in,out] WriterPtr  Pointer to the writer.
+ *  \param [in]     Offset     Offset of the data from the file position when the writer was started.
+ *  \param [in]     DataPtr    Pointer to the replacement data.
+ *  \param [in]     DataLength Number of bytes to replace.
+ *
+ *  \return Boolean update response
+ *  \retval true  Buffered data replaced
+ *  \retval false Data was already written to the file, or a write has failed
+ *
+ *  \sa #FM_ChildWriterWrite, #FM_ChildWriterFlush
+ */
+bool FM_ChildWriterUpdate(FM_ChildWriter_t *WriterPtr, size_t Offset, const void *DataPtr, size_t DataLength);
+
+/**
+ *  \brief Child Task Compact Dir List Entry Function
+ *
+ *  \par Description
+ *       This function encodes a directory list entry in the compact output
+ *       file format: the name length and unpadded name followed by the size,
+ *       the difference from the previous modification time and the mode, all
+ *       lengths and values as variable length integers.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The buffer must hold #FM_DIR_LIST_COMPACT_ENTRY_MAX bytes.  The
+ *       previous time is zero for the first entry of a file.
+ *
+ *  \param [out]    Buffer      Pointer to the encoded entry.
+ *  \param [in]     EntryPtr    Pointer to the directory list entry.
+ *  \param [in,out] LastTimePtr Pointer to the previous modification time, set to this entry's time.
+ *
+ *  \return Number of bytes in the encoded entry
+ *
+ *  \sa #FM_DIR_LIST_COMPACT_ENTRY_MAX
+ */
+size_t FM_ChildDirListCompactEntry(uint8 *Buffer, const FM_DirListEntry_t *EntryPtr, uint32 *LastTimePtr);
 
 /**
  *  \brief Child Task File Size Time and Mode Utility Function
@@ -411,8 +1316,237 @@ int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileT
  *  \param [out] FilesTillSleep If this is zero the function will sleep for #FM_CHILD_STAT_SLEEP_MS and reset it to
  *                              #FM_CHILD_STAT_SLEEP_FILECOUNT. Otherwise it will subtract 1
  *  \param [in] GetSizeTimeMode Whether this function should call FM_ChildSizeTimeMode
+ *
+ *  \return Execution status of FM_ChildSizeTimeMode, #OS_SUCCESS if it was not called
+ */
+int32 FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
+                        bool GetSizeTimeMode);
+
+/**
+ *  \brief Child Task Directory Scan Open Function
+ *
+ *  \par Description
+ *       This function opens a directory for the scan functions.  When
+ *       #FM_CHILD_NATIVE_DIR_SCAN is enabled the directory is opened with the
+ *       host C library, otherwise (or if that fails) it is opened with OSAL.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The scan must be closed with #FM_ChildScanClose once opened.
+ *
+ *  \param [out] ScanPtr    Pointer to the directory scan.
+ *  \param [in]  Directory  Pointer to the directory name.
+ *  \param [in]  DirWithSep Pointer to the directory name plus separator.
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 FM_ChildScanOpen(FM_ChildScan_t *ScanPtr, const char *Directory, const char *DirWithSep);
+
+/**
+ *  \brief Child Task Directory Scan Read Function
+ *
+ *  \par Description
+ *       This function reads the next directory entry, skipping the "." and
+ *       ".." entries.  The entry type is set when the directory was read
+ *       natively and the file system reports it, and the entry name is placed
+ *       after the directory name in the scan path.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       PathValid is false if the combined directory and entry names do not
+ *       fit in the scan path.
+ *
+ *  \param [in,out] ScanPtr Pointer to the directory scan.
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 FM_ChildScanRead(FM_ChildScan_t *ScanPtr);
+
+/**
+ *  \brief Child Task Directory Scan Stat Function
+ *
+ *  \par Description
+ *       This function queries the size, last modify time and mode of the
+ *       current directory entry, sleeping as #FM_ChildSleepStat does.  An
+ *       entry read natively is looked up relative to the open directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]     ScanPtr        Pointer to the directory scan.
+ *  \param [out]    DirListData    Pointer to the entry size, last modify time and mode.
+ *  \param [in,out] FilesTillSleep Number of entries left before the next sleep.
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS           \copybrief OS_SUCCESS
+ *  \retval #OS_ERR_NAME_TOO_LONG \copybrief OS_ERR_NAME_TOO_LONG
+ */
+int32 FM_ChildScanStat(FM_ChildScan_t *ScanPtr, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep);
+
+/**
+ *  \brief Child Task Directory Scan Entry State Function
+ *
+ *  \par Description
+ *       This function returns the filename state of the current directory
+ *       entry.  When the entry type is known no stat is needed, otherwise
+ *       the state is read with #FM_GetBatchFilenameState.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       With an open file set, files opened since it was loaded are
+ *       reported as closed.
+ *
+ *  \param [in] ScanPtr Pointer to the directory scan.
+ *  \param [in] SetPtr  Pointer to the open file set, or NULL to search OSAL.
+ *
+ *  \return File state
+ *  \retval #FM_NAME_IS_INVALID     \copydoc FM_NAME_IS_INVALID
+ *  \retval #FM_NAME_IS_NOT_IN_USE  \copydoc FM_NAME_IS_NOT_IN_USE
+ *  \retval #FM_NAME_IS_FILE_OPEN   \copydoc FM_NAME_IS_FILE_OPEN
+ *  \retval #FM_NAME_IS_FILE_CLOSED \copydoc FM_NAME_IS_FILE_CLOSED
+ *  \retval #FM_NAME_IS_DIRECTORY   \copydoc FM_NAME_IS_DIRECTORY
+ */
+uint32 FM_ChildScanState(FM_ChildScan_t *ScanPtr, const FM_OpenFileSet_t *SetPtr);
+
+/**
+ *  \brief Child Task Directory Scan Rewind Function
+ *
+ *  \par Description
+ *       This function returns the directory scan to the first entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] ScanPtr Pointer to the directory scan.
+ */
+void FM_ChildScanRewind(FM_ChildScan_t *ScanPtr);
+
+/**
+ *  \brief Child Task Directory Scan Close Function
+ *
+ *  \par Description
+ *       This function closes the directory opened by #FM_ChildScanOpen.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] ScanPtr Pointer to the directory scan.
+ */
+void FM_ChildScanClose(FM_ChildScan_t *ScanPtr);
+
+/**
+ *  \brief Child Task Tracked Directory Find Function
+ *
+ *  \par Description
+ *       This function returns the change tracking record of a directory.  A
+ *       directory that is not tracked gets an unused record, or the least
+ *       recently used record if none is unused, with no entries and a
+ *       change sequence number taken from the local time in seconds.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] Directory Directory name.
+ *
+ *  \return Pointer to the tracked directory record
+ */
+FM_DirTrack_t *FM_ChildDirTrackGet(const char *Directory);
+
+/**
+ *  \brief Child Task Tracked Directory Release Function
+ *
+ *  \par Description
+ *       This function removes the inotify watch of a tracked directory and
+ *       marks the record unused.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] TrackPtr Pointer to the tracked directory record.
+ */
+void FM_ChildDirTrackRelease(FM_DirTrack_t *TrackPtr);
+
+/**
+ *  \brief Child Task Tracked Directory Change Check Function
+ *
+ *  \par Description
+ *       This function reports whether a tracked directory may have changed
+ *       since it was last read.  With #FM_DIR_TRACK_INOTIFY the pending
+ *       events of the directory watch are read, and a watch is added if the
+ *       directory has none.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Without a watch the directory is always reported as changed.
+ *
+ *  \param [in,out] TrackPtr  Pointer to the tracked directory record.
+ *  \param [in]     Directory Directory name.
+ *
+ *  \return Boolean directory changed response
+ *  \retval true  Directory must be read again
+ *  \retval false No change was seen since the directory was last read
+ */
+bool FM_ChildDirTrackChanged(FM_DirTrack_t *TrackPtr, const char *Directory);
+
+/**
+ *  \brief Child Task Tracked Directory Read Function
+ *
+ *  \par Description
+ *       This function reads the size and modify time of every entry of a
+ *       tracked directory and compares them with the entries from the
+ *       previous read.  Added and changed entries take the next change
+ *       sequence number and removed entries are recorded with it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Entries beyond #FM_DIR_TRACK_ENTRIES, entries whose full name is too
+ *       long and entries that cannot be read are counted in UntrackedCount
+ *       and look removed.
+ *
+ *  \param [in,out] TrackPtr Pointer to the tracked directory record.
+ *  \param [in]     CmdArgs  Command arguments with the directory names.
+ *
+ *  \return OSAL status of opening the directory
+ */
+int32 FM_ChildDirTrackScan(FM_DirTrack_t *TrackPtr, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Tracked Directory Removal Function
+ *
+ *  \par Description
+ *       This function records the removal of an entry from a tracked
+ *       directory.  When #FM_DIR_TRACK_REMOVED removals are already recorded
+ *       the oldest is overwritten and RemovedBase moves past it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] TrackPtr Pointer to the tracked directory record.
+ *  \param [in]     Name     Name of the removed entry.
+ *  \param [in]     Sequence Change sequence number of the removal.
+ */
+void FM_ChildDirTrackRemove(FM_DirTrack_t *TrackPtr, const char *Name, uint32 Sequence);
+
+/**
+ *  \brief Child Task Directory Changes Packet Function
+ *
+ *  \par Description
+ *       This function fills the directory changes telemetry packet with the
+ *       changes to a tracked directory since the commanded sequence number.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] TrackPtr Pointer to the tracked directory record.
+ *  \param [in] CmdArgs  Command arguments with the sequence number and offset.
+ */
+void FM_ChildDirChangesReport(const FM_DirTrack_t *TrackPtr, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Directory Changes Packet Entry Function
+ *
+ *  \par Description
+ *       This function counts one change and lists it in the directory
+ *       changes telemetry packet when it is at or after the first change of
+ *       the packet and the packet is not full.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] ReportPtr  Directory changes telemetry payload.
+ *  \param [in]     EntryPtr   Pointer to the changed entry.
+ *  \param [in]     ChangeType Change type, see #FM_DIR_CHANGE_ADDED.
  */
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool GetSizeTimeMode);
+void FM_ChildDirChangesAdd(FM_DirChangesPkt_Payload_t *ReportPtr, const FM_DirTrackEntry_t *EntryPtr,
+                           uint8 ChangeType);
 
 #endif
@@ -32,12 +32,36 @@
 #include "fm_child.h"
 #include "fm_perfids.h"
 #include "fm_events.h"
+#include "fm_stat_cache.h"
 
 #include <string.h>
 #include <ctype.h>
 
-static uint32 OpenFileCount = 0;
-static bool   FileIsOpen    = false;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility local definitions                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+** The OS_ForEachObject callbacks keep their state in a context owned by
+** the caller, so the main task and the child task can search at once
+*/
+
+/* Open files list being loaded */
+typedef struct
+{
+    FM_OpenFilesEntry_t *OpenFilesData; /* Caller list to fill in, NULL to only count */
+    osal_id_t *          ObjIds;        /* Caller list of stream IDs to fill in, may be NULL */
+    uint32               OpenFileCount; /* Number of open files found so far */
+} FM_OpenFilesLoad_t;
+
+/* Open file search */
+typedef struct
+{
+    const char *Filename;   /* Name being searched for */
+    bool        FileIsOpen; /* A stream with the name was found */
+} FM_OpenFileSearch_t;
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -66,43 +90,230 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-static void LoadOpenFileData(osal_id_t ObjId, void *CallbackArg)
+static void LoadOpenFileEntry(osal_id_t ObjId, FM_OpenFilesEntry_t *EntryPtr)
 {
-    FM_OpenFilesEntry_t *OpenFilesData = (FM_OpenFilesEntry_t *)CallbackArg;
-    OS_task_prop_t       TaskInfo;
-    OS_file_prop_t       FdProp;
+    OS_task_prop_t TaskInfo;
+    OS_file_prop_t FdProp;
 
     memset(&FdProp, 0, sizeof(FdProp));
 
+    if (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS)
+    {
+        strncpy(EntryPtr->LogicalName, FdProp.Path, OS_MAX_PATH_LEN);
+
+        /* Get the name of the application that opened the file */
+        memset(&TaskInfo, 0, sizeof(TaskInfo));
+
+        if (OS_TaskGetInfo(FdProp.User, &TaskInfo) == OS_SUCCESS)
+        {
+            strncpy(EntryPtr->AppName, (char *)TaskInfo.name, OS_MAX_API_NAME);
+        }
+    }
+}
+
+static void LoadOpenFileData(osal_id_t ObjId, void *CallbackArg)
+{
+    FM_OpenFilesLoad_t * LoadPtr       = (FM_OpenFilesLoad_t *)CallbackArg;
+    FM_OpenFilesEntry_t *OpenFilesData = LoadPtr->OpenFilesData;
+
     if (OS_IdentifyObject(ObjId) == OS_OBJECT_TYPE_OS_STREAM)
     {
+        if (LoadPtr->ObjIds != NULL)
+        {
+            LoadPtr->ObjIds[LoadPtr->OpenFileCount] = ObjId;
+        }
+
         if (OpenFilesData != (FM_OpenFilesEntry_t *)NULL)
         {
-            if (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS)
-            {
-                strncpy(OpenFilesData[OpenFileCount].LogicalName, FdProp.Path, OS_MAX_PATH_LEN);
+            LoadOpenFileEntry(ObjId, &OpenFilesData[LoadPtr->OpenFileCount]);
+        }
 
-                /* Get the name of the application that opened the file */
-                memset(&TaskInfo, 0, sizeof(TaskInfo));
+        LoadPtr->OpenFileCount++;
+    }
+}
 
-                if (OS_TaskGetInfo(FdProp.User, &TaskInfo) == OS_SUCCESS)
-                {
-                    strncpy(OpenFilesData[OpenFileCount].AppName, (char *)TaskInfo.name, OS_MAX_API_NAME);
-                }
+uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData)
+{
+    FM_OpenFilesLoad_t Load;
+
+    Load.OpenFilesData = OpenFilesData;
+    Load.ObjIds        = NULL;
+    Load.OpenFileCount = 0;
+
+    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenFileData, &Load);
+
+    return Load.OpenFileCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- open files summary                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void OpenFilesSummaryUpdate(bool LoadList)
+{
+    FM_OpenFilesSummary_t *SummaryPtr = &FM_GlobalData.OpenFilesSummary;
+    FM_OpenFileAge_t *     AgePtr     = NULL;
+    uint32                 PrevCount  = 0;
+    uint32                 i;
+    uint32                 j;
+    FM_OpenFilesLoad_t     Load;
+    OS_time_t              LocalTime;
+    FM_OpenFilesEntry_t    AgedFile;
+    FM_OpenFileAge_t       PrevAges[OS_MAX_NUM_OPEN_FILES];
+    osal_id_t              ObjIds[OS_MAX_NUM_OPEN_FILES];
+
+    memset(&LocalTime, 0, sizeof(LocalTime));
+    memset(ObjIds, 0, sizeof(ObjIds));
+
+    PrevCount = SummaryPtr->NumOpenFiles;
+    memcpy(PrevAges, SummaryPtr->Ages, sizeof(PrevAges));
+
+    SummaryPtr->Changed      = false;
+    SummaryPtr->RequestCount = 0;
+
+    memset(SummaryPtr->OpenFilesList, 0, sizeof(SummaryPtr->OpenFilesList));
+    memset(SummaryPtr->Ages, 0, sizeof(SummaryPtr->Ages));
+
+    /* Housekeeping only needs the count and stream IDs, names are looked up for the list */
+    Load.OpenFilesData = NULL;
+    Load.ObjIds        = ObjIds;
+    Load.OpenFileCount = 0;
+
+    if (LoadList == true)
+    {
+        Load.OpenFilesData = SummaryPtr->OpenFilesList;
+    }
+
+    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenFileData, &Load);
+
+    SummaryPtr->NumOpenFiles = Load.OpenFileCount;
+
+    OS_GetLocalTime(&LocalTime);
+    SummaryPtr->RefreshTime = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+
+    /* A stream found by the previous refresh keeps the time it was first found open */
+    for (i = 0; (i < SummaryPtr->NumOpenFiles) && (i < OS_MAX_NUM_OPEN_FILES); i++)
+    {
+        AgePtr            = &SummaryPtr->Ages[i];
+        AgePtr->ObjId     = ObjIds[i];
+        AgePtr->FirstSeen = SummaryPtr->RefreshTime;
+
+        for (j = 0; (j < PrevCount) && (j < OS_MAX_NUM_OPEN_FILES); j++)
+        {
+            if (OS_ObjectIdEqual(PrevAges[j].ObjId, ObjIds[i]) && (PrevAges[j].FirstSeen <= AgePtr->FirstSeen))
+            {
+                AgePtr->FirstSeen = PrevAges[j].FirstSeen;
+                AgePtr->Reported  = PrevAges[j].Reported;
             }
         }
 
-        OpenFileCount++;
+        /* Report each stream once when it has been open too long */
+        if ((FM_OPEN_FILE_AGE_LIMIT > 0) && (AgePtr->Reported == false) &&
+            ((SummaryPtr->RefreshTime - AgePtr->FirstSeen) >= FM_OPEN_FILE_AGE_LIMIT))
+        {
+            AgePtr->Reported = true;
+
+            memset(&AgedFile, 0, sizeof(AgedFile));
+            LoadOpenFileEntry(ObjIds[i], &AgedFile);
+
+            CFE_EVS_SendEvent(FM_OPEN_FILE_AGE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Open file age: %s opened by %s has been open for %u secs", AgedFile.LogicalName,
+                              AgedFile.AppName, (unsigned int)(SummaryPtr->RefreshTime - AgePtr->FirstSeen));
+        }
     }
 }
 
-uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData)
+void FM_OpenFilesSummaryRefresh(void)
+{
+    OpenFilesSummaryUpdate(true);
+}
+
+uint32 FM_GetOpenFilesCount(void)
+{
+    FM_OpenFilesSummary_t *SummaryPtr = &FM_GlobalData.OpenFilesSummary;
+
+    SummaryPtr->RequestCount++;
+
+    if ((SummaryPtr->Changed == true) || (SummaryPtr->RequestCount >= FM_OPEN_FILES_REFRESH_HK))
+    {
+        OpenFilesSummaryUpdate(false);
+    }
+
+    return SummaryPtr->NumOpenFiles;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- open file set                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 OpenFileSetSlot(const char *Filename)
+{
+    uint32 Hash = 2166136261u;
+
+    /* FNV-1a */
+    while (*Filename != '\0')
+    {
+        Hash ^= (uint8)*Filename;
+        Hash *= 16777619u;
+        Filename++;
+    }
+
+    return Hash % FM_OPEN_FILE_SET_SLOTS;
+}
+
+static void LoadOpenFileSet(osal_id_t ObjId, void *CallbackArg)
+{
+    FM_OpenFileSet_t *SetPtr = (FM_OpenFileSet_t *)CallbackArg;
+    OS_file_prop_t    FdProp;
+    uint32            Slot   = 0;
+
+    memset(&FdProp, 0, sizeof(FdProp));
+
+    if ((OS_IdentifyObject(ObjId) == OS_OBJECT_TYPE_OS_STREAM) && (SetPtr->FileCount < OS_MAX_NUM_OPEN_FILES) &&
+        (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS) && (FdProp.Path[0] != '\0'))
+    {
+        FdProp.Path[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* A file open more than once takes a single slot */
+        Slot = OpenFileSetSlot(FdProp.Path);
+
+        while ((SetPtr->Filename[Slot][0] != '\0') && (strcmp(SetPtr->Filename[Slot], FdProp.Path) != 0))
+        {
+            Slot = (Slot + 1) % FM_OPEN_FILE_SET_SLOTS;
+        }
+
+        if (SetPtr->Filename[Slot][0] == '\0')
+        {
+            strncpy(SetPtr->Filename[Slot], FdProp.Path, OS_MAX_PATH_LEN);
+            SetPtr->FileCount++;
+        }
+    }
+}
+
+void FM_OpenFileSetLoad(FM_OpenFileSet_t *SetPtr)
+{
+    memset(SetPtr, 0, sizeof(*SetPtr));
+
+    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenFileSet, SetPtr);
+}
+
+bool FM_OpenFileSetFind(const FM_OpenFileSet_t *SetPtr, const char *Filename)
 {
-    OpenFileCount = 0;
+    uint32 Slot = 0;
 
-    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenFileData, OpenFilesData);
+    /* The set is never full, so the probe ends at a free slot */
+    Slot = OpenFileSetSlot(Filename);
 
-    return OpenFileCount;
+    while ((SetPtr->Filename[Slot][0] != '\0') && (strncmp(SetPtr->Filename[Slot], Filename, OS_MAX_PATH_LEN) != 0))
+    {
+        Slot = (Slot + 1) % FM_OPEN_FILE_SET_SLOTS;
+    }
+
+    return SetPtr->Filename[Slot][0] != '\0';
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -113,33 +324,42 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData)
 
 static void SearchOpenFileData(osal_id_t ObjId, void *CallbackArg)
 {
-    const char *   Fname = (const char *)CallbackArg;
-    OS_file_prop_t FdProp;
+    FM_OpenFileSearch_t *SearchPtr = (FM_OpenFileSearch_t *)CallbackArg;
+    OS_file_prop_t       FdProp;
 
     memset(&FdProp, 0, sizeof(FdProp));
 
-    if (OS_IdentifyObject(ObjId) == OS_OBJECT_TYPE_OS_STREAM)
+    /* The rest of the objects are passed over once the file is found */
+    if ((SearchPtr->FileIsOpen == false) && (OS_IdentifyObject(ObjId) == OS_OBJECT_TYPE_OS_STREAM))
     {
         /* Get system info for each file descriptor table entry */
         /* If the FD table entry is valid - then the file is open */
         if (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS)
         {
-            if (strcmp(Fname, FdProp.Path) == 0)
+            if (strcmp(SearchPtr->Filename, FdProp.Path) == 0)
             {
-                FileIsOpen = true;
+                SearchPtr->FileIsOpen = true;
             }
         }
     }
 }
 
-uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd)
+bool FM_IsFileOpen(const char *Filename)
 {
-    os_fstat_t FileStatus;
-    uint32     FilenameState   = FM_NAME_IS_INVALID;
-    bool       FilenameIsValid = false;
-    int32      StringLength;
+    FM_OpenFileSearch_t Search;
 
-    memset(&FileStatus, 0, sizeof(FileStatus));
+    Search.Filename   = Filename;
+    Search.FileIsOpen = false;
+
+    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, SearchOpenFileData, &Search);
+
+    return Search.FileIsOpen;
+}
+
+static bool FilenameIsValid(const char *Filename, size_t BufferSize)
+{
+    bool  IsValid = false;
+    int32 StringLength;
 
     if (Filename != NULL)
     {
@@ -155,15 +375,40 @@ uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInf
         /* Verify that Filename is not empty and has a terminator */
         if ((StringLength > 0) && (StringLength < BufferSize))
         {
-            FilenameIsValid = true;
+            IsValid = true;
         }
     }
 
+    return IsValid;
+}
+
+static uint32 QueryFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd,
+                                 const FM_OpenFileSet_t *SetPtr)
+{
+    os_fstat_t FileStatus;
+    uint32     FilenameState = FM_NAME_IS_INVALID;
+    int32      StatStatus    = OS_SUCCESS;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
     /* If Filename is valid, then determine its state */
-    if (FilenameIsValid)
+    if (FilenameIsValid(Filename, BufferSize))
     {
+        /*
+         * File Info reports the size and time, which must be current.  Batch
+         * queries cover a whole directory and would only flush the cache.
+         */
+        if ((FileInfoCmd == true) || (SetPtr != NULL))
+        {
+            StatStatus = OS_stat(Filename, &FileStatus);
+        }
+        else
+        {
+            StatStatus = FM_StatCacheGet(Filename, &FileStatus);
+        }
+
         /* Check to see if Filename is in use */
-        if (OS_stat(Filename, &FileStatus) == OS_SUCCESS)
+        if (StatStatus == OS_SUCCESS)
         {
             /* Filename is in use, is it also a directory? */
             if (OS_FILESTAT_ISDIR(FileStatus))
@@ -175,11 +420,15 @@ uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInf
             {
                 /* Filename is a file, but is it open? */
                 FilenameState = FM_NAME_IS_FILE_CLOSED;
-                FileIsOpen    = false;
-
-                OS_ForEachObject(OS_OBJECT_CREATOR_ANY, SearchOpenFileData, (void *)Filename);
 
-                if (FileIsOpen == true)
+                if (SetPtr != NULL)
+                {
+                    if (FM_OpenFileSetFind(SetPtr, Filename) == true)
+                    {
+                        FilenameState = FM_NAME_IS_FILE_OPEN;
+                    }
+                }
+                else if (FM_IsFileOpen(Filename) == true)
                 {
                     FilenameState = FM_NAME_IS_FILE_OPEN;
                 }
@@ -211,6 +460,16 @@ uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInf
     return FilenameState;
 }
 
+uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd)
+{
+    return QueryFilenameState(Filename, BufferSize, FileInfoCmd, NULL);
+}
+
+uint32 FM_GetBatchFilenameState(const char *Filename, size_t BufferSize, const FM_OpenFileSet_t *SetPtr)
+{
+    return QueryFilenameState(Filename, BufferSize, false, SetPtr);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- verify state is not invalid              */
@@ -244,8 +503,8 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
-                        const char *CmdText)
+static bool CheckFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
+                           const char *CmdText)
 {
     bool        Result        = false;
     uint32      FilenameState = FM_NAME_IS_INVALID;
@@ -348,6 +607,51 @@ bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t Buffe
     return Result;
 }
 
+bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
+                        const char *CmdText)
+{
+    FM_ChildVerify_t *VerifyPtr = NULL;
+    bool              Result    = false;
+
+    /*
+    ** With deferred checks the main task only rejects names that are not
+    ** valid strings, the file state is checked later by the child task
+    */
+    if ((FM_GlobalData.DeferVerify == true) && (FM_GlobalData.ChildVerifyCount < FM_CHILD_VERIFY_COUNT) &&
+        (FilenameIsValid(Filename, BufferSize) == true) && (strlen(Filename) < sizeof(VerifyPtr->Name)))
+    {
+        VerifyPtr = &FM_GlobalData.ChildVerify[FM_GlobalData.ChildVerifyCount];
+
+        VerifyPtr->CmdText = CmdText;
+        VerifyPtr->EventID = EventID;
+        VerifyPtr->State   = State;
+        strncpy(VerifyPtr->Name, Filename, sizeof(VerifyPtr->Name) - 1);
+        VerifyPtr->Name[sizeof(VerifyPtr->Name) - 1] = '\0';
+
+        FM_GlobalData.ChildVerifyCount++;
+
+        Result = true;
+    }
+    else
+    {
+        Result = CheckFileState(State, Filename, BufferSize, EventID, CmdText);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- run a file state check deferred to child */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_VerifyDeferredFileState(const FM_ChildVerify_t *VerifyPtr)
+{
+    return CheckFileState((FM_File_States)VerifyPtr->State, VerifyPtr->Name, sizeof(VerifyPtr->Name),
+                          VerifyPtr->EventID, VerifyPtr->CmdText);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- verify state is closed file              */
@@ -422,7 +726,8 @@ bool FM_VerifyDirNoExist(const char *Name, size_t BufferSize, uint32 EventID, co
 
 bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
 {
-    bool Result = false;
+    FM_ChildQueueEntry_t *CmdArgs = NULL;
+    bool                  Result  = false;
 
     /* Copy of child queue count that child task cannot change */
     uint8 LocalQueueCount = FM_GlobalData.ChildQueueCount;
@@ -455,12 +760,20 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
     }
     else
     {
-        memset(&FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex], 0, sizeof(FM_GlobalData.ChildQueue[0]));
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        memset(CmdArgs, 0, sizeof(*CmdArgs));
+
+        /* Hand any deferred file state checks to the child task */
+        CmdArgs->VerifyCount = FM_GlobalData.ChildVerifyCount;
+        memcpy(CmdArgs->Verify, FM_GlobalData.ChildVerify, sizeof(CmdArgs->Verify));
 
         /* OK to add another command to the queue */
         Result = true;
     }
 
+    /* Checks staged for a rejected command must not reach the next one */
+    FM_GlobalData.ChildVerifyCount = 0;
+
     return Result;
 }
 
@@ -573,13 +886,22 @@ CFE_Status_t FM_GetDirectorySpaceEstimate(const char *Directory, uint64 *BlockCo
     char          FullPath[OS_MAX_PATH_LEN];
     uint64        TotalBytes;
     size_t        DirLen;
+    bool          UseIndex;
 
     TotalBytes = 0;
 
     memset(&DirEntry, 0, sizeof(DirEntry));
     snprintf(FullPath, sizeof(FullPath), "%s", Directory);
     DirLen = OS_strnlen(FullPath, OS_MAX_PATH_LEN);
-    if (DirLen < (sizeof(FullPath) - 2))
+
+    /* A directory with a current index is not read at all */
+    UseIndex = FM_DirIndexEstimate(Directory, &TotalBytes);
+
+    if (UseIndex == true)
+    {
+        OS_Status = OS_SUCCESS;
+    }
+    else if (DirLen < (sizeof(FullPath) - 2))
     {
         FullPath[DirLen] = '/';
         ++DirLen;
@@ -601,6 +923,12 @@ CFE_Status_t FM_GetDirectorySpaceEstimate(const char *Directory, uint64 *BlockCo
 
         Result = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
+    else if (UseIndex == true)
+    {
+        /* Total was taken from the index */
+        *ByteCount = TotalBytes;
+        Result     = CFE_SUCCESS;
+    }
     else
     {
         /* Read each directory entry and stat the files */
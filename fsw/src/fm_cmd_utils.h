@@ -45,6 +45,56 @@ typedef enum
     FM_DIR_NOEXIST   /**< \brief FM Directory Does Not Exist */
 } FM_File_States;
 
+/**
+ *  \brief Number of open file set slots
+ *
+ *  Twice the number of files OSAL can have open, so that a slot is always
+ *  free and probe sequences stay short.
+ */
+#define FM_OPEN_FILE_SET_SLOTS (2 * OS_MAX_NUM_OPEN_FILES)
+
+/**
+ *  \brief Open file set
+ *
+ *  Names of the files that were open when the set was loaded, in a hash
+ *  table with linear probing.  An empty name marks a free slot.
+ */
+typedef struct
+{
+    uint32 FileCount;                                         /**< \brief Number of names in the set */
+    char   Filename[FM_OPEN_FILE_SET_SLOTS][OS_MAX_PATH_LEN]; /**< \brief Open file names by hash slot */
+} FM_OpenFileSet_t;
+
+/**
+ *  \brief Open file age
+ *
+ *  Time an open stream was first found by an open files summary refresh.
+ */
+typedef struct
+{
+    osal_id_t ObjId;     /**< \brief OSAL stream ID */
+    uint32    FirstSeen; /**< \brief Local time in seconds of the first refresh that found the stream */
+    bool      Reported;  /**< \brief Stream was reported as open too long */
+} FM_OpenFileAge_t;
+
+/**
+ *  \brief Open files summary
+ *
+ *  Open file table taken by the main task for housekeeping and the Get
+ *  Open Files command, so that OSAL is not searched on every request.
+ *  Ages has an entry for each open file.  OpenFilesList is only filled
+ *  by a full refresh, a housekeeping refresh leaves it empty.
+ */
+typedef struct
+{
+    bool                Changed;                              /**< \brief Child task opened or deleted files */
+    uint32              RequestCount;                         /**< \brief Housekeeping requests since last refresh */
+    uint32              RefreshTime;                          /**< \brief Local time in seconds of last refresh */
+    uint32              NumOpenFiles;                         /**< \brief Number of open files at last refresh */
+    FM_OpenFilesEntry_t OpenFilesList[OS_MAX_NUM_OPEN_FILES]; /**< \brief Open files at last full refresh */
+    FM_OpenFileAge_t    Ages[OS_MAX_NUM_OPEN_FILES];          /**< \brief Open file ages at last refresh */
+} FM_OpenFilesSummary_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM command handler utility function prototypes                  */
@@ -80,6 +130,8 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText);
  *       This function creates a list of open files
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Keeps no state of its own, the main task and the child task may
+ *       call it at the same time.
  *
  *  \param [in]  OpenFilesData pointer to open files data
  *
@@ -89,6 +141,68 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText);
  */
 uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData);
 
+/**
+ *  \brief Refresh Open Files Summary Function
+ *
+ *  \par Description
+ *       This function takes a new summary of the OSAL open file table.
+ *       Streams found by the previous summary keep the time they were first
+ *       found open, and a stream open for #FM_OPEN_FILE_AGE_LIMIT seconds
+ *       is reported by an event, once.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the main task only.  The child task marks the summary as
+ *       changed, which is cleared before the search so that a change made
+ *       during the search is not lost.  Ages are only as precise as the
+ *       time between refreshes.
+ *
+ *  \sa #FM_GetOpenFilesData, #FM_GetOpenFilesCount
+ */
+void FM_OpenFilesSummaryRefresh(void);
+
+/**
+ *  \brief Get Open Files Count Function
+ *
+ *  \par Description
+ *       This function returns the number of open files for housekeeping.
+ *       The summary is refreshed every #FM_OPEN_FILES_REFRESH_HK requests,
+ *       or when the child task has marked it as changed.  The refresh
+ *       counts the open streams and updates their ages without reading
+ *       their names, which are only read for a stream reported as open
+ *       too long.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the main task once per housekeeping request.
+ *
+ *  \return The number of open files
+ *
+ *  \sa #FM_OpenFilesSummaryRefresh
+ */
+uint32 FM_GetOpenFilesCount(void);
+
+/**
+ *  \brief Is File Open Function
+ *
+ *  \par Description
+ *       This function searches the OSAL open file table for a stream that
+ *       was opened with the input filename.  It is the open file check made
+ *       by #FM_GetFilenameState, for callers that already know the name
+ *       refers to a file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The search state is on the stack of the caller, so more than one
+ *       task may search at once.
+ *
+ *  \param [in]  Filename    Pointer to buffer containing filename
+ *
+ *  \return Boolean file is open response
+ *  \retval true  File is open
+ *  \retval false File is not open
+ *
+ *  \sa #OS_FDGetInfo
+ */
+bool FM_IsFileOpen(const char *Filename);
+
 /**
  *  \brief Get Filename State Function
  *
@@ -100,6 +214,8 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData);
  *       also stores the file size and last modified timestamp.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       May be called from any task, except that FileInfoCmd is only set by
+ *       the main task since the stored file info is global.
  *
  *  \param [in]  Filename    Pointer to buffer containing filename
  *  \param [in]  BufferSize  Size of filename character buffer
@@ -116,6 +232,62 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData);
  */
 uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd);
 
+/**
+ *  \brief Load Open File Set Function
+ *
+ *  \par Description
+ *       This function searches the OSAL open file table once and places the
+ *       name of every open stream in an open file set.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The set does not see files opened or closed after it was loaded.
+ *
+ *  \param [out] SetPtr Pointer to the open file set
+ *
+ *  \sa #FM_OpenFileSetFind
+ */
+void FM_OpenFileSetLoad(FM_OpenFileSet_t *SetPtr);
+
+/**
+ *  \brief Find In Open File Set Function
+ *
+ *  \par Description
+ *       This function reports whether a filename is in an open file set.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in] SetPtr   Pointer to the open file set
+ *  \param [in] Filename Pointer to buffer containing filename
+ *
+ *  \return Boolean file is open response
+ *  \retval true  File was open when the set was loaded
+ *  \retval false File was not open when the set was loaded
+ *
+ *  \sa #FM_OpenFileSetLoad
+ */
+bool FM_OpenFileSetFind(const FM_OpenFileSet_t *SetPtr, const char *Filename);
+
+/**
+ *  \brief Get Batch Filename State Function
+ *
+ *  \par Description
+ *       This function is #FM_GetFilenameState for commands that check many
+ *       files.  When an open file set is given, the open file check is made
+ *       against the set instead of the OSAL open file table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       File info is never stored.
+ *
+ *  \param [in] Filename   Pointer to buffer containing filename
+ *  \param [in] BufferSize Size of filename character buffer
+ *  \param [in] SetPtr     Pointer to the open file set, or NULL to search OSAL
+ *
+ *  \return File state, as #FM_GetFilenameState
+ *
+ *  \sa #FM_OpenFileSetLoad
+ */
+uint32 FM_GetBatchFilenameState(const char *Filename, size_t BufferSize, const FM_OpenFileSet_t *SetPtr);
+
 /**
  *  \brief Verify Name Function
  *
@@ -149,6 +321,10 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
  *       an error event if the state is anything other than the given state.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       When file state checks are deferred (#FM_CHILD_DEFER_VERIFY) a
+ *       valid name is not looked up.  The check is staged instead and
+ *       returns true, and #FM_VerifyChildTask hands the staged checks to
+ *       the child queue entry.  Only called by the main task.
  *
  *  \param [in]  State      State of file to verify
  *  \param [in]  Filename   Pointer to buffer containing filename
@@ -165,6 +341,27 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
 bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
                         const char *CmdText);
 
+/**
+ *  \brief Verify Deferred File State Function
+ *
+ *  \par Description
+ *       This function runs a file state check that the main task deferred
+ *       and generates the same error event as #FM_VerifyFileState would
+ *       have if the file is not in the required state.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the child task before it runs the command.
+ *
+ *  \param [in]  VerifyPtr Pointer to the deferred check
+ *
+ *  \return Boolean file state response
+ *  \retval true  File is in the required state
+ *  \retval false File is not in the required state
+ *
+ *  \sa #FM_VerifyFileState, #FM_ChildVerify_t
+ */
+bool FM_VerifyDeferredFileState(const FM_ChildVerify_t *VerifyPtr);
+
 /**
  *  \brief Verify File is Closed Function
  *
@@ -307,6 +504,8 @@ bool FM_VerifyDirNoExist(const char *Name, size_t BufferSize, uint32 EventID, co
  *       not full and that the queue index values are within bounds.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The queue entry is cleared and given any file state checks staged
+ *       by the command.  The staged checks are dropped either way.
  *
  *  \param [in]  EventID Error event ID (command-specific)
  *  \param [in]  CmdText Error event text (command-specific)
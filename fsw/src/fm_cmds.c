@@ -32,11 +32,13 @@
 #include "fm_app.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_digest.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_version.h"
 #include "fm_verify.h"
 
+#include <stddef.h>
 #include <string.h>
 
 /**
@@ -516,8 +518,7 @@ bool FM_GetFileInfoCmd(const CFE_SB_Buffer_t *BufPtr)
 
 bool FM_GetOpenFilesCmd(const CFE_SB_Buffer_t *BufPtr)
 {
-    const char *CmdText      = "Get Open Files";
-    uint32      NumOpenFiles = 0;
+    const char *CmdText = "Get Open Files";
 
     FM_OpenFilesPkt_Payload_t *ReportPtr = &FM_GlobalData.OpenFilesPkt.Payload;
 
@@ -525,10 +526,11 @@ bool FM_GetOpenFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.OpenFilesPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_OPEN_FILES_TLM_MID),
                  sizeof(FM_OpenFilesPkt_t));
 
-    /* Get list of open files and count */
-    NumOpenFiles = FM_GetOpenFilesData(ReportPtr->OpenFilesList);
+    /* Take a new open files summary, which housekeeping also reports */
+    FM_OpenFilesSummaryRefresh();
 
-    ReportPtr->NumOpenFiles = NumOpenFiles;
+    memcpy(ReportPtr->OpenFilesList, FM_GlobalData.OpenFilesSummary.OpenFilesList, sizeof(ReportPtr->OpenFilesList));
+    ReportPtr->NumOpenFiles = FM_GlobalData.OpenFilesSummary.NumOpenFiles;
 
     /* Timestamp and send open files telemetry packet */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.OpenFilesPkt.TelemetryHeader));
@@ -540,6 +542,98 @@ bool FM_GetOpenFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     return true;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Page of Open Files                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetOpenFilesPageCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *               CmdText       = "Get Open Files Page";
+    const FM_OpenFilesEntry_t *EntryPtr      = NULL;
+    const FM_OpenFileAge_t *   AgePtr        = NULL;
+    bool                       CommandResult = true;
+    size_t                     PrefixLength  = 0;
+    uint32                     MaxFiles      = 0;
+    uint32                     i;
+
+    const FM_GetOpenFilesPage_Payload_t *CmdPtr    = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetOpenFilesPageCmd_t);
+    FM_OpenFilesPagePkt_Payload_t *      ReportPtr = &FM_GlobalData.OpenFilesPagePkt.Payload;
+
+    /* Verify that the filters are terminated */
+    if ((OS_strnlen(CmdPtr->AppName, sizeof(CmdPtr->AppName)) == sizeof(CmdPtr->AppName)) ||
+        (OS_strnlen(CmdPtr->PathPrefix, sizeof(CmdPtr->PathPrefix)) == sizeof(CmdPtr->PathPrefix)))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_GET_OPEN_FILES_PAGE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: application name or path prefix is not terminated", CmdText);
+    }
+
+    if (CommandResult == true)
+    {
+        /* A limit of zero, or more than fits, fills the packet */
+        MaxFiles = CmdPtr->MaxFiles;
+        if ((MaxFiles == 0) || (MaxFiles > OS_MAX_NUM_OPEN_FILES))
+        {
+            MaxFiles = OS_MAX_NUM_OPEN_FILES;
+        }
+
+        PrefixLength = strlen(CmdPtr->PathPrefix);
+
+        CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.OpenFilesPagePkt.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(FM_OPEN_FILES_PAGE_TLM_MID), sizeof(FM_OpenFilesPagePkt_t));
+
+        ReportPtr->FirstFile = CmdPtr->FileOffset;
+
+        /* Take a new open files summary, which housekeeping also reports */
+        FM_OpenFilesSummaryRefresh();
+
+        ReportPtr->TotalOpenFiles = FM_GlobalData.OpenFilesSummary.NumOpenFiles;
+
+        for (i = 0; (i < ReportPtr->TotalOpenFiles) && (i < OS_MAX_NUM_OPEN_FILES); i++)
+        {
+            EntryPtr = &FM_GlobalData.OpenFilesSummary.OpenFilesList[i];
+            AgePtr   = &FM_GlobalData.OpenFilesSummary.Ages[i];
+
+            if (((CmdPtr->AppName[0] == '\0') ||
+                 (strncmp(EntryPtr->AppName, CmdPtr->AppName, sizeof(EntryPtr->AppName)) == 0)) &&
+                (strncmp(EntryPtr->LogicalName, CmdPtr->PathPrefix, PrefixLength) == 0) &&
+                ((FM_GlobalData.OpenFilesSummary.RefreshTime - AgePtr->FirstSeen) >= CmdPtr->MinOpenSecs))
+            {
+                if ((ReportPtr->MatchingFiles >= ReportPtr->FirstFile) && (ReportPtr->PacketFiles < MaxFiles))
+                {
+                    memcpy(ReportPtr->OpenFilesList[ReportPtr->PacketFiles].LogicalName, EntryPtr->LogicalName,
+                           sizeof(EntryPtr->LogicalName));
+                    memcpy(ReportPtr->OpenFilesList[ReportPtr->PacketFiles].AppName, EntryPtr->AppName,
+                           sizeof(EntryPtr->AppName));
+                    ReportPtr->OpenFilesList[ReportPtr->PacketFiles].OpenSecs =
+                        FM_GlobalData.OpenFilesSummary.RefreshTime - AgePtr->FirstSeen;
+                    ReportPtr->PacketFiles++;
+                }
+
+                ReportPtr->MatchingFiles++;
+            }
+        }
+
+        /* Send only the header and the listed files */
+        CFE_MSG_SetSize(CFE_MSG_PTR(FM_GlobalData.OpenFilesPagePkt.TelemetryHeader),
+                        offsetof(FM_OpenFilesPagePkt_t, Payload.OpenFilesList) +
+                            (ReportPtr->PacketFiles * sizeof(FM_OpenFilesPageEntry_t)));
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.OpenFilesPagePkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.OpenFilesPagePkt.TelemetryHeader), true);
+
+        CFE_EVS_SendEvent(FM_GET_OPEN_FILES_PAGE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: offset = %u, matching = %u, sent = %u", CmdText,
+                          (unsigned int)ReportPtr->FirstFile, (unsigned int)ReportPtr->MatchingFiles,
+                          (unsigned int)ReportPtr->PacketFiles);
+    }
+
+    return CommandResult;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM command handler -- Create Directory                          */
@@ -638,9 +732,21 @@ bool FM_GetDirListFileCmd(const CFE_SB_Buffer_t *BufPtr)
 
     const FM_GetDirectoryToFile_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetDirListFileCmd_t);
 
-    /* Verify that source directory exists */
-    CommandResult =
-        FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_FILE_SRC_BASE_EID, CmdText);
+    /* Verify the output file format and depth */
+    if ((CmdPtr->ListFormat > FM_DIR_LIST_FORMAT_COMPACT) || (CmdPtr->MaxDepth > FM_DIR_LIST_MAX_DEPTH))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid argument: format = %d, depth = %d", CmdText, (int)CmdPtr->ListFormat,
+                          (int)CmdPtr->MaxDepth);
+    }
+    else
+    {
+        /* Verify that source directory exists */
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_FILE_SRC_BASE_EID, CmdText);
+    }
 
     /* Verify that target file is not already open */
     if (CommandResult == true)
@@ -679,6 +785,8 @@ bool FM_GetDirListFileCmd(const CFE_SB_Buffer_t *BufPtr)
         /* Set handshake queue command args */
         CmdArgs->CommandCode     = FM_GET_DIR_LIST_FILE_CC;
         CmdArgs->GetSizeTimeMode = CmdPtr->GetSizeTimeMode;
+        CmdArgs->ListFormat      = CmdPtr->ListFormat;
+        CmdArgs->MaxDepth        = CmdPtr->MaxDepth;
         strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
         CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
 
@@ -710,9 +818,20 @@ bool FM_GetDirListPktCmd(const CFE_SB_Buffer_t *BufPtr)
 
     const FM_GetDirectoryToPkt_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetDirListPktCmd_t);
 
-    /* Verify that source directory exists */
-    CommandResult =
-        FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_PKT_SRC_BASE_EID, CmdText);
+    /* Verify the packet mode */
+    if (CmdPtr->PacketMode > FM_DIR_LIST_PKT_STREAM)
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_GET_DIR_PKT_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid argument: mode = %d", CmdText, (int)CmdPtr->PacketMode);
+    }
+    else
+    {
+        /* Verify that source directory exists */
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_PKT_SRC_BASE_EID, CmdText);
+    }
 
     /* Check for lower priority child task availability */
     if (CommandResult == true)
@@ -733,6 +852,7 @@ bool FM_GetDirListPktCmd(const CFE_SB_Buffer_t *BufPtr)
         /* Set handshake queue command args */
         CmdArgs->CommandCode     = FM_GET_DIR_LIST_PKT_CC;
         CmdArgs->GetSizeTimeMode = CmdPtr->GetSizeTimeMode;
+        CmdArgs->PacketMode      = CmdPtr->PacketMode;
         strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
         CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
 
@@ -944,3 +1064,378 @@ bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr)
 
     return CommandResult;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Write Directory Checksum Manifest         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirManifestCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText                     = "Directory Manifest";
+    char                  DirWithSep[OS_MAX_PATH_LEN] = "\0";
+    char                  Filename[OS_MAX_PATH_LEN]   = "\0";
+    FM_ChildQueueEntry_t *CmdArgs                     = NULL;
+    bool                  CommandResult;
+
+    const FM_DirManifest_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_DirManifestCmd_t);
+
+    /* Verify that source directory exists */
+    CommandResult =
+        FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_DIR_MANIFEST_SRC_BASE_EID, CmdText);
+
+    /* Verify that target file is not already open */
+    if (CommandResult == true)
+    {
+        /* Use default filename if not specified in the command */
+        if (CmdPtr->Filename[0] == '\0')
+        {
+            strncpy(Filename, FM_DIR_MANIFEST_FILE_DEFNAME, sizeof(Filename) - 1);
+            Filename[sizeof(Filename) - 1] = '\0';
+        }
+        else
+        {
+            memcpy(Filename, CmdPtr->Filename, sizeof(Filename));
+        }
+
+        /* Note: it is OK for this file to overwrite a previous version of the file */
+        CommandResult = FM_VerifyFileNotOpen(Filename, sizeof(Filename), FM_DIR_MANIFEST_TGT_BASE_EID, CmdText);
+    }
+
+    /* Verify that the CRC or hash algorithm is known */
+    if ((CommandResult == true) && (FM_DigestIsSupported(CmdPtr->FileInfoCRC) == false))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_DIR_MANIFEST_TYPE_ERR_EID, CFE_EVS_EventType_ERROR, "%s error: invalid CRC type = %d",
+                          CmdText, (int)CmdPtr->FileInfoCRC);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_DIR_MANIFEST_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+
+        /* Append a path separator to the end of the directory name */
+        strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        DirWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(DirWithSep, OS_MAX_PATH_LEN);
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_DIR_MANIFEST_CC;
+        CmdArgs->FileInfoCRC = CmdPtr->FileInfoCRC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Source2, DirWithSep, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Target, Filename, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Compare Files                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CompareFilesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText = "Compare Files";
+    FM_ChildQueueEntry_t *CmdArgs = NULL;
+    bool                  CommandResult;
+
+    const FM_CompareFiles_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_CompareFilesCmd_t);
+
+    /* Verify that source file #1 exists, is not a directory and is not open */
+    CommandResult =
+        FM_VerifyFileClosed(CmdPtr->Source1, sizeof(CmdPtr->Source1), FM_COMPARE_FILES_SRC1_BASE_EID, CmdText);
+
+    /* Verify that source file #2 exists, is not a directory and is not open */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileClosed(CmdPtr->Source2, sizeof(CmdPtr->Source2), FM_COMPARE_FILES_SRC2_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_COMPARE_FILES_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_COMPARE_FILES_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Source1, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+        strncpy(CmdArgs->Source2, CmdPtr->Source2, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Sorted List of Directory Entries      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetDirListSortedCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText                     = "Sorted Directory List";
+    char                  DirWithSep[OS_MAX_PATH_LEN] = "\0";
+    FM_ChildQueueEntry_t *CmdArgs                     = NULL;
+    bool                  CommandResult               = true;
+
+    const FM_GetDirListSorted_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetDirListSortedCmd_t);
+
+    /* Verify the sort arguments and that the pattern is terminated */
+    if ((CmdPtr->SortKey > FM_SORT_BY_SIZE) || (CmdPtr->SortDirection > FM_SORT_DESCENDING) ||
+        (OS_strnlen(CmdPtr->Pattern, sizeof(CmdPtr->Pattern)) == sizeof(CmdPtr->Pattern)))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_GET_DIR_SORTED_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid argument: key = %d, direction = %d", CmdText, (int)CmdPtr->SortKey,
+                          (int)CmdPtr->SortDirection);
+    }
+
+    /* Verify that source directory exists */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_SORTED_SRC_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_GET_DIR_SORTED_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+
+        /* Append a path separator to the end of the directory name */
+        strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        DirWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(DirWithSep, OS_MAX_PATH_LEN);
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode     = FM_GET_DIR_LIST_SORTED_CC;
+        CmdArgs->GetSizeTimeMode = CmdPtr->GetSizeTimeMode;
+        CmdArgs->SortKey         = CmdPtr->SortKey;
+        CmdArgs->SortDirection   = CmdPtr->SortDirection;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Source2, DirWithSep, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Pattern is known to be terminated and is shorter than a path */
+        snprintf(CmdArgs->Target, sizeof(CmdArgs->Target), "%s", CmdPtr->Pattern);
+
+        /* A limit of zero, or more than fits, fills the packet */
+        CmdArgs->MaxEntries = CmdPtr->MaxEntries;
+        if ((CmdArgs->MaxEntries == 0) || (CmdArgs->MaxEntries > FM_DIR_LIST_PKT_ENTRIES))
+        {
+            CmdArgs->MaxEntries = FM_DIR_LIST_PKT_ENTRIES;
+        }
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Directory Statistics                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetDirStatsCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText                     = "Directory Statistics";
+    char                  DirWithSep[OS_MAX_PATH_LEN] = "\0";
+    FM_ChildQueueEntry_t *CmdArgs                     = NULL;
+    bool                  CommandResult;
+
+    const FM_GetDirStats_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetDirStatsCmd_t);
+
+    /* Verify that source directory exists */
+    CommandResult =
+        FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_STATS_SRC_BASE_EID, CmdText);
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_GET_DIR_STATS_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+
+        /* Append a path separator to the end of the directory name */
+        strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        DirWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(DirWithSep, OS_MAX_PATH_LEN);
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_GET_DIR_STATS_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Source2, DirWithSep, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+
+#if FM_DIR_TRACK_DIRS > 0
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Directory Changes                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetDirChangesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText                     = "Directory Changes";
+    char                  DirWithSep[OS_MAX_PATH_LEN] = "\0";
+    FM_ChildQueueEntry_t *CmdArgs                     = NULL;
+    bool                  CommandResult;
+
+    const FM_GetDirChanges_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetDirChangesCmd_t);
+
+    /* Verify that source directory exists */
+    CommandResult =
+        FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_GET_DIR_CHANGES_SRC_BASE_EID, CmdText);
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_GET_DIR_CHANGES_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+
+        /* Append a path separator to the end of the directory name */
+        strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        DirWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(DirWithSep, OS_MAX_PATH_LEN);
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_GET_DIR_CHANGES_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Source2, DirWithSep, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        CmdArgs->SinceSequence = CmdPtr->SinceSequence;
+        CmdArgs->DirListOffset = CmdPtr->ChangeOffset;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Build Directory Index                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_BuildDirIndexCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText                     = "Build Directory Index";
+    char                  DirWithSep[OS_MAX_PATH_LEN] = "\0";
+    FM_ChildQueueEntry_t *CmdArgs                     = NULL;
+    bool                  CommandResult               = true;
+
+    const FM_BuildDirIndex_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_BuildDirIndexCmd_t);
+
+    if (FM_GlobalData.DirIndexEnable == false)
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_BUILD_DIR_INDEX_DISABLED_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: directory index is disabled", CmdText);
+    }
+
+    /* Verify that source directory exists */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_BUILD_DIR_INDEX_SRC_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_BUILD_DIR_INDEX_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+
+        /* Append a path separator to the end of the directory name */
+        strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        DirWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+        FM_AppendPathSep(DirWithSep, OS_MAX_PATH_LEN);
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_BUILD_DIR_INDEX_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Source2, DirWithSep, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
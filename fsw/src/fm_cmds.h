@@ -425,4 +425,177 @@ bool FM_SetTableStateCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Directory Manifest Command Handler Function
+ *
+ *  \par Description
+ *       This function generates a manifest file containing the name, size,
+ *       last modify time and digest of each closed file in a directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory and files will be performed by a lower priority
+ *       child task.  As such, the return value for this function only refers to
+ *       the result of command argument verification and being able to place the
+ *       command on the child task interface queue.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_DIR_MANIFEST_CC, #FM_DirManifestCmd_t, #FM_DirManifestEntry_t
+ */
+bool FM_DirManifestCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Compare Files Command Handler Function
+ *
+ *  \par Description
+ *       This function compares the sizes and contents of two files and
+ *       reports the result in a telemetry packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the files will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_COMPARE_FILES_CC, #FM_CompareFilesCmd_t, #FM_CompareFilesPkt_t
+ */
+bool FM_CompareFilesCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Get Sorted Directory List to Packet Command Handler Function
+ *
+ *  \par Description
+ *       This function sends a telemetry packet listing the entries of a
+ *       directory that match a name pattern, ordered by name, time or size
+ *       and limited to a command-specified number of entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_GET_DIR_LIST_SORTED_CC, #FM_GetDirListSortedCmd_t, #FM_DirListPkt_t
+ */
+bool FM_GetDirListSortedCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Get Directory Statistics Command Handler Function
+ *
+ *  \par Description
+ *       This function sends a telemetry packet with the entry counts, total
+ *       file size, file size histogram, oldest and newest modification times
+ *       and largest file of a directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_GET_DIR_STATS_CC, #FM_GetDirStatsCmd_t, #FM_DirStatsPkt_t
+ */
+bool FM_GetDirStatsCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Get Directory Changes Command Handler Function
+ *
+ *  \par Description
+ *       This function sends a telemetry packet with the entries of a
+ *       directory that changed since a commanded change sequence number.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_GET_DIR_CHANGES_CC, #FM_GetDirChangesCmd_t, #FM_DirChangesPkt_t
+ */
+bool FM_GetDirChangesCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Build Directory Index Command Handler Function
+ *
+ *  \par Description
+ *       This function writes a persistent index file of the entries of a
+ *       directory, used to list the directory without reading it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Because of the possibility that this command might take a very long time
+ *       to complete, command argument validation will be done immediately but
+ *       reading the directory will be performed by a lower priority child task.
+ *       As such, the return value for this function only refers to the result
+ *       of command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_BUILD_DIR_INDEX_CC, #FM_BuildDirIndexCmd_t
+ */
+bool FM_BuildDirIndexCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Get Open Files Page Command Handler Function
+ *
+ *  \par Description
+ *       This function sends a telemetry packet with the open files that match
+ *       the application name and path prefix filters, starting from the
+ *       commanded offset.  The packet length covers only the listed files.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Takes a new open files summary, which housekeeping also reports.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_GET_OPEN_FILES_PAGE_CC, #FM_GetOpenFilesPageCmd_t, #FM_OpenFilesPagePkt_t
+ */
+bool FM_GetOpenFilesPageCmd(const CFE_SB_Buffer_t *BufPtr);
+
 #endif
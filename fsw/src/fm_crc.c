@@ -0,0 +1,838 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) CRC Calculation Functions
+ *
+ *  Provides table driven (slicing-by-8) CRC calculation for the
+ *  Get File Info command, with optional CRC-32 and CRC-32C hardware
+ *  acceleration, and combination of CRC values of consecutive blocks
+ */
+
+#include "cfe.h"
+#include "fm_crc.h"
+#include "fm_platform_cfg.h"
+#include "fm_verify.h"
+
+#include <string.h>
+
+/************************************************************************
+** Hardware CRC-32 and CRC-32C acceleration
+** The accelerated paths are compiled only for GCC compatible compilers on
+** processors that may have the instructions, and are used only when the
+** processor reports support for them at startup.  Function level target
+** attributes are used so the rest of FM is built for the baseline CPU.
+*************************************************************************/
+#if (FM_CRC_HW_ACCELERATION == 1) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FM_CRC_HAVE_PCLMUL
+#define FM_CRC_HAVE_SSE42
+#include <immintrin.h>
+#endif
+
+#if (FM_CRC_HW_ACCELERATION == 1) && defined(__GNUC__) && defined(__aarch64__) && defined(__linux__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define FM_CRC_HAVE_ARMV8
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#ifdef __clang__
+#define FM_CRC_ARMV8_TARGET __attribute__((target("crc")))
+#else
+#define FM_CRC_ARMV8_TARGET __attribute__((target("+crc")))
+#endif
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local definitions                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Number of bytes consumed per table lookup pass */
+#define FM_CRC_SLICES 8
+
+/* Widest CRC register, one GF(2) matrix column per register bit */
+#define FM_CRC_MAX_WIDTH 32
+
+/* Generator polynomials (reflected form for the reflected algorithms) */
+#define FM_CRC8_POLY   0x07
+#define FM_CRC16_POLY  0xA001
+#define FM_CRC32_POLY  0xEDB88320
+#define FM_CRC32C_POLY 0x82F63B78
+
+/*
+** Slicing table entry [k][n] is the CRC register contribution of byte
+** value n followed by k zero bytes.  The register is kept in the low
+** bits of a uint32 for all algorithm widths so one loop serves all.
+*/
+typedef struct
+{
+    uint32 Table[FM_CRC_SLICES][256];
+} FM_CrcTable_t;
+
+static FM_CrcTable_t FM_Crc8Table;
+static FM_CrcTable_t FM_Crc16Table;
+static FM_CrcTable_t FM_Crc32Table;
+static FM_CrcTable_t FM_Crc32cTable;
+
+/* CRC-32 and CRC-32C implementations selected at startup */
+static FM_CrcImpl_t FM_Crc32Impl  = FM_CRC_IMPL_TABLE;
+static FM_CrcImpl_t FM_Crc32cImpl = FM_CRC_IMPL_TABLE;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- extend byte tables to slicing tables   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_CrcExtendTable(FM_CrcTable_t *CrcTable)
+{
+    uint32 Slice;
+    uint32 Index;
+    uint32 Crc;
+
+    for (Index = 0; Index < 256; Index++)
+    {
+        Crc = CrcTable->Table[0][Index];
+
+        for (Slice = 1; Slice < FM_CRC_SLICES; Slice++)
+        {
+            Crc                           = (Crc >> 8) ^ CrcTable->Table[0][Crc & 0xFF];
+            CrcTable->Table[Slice][Index] = Crc;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- slicing-by-8 table update              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_CrcUpdate(const FM_CrcTable_t *CrcTable, const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    const uint32(*Table)[256] = CrcTable->Table;
+
+    while (DataLength >= FM_CRC_SLICES)
+    {
+        /* Assemble the first word by byte so the result does not depend on alignment or endianness */
+        Crc ^= (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+
+        Crc = Table[7][Crc & 0xFF] ^ Table[6][(Crc >> 8) & 0xFF] ^ Table[5][(Crc >> 16) & 0xFF] ^
+              Table[4][Crc >> 24] ^ Table[3][BufPtr[4]] ^ Table[2][BufPtr[5]] ^ Table[1][BufPtr[6]] ^
+              Table[0][BufPtr[7]];
+
+        BufPtr += FM_CRC_SLICES;
+        DataLength -= FM_CRC_SLICES;
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = (Crc >> 8) ^ Table[0][(Crc ^ *BufPtr) & 0xFF];
+
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+#ifdef FM_CRC_HAVE_PCLMUL
+
+/* Shortest buffer worth the fold setup, the fold needs at least four 16 byte blocks */
+#define FM_CRC_PCLMUL_MIN_LENGTH 64
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32 PCLMULQDQ folding               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+** Folds 64 bytes per pass with carry-less multiply, reduces to 128 then
+** 64 bits and finishes with a Barrett reduction, following Intel's "Fast
+** CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+** The constants are x^n mod P(x) for the bit-reflected CRC-32 polynomial.
+** DataLength must be a multiple of 16 and at least FM_CRC_PCLMUL_MIN_LENGTH.
+*/
+__attribute__((target("pclmul,sse4.1"))) static uint32 FM_Crc32PclmulFold(const uint8 *BufPtr, size_t DataLength,
+                                                                         uint32 Crc)
+{
+    static const uint64 K1K2[2] __attribute__((aligned(16))) = {0x0154442bd4, 0x01c6e41596};
+    static const uint64 K3K4[2] __attribute__((aligned(16))) = {0x01751997d0, 0x00ccaa009e};
+    static const uint64 K5K0[2] __attribute__((aligned(16))) = {0x0163cd6124, 0x0000000000};
+    static const uint64 Poly[2] __attribute__((aligned(16))) = {0x01db710641, 0x01f7011641};
+
+    __m128i X0, X1, X2, X3, X4, X5, X6, X7, X8;
+    __m128i Y5, Y6, Y7, Y8;
+
+    X1 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x00));
+    X2 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x10));
+    X3 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x20));
+    X4 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x30));
+
+    X1 = _mm_xor_si128(X1, _mm_cvtsi32_si128((int)Crc));
+
+    X0 = _mm_load_si128((const __m128i *)K1K2);
+
+    BufPtr += 64;
+    DataLength -= 64;
+
+    /* Fold four blocks in parallel */
+    while (DataLength >= 64)
+    {
+        X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+        X6 = _mm_clmulepi64_si128(X2, X0, 0x00);
+        X7 = _mm_clmulepi64_si128(X3, X0, 0x00);
+        X8 = _mm_clmulepi64_si128(X4, X0, 0x00);
+
+        X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+        X2 = _mm_clmulepi64_si128(X2, X0, 0x11);
+        X3 = _mm_clmulepi64_si128(X3, X0, 0x11);
+        X4 = _mm_clmulepi64_si128(X4, X0, 0x11);
+
+        Y5 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x00));
+        Y6 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x10));
+        Y7 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x20));
+        Y8 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x30));
+
+        X1 = _mm_xor_si128(_mm_xor_si128(X1, X5), Y5);
+        X2 = _mm_xor_si128(_mm_xor_si128(X2, X6), Y6);
+        X3 = _mm_xor_si128(_mm_xor_si128(X3, X7), Y7);
+        X4 = _mm_xor_si128(_mm_xor_si128(X4, X8), Y8);
+
+        BufPtr += 64;
+        DataLength -= 64;
+    }
+
+    /* Fold the four blocks into one */
+    X0 = _mm_load_si128((const __m128i *)K3K4);
+
+    X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X2), X5);
+
+    X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X3), X5);
+
+    X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X4), X5);
+
+    /* Fold any remaining single blocks */
+    while (DataLength >= 16)
+    {
+        X2 = _mm_loadu_si128((const __m128i *)BufPtr);
+
+        X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+        X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+        X1 = _mm_xor_si128(_mm_xor_si128(X1, X2), X5);
+
+        BufPtr += 16;
+        DataLength -= 16;
+    }
+
+    /* Fold 128 bits to 64 bits */
+    X2 = _mm_clmulepi64_si128(X1, X0, 0x10);
+    X3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    X1 = _mm_srli_si128(X1, 8);
+    X1 = _mm_xor_si128(X1, X2);
+
+    X0 = _mm_loadl_epi64((const __m128i *)K5K0);
+
+    X2 = _mm_srli_si128(X1, 4);
+    X1 = _mm_and_si128(X1, X3);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_xor_si128(X1, X2);
+
+    /* Barrett reduce to 32 bits */
+    X0 = _mm_load_si128((const __m128i *)Poly);
+
+    X2 = _mm_and_si128(X1, X3);
+    X2 = _mm_clmulepi64_si128(X2, X0, 0x10);
+    X2 = _mm_and_si128(X2, X3);
+    X2 = _mm_clmulepi64_si128(X2, X0, 0x00);
+    X1 = _mm_xor_si128(X1, X2);
+
+    return (uint32)_mm_extract_epi32(X1, 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32 update using PCLMULQDQ          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_Crc32Pclmul(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    size_t FoldLength;
+
+    if (DataLength >= FM_CRC_PCLMUL_MIN_LENGTH)
+    {
+        /* Fold whole 16 byte blocks, the table handles the tail */
+        FoldLength = DataLength & ~((size_t)15);
+        Crc        = FM_Crc32PclmulFold(BufPtr, FoldLength, Crc);
+
+        BufPtr += FoldLength;
+        DataLength -= FoldLength;
+    }
+
+    return FM_CrcUpdate(&FM_Crc32Table, BufPtr, DataLength, Crc);
+}
+
+#endif /* FM_CRC_HAVE_PCLMUL */
+
+#ifdef FM_CRC_HAVE_SSE42
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32C update using SSE4.2 CRC32      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+__attribute__((target("sse4.2"))) static uint32 FM_Crc32cSse42(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+#ifdef __x86_64__
+    uint64 Crc64 = Crc;
+    uint64 Word;
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc64 = _mm_crc32_u64(Crc64, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+
+    Crc = (uint32)Crc64;
+#else
+    uint32 Word;
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = _mm_crc32_u32(Crc, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+#endif
+
+    while (DataLength > 0)
+    {
+        Crc = _mm_crc32_u8(Crc, *BufPtr);
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+#endif /* FM_CRC_HAVE_SSE42 */
+
+#ifdef FM_CRC_HAVE_ARMV8
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32 update using ARMv8 CRC32        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+FM_CRC_ARMV8_TARGET static uint32 FM_Crc32Armv8(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    uint64 Word;
+
+    /* Align to a doubleword so the wide loads do not straddle */
+    while ((DataLength > 0) && (((cpuaddr)BufPtr & 7) != 0))
+    {
+        Crc = __crc32b(Crc, *BufPtr);
+        BufPtr++;
+        DataLength--;
+    }
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = __crc32d(Crc, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = __crc32b(Crc, *BufPtr);
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32C update using ARMv8 CRC32C      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+FM_CRC_ARMV8_TARGET static uint32 FM_Crc32cArmv8(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    uint64 Word;
+
+    while ((DataLength > 0) && (((cpuaddr)BufPtr & 7) != 0))
+    {
+        Crc = __crc32cb(Crc, *BufPtr);
+        BufPtr++;
+        DataLength--;
+    }
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = __crc32cd(Crc, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = __crc32cb(Crc, *BufPtr);
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+#endif /* FM_CRC_HAVE_ARMV8 */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- generate lookup tables                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CrcInit(void)
+{
+    uint32 Index;
+    uint32 Bit;
+    uint32 Crc8;
+    uint32 Crc16;
+    uint32 Crc32;
+    uint32 Crc32c;
+
+    for (Index = 0; Index < 256; Index++)
+    {
+        Crc8   = Index;
+        Crc16  = Index;
+        Crc32  = Index;
+        Crc32c = Index;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            /* CRC-8 is shifted MSB first, the 8 bit register makes the slicing update identical */
+            Crc8   = (Crc8 & 0x80) ? (((Crc8 << 1) ^ FM_CRC8_POLY) & 0xFF) : ((Crc8 << 1) & 0xFF);
+            Crc16  = (Crc16 & 1) ? ((Crc16 >> 1) ^ FM_CRC16_POLY) : (Crc16 >> 1);
+            Crc32  = (Crc32 & 1) ? ((Crc32 >> 1) ^ FM_CRC32_POLY) : (Crc32 >> 1);
+            Crc32c = (Crc32c & 1) ? ((Crc32c >> 1) ^ FM_CRC32C_POLY) : (Crc32c >> 1);
+        }
+
+        FM_Crc8Table.Table[0][Index]   = Crc8;
+        FM_Crc16Table.Table[0][Index]  = Crc16;
+        FM_Crc32Table.Table[0][Index]  = Crc32;
+        FM_Crc32cTable.Table[0][Index] = Crc32c;
+    }
+
+    FM_CrcExtendTable(&FM_Crc8Table);
+    FM_CrcExtendTable(&FM_Crc16Table);
+    FM_CrcExtendTable(&FM_Crc32Table);
+    FM_CrcExtendTable(&FM_Crc32cTable);
+
+    /* Use the fastest implementations this processor supports */
+    if (FM_CrcSelectImpl(CFE_ES_CrcType_CRC_32, FM_CRC_IMPL_PCLMUL) == false)
+    {
+        if (FM_CrcSelectImpl(CFE_ES_CrcType_CRC_32, FM_CRC_IMPL_ARMV8) == false)
+        {
+            FM_CrcSelectImpl(CFE_ES_CrcType_CRC_32, FM_CRC_IMPL_TABLE);
+        }
+    }
+
+    if (FM_CrcSelectImpl(FM_CRC_TYPE_CRC32C, FM_CRC_IMPL_SSE42) == false)
+    {
+        if (FM_CrcSelectImpl(FM_CRC_TYPE_CRC32C, FM_CRC_IMPL_ARMV8) == false)
+        {
+            FM_CrcSelectImpl(FM_CRC_TYPE_CRC32C, FM_CRC_IMPL_TABLE);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- query processor support for implementation   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CrcImplSupported(uint32 TypeCRC, FM_CrcImpl_t Impl)
+{
+    bool Supported = false;
+
+    switch (Impl)
+    {
+        case FM_CRC_IMPL_TABLE:
+            Supported = ((TypeCRC == CFE_ES_CrcType_CRC_8) || (TypeCRC == CFE_ES_CrcType_CRC_16) ||
+                         (TypeCRC == CFE_ES_CrcType_CRC_32) || (TypeCRC == FM_CRC_TYPE_CRC32C));
+            break;
+
+#ifdef FM_CRC_HAVE_PCLMUL
+        case FM_CRC_IMPL_PCLMUL:
+            __builtin_cpu_init();
+            Supported = ((TypeCRC == CFE_ES_CrcType_CRC_32) && __builtin_cpu_supports("pclmul") &&
+                         __builtin_cpu_supports("sse4.1"));
+            break;
+#endif
+
+#ifdef FM_CRC_HAVE_SSE42
+        case FM_CRC_IMPL_SSE42:
+            __builtin_cpu_init();
+            Supported = ((TypeCRC == FM_CRC_TYPE_CRC32C) && __builtin_cpu_supports("sse4.2"));
+            break;
+#endif
+
+#ifdef FM_CRC_HAVE_ARMV8
+        case FM_CRC_IMPL_ARMV8:
+            Supported = (((TypeCRC == CFE_ES_CrcType_CRC_32) || (TypeCRC == FM_CRC_TYPE_CRC32C)) &&
+                         ((getauxval(AT_HWCAP) & HWCAP_CRC32) != 0));
+            break;
+#endif
+
+        default:
+            break;
+    }
+
+    return Supported;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- select CRC implementation                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CrcSelectImpl(uint32 TypeCRC, FM_CrcImpl_t Impl)
+{
+    bool Selected = false;
+
+    if (FM_CrcImplSupported(TypeCRC, Impl) == true)
+    {
+        /* Only CRC-32 and CRC-32C have more than one implementation */
+        if (TypeCRC == CFE_ES_CrcType_CRC_32)
+        {
+            FM_Crc32Impl = Impl;
+        }
+        else if (TypeCRC == FM_CRC_TYPE_CRC32C)
+        {
+            FM_Crc32cImpl = Impl;
+        }
+
+        Selected = true;
+    }
+
+    return Selected;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- report selected CRC implementation           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+FM_CrcImpl_t FM_CrcGetImpl(uint32 TypeCRC)
+{
+    FM_CrcImpl_t Impl = FM_CRC_IMPL_TABLE;
+
+    if (TypeCRC == CFE_ES_CrcType_CRC_32)
+    {
+        Impl = FM_Crc32Impl;
+    }
+    else if (TypeCRC == FM_CRC_TYPE_CRC32C)
+    {
+        Impl = FM_Crc32cImpl;
+    }
+
+    return Impl;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32 update with selected path       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_Crc32Update(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    switch (FM_Crc32Impl)
+    {
+#ifdef FM_CRC_HAVE_PCLMUL
+        case FM_CRC_IMPL_PCLMUL:
+            Crc = FM_Crc32Pclmul(BufPtr, DataLength, Crc);
+            break;
+#endif
+
+#ifdef FM_CRC_HAVE_ARMV8
+        case FM_CRC_IMPL_ARMV8:
+            Crc = FM_Crc32Armv8(BufPtr, DataLength, Crc);
+            break;
+#endif
+
+        default:
+            Crc = FM_CrcUpdate(&FM_Crc32Table, BufPtr, DataLength, Crc);
+            break;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- CRC-32C update with selected path      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_Crc32cUpdate(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    switch (FM_Crc32cImpl)
+    {
+#ifdef FM_CRC_HAVE_SSE42
+        case FM_CRC_IMPL_SSE42:
+            Crc = FM_Crc32cSse42(BufPtr, DataLength, Crc);
+            break;
+#endif
+
+#ifdef FM_CRC_HAVE_ARMV8
+        case FM_CRC_IMPL_ARMV8:
+            Crc = FM_Crc32cArmv8(BufPtr, DataLength, Crc);
+            break;
+#endif
+
+        default:
+            Crc = FM_CrcUpdate(&FM_Crc32cTable, BufPtr, DataLength, Crc);
+            break;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- calculate CRC over a block of data           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    uint32 Crc = 0;
+
+    if ((DataPtr == NULL) || (DataLength == 0))
+    {
+        /* Nothing to add, the CRC is unchanged */
+        Crc = InputCRC;
+    }
+    else
+    {
+        switch (TypeCRC)
+        {
+            case CFE_ES_CrcType_CRC_8:
+                Crc = FM_CrcUpdate(&FM_Crc8Table, DataPtr, DataLength, InputCRC & 0xFF);
+                break;
+
+            case CFE_ES_CrcType_CRC_16:
+                Crc = FM_CrcUpdate(&FM_Crc16Table, DataPtr, DataLength, InputCRC & 0xFFFF);
+                break;
+
+            case CFE_ES_CrcType_CRC_32:
+                /* Pre and post inversion allow the finished CRC to be passed back in for the next block */
+                Crc = ~FM_Crc32Update(DataPtr, DataLength, ~InputCRC);
+                break;
+
+            case FM_CRC_TYPE_CRC32C:
+                Crc = ~FM_Crc32cUpdate(DataPtr, DataLength, ~InputCRC);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- GF(2) matrix times vector              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_CrcMatrixTimes(const uint32 *Matrix, uint32 Vector)
+{
+    uint32 Sum = 0;
+
+    while (Vector != 0)
+    {
+        if ((Vector & 1) != 0)
+        {
+            Sum ^= *Matrix;
+        }
+
+        Vector >>= 1;
+        Matrix++;
+    }
+
+    return Sum;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC local function -- GF(2) matrix square                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_CrcMatrixSquare(uint32 *Square, const uint32 *Matrix, uint32 Width)
+{
+    uint32 Column;
+
+    for (Column = 0; Column < Width; Column++)
+    {
+        Square[Column] = FM_CrcMatrixTimes(Matrix, Matrix[Column]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function -- combine CRC values of consecutive blocks     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_CrcCombine(uint32 Crc1, uint32 Crc2, size_t Length2, uint32 TypeCRC)
+{
+    uint32 Even[FM_CRC_MAX_WIDTH];
+    uint32 Odd[FM_CRC_MAX_WIDTH];
+    uint32 Width     = 0;
+    uint32 Poly      = 0;
+    uint32 Column    = 0;
+    uint32 Combined  = 0;
+    bool   Reflected = true;
+
+    switch (TypeCRC)
+    {
+        case CFE_ES_CrcType_CRC_8:
+            Width     = 8;
+            Poly      = FM_CRC8_POLY;
+            Reflected = false;
+            break;
+
+        case CFE_ES_CrcType_CRC_16:
+            Width = 16;
+            Poly  = FM_CRC16_POLY;
+            break;
+
+        case CFE_ES_CrcType_CRC_32:
+            Width = 32;
+            Poly  = FM_CRC32_POLY;
+            break;
+
+        case FM_CRC_TYPE_CRC32C:
+            Width = 32;
+            Poly  = FM_CRC32C_POLY;
+            break;
+
+        default:
+            break;
+    }
+
+    if (Width < FM_CRC_MAX_WIDTH)
+    {
+        /* Keep only the register bits, the matrices have one column per bit */
+        Crc1 &= ((uint32)1 << Width) - 1;
+        Crc2 &= ((uint32)1 << Width) - 1;
+    }
+
+    if ((Width == 0) || (Length2 == 0))
+    {
+        /* Unsupported type, or nothing follows the first block */
+        Combined = (Width == 0) ? 0 : Crc1;
+    }
+    else
+    {
+        /*
+        ** Build the operator that shifts one zero bit through the CRC
+        ** register.  The CRC-32 pre and post inversion cancel out, so the
+        ** finished CRC values can be combined directly.
+        */
+        for (Column = 0; Column < Width; Column++)
+        {
+            if (Reflected == true)
+            {
+                Odd[Column] = (Column == 0) ? Poly : ((uint32)1 << (Column - 1));
+            }
+            else
+            {
+                Odd[Column] = (Column == (Width - 1)) ? Poly : ((uint32)1 << (Column + 1));
+            }
+        }
+
+        /* Two zero bits, then four zero bits */
+        FM_CrcMatrixSquare(Even, Odd, Width);
+        FM_CrcMatrixSquare(Odd, Even, Width);
+
+        /* Apply one zero byte operator per set bit of Length2, squaring each pass */
+        while (Length2 != 0)
+        {
+            FM_CrcMatrixSquare(Even, Odd, Width);
+
+            if ((Length2 & 1) != 0)
+            {
+                Crc1 = FM_CrcMatrixTimes(Even, Crc1);
+            }
+
+            Length2 >>= 1;
+
+            if (Length2 != 0)
+            {
+                FM_CrcMatrixSquare(Odd, Even, Width);
+
+                if ((Length2 & 1) != 0)
+                {
+                    Crc1 = FM_CrcMatrixTimes(Odd, Crc1);
+                }
+
+                Length2 >>= 1;
+            }
+        }
+
+        Combined = Crc1 ^ Crc2;
+    }
+
+    return Combined;
+}
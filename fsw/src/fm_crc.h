@@ -0,0 +1,193 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager CRC calculation functions.
+ */
+#ifndef FM_CRC_H
+#define FM_CRC_H
+
+#include "cfe.h"
+#include "fm_extern_typedefs.h"
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ *  \brief  FM enum used to select the CRC implementation
+ */
+typedef enum
+{
+    FM_CRC_IMPL_TABLE  = 0, /**< \brief Portable slicing-by-8 table lookup (all CRC types) */
+    FM_CRC_IMPL_PCLMUL = 1, /**< \brief x86 PCLMULQDQ carry-less multiply folding (CRC-32) */
+    FM_CRC_IMPL_ARMV8  = 2, /**< \brief ARMv8 CRC32 and CRC32C instructions (CRC-32, CRC-32C) */
+    FM_CRC_IMPL_SSE42  = 3  /**< \brief x86 SSE4.2 CRC32 instruction (CRC-32C) */
+} FM_CrcImpl_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC function prototypes                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief CRC Table Initialization Function
+ *
+ *  \par Description
+ *       This function is invoked during FM application startup initialization
+ *       to generate the slicing-by-8 lookup tables for each supported CRC
+ *       algorithm.  The tables are generated once and then only read by the
+ *       child task when computing file CRC values.  The fastest CRC-32 and
+ *       CRC-32C implementations supported by the processor are also selected.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the child task is created.
+ *
+ *  \sa #FM_CalculateCRC, #FM_CrcSelectImpl
+ */
+void FM_CrcInit(void);
+
+/**
+ *  \brief Query CRC Implementation Support Function
+ *
+ *  \par Description
+ *       This function reports whether an implementation of a CRC type was
+ *       included in the build and is supported by the processor FM is running
+ *       on.  The portable table implementation supports every CRC type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Hardware implementations are only built when #FM_CRC_HW_ACCELERATION
+ *       is set to 1.
+ *
+ *  \param [in] TypeCRC CRC algorithm selection
+ *  \param [in] Impl    CRC implementation
+ *
+ *  \return Boolean implementation supported response
+ *  \retval true  Implementation may be selected
+ *  \retval false Implementation is not available
+ *
+ *  \sa #FM_CrcSelectImpl
+ */
+bool FM_CrcImplSupported(uint32 TypeCRC, FM_CrcImpl_t Impl);
+
+/**
+ *  \brief Select CRC Implementation Function
+ *
+ *  \par Description
+ *       This function selects the implementation used for subsequent
+ *       calculations of a CRC type.  All implementations produce identical
+ *       results, so this only affects the CPU time needed to compute a file CRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The current selection is unchanged if the implementation is not
+ *       supported.
+ *
+ *  \param [in] TypeCRC CRC algorithm selection
+ *  \param [in] Impl    CRC implementation
+ *
+ *  \return Boolean implementation selected response
+ *  \retval true  Implementation selected
+ *  \retval false Implementation is not available
+ *
+ *  \sa #FM_CrcImplSupported, #FM_CrcGetImpl
+ */
+bool FM_CrcSelectImpl(uint32 TypeCRC, FM_CrcImpl_t Impl);
+
+/**
+ *  \brief Get CRC Implementation Function
+ *
+ *  \par Description
+ *       This function returns the implementation currently used for
+ *       calculations of a CRC type.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in] TypeCRC CRC algorithm selection
+ *
+ *  \return Selected CRC implementation
+ *
+ *  \sa #FM_CrcSelectImpl
+ */
+FM_CrcImpl_t FM_CrcGetImpl(uint32 TypeCRC);
+
+/**
+ *  \brief Calculate CRC Function
+ *
+ *  \par Description
+ *       This function computes a CRC over a block of data, continuing from
+ *       the CRC value returned by a previous call so that a file can be
+ *       processed one buffer at a time.  The supported algorithms are:
+ *
+ *       - #CFE_ES_CrcType_CRC_8  : CRC-8/SMBUS (poly 0x07, init 0x00)
+ *       - #CFE_ES_CrcType_CRC_16 : CRC-16/ARC (poly 0x8005 reflected, init 0x0000),
+ *                                  the same algorithm used by CFE_ES_CalculateCRC
+ *       - #CFE_ES_CrcType_CRC_32 : CRC-32/ISO-HDLC (poly 0x04C11DB7 reflected,
+ *                                  init and final xor 0xFFFFFFFF)
+ *       - #FM_CRC_TYPE_CRC32C    : CRC-32C/ISCSI (poly 0x1EDC6F41 reflected,
+ *                                  init and final xor 0xFFFFFFFF)
+ *
+ *       The data is consumed eight bytes at a time using per-algorithm
+ *       slicing tables, with the remaining tail processed one byte at a time.
+ *       CRC-32 and CRC-32C use the implementation chosen by #FM_CrcSelectImpl.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The initial InputCRC value for the first block of data must be zero.
+ *       An unsupported CRC type returns zero.
+ *
+ *  \param [in] DataPtr    Pointer to the data to include in the CRC
+ *  \param [in] DataLength Number of bytes of data
+ *  \param [in] InputCRC   CRC returned from the previous block (zero for the first block)
+ *  \param [in] TypeCRC    CRC algorithm selection
+ *
+ *  \return CRC value including the new block of data
+ *
+ *  \sa #FM_CrcInit
+ */
+uint32 FM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC);
+
+/**
+ *  \brief Combine CRC Function
+ *
+ *  \par Description
+ *       This function computes the CRC of two consecutive blocks of data
+ *       from the CRC of each block, so that segments of a file can be
+ *       processed independently and in any order.  The CRC of the first
+ *       block is advanced over Length2 zero bytes using GF(2) matrix
+ *       squaring and then combined with the CRC of the second block.  The
+ *       result is identical to #FM_CalculateCRC over both blocks in order.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each block CRC must be computed starting from an InputCRC of zero.
+ *       The cost depends on log2(Length2), not on the amount of data.  An
+ *       unsupported CRC type returns zero.
+ *
+ *  \param [in] Crc1    CRC of the first block of data
+ *  \param [in] Crc2    CRC of the second block of data
+ *  \param [in] Length2 Number of bytes in the second block of data
+ *  \param [in] TypeCRC CRC algorithm selection
+ *
+ *  \return CRC value of the first block followed by the second block
+ *
+ *  \sa #FM_CalculateCRC
+ */
+uint32 FM_CrcCombine(uint32 Crc1, uint32 Crc2, size_t Length2, uint32 TypeCRC);
+
+#endif
@@ -0,0 +1,596 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) File Digest Functions
+ *
+ *  Provides a common streaming interface to the CRC and hash algorithms
+ *  that may be computed over a file
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_crc.h"
+#include "fm_digest.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest local definitions                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* xxHash64 primes */
+#define FM_XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define FM_XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define FM_XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define FM_XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define FM_XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+#define FM_XXH_STRIPE_SIZE 32
+#define FM_XXH_DIGEST_SIZE 8
+
+#define FM_SHA256_BLOCK_SIZE  64
+#define FM_SHA256_DIGEST_SIZE 32
+
+#define FM_ROTL64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+#define FM_ROTR32(x, r) (((x) >> (r)) | ((x) << (32 - (r))))
+
+/* SHA-256 round constants (FIPS 180-4 section 4.2.2) */
+static const uint32 FM_Sha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest local function -- byte order helpers                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint64 FM_DigestGetLE64(const uint8 *BufPtr)
+{
+    return (uint64)BufPtr[0] | ((uint64)BufPtr[1] << 8) | ((uint64)BufPtr[2] << 16) | ((uint64)BufPtr[3] << 24) |
+           ((uint64)BufPtr[4] << 32) | ((uint64)BufPtr[5] << 40) | ((uint64)BufPtr[6] << 48) |
+           ((uint64)BufPtr[7] << 56);
+}
+
+static uint32 FM_DigestGetLE32(const uint8 *BufPtr)
+{
+    return (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+}
+
+static uint32 FM_DigestGetBE32(const uint8 *BufPtr)
+{
+    return ((uint32)BufPtr[0] << 24) | ((uint32)BufPtr[1] << 16) | ((uint32)BufPtr[2] << 8) | (uint32)BufPtr[3];
+}
+
+static void FM_DigestPutBE(uint8 *BufPtr, uint64 Value, uint32 Size)
+{
+    while (Size > 0)
+    {
+        Size--;
+        BufPtr[Size] = (uint8)Value;
+        Value >>= 8;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest local function -- xxHash64                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint64 FM_Xxh64Round(uint64 Acc, uint64 Input)
+{
+    Acc += Input * FM_XXH_PRIME64_2;
+    Acc = FM_ROTL64(Acc, 31);
+    Acc *= FM_XXH_PRIME64_1;
+
+    return Acc;
+}
+
+static uint64 FM_Xxh64MergeRound(uint64 Hash, uint64 Acc)
+{
+    Hash ^= FM_Xxh64Round(0, Acc);
+    Hash = (Hash * FM_XXH_PRIME64_1) + FM_XXH_PRIME64_4;
+
+    return Hash;
+}
+
+static void FM_Xxh64Stripe(FM_Xxh64State_t *StatePtr, const uint8 *BufPtr)
+{
+    StatePtr->Acc[0] = FM_Xxh64Round(StatePtr->Acc[0], FM_DigestGetLE64(&BufPtr[0]));
+    StatePtr->Acc[1] = FM_Xxh64Round(StatePtr->Acc[1], FM_DigestGetLE64(&BufPtr[8]));
+    StatePtr->Acc[2] = FM_Xxh64Round(StatePtr->Acc[2], FM_DigestGetLE64(&BufPtr[16]));
+    StatePtr->Acc[3] = FM_Xxh64Round(StatePtr->Acc[3], FM_DigestGetLE64(&BufPtr[24]));
+}
+
+static void FM_Xxh64Init(FM_Xxh64State_t *StatePtr)
+{
+    memset(StatePtr, 0, sizeof(*StatePtr));
+
+    /* Seed of zero */
+    StatePtr->Acc[0] = FM_XXH_PRIME64_1 + FM_XXH_PRIME64_2;
+    StatePtr->Acc[1] = FM_XXH_PRIME64_2;
+    StatePtr->Acc[2] = 0;
+    StatePtr->Acc[3] = 0 - FM_XXH_PRIME64_1;
+}
+
+static void FM_Xxh64Update(FM_Xxh64State_t *StatePtr, const uint8 *BufPtr, size_t DataLength)
+{
+    uint32 CopyLength;
+
+    StatePtr->TotalLength += DataLength;
+
+    /* Complete a partial stripe left from the previous block */
+    if (StatePtr->BufferSize > 0)
+    {
+        CopyLength = FM_XXH_STRIPE_SIZE - StatePtr->BufferSize;
+        if (CopyLength > DataLength)
+        {
+            CopyLength = DataLength;
+        }
+
+        memcpy(&StatePtr->Buffer[StatePtr->BufferSize], BufPtr, CopyLength);
+        StatePtr->BufferSize += CopyLength;
+        BufPtr += CopyLength;
+        DataLength -= CopyLength;
+
+        if (StatePtr->BufferSize == FM_XXH_STRIPE_SIZE)
+        {
+            FM_Xxh64Stripe(StatePtr, StatePtr->Buffer);
+            StatePtr->BufferSize = 0;
+        }
+    }
+
+    while (DataLength >= FM_XXH_STRIPE_SIZE)
+    {
+        FM_Xxh64Stripe(StatePtr, BufPtr);
+        BufPtr += FM_XXH_STRIPE_SIZE;
+        DataLength -= FM_XXH_STRIPE_SIZE;
+    }
+
+    if (DataLength > 0)
+    {
+        memcpy(StatePtr->Buffer, BufPtr, DataLength);
+        StatePtr->BufferSize = DataLength;
+    }
+}
+
+static uint64 FM_Xxh64Final(const FM_Xxh64State_t *StatePtr)
+{
+    const uint8 *BufPtr    = StatePtr->Buffer;
+    uint32       Remaining = StatePtr->BufferSize;
+    uint64       Hash;
+
+    if (StatePtr->TotalLength >= FM_XXH_STRIPE_SIZE)
+    {
+        Hash = FM_ROTL64(StatePtr->Acc[0], 1) + FM_ROTL64(StatePtr->Acc[1], 7) + FM_ROTL64(StatePtr->Acc[2], 12) +
+               FM_ROTL64(StatePtr->Acc[3], 18);
+
+        Hash = FM_Xxh64MergeRound(Hash, StatePtr->Acc[0]);
+        Hash = FM_Xxh64MergeRound(Hash, StatePtr->Acc[1]);
+        Hash = FM_Xxh64MergeRound(Hash, StatePtr->Acc[2]);
+        Hash = FM_Xxh64MergeRound(Hash, StatePtr->Acc[3]);
+    }
+    else
+    {
+        Hash = FM_XXH_PRIME64_5;
+    }
+
+    Hash += StatePtr->TotalLength;
+
+    while (Remaining >= 8)
+    {
+        Hash ^= FM_Xxh64Round(0, FM_DigestGetLE64(BufPtr));
+        Hash = (FM_ROTL64(Hash, 27) * FM_XXH_PRIME64_1) + FM_XXH_PRIME64_4;
+        BufPtr += 8;
+        Remaining -= 8;
+    }
+
+    if (Remaining >= 4)
+    {
+        Hash ^= (uint64)FM_DigestGetLE32(BufPtr) * FM_XXH_PRIME64_1;
+        Hash = (FM_ROTL64(Hash, 23) * FM_XXH_PRIME64_2) + FM_XXH_PRIME64_3;
+        BufPtr += 4;
+        Remaining -= 4;
+    }
+
+    while (Remaining > 0)
+    {
+        Hash ^= (uint64)(*BufPtr) * FM_XXH_PRIME64_5;
+        Hash = FM_ROTL64(Hash, 11) * FM_XXH_PRIME64_1;
+        BufPtr++;
+        Remaining--;
+    }
+
+    /* Final avalanche */
+    Hash ^= Hash >> 33;
+    Hash *= FM_XXH_PRIME64_2;
+    Hash ^= Hash >> 29;
+    Hash *= FM_XXH_PRIME64_3;
+    Hash ^= Hash >> 32;
+
+    return Hash;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest local function -- SHA-256 (FIPS 180-4)                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_Sha256Block(FM_Sha256State_t *StatePtr, const uint8 *BufPtr)
+{
+    uint32 W[64];
+    uint32 A, B, C, D, E, F, G, H;
+    uint32 T1, T2;
+    uint32 i;
+
+    for (i = 0; i < 16; i++)
+    {
+        W[i] = FM_DigestGetBE32(&BufPtr[i * 4]);
+    }
+
+    for (i = 16; i < 64; i++)
+    {
+        W[i] = (FM_ROTR32(W[i - 2], 17) ^ FM_ROTR32(W[i - 2], 19) ^ (W[i - 2] >> 10)) + W[i - 7] +
+               (FM_ROTR32(W[i - 15], 7) ^ FM_ROTR32(W[i - 15], 18) ^ (W[i - 15] >> 3)) + W[i - 16];
+    }
+
+    A = StatePtr->State[0];
+    B = StatePtr->State[1];
+    C = StatePtr->State[2];
+    D = StatePtr->State[3];
+    E = StatePtr->State[4];
+    F = StatePtr->State[5];
+    G = StatePtr->State[6];
+    H = StatePtr->State[7];
+
+    for (i = 0; i < 64; i++)
+    {
+        T1 = H + (FM_ROTR32(E, 6) ^ FM_ROTR32(E, 11) ^ FM_ROTR32(E, 25)) + ((E & F) ^ (~E & G)) + FM_Sha256K[i] + W[i];
+        T2 = (FM_ROTR32(A, 2) ^ FM_ROTR32(A, 13) ^ FM_ROTR32(A, 22)) + ((A & B) ^ (A & C) ^ (B & C));
+
+        H = G;
+        G = F;
+        F = E;
+        E = D + T1;
+        D = C;
+        C = B;
+        B = A;
+        A = T1 + T2;
+    }
+
+    StatePtr->State[0] += A;
+    StatePtr->State[1] += B;
+    StatePtr->State[2] += C;
+    StatePtr->State[3] += D;
+    StatePtr->State[4] += E;
+    StatePtr->State[5] += F;
+    StatePtr->State[6] += G;
+    StatePtr->State[7] += H;
+}
+
+static void FM_Sha256Init(FM_Sha256State_t *StatePtr)
+{
+    memset(StatePtr, 0, sizeof(*StatePtr));
+
+    StatePtr->State[0] = 0x6a09e667;
+    StatePtr->State[1] = 0xbb67ae85;
+    StatePtr->State[2] = 0x3c6ef372;
+    StatePtr->State[3] = 0xa54ff53a;
+    StatePtr->State[4] = 0x510e527f;
+    StatePtr->State[5] = 0x9b05688c;
+    StatePtr->State[6] = 0x1f83d9ab;
+    StatePtr->State[7] = 0x5be0cd19;
+}
+
+static void FM_Sha256Update(FM_Sha256State_t *StatePtr, const uint8 *BufPtr, size_t DataLength)
+{
+    uint32 CopyLength;
+
+    StatePtr->TotalLength += DataLength;
+
+    /* Complete a partial block left from the previous data */
+    if (StatePtr->BufferSize > 0)
+    {
+        CopyLength = FM_SHA256_BLOCK_SIZE - StatePtr->BufferSize;
+        if (CopyLength > DataLength)
+        {
+            CopyLength = DataLength;
+        }
+
+        memcpy(&StatePtr->Buffer[StatePtr->BufferSize], BufPtr, CopyLength);
+        StatePtr->BufferSize += CopyLength;
+        BufPtr += CopyLength;
+        DataLength -= CopyLength;
+
+        if (StatePtr->BufferSize == FM_SHA256_BLOCK_SIZE)
+        {
+            FM_Sha256Block(StatePtr, StatePtr->Buffer);
+            StatePtr->BufferSize = 0;
+        }
+    }
+
+    while (DataLength >= FM_SHA256_BLOCK_SIZE)
+    {
+        FM_Sha256Block(StatePtr, BufPtr);
+        BufPtr += FM_SHA256_BLOCK_SIZE;
+        DataLength -= FM_SHA256_BLOCK_SIZE;
+    }
+
+    if (DataLength > 0)
+    {
+        memcpy(StatePtr->Buffer, BufPtr, DataLength);
+        StatePtr->BufferSize = DataLength;
+    }
+}
+
+static void FM_Sha256Final(FM_Sha256State_t *StatePtr, uint8 *DigestPtr)
+{
+    uint64 BitLength = StatePtr->TotalLength * 8;
+    uint32 i;
+
+    /* Append the 0x80 terminator, pad with zeros and finish with the message length in bits */
+    StatePtr->Buffer[StatePtr->BufferSize] = 0x80;
+    StatePtr->BufferSize++;
+
+    if (StatePtr->BufferSize > (FM_SHA256_BLOCK_SIZE - 8))
+    {
+        memset(&StatePtr->Buffer[StatePtr->BufferSize], 0, FM_SHA256_BLOCK_SIZE - StatePtr->BufferSize);
+        FM_Sha256Block(StatePtr, StatePtr->Buffer);
+        StatePtr->BufferSize = 0;
+    }
+
+    memset(&StatePtr->Buffer[StatePtr->BufferSize], 0, (FM_SHA256_BLOCK_SIZE - 8) - StatePtr->BufferSize);
+    FM_DigestPutBE(&StatePtr->Buffer[FM_SHA256_BLOCK_SIZE - 8], BitLength, 8);
+    FM_Sha256Block(StatePtr, StatePtr->Buffer);
+
+    for (i = 0; i < 8; i++)
+    {
+        FM_DigestPutBE(&DigestPtr[i * 4], StatePtr->State[i], 4);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function -- query algorithm support                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DigestIsSupported(uint32 TypeCRC)
+{
+    bool Supported = false;
+
+    switch (TypeCRC)
+    {
+        case CFE_ES_CrcType_CRC_8:
+        case CFE_ES_CrcType_CRC_16:
+        case CFE_ES_CrcType_CRC_32:
+        case FM_CRC_TYPE_CRC32C:
+        case FM_CRC_TYPE_XXHASH64:
+        case FM_CRC_TYPE_SHA256:
+            Supported = true;
+            break;
+
+        default:
+            break;
+    }
+
+    return Supported;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function -- start digest                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestInit(FM_DigestContext_t *ContextPtr, uint32 TypeCRC)
+{
+    memset(ContextPtr, 0, sizeof(*ContextPtr));
+
+    ContextPtr->TypeCRC = TypeCRC;
+
+    if (TypeCRC == FM_CRC_TYPE_XXHASH64)
+    {
+        FM_Xxh64Init(&ContextPtr->Hash.Xxh64);
+    }
+    else if (TypeCRC == FM_CRC_TYPE_SHA256)
+    {
+        FM_Sha256Init(&ContextPtr->Hash.Sha256);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function -- add data to digest                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestUpdate(FM_DigestContext_t *ContextPtr, const void *DataPtr, size_t DataLength)
+{
+    if ((DataPtr != NULL) && (DataLength > 0))
+    {
+        if (ContextPtr->TypeCRC == FM_CRC_TYPE_XXHASH64)
+        {
+            FM_Xxh64Update(&ContextPtr->Hash.Xxh64, DataPtr, DataLength);
+        }
+        else if (ContextPtr->TypeCRC == FM_CRC_TYPE_SHA256)
+        {
+            FM_Sha256Update(&ContextPtr->Hash.Sha256, DataPtr, DataLength);
+        }
+        else
+        {
+            ContextPtr->Crc = FM_CalculateCRC(DataPtr, DataLength, ContextPtr->Crc, ContextPtr->TypeCRC);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function -- finish digest                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_DigestFinal(FM_DigestContext_t *ContextPtr, uint8 *DigestPtr, uint8 *DigestSizePtr)
+{
+    uint32 Summary    = 0;
+    uint8  DigestSize = 0;
+
+    memset(DigestPtr, 0, FM_MAX_DIGEST_SIZE);
+
+    switch (ContextPtr->TypeCRC)
+    {
+        case CFE_ES_CrcType_CRC_8:
+            DigestSize = 1;
+            break;
+
+        case CFE_ES_CrcType_CRC_16:
+            DigestSize = 2;
+            break;
+
+        case CFE_ES_CrcType_CRC_32:
+        case FM_CRC_TYPE_CRC32C:
+            DigestSize = 4;
+            break;
+
+        case FM_CRC_TYPE_XXHASH64:
+            FM_DigestPutBE(DigestPtr, FM_Xxh64Final(&ContextPtr->Hash.Xxh64), FM_XXH_DIGEST_SIZE);
+            DigestSize = FM_XXH_DIGEST_SIZE;
+            break;
+
+        case FM_CRC_TYPE_SHA256:
+            FM_Sha256Final(&ContextPtr->Hash.Sha256, DigestPtr);
+            DigestSize = FM_SHA256_DIGEST_SIZE;
+            break;
+
+        default:
+            break;
+    }
+
+    if ((ContextPtr->TypeCRC == FM_CRC_TYPE_XXHASH64) || (ContextPtr->TypeCRC == FM_CRC_TYPE_SHA256))
+    {
+        Summary = FM_DigestGetBE32(DigestPtr);
+    }
+    else
+    {
+        /* CRC digests are the CRC value itself */
+        Summary = ContextPtr->Crc;
+        FM_DigestPutBE(DigestPtr, Summary, DigestSize);
+    }
+
+    *DigestSizePtr = DigestSize;
+
+    return Summary;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function -- find cached digest                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DigestCacheLookup(const char *Filename, uint32 FileSize, uint32 FileTime, uint32 TypeCRC, uint32 *CrcPtr,
+                          uint8 *DigestPtr, uint8 *DigestSizePtr)
+{
+    FM_DigestCacheEntry_t *EntryPtr = NULL;
+    bool                   Found    = false;
+    uint32                 i;
+
+    for (i = 0; (i < FM_DIGEST_CACHE_ENTRIES) && (Found == false); i++)
+    {
+        EntryPtr = &FM_GlobalData.DigestCache[i];
+
+        if ((EntryPtr->Filename[0] != '\0') && (EntryPtr->TypeCRC == TypeCRC) && (EntryPtr->FileSize == FileSize) &&
+            (EntryPtr->FileTime == FileTime) && (strncmp(EntryPtr->Filename, Filename, OS_MAX_PATH_LEN) == 0))
+        {
+            Found = true;
+        }
+    }
+
+    if (Found == true)
+    {
+        FM_GlobalData.DigestCacheUseCount++;
+        EntryPtr->LastUsed = FM_GlobalData.DigestCacheUseCount;
+
+        memset(DigestPtr, 0, FM_MAX_DIGEST_SIZE);
+        memcpy(DigestPtr, EntryPtr->Digest, EntryPtr->DigestSize);
+        *DigestSizePtr = EntryPtr->DigestSize;
+        *CrcPtr        = EntryPtr->Crc;
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function -- save digest in cache                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestCacheStore(const char *Filename, uint32 FileSize, uint32 FileTime, uint32 TypeCRC, uint32 Crc,
+                         const uint8 *DigestPtr, uint8 DigestSize)
+{
+    FM_DigestCacheEntry_t *EntryPtr = &FM_GlobalData.DigestCache[0];
+    bool                   SameFile = false;
+    uint32                 i;
+
+    /* Reuse the entry for this file and algorithm, else an unused entry, else the least recently used */
+    for (i = 0; (i < FM_DIGEST_CACHE_ENTRIES) && (SameFile == false); i++)
+    {
+        if ((FM_GlobalData.DigestCache[i].TypeCRC == TypeCRC) &&
+            (strncmp(FM_GlobalData.DigestCache[i].Filename, Filename, OS_MAX_PATH_LEN) == 0))
+        {
+            EntryPtr = &FM_GlobalData.DigestCache[i];
+            SameFile = true;
+        }
+        else if ((EntryPtr->Filename[0] != '\0') && ((FM_GlobalData.DigestCache[i].Filename[0] == '\0') ||
+                                                     (FM_GlobalData.DigestCache[i].LastUsed < EntryPtr->LastUsed)))
+        {
+            EntryPtr = &FM_GlobalData.DigestCache[i];
+        }
+    }
+
+    if (DigestSize > FM_MAX_DIGEST_SIZE)
+    {
+        DigestSize = FM_MAX_DIGEST_SIZE;
+    }
+
+    FM_GlobalData.DigestCacheUseCount++;
+
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+    snprintf(EntryPtr->Filename, sizeof(EntryPtr->Filename), "%s", Filename);
+    EntryPtr->FileSize   = FileSize;
+    EntryPtr->FileTime   = FileTime;
+    EntryPtr->TypeCRC    = TypeCRC;
+    EntryPtr->Crc        = Crc;
+    EntryPtr->LastUsed   = FM_GlobalData.DigestCacheUseCount;
+    EntryPtr->DigestSize = DigestSize;
+    memcpy(EntryPtr->Digest, DigestPtr, DigestSize);
+}
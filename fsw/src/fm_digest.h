@@ -0,0 +1,224 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager file digest (CRC and hash)
+ *   functions.
+ */
+#ifndef FM_DIGEST_H
+#define FM_DIGEST_H
+
+#include "cfe.h"
+#include "fm_extern_typedefs.h"
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ *  \brief xxHash64 running state
+ */
+typedef struct
+{
+    uint64 TotalLength; /**< \brief Number of bytes hashed so far */
+    uint64 Acc[4];      /**< \brief Stripe accumulators */
+    uint8  Buffer[32];  /**< \brief Partial stripe not yet hashed */
+    uint32 BufferSize;  /**< \brief Number of bytes in Buffer */
+} FM_Xxh64State_t;
+
+/**
+ *  \brief SHA-256 running state
+ */
+typedef struct
+{
+    uint64 TotalLength; /**< \brief Number of bytes hashed so far */
+    uint32 State[8];    /**< \brief Intermediate hash value */
+    uint8  Buffer[64];  /**< \brief Partial block not yet hashed */
+    uint32 BufferSize;  /**< \brief Number of bytes in Buffer */
+} FM_Sha256State_t;
+
+/**
+ *  \brief File digest calculation context
+ */
+typedef struct
+{
+    uint32 TypeCRC; /**< \brief CRC or hash algorithm selection */
+    uint32 Crc;     /**< \brief Running CRC for the CRC algorithms */
+
+    union
+    {
+        FM_Xxh64State_t  Xxh64;  /**< \brief Running xxHash64 state */
+        FM_Sha256State_t Sha256; /**< \brief Running SHA-256 state */
+    } Hash;
+} FM_DigestContext_t;
+
+/**
+ *  \brief Cached file digest result
+ */
+typedef struct
+{
+    char   Filename[OS_MAX_PATH_LEN];  /**< \brief File name, empty if entry is unused */
+    uint32 FileSize;                   /**< \brief File size when the digest was computed */
+    uint32 FileTime;                   /**< \brief File modify time when the digest was computed */
+    uint32 TypeCRC;                    /**< \brief CRC or hash algorithm selection */
+    uint32 Crc;                        /**< \brief 32 bit digest summary, see #FM_DigestFinal */
+    uint32 LastUsed;                   /**< \brief Cache usage count when last stored or found */
+    uint8  DigestSize;                 /**< \brief Number of valid bytes in Digest */
+    uint8  Digest[FM_MAX_DIGEST_SIZE]; /**< \brief Full digest, most significant byte first */
+} FM_DigestCacheEntry_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest function prototypes                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Query Digest Algorithm Support Function
+ *
+ *  \par Description
+ *       This function reports whether FM can compute the requested CRC or
+ *       hash algorithm.  The supported algorithms are the cFE CRC types
+ *       (#CFE_ES_CrcType_CRC_8, #CFE_ES_CrcType_CRC_16, #CFE_ES_CrcType_CRC_32)
+ *       and #FM_CRC_TYPE_CRC32C, #FM_CRC_TYPE_XXHASH64 and #FM_CRC_TYPE_SHA256.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #FM_IGNORE_CRC is not a supported algorithm.
+ *
+ *  \param [in] TypeCRC CRC or hash algorithm selection
+ *
+ *  \return Boolean algorithm supported response
+ *  \retval true  Algorithm is supported
+ *  \retval false Algorithm is not supported
+ */
+bool FM_DigestIsSupported(uint32 TypeCRC);
+
+/**
+ *  \brief Start Digest Function
+ *
+ *  \par Description
+ *       This function initializes a digest context for the selected
+ *       algorithm.  File data is then added with #FM_DigestUpdate and the
+ *       result collected with #FM_DigestFinal.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The algorithm must be supported, see #FM_DigestIsSupported.
+ *
+ *  \param [out] ContextPtr Pointer to digest context
+ *  \param [in]  TypeCRC    CRC or hash algorithm selection
+ *
+ *  \sa #FM_DigestUpdate, #FM_DigestFinal
+ */
+void FM_DigestInit(FM_DigestContext_t *ContextPtr, uint32 TypeCRC);
+
+/**
+ *  \brief Add Data To Digest Function
+ *
+ *  \par Description
+ *       This function adds a block of file data to a digest.  Data may be
+ *       added in blocks of any size.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in,out] ContextPtr Pointer to digest context
+ *  \param [in]     DataPtr    Pointer to the data to add
+ *  \param [in]     DataLength Number of bytes of data
+ *
+ *  \sa #FM_DigestInit, #FM_DigestFinal
+ */
+void FM_DigestUpdate(FM_DigestContext_t *ContextPtr, const void *DataPtr, size_t DataLength);
+
+/**
+ *  \brief Finish Digest Function
+ *
+ *  \par Description
+ *       This function completes a digest and stores the result most
+ *       significant byte first.  The digest size is 1, 2 or 4 bytes for the
+ *       CRC algorithms, 8 bytes for xxHash64 and 32 bytes for SHA-256.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The context must be initialized again before it is reused.
+ *
+ *  \param [in,out] ContextPtr    Pointer to digest context
+ *  \param [out]    DigestPtr     Buffer of at least #FM_MAX_DIGEST_SIZE bytes for the result
+ *  \param [out]    DigestSizePtr Number of valid bytes stored in DigestPtr
+ *
+ *  \return 32 bit summary of the digest: the CRC value for the CRC
+ *          algorithms, otherwise the first four digest bytes
+ *
+ *  \sa #FM_DigestInit, #FM_DigestUpdate
+ */
+uint32 FM_DigestFinal(FM_DigestContext_t *ContextPtr, uint8 *DigestPtr, uint8 *DigestSizePtr);
+
+/**
+ *  \brief Find Cached Digest Function
+ *
+ *  \par Description
+ *       This function searches the digest cache for a result previously
+ *       computed for the same file name, size, modify time and algorithm.
+ *       A match means the file data has not changed and the result can be
+ *       reported without reading the file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cache is only used by the child task.  File size and modify time
+ *       should come from a stat of the file taken when the command was received.
+ *
+ *  \param [in]  Filename      Name of the file
+ *  \param [in]  FileSize      Current file size
+ *  \param [in]  FileTime      Current file modify time
+ *  \param [in]  TypeCRC       CRC or hash algorithm selection
+ *  \param [out] CrcPtr        32 bit digest summary, see #FM_DigestFinal
+ *  \param [out] DigestPtr     Buffer of at least #FM_MAX_DIGEST_SIZE bytes for the result
+ *  \param [out] DigestSizePtr Number of valid bytes stored in DigestPtr
+ *
+ *  \return Boolean cache hit response
+ *  \retval true  Result found, outputs are valid
+ *  \retval false Result not found, outputs are unchanged
+ *
+ *  \sa #FM_DigestCacheStore
+ */
+bool FM_DigestCacheLookup(const char *Filename, uint32 FileSize, uint32 FileTime, uint32 TypeCRC, uint32 *CrcPtr,
+                          uint8 *DigestPtr, uint8 *DigestSizePtr);
+
+/**
+ *  \brief Save Digest In Cache Function
+ *
+ *  \par Description
+ *       This function saves a computed digest result in the digest cache,
+ *       replacing any result for the same file and algorithm.  When the cache
+ *       is full the least recently used entry is replaced.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cache is only used by the child task.
+ *
+ *  \param [in] Filename   Name of the file
+ *  \param [in] FileSize   File size before the digest was computed
+ *  \param [in] FileTime   File modify time before the digest was computed
+ *  \param [in] TypeCRC    CRC or hash algorithm selection
+ *  \param [in] Crc        32 bit digest summary, see #FM_DigestFinal
+ *  \param [in] DigestPtr  Full digest, most significant byte first
+ *  \param [in] DigestSize Number of valid bytes in DigestPtr
+ *
+ *  \sa #FM_DigestCacheLookup
+ */
+void FM_DigestCacheStore(const char *Filename, uint32 FileSize, uint32 FileTime, uint32 TypeCRC, uint32 Crc,
+                         const uint8 *DigestPtr, uint8 DigestSize);
+
+#endif
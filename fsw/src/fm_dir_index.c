@@ -0,0 +1,870 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Persistent Directory Index Functions
+ *
+ *  Keeps a sorted file of the entries of a directory so that large
+ *  directories can be listed without reading every entry each time
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_child.h"
+#include "fm_crc.h"
+#include "fm_dir_index.h"
+#include "fm_platform_cfg.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index local definitions                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_DIR_INDEX_SUFFIX "idx"
+
+/* Work files of an index being built, the sorted runs move between them */
+static const char *const FM_DirIndexWorkSuffix[2] = {"wk0", "wk1"};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index local function -- directory name CRC         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_DirIndexNameCrc(const char *Directory)
+{
+    return FM_CalculateCRC(Directory, OS_strnlen(Directory, OS_MAX_PATH_LEN), 0, CFE_ES_CrcType_CRC_32);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index local function -- index file names           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_DirIndexFileName(const char *Directory, const char *Suffix, char *FileName)
+{
+    snprintf(FileName, OS_MAX_PATH_LEN, "%s/%08lx.%s", FM_DIR_INDEX_PATH,
+             (unsigned long)FM_DirIndexNameCrc(Directory), Suffix);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index local function -- add or drop listed index   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_DirIndexListUpdate(uint32 NameCrc, bool Indexed)
+{
+    FM_DirIndexList_t *ListPtr = &FM_GlobalData.DirIndexList;
+    uint32             i       = 0;
+
+    while ((i < ListPtr->Count) && (ListPtr->NameCrc[i] != NameCrc))
+    {
+        i++;
+    }
+
+    if ((Indexed == true) && (i == ListPtr->Count))
+    {
+        if (ListPtr->Count < FM_DIR_INDEX_DIRS)
+        {
+            ListPtr->NameCrc[ListPtr->Count] = NameCrc;
+            ListPtr->Count++;
+        }
+        else
+        {
+            /* Index files that do not fit are looked for by every command */
+            ListPtr->Overflow = true;
+        }
+    }
+    else if ((Indexed == false) && (i < ListPtr->Count))
+    {
+        /* Order does not matter, the last name CRC takes the place of the removed one */
+        ListPtr->Count--;
+        ListPtr->NameCrc[i] = ListPtr->NameCrc[ListPtr->Count];
+    }
+    else
+    {
+        /* List already matches */
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index local function -- order entries by name      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static int FM_DirIndexCompare(const void *Entry1, const void *Entry2)
+{
+    return strcmp(((const FM_DirListEntry_t *)Entry1)->EntryName, ((const FM_DirListEntry_t *)Entry2)->EntryName);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index local function -- file offset of a record    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static int32 FM_DirIndexOffset(uint32 Index)
+{
+    return (int32)(sizeof(FM_DirIndexHeader_t) + ((size_t)Index * sizeof(FM_DirListEntry_t)));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- index file name                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DirIndexName(const char *Directory, char *IndexName)
+{
+    FM_DirIndexFileName(Directory, FM_DIR_INDEX_SUFFIX, IndexName);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- directory may have an index      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexKnown(const char *Directory)
+{
+    FM_DirIndexList_t *ListPtr = &FM_GlobalData.DirIndexList;
+    uint32             NameCrc = 0;
+    uint32             i       = 0;
+    bool               Known   = false;
+
+    if (FM_GlobalData.DirIndexEnable == true)
+    {
+        if (ListPtr->Loaded == false)
+        {
+            FM_DirIndexListLoad();
+        }
+
+        Known   = ListPtr->Overflow;
+        NameCrc = FM_DirIndexNameCrc(Directory);
+
+        for (i = 0; (i < ListPtr->Count) && (Known == false); i++)
+        {
+            Known = (ListPtr->NameCrc[i] == NameCrc);
+        }
+    }
+
+    return Known;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- list existing index files        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DirIndexListLoad(void)
+{
+    FM_DirIndexList_t *ListPtr   = &FM_GlobalData.DirIndexList;
+    osal_id_t          DirId     = OS_OBJECT_ID_UNDEFINED;
+    const char *       EntryName = NULL;
+    char *             EndPtr    = NULL;
+    unsigned long      NameCrc   = 0;
+    os_dirent_t        DirEntry;
+
+    memset(ListPtr, 0, sizeof(*ListPtr));
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    ListPtr->Loaded = true;
+
+    /* No index directory means no index files */
+    if (OS_DirectoryOpen(&DirId, FM_DIR_INDEX_PATH) == OS_SUCCESS)
+    {
+        while (OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS)
+        {
+            EntryName = OS_DIRENTRY_NAME(DirEntry);
+            NameCrc   = strtoul(EntryName, &EndPtr, 16);
+
+            /* Index files are named by FM_DirIndexFileName, work files are skipped */
+            if (((EndPtr - EntryName) == 8) && (strcmp(EndPtr, "." FM_DIR_INDEX_SUFFIX) == 0))
+            {
+                FM_DirIndexListUpdate((uint32)NameCrc, true);
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- remove index file                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DirIndexRemove(const char *Directory)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    char                IndexName[OS_MAX_PATH_LEN];
+    FM_DirIndexHeader_t Header;
+
+    /* Only an index of this directory, another one may have the same file name */
+    if (FM_DirIndexOpen(Directory, false, &FileHandle, &Header) == true)
+    {
+        OS_close(FileHandle);
+
+        FM_DirIndexName(Directory, IndexName);
+        OS_remove(IndexName);
+
+        FM_DirIndexListUpdate(FM_DirIndexNameCrc(Directory), false);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- open index file                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexOpen(const char *Directory, bool CheckTime, osal_id_t *FileHandlePtr, FM_DirIndexHeader_t *HeaderPtr)
+{
+    bool      IndexOpen  = false;
+    osal_id_t FileHandle = OS_OBJECT_ID_UNDEFINED;
+    char      IndexName[OS_MAX_PATH_LEN];
+    uint32    DirSize = 0;
+    uint32    DirTime = 0;
+    uint32    DirMode = 0;
+
+    FM_DirIndexName(Directory, IndexName);
+
+    /* Most directories have no index, their index file is not looked for */
+    if ((FM_DirIndexKnown(Directory) == true) &&
+        (OS_OpenCreate(&FileHandle, IndexName, OS_FILE_FLAG_NONE, OS_READ_WRITE) == OS_SUCCESS))
+    {
+        /* Another directory may have an index file of the same name */
+        if ((OS_read(FileHandle, HeaderPtr, sizeof(*HeaderPtr)) == sizeof(*HeaderPtr)) &&
+            (HeaderPtr->Magic == FM_DIR_INDEX_MAGIC) && (HeaderPtr->RecordSize == sizeof(FM_DirListEntry_t)) &&
+            (strncmp(HeaderPtr->DirName, Directory, sizeof(HeaderPtr->DirName)) == 0))
+        {
+            IndexOpen = true;
+
+            if (CheckTime == true)
+            {
+                /* A time of zero marks an index that could not be kept up to date */
+                IndexOpen = (HeaderPtr->DirTime != 0) &&
+                            (FM_ChildSizeTimeMode(Directory, &DirSize, &DirTime, &DirMode) == OS_SUCCESS) &&
+                            (DirTime == HeaderPtr->DirTime);
+            }
+        }
+
+        if (IndexOpen == true)
+        {
+            *FileHandlePtr = FileHandle;
+        }
+        else
+        {
+            OS_close(FileHandle);
+        }
+    }
+
+    return IndexOpen;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- read index records               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_DirIndexRead(osal_id_t FileHandle, uint32 Index, uint32 Count, FM_DirListEntry_t *EntryPtr)
+{
+    uint32 ReadCount = 0;
+    int32  BytesRead = 0;
+
+    if (OS_lseek(FileHandle, FM_DirIndexOffset(Index), OS_SEEK_SET) >= 0)
+    {
+        BytesRead = OS_read(FileHandle, EntryPtr, Count * sizeof(FM_DirListEntry_t));
+
+        if (BytesRead > 0)
+        {
+            ReadCount = BytesRead / sizeof(FM_DirListEntry_t);
+        }
+    }
+
+    return ReadCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- write index records              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexWrite(osal_id_t FileHandle, uint32 Index, uint32 Count, const FM_DirListEntry_t *EntryPtr)
+{
+    bool  Written      = false;
+    int32 BytesWritten = 0;
+
+    if (OS_lseek(FileHandle, FM_DirIndexOffset(Index), OS_SEEK_SET) >= 0)
+    {
+        BytesWritten = OS_write(FileHandle, EntryPtr, Count * sizeof(FM_DirListEntry_t));
+
+        Written = (BytesWritten == (int32)(Count * sizeof(FM_DirListEntry_t)));
+    }
+
+    return Written;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- build index file                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_DirIndexBuild(const char *Directory, const char *DirWithSep, FM_DirIndexHeader_t *HeaderPtr)
+{
+    FM_DirListEntry_t *EntryPtr       = NULL;
+    osal_id_t          WorkHandle[2]  = {OS_OBJECT_ID_UNDEFINED, OS_OBJECT_ID_UNDEFINED};
+    uint32             SortCount      = 0;
+    uint32             RunLength      = FM_DIR_INDEX_SORT_ENTRIES;
+    uint32             Current        = 0;
+    uint32             DirSize        = 0;
+    uint32             DirMode        = 0;
+    uint32             i              = 0;
+    int32              FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
+    int32              Status         = OS_SUCCESS;
+    bool               Written        = true;
+    char               IndexName[OS_MAX_PATH_LEN];
+    char               WorkName[2][OS_MAX_PATH_LEN];
+    FM_ChildScan_t     Scan;
+
+    memset(HeaderPtr, 0, sizeof(*HeaderPtr));
+    HeaderPtr->Magic      = FM_DIR_INDEX_MAGIC;
+    HeaderPtr->RecordSize = sizeof(FM_DirListEntry_t);
+    snprintf(HeaderPtr->DirName, sizeof(HeaderPtr->DirName), "%s", Directory);
+
+    FM_DirIndexName(Directory, IndexName);
+
+    /* The index directory is made by the first build, an existing one is kept */
+    OS_mkdir(FM_DIR_INDEX_PATH, 0);
+
+    /* Directory time is taken first so changes made while reading leave the index stale */
+    Status = FM_ChildSizeTimeMode(Directory, &DirSize, &HeaderPtr->DirTime, &DirMode);
+
+    for (i = 0; (i < 2) && (Status == OS_SUCCESS); i++)
+    {
+        FM_DirIndexFileName(Directory, FM_DirIndexWorkSuffix[i], WorkName[i]);
+
+        Status = OS_OpenCreate(&WorkHandle[i], WorkName[i], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                               OS_READ_WRITE);
+
+        /* Records are written after room for the header */
+        if ((Status == OS_SUCCESS) && (OS_write(WorkHandle[i], HeaderPtr, sizeof(*HeaderPtr)) != sizeof(*HeaderPtr)))
+        {
+            Status = OS_ERROR;
+        }
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        Status = FM_ChildScanOpen(&Scan, Directory, DirWithSep);
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        /* Sort the entries in runs that fit the sort buffer */
+        while ((Written == true) && (FM_ChildScanRead(&Scan) == OS_SUCCESS))
+        {
+            EntryPtr = &FM_GlobalData.DirIndexSort[SortCount];
+
+            snprintf(EntryPtr->EntryName, sizeof(EntryPtr->EntryName), "%s", OS_DIRENTRY_NAME(Scan.DirEntry));
+
+            /* An entry that cannot be read is still listed, with no size or time */
+            FM_ChildScanStat(&Scan, EntryPtr, &FilesTillSleep);
+
+            if ((EntryPtr->Mode & OS_FILESTAT_MODE_DIR) == 0)
+            {
+                HeaderPtr->FileCount++;
+                HeaderPtr->TotalBytes += EntryPtr->EntrySize;
+            }
+
+            HeaderPtr->EntryCount++;
+            SortCount++;
+
+            if (SortCount == FM_DIR_INDEX_SORT_ENTRIES)
+            {
+                Written   = FM_DirIndexWriteRun(WorkHandle[0], HeaderPtr->EntryCount - SortCount, SortCount);
+                SortCount = 0;
+            }
+        }
+
+        FM_ChildScanClose(&Scan);
+
+        if ((Written == true) && (SortCount > 0))
+        {
+            Written = FM_DirIndexWriteRun(WorkHandle[0], HeaderPtr->EntryCount - SortCount, SortCount);
+        }
+
+        /* Merge pairs of runs until a single run holds every entry */
+        while ((Written == true) && (RunLength < HeaderPtr->EntryCount))
+        {
+            Written = FM_DirIndexMergePass(WorkHandle[Current], WorkHandle[1 - Current], HeaderPtr->EntryCount,
+                                           RunLength);
+            Current = 1 - Current;
+            RunLength *= 2;
+        }
+
+        if ((Written == true) && (OS_lseek(WorkHandle[Current], 0, OS_SEEK_SET) >= 0))
+        {
+            Written = (OS_write(WorkHandle[Current], HeaderPtr, sizeof(*HeaderPtr)) == sizeof(*HeaderPtr));
+        }
+        else
+        {
+            Written = false;
+        }
+
+        if (Written == false)
+        {
+            Status = OS_ERROR;
+        }
+    }
+
+    for (i = 0; i < 2; i++)
+    {
+        if (OS_ObjectIdDefined(WorkHandle[i]))
+        {
+            OS_close(WorkHandle[i]);
+        }
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        /* The previous index stays in place until the new one is complete */
+        OS_remove(IndexName);
+        Status = OS_rename(WorkName[Current], IndexName);
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        FM_DirIndexListUpdate(FM_DirIndexNameCrc(Directory), true);
+    }
+
+    /* The final work file is already gone once renamed */
+    for (i = 0; i < 2; i++)
+    {
+        if (OS_ObjectIdDefined(WorkHandle[i]))
+        {
+            OS_remove(WorkName[i]);
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- write sorted run                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexWriteRun(osal_id_t FileHandle, uint32 Index, uint32 Count)
+{
+    qsort(FM_GlobalData.DirIndexSort, Count, sizeof(FM_DirListEntry_t), FM_DirIndexCompare);
+
+    return FM_DirIndexWrite(FileHandle, Index, Count, FM_GlobalData.DirIndexSort);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- merge sorted runs                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexMergePass(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 EntryCount, uint32 RunLength)
+{
+    uint32             BlockSize   = FM_DIR_INDEX_SORT_ENTRIES / 3;
+    FM_DirListEntry_t *OutputPtr   = &FM_GlobalData.DirIndexSort[2 * BlockSize];
+    uint32             OutputCount = 0;
+    uint32             OutputIndex = 0;
+    uint32             First       = 0;
+    uint32             Which       = 0;
+    uint32             i           = 0;
+    bool               Merged      = true;
+    FM_DirIndexRun_t   Run[2];
+    FM_DirListEntry_t *EntryPtr[2];
+
+    for (First = 0; (Merged == true) && (First < EntryCount); First += 2 * RunLength)
+    {
+        for (i = 0; i < 2; i++)
+        {
+            memset(&Run[i], 0, sizeof(Run[i]));
+            Run[i].Next       = First + (i * RunLength);
+            Run[i].End        = Run[i].Next + RunLength;
+            Run[i].BufferSize = BlockSize;
+            Run[i].Buffer     = &FM_GlobalData.DirIndexSort[i * BlockSize];
+
+            /* The last runs of the file may be short or missing */
+            if (Run[i].Next > EntryCount)
+            {
+                Run[i].Next = EntryCount;
+            }
+            if (Run[i].End > EntryCount)
+            {
+                Run[i].End = EntryCount;
+            }
+
+            EntryPtr[i] = FM_DirIndexRunPeek(SourceHandle, &Run[i]);
+        }
+
+        while ((Merged == true) && ((EntryPtr[0] != NULL) || (EntryPtr[1] != NULL)))
+        {
+            /* Equal names are taken from the first run */
+            if ((EntryPtr[1] == NULL) ||
+                ((EntryPtr[0] != NULL) && (strcmp(EntryPtr[0]->EntryName, EntryPtr[1]->EntryName) <= 0)))
+            {
+                Which = 0;
+            }
+            else
+            {
+                Which = 1;
+            }
+
+            OutputPtr[OutputCount] = *EntryPtr[Which];
+            OutputCount++;
+            Run[Which].Index++;
+
+            if (OutputCount == BlockSize)
+            {
+                Merged = FM_DirIndexWrite(TargetHandle, OutputIndex, OutputCount, OutputPtr);
+                OutputIndex += OutputCount;
+                OutputCount = 0;
+            }
+
+            EntryPtr[Which] = FM_DirIndexRunPeek(SourceHandle, &Run[Which]);
+        }
+    }
+
+    if ((Merged == true) && (OutputCount > 0))
+    {
+        Merged = FM_DirIndexWrite(TargetHandle, OutputIndex, OutputCount, OutputPtr);
+        OutputIndex += OutputCount;
+    }
+
+    /* A short read ends a run early and leaves records out */
+    if (OutputIndex != EntryCount)
+    {
+        Merged = false;
+    }
+
+    return Merged;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- current record of sorted run     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+FM_DirListEntry_t *FM_DirIndexRunPeek(osal_id_t FileHandle, FM_DirIndexRun_t *RunPtr)
+{
+    FM_DirListEntry_t *EntryPtr  = NULL;
+    uint32             ReadCount = 0;
+
+    if ((RunPtr->Index >= RunPtr->Count) && (RunPtr->Next < RunPtr->End))
+    {
+        ReadCount = RunPtr->End - RunPtr->Next;
+
+        if (ReadCount > RunPtr->BufferSize)
+        {
+            ReadCount = RunPtr->BufferSize;
+        }
+
+        RunPtr->Count = FM_DirIndexRead(FileHandle, RunPtr->Next, ReadCount, RunPtr->Buffer);
+        RunPtr->Index = 0;
+        RunPtr->Next += ReadCount;
+    }
+
+    if (RunPtr->Index < RunPtr->Count)
+    {
+        EntryPtr = &RunPtr->Buffer[RunPtr->Index];
+    }
+
+    return EntryPtr;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- find entry by name               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexFind(osal_id_t FileHandle, const FM_DirIndexHeader_t *HeaderPtr, const char *EntryName,
+                     FM_DirListEntry_t *EntryPtr, uint32 *IndexPtr, bool *FoundPtr)
+{
+    uint32 Low       = 0;
+    uint32 High      = HeaderPtr->EntryCount;
+    uint32 Middle    = 0;
+    int    Compare   = 0;
+    bool   Searched  = true;
+    bool   NameFound = false;
+
+    while ((Searched == true) && (NameFound == false) && (Low < High))
+    {
+        Middle = Low + ((High - Low) / 2);
+
+        if (FM_DirIndexRead(FileHandle, Middle, 1, EntryPtr) != 1)
+        {
+            Searched = false;
+        }
+        else
+        {
+            Compare = strncmp(EntryName, EntryPtr->EntryName, sizeof(EntryPtr->EntryName));
+
+            if (Compare == 0)
+            {
+                NameFound = true;
+                Low       = Middle;
+            }
+            else if (Compare < 0)
+            {
+                High = Middle;
+            }
+            else
+            {
+                Low = Middle + 1;
+            }
+        }
+    }
+
+    *IndexPtr = Low;
+    *FoundPtr = NameFound;
+
+    return Searched;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- move records up or down          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexShift(osal_id_t FileHandle, uint32 First, uint32 EntryCount, bool Insert)
+{
+    FM_DirListEntry_t *BufferPtr = FM_GlobalData.DirIndexSort;
+    uint32             Start     = 0;
+    uint32             End       = EntryCount;
+    uint32             Count     = 0;
+    bool               Moved     = true;
+
+    if (Insert == true)
+    {
+        /* Work down from the end so no record is overwritten before it is moved */
+        while ((Moved == true) && (End > First))
+        {
+            Count = End - First;
+
+            if (Count > FM_DIR_INDEX_SORT_ENTRIES)
+            {
+                Count = FM_DIR_INDEX_SORT_ENTRIES;
+            }
+
+            Start = End - Count;
+            Moved = (FM_DirIndexRead(FileHandle, Start, Count, BufferPtr) == Count) &&
+                    (FM_DirIndexWrite(FileHandle, Start + 1, Count, BufferPtr) == true);
+            End   = Start;
+        }
+    }
+    else
+    {
+        /* Work up from the gap, the record left past the new end is ignored */
+        Start = First;
+
+        while ((Moved == true) && (Start < EntryCount))
+        {
+            Count = EntryCount - Start;
+
+            if (Count > FM_DIR_INDEX_SORT_ENTRIES)
+            {
+                Count = FM_DIR_INDEX_SORT_ENTRIES;
+            }
+
+            Moved = (FM_DirIndexRead(FileHandle, Start, Count, BufferPtr) == Count) &&
+                    (FM_DirIndexWrite(FileHandle, Start - 1, Count, BufferPtr) == true);
+            Start += Count;
+        }
+    }
+
+    return Moved;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- directory space estimate         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirIndexEstimate(const char *Directory, uint64 *ByteCountPtr)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FM_DirIndexHeader_t Header;
+    bool                Estimated = false;
+
+    Estimated = FM_DirIndexOpen(Directory, true, &FileHandle, &Header);
+
+    if (Estimated == true)
+    {
+        *ByteCountPtr = Header.TotalBytes;
+
+        OS_close(FileHandle);
+    }
+
+    return Estimated;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- start index update               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DirIndexPrepare(FM_DirIndexUpdate_t *UpdatePtr, const char *Path)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    const char *        NamePtr    = NULL;
+    size_t              DirLength  = 0;
+    FM_DirIndexHeader_t Header;
+
+    memset(UpdatePtr, 0, sizeof(*UpdatePtr));
+
+    NamePtr = strrchr(Path, '/');
+
+    /* Entries of the root directory and names with a trailing separator are not indexed */
+    if ((NamePtr != NULL) && (NamePtr != Path) && (NamePtr[1] != '\0'))
+    {
+        DirLength = NamePtr - Path;
+        NamePtr++;
+
+        if ((DirLength < sizeof(UpdatePtr->DirName)) &&
+            (OS_strnlen(NamePtr, sizeof(UpdatePtr->EntryName)) < sizeof(UpdatePtr->EntryName)))
+        {
+            memcpy(UpdatePtr->DirName, Path, DirLength);
+            UpdatePtr->DirName[DirLength] = '\0';
+            snprintf(UpdatePtr->EntryName, sizeof(UpdatePtr->EntryName), "%s", NamePtr);
+
+            if (FM_DirIndexOpen(UpdatePtr->DirName, true, &FileHandle, &Header) == true)
+            {
+                UpdatePtr->Indexed = true;
+                UpdatePtr->DirTime = Header.DirTime;
+
+                OS_close(FileHandle);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function -- apply index update               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DirIndexCommit(const FM_DirIndexUpdate_t *UpdatePtr)
+{
+    osal_id_t           FileHandle  = OS_OBJECT_ID_UNDEFINED;
+    uint32              DirSize     = 0;
+    uint32              DirTime     = 0;
+    uint32              DirMode     = 0;
+    uint32              Index       = 0;
+    bool                EntryFound  = false;
+    bool                EntryExists = false;
+    bool                Updated     = false;
+    char                Path[OS_MAX_PATH_LEN];
+    FM_DirIndexHeader_t Header;
+    FM_DirListEntry_t   OldEntry;
+    FM_DirListEntry_t   NewEntry;
+
+    if ((UpdatePtr->Indexed == true) && (FM_DirIndexOpen(UpdatePtr->DirName, false, &FileHandle, &Header) == true))
+    {
+        /* The index may already have the new directory time from the other half of a rename */
+        if ((Header.DirTime != 0) &&
+            (FM_ChildSizeTimeMode(UpdatePtr->DirName, &DirSize, &DirTime, &DirMode) == OS_SUCCESS) &&
+            ((Header.DirTime == UpdatePtr->DirTime) || (Header.DirTime == DirTime)))
+        {
+            memset(&NewEntry, 0, sizeof(NewEntry));
+            snprintf(NewEntry.EntryName, sizeof(NewEntry.EntryName), "%s", UpdatePtr->EntryName);
+            snprintf(Path, sizeof(Path), "%s/%s", UpdatePtr->DirName, UpdatePtr->EntryName);
+
+            /* The entry is read again whether or not the command succeeded */
+            EntryExists = (FM_ChildSizeTimeMode(Path, &NewEntry.EntrySize, &NewEntry.ModifyTime, &NewEntry.Mode) ==
+                           OS_SUCCESS);
+
+            Updated = FM_DirIndexFind(FileHandle, &Header, UpdatePtr->EntryName, &OldEntry, &Index, &EntryFound);
+
+            if ((Updated == true) && (EntryFound == true) && ((OldEntry.Mode & OS_FILESTAT_MODE_DIR) == 0))
+            {
+                Header.FileCount--;
+                Header.TotalBytes -= OldEntry.EntrySize;
+            }
+
+            if ((Updated == true) && (EntryExists == true) && ((NewEntry.Mode & OS_FILESTAT_MODE_DIR) == 0))
+            {
+                Header.FileCount++;
+                Header.TotalBytes += NewEntry.EntrySize;
+            }
+
+            if ((Updated == true) && (EntryFound == true) && (EntryExists == true))
+            {
+                Updated = FM_DirIndexWrite(FileHandle, Index, 1, &NewEntry);
+            }
+            else if ((Updated == true) && (EntryExists == true))
+            {
+                Updated = FM_DirIndexShift(FileHandle, Index, Header.EntryCount, true) &&
+                          FM_DirIndexWrite(FileHandle, Index, 1, &NewEntry);
+                Header.EntryCount++;
+            }
+            else if ((Updated == true) && (EntryFound == true))
+            {
+                Updated = FM_DirIndexShift(FileHandle, Index + 1, Header.EntryCount, false);
+                Header.EntryCount--;
+            }
+            else
+            {
+                /* Entry was not indexed and still does not exist */
+            }
+
+            Header.DirTime = DirTime;
+        }
+
+        /* An index that was not updated is no longer current */
+        if (Updated == false)
+        {
+            Header.DirTime = 0;
+        }
+
+        if (OS_lseek(FileHandle, 0, OS_SEEK_SET) >= 0)
+        {
+            OS_write(FileHandle, &Header, sizeof(Header));
+        }
+
+        OS_close(FileHandle);
+    }
+}
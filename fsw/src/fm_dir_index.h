@@ -0,0 +1,412 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager persistent directory index
+ *   functions.
+ */
+#ifndef FM_DIR_INDEX_H
+#define FM_DIR_INDEX_H
+
+#include "cfe.h"
+#include "fm_msg.h"
+
+/************************************************************************
+ * Macro Definitions
+ ************************************************************************/
+
+#define FM_DIR_INDEX_MAGIC 0x464D4958 /**< \brief Directory index file identifier, "FMIX" */
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ *  \brief Directory index file header
+ *
+ *  The header is followed by EntryCount #FM_DirListEntry_t records sorted
+ *  by entry name.  The index is current while DirTime matches the modify
+ *  time of the directory.
+ */
+typedef struct
+{
+    uint32 Magic;                    /**< \brief Index file identifier, #FM_DIR_INDEX_MAGIC */
+    uint32 RecordSize;               /**< \brief Size of each entry record */
+    char   DirName[OS_MAX_PATH_LEN]; /**< \brief Indexed directory name */
+    uint32 DirTime;                  /**< \brief Directory modify time the index matches */
+    uint32 EntryCount;               /**< \brief Number of entry records */
+    uint32 FileCount;                /**< \brief Number of entries that are not directories */
+    uint32 Spare;                    /**< \brief Padding to 64 bit boundary */
+    uint64 TotalBytes;               /**< \brief Total size of the entries that are not directories */
+} FM_DirIndexHeader_t;
+
+/**
+ *  \brief Directory index update for one entry
+ *
+ *  Taken before FM changes an entry of a directory, so that the change can
+ *  be applied to the index of the directory afterwards.
+ */
+typedef struct
+{
+    char   DirName[OS_MAX_PATH_LEN];    /**< \brief Directory that holds the entry */
+    char   EntryName[OS_MAX_FILE_NAME]; /**< \brief Entry name */
+    uint32 DirTime;                     /**< \brief Index directory modify time before the change */
+    bool   Indexed;                     /**< \brief Directory had a current index before the change */
+} FM_DirIndexUpdate_t;
+
+/**
+ *  \brief Directory index sorted run reader
+ *
+ *  Reads the records of one sorted run of the index being built a block
+ *  at a time.
+ */
+typedef struct
+{
+    uint32             Next;       /**< \brief Index of the next record to read from the file */
+    uint32             End;        /**< \brief Index one past the last record of the run */
+    uint32             Count;      /**< \brief Number of records in Buffer */
+    uint32             Index;      /**< \brief Index in Buffer of the current record */
+    uint32             BufferSize; /**< \brief Number of records Buffer can hold */
+    FM_DirListEntry_t *Buffer;     /**< \brief Records read from the file */
+} FM_DirIndexRun_t;
+
+/**
+ *  \brief Directory index file list
+ *
+ *  Name CRCs of the index files in #FM_DIR_INDEX_PATH, so that a directory
+ *  without an index is known without looking for its index file.
+ */
+typedef struct
+{
+    bool   Loaded;                     /**< \brief Index files left by an earlier run have been found */
+    bool   Overflow;                   /**< \brief Some index files are not in the list */
+    uint32 Count;                      /**< \brief Number of index files in the list */
+    uint32 NameCrc[FM_DIR_INDEX_DIRS]; /**< \brief Directory name CRC of each index file */
+} FM_DirIndexList_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM directory index function prototypes                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Directory Index File Name Function
+ *
+ *  \par Description
+ *       This function builds the name of the index file of a directory in
+ *       #FM_DIR_INDEX_PATH from a CRC of the directory name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Directories whose names have the same CRC share an index file, the
+ *       directory name in the header tells which one it belongs to.
+ *
+ *  \param [in]  Directory Directory name
+ *  \param [out] IndexName Buffer of #OS_MAX_PATH_LEN bytes for the index file name
+ */
+void FM_DirIndexName(const char *Directory, char *IndexName);
+
+/**
+ *  \brief Directory Index Known Function
+ *
+ *  \par Description
+ *       This function reports whether a directory may have an index file,
+ *       without opening it.  The index files in #FM_DIR_INDEX_PATH are
+ *       listed the first time it is called.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Always true once more than #FM_DIR_INDEX_DIRS index files have
+ *       been found, always false when the directory index is disabled.
+ *
+ *  \param [in] Directory Directory name
+ *
+ *  \return Boolean index known response
+ */
+bool FM_DirIndexKnown(const char *Directory);
+
+/**
+ *  \brief Directory Index List Load Function
+ *
+ *  \par Description
+ *       This function reads #FM_DIR_INDEX_PATH and lists the name CRC of
+ *       every index file in it.  A missing index directory leaves the list
+ *       empty.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the child task.
+ */
+void FM_DirIndexListLoad(void);
+
+/**
+ *  \brief Directory Index Remove Function
+ *
+ *  \par Description
+ *       This function removes the index file of a directory that has been
+ *       deleted or emptied, whether or not the index is current.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the child task.  An index file of another directory
+ *       with the same name CRC is left in place.
+ *
+ *  \param [in] Directory Directory name
+ */
+void FM_DirIndexRemove(const char *Directory);
+
+/**
+ *  \brief Directory Index Open Function
+ *
+ *  \par Description
+ *       This function opens the index file of a directory and reads its
+ *       header.  The file is left open only when it is an index of the
+ *       directory and, if CheckTime is set, the header time matches the
+ *       current directory modify time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must be closed with OS_close once opened.  The file is
+ *       only looked for when #FM_DirIndexKnown reports the directory.
+ *
+ *  \param [in]  Directory     Directory name
+ *  \param [in]  CheckTime     Require the index to be current
+ *  \param [out] FileHandlePtr Open index file handle
+ *  \param [out] HeaderPtr     Index file header
+ *
+ *  \return Boolean index open response
+ *  \retval true  Index file is open
+ *  \retval false No usable index, always when the directory index is disabled
+ */
+bool FM_DirIndexOpen(const char *Directory, bool CheckTime, osal_id_t *FileHandlePtr, FM_DirIndexHeader_t *HeaderPtr);
+
+/**
+ *  \brief Directory Index Read Function
+ *
+ *  \par Description
+ *       This function reads consecutive entry records from an index file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller limits Count to the records that exist.
+ *
+ *  \param [in]  FileHandle Open index file handle
+ *  \param [in]  Index      Index of the first record to read
+ *  \param [in]  Count      Number of records to read
+ *  \param [out] EntryPtr   Buffer for Count records
+ *
+ *  \return Number of records read
+ */
+uint32 FM_DirIndexRead(osal_id_t FileHandle, uint32 Index, uint32 Count, FM_DirListEntry_t *EntryPtr);
+
+/**
+ *  \brief Directory Index Write Function
+ *
+ *  \par Description
+ *       This function writes consecutive entry records to an index file.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in] FileHandle Open index file handle
+ *  \param [in] Index      Index of the first record to write
+ *  \param [in] Count      Number of records to write
+ *  \param [in] EntryPtr   Records to write
+ *
+ *  \return Boolean write response
+ *  \retval true  Every record was written
+ *  \retval false Write failed
+ */
+bool FM_DirIndexWrite(osal_id_t FileHandle, uint32 Index, uint32 Count, const FM_DirListEntry_t *EntryPtr);
+
+/**
+ *  \brief Directory Index Build Function
+ *
+ *  \par Description
+ *       This function reads every entry of a directory and writes a new
+ *       index file for it.  Entries are sorted in runs of
+ *       #FM_DIR_INDEX_SORT_ENTRIES in memory and the runs are then merged
+ *       in passes between two work files in #FM_DIR_INDEX_PATH, so a
+ *       directory of any size can be indexed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the child task.  The directory modify time is read
+ *       first, so a directory that changes while it is read leaves an index
+ *       that is not current.  #FM_DIR_INDEX_PATH is created if it does not
+ *       exist.
+ *
+ *  \param [in]  Directory  Directory name
+ *  \param [in]  DirWithSep Directory name plus separator
+ *  \param [out] HeaderPtr  Header of the new index
+ *
+ *  \return OSAL status, OS_SUCCESS if the index was written
+ */
+int32 FM_DirIndexBuild(const char *Directory, const char *DirWithSep, FM_DirIndexHeader_t *HeaderPtr);
+
+/**
+ *  \brief Directory Index Run Write Function
+ *
+ *  \par Description
+ *       This function sorts the entries in the sort buffer and writes them
+ *       to a work file as one sorted run.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in] FileHandle Work file handle
+ *  \param [in] Index      Index of the first record of the run
+ *  \param [in] Count      Number of entries in the sort buffer
+ *
+ *  \return Boolean write response
+ */
+bool FM_DirIndexWriteRun(osal_id_t FileHandle, uint32 Index, uint32 Count);
+
+/**
+ *  \brief Directory Index Merge Pass Function
+ *
+ *  \par Description
+ *       This function merges each pair of sorted runs of RunLength records
+ *       in one work file into a sorted run in the other work file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The sort buffer is split between the two runs being read and the
+ *       records being written.
+ *
+ *  \param [in] SourceHandle Work file holding the runs
+ *  \param [in] TargetHandle Work file for the merged runs
+ *  \param [in] EntryCount   Number of records in the work file
+ *  \param [in] RunLength    Number of records in each sorted run
+ *
+ *  \return Boolean merge response
+ *  \retval true  Every record was merged
+ *  \retval false A work file read or write failed
+ */
+bool FM_DirIndexMergePass(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 EntryCount, uint32 RunLength);
+
+/**
+ *  \brief Directory Index Run Reader Function
+ *
+ *  \par Description
+ *       This function returns the current record of a sorted run, reading
+ *       the next block of the run when the buffer is used up.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in]     FileHandle Work file handle
+ *  \param [in,out] RunPtr     Sorted run reader
+ *
+ *  \return Pointer to the current record, NULL at the end of the run
+ */
+FM_DirListEntry_t *FM_DirIndexRunPeek(osal_id_t FileHandle, FM_DirIndexRun_t *RunPtr);
+
+/**
+ *  \brief Directory Index Entry Search Function
+ *
+ *  \par Description
+ *       This function finds an entry name in an index file by binary
+ *       search.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in]  FileHandle Open index file handle
+ *  \param [in]  HeaderPtr  Index file header
+ *  \param [in]  EntryName  Entry name to find
+ *  \param [out] EntryPtr   Record of the entry, if found
+ *  \param [out] IndexPtr   Index of the entry, or of the record it would be inserted before
+ *  \param [out] FoundPtr   Whether the entry is in the index
+ *
+ *  \return Boolean search response
+ *  \retval true  Search completed, FoundPtr and IndexPtr are valid
+ *  \retval false An index record could not be read
+ */
+bool FM_DirIndexFind(osal_id_t FileHandle, const FM_DirIndexHeader_t *HeaderPtr, const char *EntryName,
+                     FM_DirListEntry_t *EntryPtr, uint32 *IndexPtr, bool *FoundPtr);
+
+/**
+ *  \brief Directory Index Record Move Function
+ *
+ *  \par Description
+ *       This function moves the records from First to the end of the index
+ *       one place up (Insert set) to open a gap at First, or one place down
+ *       (Insert clear) to close the gap below First.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the child task, the sort buffer holds the records
+ *       being moved.
+ *
+ *  \param [in] FileHandle Open index file handle
+ *  \param [in] First      Index of the first record to move
+ *  \param [in] EntryCount Number of records in the index
+ *  \param [in] Insert     Move records up rather than down
+ *
+ *  \return Boolean move response
+ */
+bool FM_DirIndexShift(osal_id_t FileHandle, uint32 First, uint32 EntryCount, bool Insert);
+
+/**
+ *  \brief Directory Index Space Estimate Function
+ *
+ *  \par Description
+ *       This function reports the total size of the files of a directory
+ *       from its index, when the directory has a current index.
+ *
+ *  \par Assumptions, External Events, and Notes: None
+ *
+ *  \param [in]  Directory    Directory name
+ *  \param [out] ByteCountPtr Total size of the files
+ *
+ *  \return Boolean estimate response
+ *  \retval true  ByteCountPtr was set from a current index
+ *  \retval false No current index, ByteCountPtr is unchanged
+ */
+bool FM_DirIndexEstimate(const char *Directory, uint64 *ByteCountPtr);
+
+/**
+ *  \brief Directory Index Update Start Function
+ *
+ *  \par Description
+ *       This function is called before FM adds, changes or removes a
+ *       directory entry.  It records whether the directory holding the
+ *       entry has a current index.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the child task.
+ *
+ *  \param [out] UpdatePtr Directory index update
+ *  \param [in]  Path      Full name of the entry
+ *
+ *  \sa #FM_DirIndexCommit
+ */
+void FM_DirIndexPrepare(FM_DirIndexUpdate_t *UpdatePtr, const char *Path);
+
+/**
+ *  \brief Directory Index Update Function
+ *
+ *  \par Description
+ *       This function is called after FM has added, changed or removed a
+ *       directory entry.  If the directory had a current index, the entry
+ *       record is added, replaced or removed to match the entry and the
+ *       index is marked current for the new directory modify time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the child task.  It does not matter whether the
+ *       change succeeded, the entry is read again.  An index that cannot be
+ *       updated is left not current.
+ *
+ *  \param [in] UpdatePtr Directory index update from #FM_DirIndexPrepare
+ *
+ *  \sa #FM_DirIndexPrepare
+ */
+void FM_DirIndexCommit(const FM_DirIndexUpdate_t *UpdatePtr);
+
+#endif
@@ -381,6 +381,134 @@ bool FM_SetPermissionsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
     return FM_SetPermissionsCmd(BufPtr);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Write Directory Checksum Manifest         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DirManifestVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_DirManifestCmd_t), FM_DIR_MANIFEST_PKT_ERR_EID,
+                                "Directory Manifest"))
+    {
+        return false;
+    }
+
+    return FM_DirManifestCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Compare Files                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_CompareFilesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_CompareFilesCmd_t), FM_COMPARE_FILES_PKT_ERR_EID,
+                                "Compare Files"))
+    {
+        return false;
+    }
+
+    return FM_CompareFilesCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Sorted List of Directory Entries      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetDirListSortedVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_GetDirListSortedCmd_t), FM_GET_DIR_SORTED_PKT_ERR_EID,
+                                "Sorted Directory List"))
+    {
+        return false;
+    }
+
+    return FM_GetDirListSortedCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Directory Statistics                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetDirStatsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_GetDirStatsCmd_t), FM_GET_DIR_STATS_PKT_ERR_EID,
+                                "Directory Statistics"))
+    {
+        return false;
+    }
+
+    return FM_GetDirStatsCmd(BufPtr);
+}
+
+#if FM_DIR_TRACK_DIRS > 0
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Directory Changes                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetDirChangesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_GetDirChangesCmd_t), FM_GET_DIR_CHANGES_PKT_ERR_EID,
+                                "Directory Changes"))
+    {
+        return false;
+    }
+
+    return FM_GetDirChangesCmd(BufPtr);
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Build Directory Index                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_BuildDirIndexVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_BuildDirIndexCmd_t), FM_BUILD_DIR_INDEX_PKT_ERR_EID,
+                                "Build Directory Index"))
+    {
+        return false;
+    }
+
+    return FM_BuildDirIndexCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get Page of Open Files                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetOpenFilesPageVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_GetOpenFilesPageCmd_t), FM_GET_OPEN_FILES_PAGE_PKT_ERR_EID,
+                                "Get Open Files Page"))
+    {
+        return false;
+    }
+
+    return FM_GetOpenFilesPageCmd(BufPtr);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM command handler -- Send Housekeeping                         */
@@ -442,6 +570,9 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
 
     CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
 
+    /* No file state checks are staged until the command handler runs */
+    FM_GlobalData.ChildVerifyCount = 0;
+
     /* Invoke specific command handler */
     switch (CommandCode)
     {
@@ -517,6 +648,36 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             Result = FM_SetPermissionsVerifyDispatch(BufPtr);
             break;
 
+        case FM_DIR_MANIFEST_CC:
+            Result = FM_DirManifestVerifyDispatch(BufPtr);
+            break;
+
+        case FM_COMPARE_FILES_CC:
+            Result = FM_CompareFilesVerifyDispatch(BufPtr);
+            break;
+
+        case FM_GET_DIR_LIST_SORTED_CC:
+            Result = FM_GetDirListSortedVerifyDispatch(BufPtr);
+            break;
+
+        case FM_GET_DIR_STATS_CC:
+            Result = FM_GetDirStatsVerifyDispatch(BufPtr);
+            break;
+
+#if FM_DIR_TRACK_DIRS > 0
+        case FM_GET_DIR_CHANGES_CC:
+            Result = FM_GetDirChangesVerifyDispatch(BufPtr);
+            break;
+#endif
+
+        case FM_BUILD_DIR_INDEX_CC:
+            Result = FM_BuildDirIndexVerifyDispatch(BufPtr);
+            break;
+
+        case FM_GET_OPEN_FILES_PAGE_CC:
+            Result = FM_GetOpenFilesPageVerifyDispatch(BufPtr);
+            break;
+
         default:
             Result = false;
             CFE_EVS_SendEvent(FM_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Main loop error: invalid command code: cc = %d",
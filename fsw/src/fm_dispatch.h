@@ -98,6 +98,13 @@ bool FM_GetDirListPktVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 bool FM_MonitorFilesystemSpaceVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 bool FM_SetTableStateVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 bool FM_SetPermissionsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_DirManifestVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_CompareFilesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_GetDirListSortedVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_GetDirStatsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_GetDirChangesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_BuildDirIndexVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_GetOpenFilesPageVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 void FM_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 
 #endif
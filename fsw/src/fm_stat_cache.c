@@ -0,0 +1,268 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) File Stat Cache Functions
+ *
+ *  Keeps the status of recently checked files so that the commands of a
+ *  sequence do not each call OS_stat for the same names
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_events.h"
+#include "fm_stat_cache.h"
+#include "fm_platform_cfg.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM stat cache local function -- current time                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static int64 FM_StatCacheNow(void)
+{
+    OS_time_t LocalTime;
+
+    memset(&LocalTime, 0, sizeof(LocalTime));
+
+    OS_GetLocalTime(&LocalTime);
+
+    return OS_TimeGetTotalMilliseconds(LocalTime);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM stat cache local function -- save file status                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_StatCacheStore(const char *Path, const os_fstat_t *FileStatusPtr, int64 StatTime, uint32 Generation)
+{
+    FM_StatCache_t *     CachePtr = &FM_GlobalData.StatCache;
+    FM_StatCacheEntry_t *EntryPtr = &CachePtr->Entries[0];
+    bool                 SameName = false;
+    uint32               i;
+
+    OS_MutSemTake(CachePtr->Mutex);
+
+    /* A name that FM changed while OS_stat was running may have the old status */
+    if (CachePtr->Generation == Generation)
+    {
+        /* Reuse the entry for this name, else an unused entry, else the least recently used */
+        for (i = 0; (i < FM_STAT_CACHE_ENTRIES) && (SameName == false); i++)
+        {
+            if (strncmp(CachePtr->Entries[i].Path, Path, sizeof(CachePtr->Entries[i].Path)) == 0)
+            {
+                EntryPtr = &CachePtr->Entries[i];
+                SameName = true;
+            }
+            else if ((EntryPtr->Path[0] != '\0') && ((CachePtr->Entries[i].Path[0] == '\0') ||
+                                                     (CachePtr->Entries[i].LastUsed < EntryPtr->LastUsed)))
+            {
+                EntryPtr = &CachePtr->Entries[i];
+            }
+        }
+
+        CachePtr->UseCount++;
+
+        memset(EntryPtr, 0, sizeof(*EntryPtr));
+        snprintf(EntryPtr->Path, sizeof(EntryPtr->Path), "%s", Path);
+        EntryPtr->FileStatus = *FileStatusPtr;
+        EntryPtr->StatTime   = StatTime;
+        EntryPtr->LastUsed   = CachePtr->UseCount;
+    }
+
+    OS_MutSemGive(CachePtr->Mutex);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM stat cache function -- initialization                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_StatCacheInit(void)
+{
+    FM_StatCache_t *CachePtr = &FM_GlobalData.StatCache;
+    int32           Status   = OS_SUCCESS;
+
+    memset(CachePtr, 0, sizeof(*CachePtr));
+    CachePtr->Mutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* A TTL of zero turns the cache off */
+    if (FM_STAT_CACHE_TTL_MS > 0)
+    {
+        Status = OS_MutSemCreate(&CachePtr->Mutex, FM_STAT_CACHE_SEM_NAME, 0);
+
+        if (Status != OS_SUCCESS)
+        {
+            CachePtr->Mutex = OS_OBJECT_ID_UNDEFINED;
+
+            CFE_EVS_SendEvent(FM_STAT_CACHE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Stat cache initialization error: create mutex failed: result = %d", (int)Status);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM stat cache function -- get file status                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_StatCacheGet(const char *Path, os_fstat_t *FileStatusPtr)
+{
+    FM_StatCache_t *     CachePtr   = &FM_GlobalData.StatCache;
+    FM_StatCacheEntry_t *EntryPtr   = NULL;
+    int32                Status     = OS_SUCCESS;
+    bool                 UseCache   = false;
+    bool                 Found      = false;
+    uint32               Generation = 0;
+    int64                Now        = 0;
+    uint32               i;
+
+    /* Names too long to keep are always read */
+    UseCache = (OS_ObjectIdDefined(CachePtr->Mutex) &&
+                (OS_strnlen(Path, sizeof(CachePtr->Entries[0].Path)) < sizeof(CachePtr->Entries[0].Path)));
+
+    if (UseCache == true)
+    {
+        Now = FM_StatCacheNow();
+
+        OS_MutSemTake(CachePtr->Mutex);
+
+        for (i = 0; (i < FM_STAT_CACHE_ENTRIES) && (Found == false); i++)
+        {
+            EntryPtr = &CachePtr->Entries[i];
+
+            if ((EntryPtr->Path[0] != '\0') && (strncmp(EntryPtr->Path, Path, sizeof(EntryPtr->Path)) == 0))
+            {
+                Found = true;
+            }
+        }
+
+        if (Found == true)
+        {
+            /* Status expires after the configured time, or if the clock goes backwards */
+            if ((Now >= EntryPtr->StatTime) && ((Now - EntryPtr->StatTime) < FM_STAT_CACHE_TTL_MS))
+            {
+                CachePtr->UseCount++;
+                EntryPtr->LastUsed = CachePtr->UseCount;
+
+                *FileStatusPtr = EntryPtr->FileStatus;
+            }
+            else
+            {
+                EntryPtr->Path[0] = '\0';
+                Found             = false;
+            }
+        }
+
+        Generation = CachePtr->Generation;
+
+        OS_MutSemGive(CachePtr->Mutex);
+    }
+
+    if (Found == false)
+    {
+        Status = OS_stat(Path, FileStatusPtr);
+
+        if ((UseCache == true) && (Status == OS_SUCCESS))
+        {
+            FM_StatCacheStore(Path, FileStatusPtr, Now, Generation);
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM stat cache function -- invalidate changed name               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_StatCacheInvalidate(const char *Path)
+{
+    FM_StatCache_t *     CachePtr  = &FM_GlobalData.StatCache;
+    FM_StatCacheEntry_t *EntryPtr  = NULL;
+    const char *         NamePtr   = NULL;
+    size_t               NameLen   = 0;
+    size_t               ParentLen = 0;
+    char                 Name[OS_MAX_PATH_LEN];
+    uint32               i;
+
+    if (OS_ObjectIdDefined(CachePtr->Mutex))
+    {
+        snprintf(Name, sizeof(Name), "%s", Path);
+        NameLen = strlen(Name);
+
+        /* A trailing separator names the same directory */
+        while ((NameLen > 1) && (Name[NameLen - 1] == '/'))
+        {
+            NameLen--;
+            Name[NameLen] = '\0';
+        }
+
+        /* The directory that holds the name, the root directory keeps its separator */
+        NamePtr = strrchr(Name, '/');
+
+        if (NamePtr != NULL)
+        {
+            ParentLen = (NamePtr == Name) ? 1 : (size_t)(NamePtr - Name);
+        }
+
+        OS_MutSemTake(CachePtr->Mutex);
+
+        CachePtr->Generation++;
+
+        for (i = 0; i < FM_STAT_CACHE_ENTRIES; i++)
+        {
+            EntryPtr = &CachePtr->Entries[i];
+
+            if (EntryPtr->Path[0] == '\0')
+            {
+                /* Unused entry */
+            }
+            else if ((strncmp(EntryPtr->Path, Name, NameLen) == 0) &&
+                     ((EntryPtr->Path[NameLen] == '\0') || (EntryPtr->Path[NameLen] == '/')))
+            {
+                /* The name itself or a name below it */
+                EntryPtr->Path[0] = '\0';
+            }
+            else if ((ParentLen > 0) && (strncmp(EntryPtr->Path, Name, ParentLen) == 0) &&
+                     (EntryPtr->Path[ParentLen] == '\0'))
+            {
+                /* Directory modify time changes with its entries */
+                EntryPtr->Path[0] = '\0';
+            }
+            else
+            {
+                /* Not changed */
+            }
+        }
+
+        OS_MutSemGive(CachePtr->Mutex);
+    }
+}
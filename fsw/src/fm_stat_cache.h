@@ -0,0 +1,116 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS File Manager file stat cache functions.
+ */
+#ifndef FM_STAT_CACHE_H
+#define FM_STAT_CACHE_H
+
+#include "cfe.h"
+#include "fm_platform_cfg.h"
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ *  \brief Cached file status
+ */
+typedef struct
+{
+    char       Path[OS_MAX_PATH_LEN]; /**< \brief File or directory name, empty if entry is unused */
+    os_fstat_t FileStatus;            /**< \brief Status returned by OS_stat */
+    int64      StatTime;              /**< \brief Local time in milli-secs when OS_stat was called */
+    uint32     LastUsed;              /**< \brief Cache usage count when last stored or found */
+} FM_StatCacheEntry_t;
+
+/**
+ *  \brief File stat cache shared by the main task and the child task
+ */
+typedef struct
+{
+    osal_id_t           Mutex;                          /**< \brief Mutex semaphore, undefined if cache is off */
+    uint32              UseCount;                       /**< \brief Replacement counter */
+    uint32              Generation;                     /**< \brief Incremented by every invalidation */
+    FM_StatCacheEntry_t Entries[FM_STAT_CACHE_ENTRIES]; /**< \brief Cached names */
+} FM_StatCache_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM stat cache function prototypes                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Stat Cache Initialization Function
+ *
+ *  \par Description
+ *       This function creates the mutex semaphore that protects the cache.
+ *       If it cannot be created the cache is not used.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once by the main task before the child task is created.
+ *
+ *  \sa #FM_StatCacheGet
+ */
+void FM_StatCacheInit(void);
+
+/**
+ *  \brief Get File Status Function
+ *
+ *  \par Description
+ *       This function returns the status of a file or directory from the
+ *       cache if it was read within #FM_STAT_CACHE_TTL_MS, otherwise it
+ *       calls OS_stat and saves a successful result in the cache.  Names
+ *       that do not exist are not cached.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       May be called by the main task and the child task.  A result read
+ *       while the cache was being invalidated is returned but not saved.
+ *
+ *  \param [in]  Path          Pointer to the file or directory name
+ *  \param [out] FileStatusPtr Pointer to the status to fill in
+ *
+ *  \return OS_stat status
+ *  \retval #OS_SUCCESS \copydoc OS_SUCCESS
+ *
+ *  \sa #FM_StatCacheInvalidate
+ */
+int32 FM_StatCacheGet(const char *Path, os_fstat_t *FileStatusPtr);
+
+/**
+ *  \brief Invalidate File Status Function
+ *
+ *  \par Description
+ *       This function removes a name from the cache, along with every name
+ *       below it and the directory that holds it, whose modify time changes
+ *       with its entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after FM creates, changes or removes a file or directory.
+ *
+ *  \param [in]  Path Pointer to the changed file or directory name
+ *
+ *  \sa #FM_StatCacheGet
+ */
+void FM_StatCacheInvalidate(const char *Path);
+
+#endif
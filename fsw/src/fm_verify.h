@@ -63,13 +63,25 @@
 #error FM_DIR_LIST_FILE_DEFNAME must be defined!
 #endif
 
-/* Max number of entries written to a directory listing file */
-#ifndef FM_DIR_LIST_FILE_ENTRIES
-#error FM_DIR_LIST_FILE_ENTRIES must be defined!
-#elif FM_DIR_LIST_FILE_ENTRIES < 100
-#error FM_DIR_LIST_FILE_ENTRIES cannot be less than 100
-#elif FM_DIR_LIST_FILE_ENTRIES > 10000
-#error FM_DIR_LIST_FILE_ENTRIES cannot be greater than 10000 files
+/* Size at which a directory listing continues in the next output file */
+#ifndef FM_DIR_LIST_FILE_MAX_SIZE
+#error FM_DIR_LIST_FILE_MAX_SIZE must be defined!
+#elif (FM_DIR_LIST_FILE_MAX_SIZE != 0) && (FM_DIR_LIST_FILE_MAX_SIZE < 1024)
+#error FM_DIR_LIST_FILE_MAX_SIZE cannot be less than 1024 bytes
+#endif
+
+/* Subdirectory levels in a directory listing file */
+#ifndef FM_DIR_LIST_MAX_DEPTH
+#error FM_DIR_LIST_MAX_DEPTH must be defined!
+#elif FM_DIR_LIST_MAX_DEPTH < 1
+#error FM_DIR_LIST_MAX_DEPTH cannot be less than 1
+#elif FM_DIR_LIST_MAX_DEPTH > 16
+#error FM_DIR_LIST_MAX_DEPTH cannot be greater than 16
+#elif defined(OS_MAX_NUM_OPEN_DIRS) && (FM_DIR_LIST_MAX_DEPTH >= OS_MAX_NUM_OPEN_DIRS)
+#error FM_DIR_LIST_MAX_DEPTH must be less than OS_MAX_NUM_OPEN_DIRS
+#elif defined(OS_MAX_NUM_OPEN_DIRS) && (FM_DIR_LIST_CURSOR_TTL > 0) && \
+    ((FM_DIR_LIST_MAX_DEPTH + 1) >= OS_MAX_NUM_OPEN_DIRS)
+#error FM_DIR_LIST_MAX_DEPTH plus one must be less than OS_MAX_NUM_OPEN_DIRS when the dir list cursor is used
 #endif
 
 /* cFE file header sub-type for directory list files */
@@ -77,6 +89,23 @@
 #error FM_DIR_LIST_FILE_SUBTYPE must be defined!
 #endif
 
+/* cFE file header sub-type for compact directory list files */
+#ifndef FM_DIR_LIST_COMPACT_FILE_SUBTYPE
+#error FM_DIR_LIST_COMPACT_FILE_SUBTYPE must be defined!
+#elif FM_DIR_LIST_COMPACT_FILE_SUBTYPE == FM_DIR_LIST_FILE_SUBTYPE
+#error FM_DIR_LIST_COMPACT_FILE_SUBTYPE cannot be the same as FM_DIR_LIST_FILE_SUBTYPE
+#endif
+
+/* Default directory manifest output filename */
+#ifndef FM_DIR_MANIFEST_FILE_DEFNAME
+#error FM_DIR_MANIFEST_FILE_DEFNAME must be defined!
+#endif
+
+/* cFE file header sub-type for directory manifest files */
+#ifndef FM_DIR_MANIFEST_FILE_SUBTYPE
+#error FM_DIR_MANIFEST_FILE_SUBTYPE must be defined!
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - TLM packet definitions   */
@@ -92,6 +121,123 @@
 #error FM_DIR_LIST_PKT_ENTRIES cannot be greater than 100
 #endif
 
+#ifndef FM_DIR_LIST_PKT_STREAM_RATE
+#error FM_DIR_LIST_PKT_STREAM_RATE must be defined!
+#elif FM_DIR_LIST_PKT_STREAM_RATE < 1
+#error FM_DIR_LIST_PKT_STREAM_RATE cannot be less than 1
+#elif FM_DIR_LIST_PKT_STREAM_RATE > 100
+#error FM_DIR_LIST_PKT_STREAM_RATE cannot be greater than 100
+#endif
+
+/* Get dir list to packet cursor lifetime */
+#ifndef FM_DIR_LIST_CURSOR_TTL
+#error FM_DIR_LIST_CURSOR_TTL must be defined!
+#elif FM_DIR_LIST_CURSOR_TTL < 0
+#error FM_DIR_LIST_CURSOR_TTL cannot be less than zero
+#elif FM_DIR_LIST_CURSOR_TTL > 3600
+#error FM_DIR_LIST_CURSOR_TTL cannot be greater than 3600
+#endif
+
+#ifndef FM_DIR_TRACK_DIRS
+#error FM_DIR_TRACK_DIRS must be defined!
+#elif FM_DIR_TRACK_DIRS < 0
+#error FM_DIR_TRACK_DIRS cannot be less than zero
+#elif FM_DIR_TRACK_DIRS > 32
+#error FM_DIR_TRACK_DIRS cannot be greater than 32
+#endif
+
+#ifndef FM_DIR_TRACK_ENTRIES
+#error FM_DIR_TRACK_ENTRIES must be defined!
+#elif FM_DIR_TRACK_ENTRIES < FM_DIR_LIST_PKT_ENTRIES
+#error FM_DIR_TRACK_ENTRIES cannot be less than FM_DIR_LIST_PKT_ENTRIES
+#elif FM_DIR_TRACK_ENTRIES > 4096
+#error FM_DIR_TRACK_ENTRIES cannot be greater than 4096
+#endif
+
+#ifndef FM_DIR_TRACK_REMOVED
+#error FM_DIR_TRACK_REMOVED must be defined!
+#elif FM_DIR_TRACK_REMOVED < 1
+#error FM_DIR_TRACK_REMOVED cannot be less than 1
+#elif FM_DIR_TRACK_REMOVED > 1024
+#error FM_DIR_TRACK_REMOVED cannot be greater than 1024
+#endif
+
+#ifndef FM_DIR_TRACK_INOTIFY
+#error FM_DIR_TRACK_INOTIFY must be defined!
+#elif (FM_DIR_TRACK_INOTIFY != 0) && (FM_DIR_TRACK_INOTIFY != 1)
+#error FM_DIR_TRACK_INOTIFY must be 0 or 1
+#endif
+
+#ifndef FM_DIR_INDEX_ENABLE
+#error FM_DIR_INDEX_ENABLE must be defined!
+#elif (FM_DIR_INDEX_ENABLE != 0) && (FM_DIR_INDEX_ENABLE != 1)
+#error FM_DIR_INDEX_ENABLE must be 0 or 1
+#endif
+
+#ifndef FM_DIR_INDEX_PATH
+#error FM_DIR_INDEX_PATH must be defined!
+#endif
+
+#ifndef FM_DIR_INDEX_SORT_ENTRIES
+#error FM_DIR_INDEX_SORT_ENTRIES must be defined!
+#elif FM_DIR_INDEX_SORT_ENTRIES < 48
+#error FM_DIR_INDEX_SORT_ENTRIES cannot be less than 48
+#elif FM_DIR_INDEX_SORT_ENTRIES > 65536
+#error FM_DIR_INDEX_SORT_ENTRIES cannot be greater than 65536
+#endif
+
+#ifndef FM_DIR_INDEX_DIRS
+#error FM_DIR_INDEX_DIRS must be defined!
+#elif FM_DIR_INDEX_DIRS < 1
+#error FM_DIR_INDEX_DIRS cannot be less than 1
+#elif FM_DIR_INDEX_DIRS > 256
+#error FM_DIR_INDEX_DIRS cannot be greater than 256
+#endif
+
+#ifndef FM_OPEN_FILE_SET_REFRESH
+#error FM_OPEN_FILE_SET_REFRESH must be defined!
+#elif FM_OPEN_FILE_SET_REFRESH < 1
+#error FM_OPEN_FILE_SET_REFRESH cannot be less than 1
+#elif FM_OPEN_FILE_SET_REFRESH > 65536
+#error FM_OPEN_FILE_SET_REFRESH cannot be greater than 65536
+#endif
+
+#ifndef FM_OPEN_FILES_REFRESH_HK
+#error FM_OPEN_FILES_REFRESH_HK must be defined!
+#elif FM_OPEN_FILES_REFRESH_HK < 1
+#error FM_OPEN_FILES_REFRESH_HK cannot be less than 1
+#elif FM_OPEN_FILES_REFRESH_HK > 3600
+#error FM_OPEN_FILES_REFRESH_HK cannot be greater than 3600
+#endif
+
+#ifndef FM_OPEN_FILE_AGE_LIMIT
+#error FM_OPEN_FILE_AGE_LIMIT must be defined!
+#elif FM_OPEN_FILE_AGE_LIMIT < 0
+#error FM_OPEN_FILE_AGE_LIMIT cannot be less than 0
+#elif FM_OPEN_FILE_AGE_LIMIT > 604800
+#error FM_OPEN_FILE_AGE_LIMIT cannot be greater than 604800
+#endif
+
+#ifndef FM_STAT_CACHE_ENTRIES
+#error FM_STAT_CACHE_ENTRIES must be defined!
+#elif FM_STAT_CACHE_ENTRIES < 1
+#error FM_STAT_CACHE_ENTRIES cannot be less than 1
+#elif FM_STAT_CACHE_ENTRIES > 256
+#error FM_STAT_CACHE_ENTRIES cannot be greater than 256
+#endif
+
+#ifndef FM_STAT_CACHE_TTL_MS
+#error FM_STAT_CACHE_TTL_MS must be defined!
+#elif FM_STAT_CACHE_TTL_MS < 0
+#error FM_STAT_CACHE_TTL_MS cannot be less than 0
+#elif FM_STAT_CACHE_TTL_MS > 60000
+#error FM_STAT_CACHE_TTL_MS cannot be greater than 60000
+#endif
+
+#ifndef FM_STAT_CACHE_SEM_NAME
+#error FM_STAT_CACHE_SEM_NAME must be defined!
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - child task definitions   */
@@ -123,6 +269,24 @@
 #error FM_CHILD_FILE_SLEEP_MS cannot be greater than 100
 #endif
 
+/* Size of the child task output file write buffer */
+#ifndef FM_CHILD_WRITE_BUFFER_SIZE
+#error FM_CHILD_WRITE_BUFFER_SIZE must be defined!
+#elif FM_CHILD_WRITE_BUFFER_SIZE < 256
+#error FM_CHILD_WRITE_BUFFER_SIZE cannot be less than 256
+#elif FM_CHILD_WRITE_BUFFER_SIZE > 32768
+#error FM_CHILD_WRITE_BUFFER_SIZE cannot be greater than 32K
+#endif
+
+/* Size of each file compare read buffer */
+#ifndef FM_CHILD_COMPARE_BLOCK_SIZE
+#error FM_CHILD_COMPARE_BLOCK_SIZE must be defined!
+#elif FM_CHILD_COMPARE_BLOCK_SIZE < 256
+#error FM_CHILD_COMPARE_BLOCK_SIZE cannot be less than 256
+#elif FM_CHILD_COMPARE_BLOCK_SIZE > 32768
+#error FM_CHILD_COMPARE_BLOCK_SIZE cannot be greater than 32K
+#endif
+
 /* Number of entries in the child task command queue */
 #ifndef FM_CHILD_QUEUE_DEPTH
 #error FM_CHILD_QUEUE_DEPTH must be defined!
@@ -160,6 +324,71 @@
 #error FM_CHILD_SEM_NAME must be defined!
 #endif
 
+/* Child task directory scan with native entry type and relative stat */
+#ifndef FM_CHILD_NATIVE_DIR_SCAN
+#error FM_CHILD_NATIVE_DIR_SCAN must be defined!
+#elif (FM_CHILD_NATIVE_DIR_SCAN != 0) && (FM_CHILD_NATIVE_DIR_SCAN != 1)
+#error FM_CHILD_NATIVE_DIR_SCAN must be 0 or 1
+#endif
+
+/* File state checks deferred to the child task */
+#ifndef FM_CHILD_DEFER_VERIFY
+#error FM_CHILD_DEFER_VERIFY must be defined!
+#elif (FM_CHILD_DEFER_VERIFY != 0) && (FM_CHILD_DEFER_VERIFY != 1)
+#error FM_CHILD_DEFER_VERIFY must be 0 or 1
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM platform configuration parameters - file CRC definitions     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* CRC-32 hardware acceleration */
+#ifndef FM_CRC_HW_ACCELERATION
+#error FM_CRC_HW_ACCELERATION must be defined!
+#elif (FM_CRC_HW_ACCELERATION != 0) && (FM_CRC_HW_ACCELERATION != 1)
+#error FM_CRC_HW_ACCELERATION must be 0 or 1
+#endif
+
+#ifndef FM_DIGEST_CACHE_ENTRIES
+#error FM_DIGEST_CACHE_ENTRIES must be defined!
+#elif FM_DIGEST_CACHE_ENTRIES < 1
+#error FM_DIGEST_CACHE_ENTRIES cannot be less than 1
+#elif FM_DIGEST_CACHE_ENTRIES > 256
+#error FM_DIGEST_CACHE_ENTRIES cannot be greater than 256
+#endif
+
+#ifndef FM_CRC_WORKER_COUNT
+#error FM_CRC_WORKER_COUNT must be defined!
+#elif FM_CRC_WORKER_COUNT < 0
+#error FM_CRC_WORKER_COUNT cannot be less than 0
+#elif FM_CRC_WORKER_COUNT > 8
+#error FM_CRC_WORKER_COUNT cannot be greater than 8
+#endif
+
+#ifndef FM_CRC_WORKER_MIN_FILE_SIZE
+#error FM_CRC_WORKER_MIN_FILE_SIZE must be defined!
+#elif FM_CRC_WORKER_MIN_FILE_SIZE < 65536
+#error FM_CRC_WORKER_MIN_FILE_SIZE cannot be less than 65536
+#endif
+
+#ifndef FM_CRC_WORKER_TASK_NAME
+#error FM_CRC_WORKER_TASK_NAME must be defined!
+#endif
+
+#ifndef FM_CRC_WORK_SEM_NAME
+#error FM_CRC_WORK_SEM_NAME must be defined!
+#endif
+
+#ifndef FM_CRC_DONE_SEM_NAME
+#error FM_CRC_DONE_SEM_NAME must be defined!
+#endif
+
+#ifndef FM_CRC_JOB_MUTEX_NAME
+#error FM_CRC_JOB_MUTEX_NAME must be defined!
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - table definitions        */
@@ -42,6 +42,7 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_crc.h"
 #include "fm_dispatch.h"
 #include "fm_events.h"
 #include "fm_perfids.h"
@@ -281,6 +282,7 @@ void Test_FM_AppInit_TableInitSuccess(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_STUB_COUNT(CFE_SB_CreatePipe, 1);
     UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_STUB_COUNT(FM_CrcInit, 1);
     UtAssert_STUB_COUNT(FM_ChildInit, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_INIT_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -294,7 +296,7 @@ void Test_FM_SendHkCmd(void)
     FM_HousekeepingPkt_Payload_t *ReportPtr;
 
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetOpenFilesData), 0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetOpenFilesCount), 9);
 
     /* Set non-zero values to assert */
     FM_GlobalData.CommandCounter      = 1;
@@ -313,14 +315,14 @@ void Test_FM_SendHkCmd(void)
     UtAssert_STUB_COUNT(FM_ReleaseTablePointers, 1);
     UtAssert_STUB_COUNT(FM_AcquireTablePointers, 1);
     UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
-    UtAssert_STUB_COUNT(FM_GetOpenFilesData, 1);
+    UtAssert_STUB_COUNT(FM_GetOpenFilesCount, 1);
     UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
     UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 
     ReportPtr = &FM_GlobalData.HousekeepingPkt.Payload;
     UtAssert_INT32_EQ(ReportPtr->CommandCounter, FM_GlobalData.CommandCounter);
     UtAssert_INT32_EQ(ReportPtr->CommandErrCounter, FM_GlobalData.CommandErrCounter);
-    UtAssert_INT32_EQ(ReportPtr->NumOpenFiles, 0);
+    UtAssert_INT32_EQ(ReportPtr->NumOpenFiles, 9);
     UtAssert_INT32_EQ(ReportPtr->ChildCmdCounter, FM_GlobalData.ChildCmdCounter);
     UtAssert_INT32_EQ(ReportPtr->ChildCmdErrCounter, FM_GlobalData.ChildCmdErrCounter);
     UtAssert_INT32_EQ(ReportPtr->ChildCmdWarnCounter, FM_GlobalData.ChildCmdWarnCounter);
@@ -31,6 +31,9 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_crc.h"
+#include "fm_digest.h"
+#include "fm_dir_index.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
@@ -64,6 +67,25 @@ void UT_FM_Child_Cmd_Assert(int32 cmd_ctr, int32 cmderr_ctr, int32 cmdwarn_ctr,
     UtAssert_INT32_EQ(FM_GlobalData.ChildCurrentCC, 0);
 }
 
+void UT_FM_DirListCursor_Setup(const char *Directory, uint32 NextEntry, uint32 TotalFiles)
+{
+    FM_DirListCursor_t *CursorPtr = &FM_GlobalData.DirListCursor;
+
+    CursorPtr->DirId      = FM_UT_OBJID_1;
+    CursorPtr->DirTime    = 0;
+    CursorPtr->OpenTime   = 0;
+    CursorPtr->NextEntry  = NextEntry;
+    CursorPtr->TotalFiles = TotalFiles;
+    strncpy(CursorPtr->DirName, Directory, sizeof(CursorPtr->DirName) - 1);
+}
+
+void UT_Handler_DirListCursorTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *TimePtr = OS_TimeFromTotalSeconds(*(uint32 *)UserObj);
+}
+
 /*********************************************************************************
  *          TEST CASE FUNCTIONS
  *********************************************************************************/
@@ -174,6 +196,7 @@ void Test_FM_ChildProcess_FMCopyCC(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
+    UtAssert_BOOL_TRUE(FM_GlobalData.OpenFilesSummary.Changed);
 }
 
 void Test_FM_ChildProcess_FMMoveCC(void)
@@ -208,6 +231,7 @@ void Test_FM_ChildProcess_FMRenameCC(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
+    UtAssert_BOOL_FALSE(FM_GlobalData.OpenFilesSummary.Changed);
 }
 
 void Test_FM_ChildProcess_FMDeleteCC(void)
@@ -414,1672 +438,4958 @@ void Test_FM_ChildProcess_FMSetFilePermCC(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
 }
 
-void Test_FM_ChildProcess_DefaultSwitch(void)
+void Test_FM_ChildProcess_FMDirManifestCC(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = -1;
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_DIR_MANIFEST_CC;
+    FM_GlobalData.ChildCurrentCC            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
     UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
 
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_OSOPENDIR_ERR_EID);
 }
 
-/* ****************
- * ChildCopyCmd Tests
- * ***************/
-void Test_FM_ChildCopyCmd_OScpIsSuccess(void)
+void Test_FM_ChildProcess_FMCompareFilesCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
+    /* Arrange */
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_COMPARE_FILES_CC;
+    FM_GlobalData.ChildCurrentCC            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
 
+    UtAssert_STUB_COUNT(OS_stat, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSSTAT_ERR_EID);
 }
 
-void Test_FM_ChildCopyCmd_OScpNotSuccess(void)
+void Test_FM_ChildProcess_FMGetDirListSortedCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
-
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_LIST_SORTED_CC;
+    FM_GlobalData.ChildCurrentCC            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
 
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_SORTED_OS_ERR_EID);
 }
 
-/* ****************
- * ChildMoveCmd Tests
- * ***************/
-void Test_FM_ChildMoveCmd_OSmvNotSuccess(void)
+void Test_FM_ChildProcess_FMGetDirStatsCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
-
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_mv), !OS_SUCCESS);
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_STATS_CC;
+    FM_GlobalData.ChildCurrentCC            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_STATS_OS_ERR_EID);
 }
 
-void Test_FM_ChildMoveCmd_OSmvSuccess(void)
+void Test_FM_ChildProcess_FMGetDirChangesCC(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
+    /* Arrange */
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_CHANGES_CC;
+    FM_GlobalData.ChildCurrentCC            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_CHANGES_OS_ERR_EID);
 }
 
-/* ****************
- * ChildRenameCmd Tests
- * ***************/
-void Test_FM_ChildRenameCmd_OSRenameSuccess(void)
+void Test_FM_ChildProcess_FMBuildDirIndexCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_BUILD_DIR_INDEX_CC;
+    FM_GlobalData.ChildCurrentCC            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexBuild), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(FM_DirIndexBuild, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_BUILD_DIR_INDEX_OS_ERR_EID);
 }
 
-void Test_FM_ChildRenameCmd_OSRenameNotSuccess(void)
+void Test_FM_ChildProcess_DefaultSwitch(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+    FM_GlobalData.ChildQueue[0].CommandCode = -1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
 }
 
-/* ****************
- * ChildDeleteCmd Tests
- * ***************/
-void Test_FM_ChildDeleteCmd_OSRemoveSuccess(void)
+void Test_FM_ChildProcess_DeferredVerifyFail(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_COPY_FILE_CC;
+    FM_GlobalData.ChildQueue[0].VerifyCount = 2;
+    UT_SetDeferredRetcode(UT_KEY(FM_VerifyDeferredFileState), 1, true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_COPY_FILE_CC);
 
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
+    UtAssert_STUB_COUNT(FM_VerifyDeferredFileState, 2);
+    UtAssert_STUB_COUNT(OS_cp, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildReadIndex, 1);
 }
 
-void Test_FM_ChildDeleteCmd_OSRemoveNotSuccess(void)
+void Test_FM_ChildProcess_DeferredVerifyPass(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    FM_GlobalData.ChildQueue[0].CommandCode = FM_COPY_FILE_CC;
+    FM_GlobalData.ChildQueue[0].VerifyCount = 2;
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDeferredFileState), true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_COPY_FILE_CC);
 
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OS_ERR_EID);
+    UtAssert_STUB_COUNT(FM_VerifyDeferredFileState, 2);
+    UtAssert_STUB_COUNT(OS_cp, 1);
 }
 
 /* ****************
- * ChildDeleteAllFilesCmd Tests
+ * ChildCrcWorker Tests
  * ***************/
-void Test_FM_ChildDeleteAllFilesCmd_DirOpenNotSuccess(void)
+void Test_FM_ChildCrcWorkerInit_Success(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcWorkerInit());
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcWorkerCount, FM_CRC_WORKER_COUNT);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 2);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, FM_CRC_WORKER_COUNT);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildCrcWorkerInit_CountSemCreateNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcWorkerInit());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcWorkerCount, 0);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CRC_WORKER_INIT_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirReadNotSuccess(void)
+void Test_FM_ChildCrcWorkerInit_MutSemCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcWorkerInit());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcWorkerCount, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CRC_WORKER_INIT_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirEntryThisDirectory(void)
+void Test_FM_ChildCrcWorkerInit_CreateChildTaskNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), CFE_ES_ERR_CHILD_TASK_CREATE);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcWorkerInit());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcWorkerCount, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CRC_WORKER_INIT_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirEntryParentDirectory(void)
+void Test_FM_ChildCrcWorkerTask_WorkerLoopCalled(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcWorkerTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_PathFilenameLengthGreaterMaxPthLen(void)
+void Test_FM_ChildCrcWorkerLoop_RunsSegments(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
-                                        .Source1     = "source1",
-                                        .Source2     = "source2HasAReallyReallyLongNameSomeSayTheNameIs42Characters"};
-    os_dirent_t          direntry    = {.FileName = "ThisDirectory"};
+    FM_GlobalData.CrcJob.SegmentCount = 1;
+    FM_GlobalData.CrcJob.NextSegment  = 0;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcWorkerLoop());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.NextSegment, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_InvalidFilenameState(void)
+void Test_FM_ChildCrcRunSegments_AllSegments(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_INVALID);
+    FM_GlobalData.CrcJob.SegmentCount = FM_CRC_WORKER_COUNT + 1;
+    FM_GlobalData.CrcJob.NextSegment  = 0;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcRunSegments());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.NextSegment, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, FM_CRC_WORKER_COUNT + 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, FM_CRC_WORKER_COUNT + 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, FM_CRC_WORKER_COUNT + 1);
+}
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+void Test_FM_ChildCrcRunSegments_NoSegmentsLeft(void)
+{
+    /* Arrange */
+    FM_GlobalData.CrcJob.SegmentCount = 2;
+    FM_GlobalData.CrcJob.NextSegment  = 2;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcRunSegments());
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.NextSegment, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_NotInUseFilenameState(void)
+void Test_FM_ChildCrcSegment_OSOpenCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_CrcSegment_t *SegmentPtr = &FM_GlobalData.CrcJob.Segment[0];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    SegmentPtr->Length = FM_CHILD_FILE_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcSegment("file", CFE_ES_CrcType_CRC_32, SegmentPtr));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_INT32_EQ(SegmentPtr->Status, OS_ERROR);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+void Test_FM_ChildCrcSegment_OSlseekNotSuccess(void)
+{
+    /* Arrange */
+    FM_CrcSegment_t *SegmentPtr = &FM_GlobalData.CrcJob.Segment[FM_CRC_WORKER_COUNT];
+
+    SegmentPtr->Offset = FM_CHILD_FILE_BLOCK_SIZE;
+    SegmentPtr->Length = FM_CHILD_FILE_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERR_INVALID_ID);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcSegment("file", CFE_ES_CrcType_CRC_32, SegmentPtr));
+
+    /* Assert */
+    UtAssert_INT32_EQ(SegmentPtr->Status, OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void Test_FM_ChildCrcSegment_OSreadNotSuccess(void)
+{
+    /* Arrange */
+    FM_CrcSegment_t *SegmentPtr = &FM_GlobalData.CrcJob.Segment[0];
+
+    SegmentPtr->Length = FM_CHILD_FILE_BLOCK_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcSegment("file", CFE_ES_CrcType_CRC_32, SegmentPtr));
+
+    /* Assert */
+    UtAssert_INT32_EQ(SegmentPtr->Status, OS_ERROR);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void Test_FM_ChildCrcSegment_FileShorterThanSegment(void)
+{
+    /* Arrange */
+    FM_CrcSegment_t *SegmentPtr = &FM_GlobalData.CrcJob.Segment[0];
+
+    SegmentPtr->Length = 2 * FM_CHILD_FILE_BLOCK_SIZE;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcSegment("file", CFE_ES_CrcType_CRC_32, SegmentPtr));
+
+    /* Assert */
+    UtAssert_INT32_EQ(SegmentPtr->Status, OS_ERROR);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void Test_FM_ChildCrcSegment_Success(void)
+{
+    /* Arrange */
+    FM_CrcSegment_t *SegmentPtr = &FM_GlobalData.CrcJob.Segment[0];
+
+    SegmentPtr->Length = (FM_CHILD_FILE_LOOP_COUNT * FM_CHILD_FILE_BLOCK_SIZE) + 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x1234);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcSegment("file", CFE_ES_CrcType_CRC_16, SegmentPtr));
+
+    /* Assert */
+    UtAssert_INT32_EQ(SegmentPtr->Status, OS_SUCCESS);
+    UtAssert_UINT32_EQ(SegmentPtr->Crc, 0x1234);
+    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, FM_CHILD_FILE_LOOP_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void Test_FM_ChildParallelCRC_Success(void)
+{
+    /* Arrange */
+    uint32     Crc        = 0;
+    uint32     FileSize   = 0;
+    os_fstat_t FileStatus = {.FileSize = FM_CHILD_FILE_BLOCK_SIZE};
+
+    FM_GlobalData.CrcWorkerCount = FM_CRC_WORKER_COUNT;
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStatus, sizeof(FileStatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0xABCD);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCombine), 0xABCD);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildParallelCRC("file", CFE_ES_CrcType_CRC_32, &Crc, &FileSize), OS_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Crc, 0xABCD);
+    UtAssert_UINT32_EQ(FileSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.Segment[FM_CRC_WORKER_COUNT].Length, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_close, FM_CRC_WORKER_COUNT + 1);
+}
+
+void Test_FM_ChildParallelCRC_OSStatNotSuccess(void)
+{
+    /* Arrange */
+    uint32 Crc      = 0x5555;
+    uint32 FileSize = 0x5555;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_FS_ERR_PATH_INVALID);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildParallelCRC("file", CFE_ES_CrcType_CRC_32, &Crc, &FileSize), OS_FS_ERR_PATH_INVALID);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Crc, 0);
+    UtAssert_UINT32_EQ(FileSize, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+}
+
+void Test_FM_ChildParallelCRC_FileTooLarge(void)
+{
+    /* Arrange */
+    uint32     Crc        = 0x5555;
+    uint32     FileSize   = 0x5555;
+    os_fstat_t FileStatus = {.FileSize = (size_t)INT32_MAX + 1};
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStatus, sizeof(FileStatus), false);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildParallelCRC("file", CFE_ES_CrcType_CRC_32, &Crc, &FileSize), OS_ERR_OUTPUT_TOO_LARGE);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Crc, 0);
+    UtAssert_UINT32_EQ(FileSize, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+}
+
+void Test_FM_ChildParallelCRCJob_Success(void)
+{
+    /* Arrange */
+    uint32 Crc      = 0;
+    uint32 FileSize = ((FM_CRC_WORKER_COUNT + 1) * 2 * FM_CHILD_FILE_BLOCK_SIZE) + FM_CHILD_FILE_BLOCK_SIZE;
+
+    FM_GlobalData.CrcWorkerCount = FM_CRC_WORKER_COUNT;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0xABCD);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCombine), 0xABCD);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildParallelCRCJob("file", FileSize, CFE_ES_CrcType_CRC_32, &Crc), OS_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Crc, 0xABCD);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.SegmentCount, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.Segment[FM_CRC_WORKER_COUNT].Offset,
+                       FM_CRC_WORKER_COUNT * 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcJob.Segment[FM_CRC_WORKER_COUNT].Length, 3 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(OS_OpenCreate, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_read, FileSize / FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(FM_CrcCombine, FM_CRC_WORKER_COUNT);
+    UtAssert_STUB_COUNT(OS_CountSemGive, (2 * FM_CRC_WORKER_COUNT) + 1);
+    UtAssert_STUB_COUNT(OS_CountSemTake, FM_CRC_WORKER_COUNT + 1);
+}
+
+void Test_FM_ChildParallelCRCJob_SegmentNotSuccess(void)
+{
+    /* Arrange */
+    uint32 Crc = 0x5555;
+
+    FM_GlobalData.CrcWorkerCount = FM_CRC_WORKER_COUNT;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_FS_ERR_PATH_INVALID);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildParallelCRCJob("file", 4 * FM_CHILD_FILE_BLOCK_SIZE, FM_CRC_TYPE_CRC32C, &Crc),
+                      OS_FS_ERR_PATH_INVALID);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Crc, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(FM_CrcCombine, 0);
+    UtAssert_STUB_COUNT(OS_CountSemTake, FM_CRC_WORKER_COUNT + 1);
+}
+
+/* ****************
+ * ChildCopyCmd Tests
+ * ***************/
+void Test_FM_ChildCopyCmd_OScpIsSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
+}
+
+void Test_FM_ChildCopyCmd_OScpNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
+
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildMoveCmd Tests
+ * ***************/
+void Test_FM_ChildMoveCmd_OSmvNotSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
+
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_mv), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+}
+
+void Test_FM_ChildMoveCmd_OSmvSuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
+}
+
+/* ****************
+ * ChildRenameCmd Tests
+ * ***************/
+void Test_FM_ChildRenameCmd_OSRenameSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
+}
+
+void Test_FM_ChildRenameCmd_IndexUpdated(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC, .Source1 = "dir/a", .Target = "dir/b"};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Source and target entries are both updated */
+    UtAssert_STUB_COUNT(FM_DirIndexPrepare, 2);
+    UtAssert_STUB_COUNT(FM_DirIndexCommit, 2);
+}
+
+void Test_FM_ChildRenameCmd_OSRenameNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteCmd_OSRemoveSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteCmd_OSRemoveNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteAllFilesCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteAllFilesCmd_DirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_DirReadNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_DirEntryThisDirectory(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_DirEntryParentDirectory(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_PathFilenameLengthGreaterMaxPthLen(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
+                                        .Source1     = "source1",
+                                        .Source2     = "source2HasAReallyReallyLongNameSomeSayTheNameIs42Characters"};
+    os_dirent_t          direntry    = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_InvalidFilenameState(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_INVALID);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_NotInUseFilenameState(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_NOT_IN_USE);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_DirectoryFilenameState(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_DIRECTORY);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_OpenFilenameState(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_FILE_OPEN);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSRmNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(FM_DirIndexRemove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSrmSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_FILE_CLOSED);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_STUB_COUNT(FM_DirIndexRemove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), -1); /* default case */
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_OpenFileSetRefresh(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry[FM_OPEN_FILE_SET_REFRESH + 1];
+    uint32      i;
+
+    for (i = 0; i < FM_OPEN_FILE_SET_REFRESH + 1; i++)
+    {
+        snprintf(direntry[i].FileName, sizeof(direntry[i].FileName), "file%u", (unsigned int)i);
+    }
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), FM_OPEN_FILE_SET_REFRESH + 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetBatchFilenameState), FM_NAME_IS_FILE_OPEN);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    /* The open file set is loaded for the first entry and again once the refresh count is reached */
+    UtAssert_STUB_COUNT(FM_OpenFileSetLoad, 2);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, FM_OPEN_FILE_SET_REFRESH + 1);
+    UtAssert_STUB_COUNT(FM_IsFileOpen, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+}
+
+/* ****************
+ * ChildDecompressFileCmd Tests
+ * ***************/
+
+void Test_FM_ChildDecompressFileCmd_FSDecompressSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+
+    FM_GlobalData.ChildCurrentCC = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CMD_INF_EID);
+}
+
+void Test_FM_ChildDecompressFileCmd_FSDecompressNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+
+    FM_GlobalData.ChildCurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(FM_Decompress_Impl), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+}
+
+/* ****************
+ * ChildConcatFilesCmd Tests
+ * ***************/
+void Test_FM_ChildConcatFilesCmd_OSCpNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    FM_GlobalData.ChildCurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSOpenCreateSourceNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_SRC2_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSOpenCreateTargetNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_TGT_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSReadBytesZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_INF_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSReadBytesLessThanZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_BytesWrittenNotEqualBytesRead(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+}
+
+/* ****************
+ * ChildFileInfoCmd Tests
+ * ***************/
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = FM_IGNORE_CRC,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_OPEN};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = -1,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_TYPE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(FM_DigestFinal, 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_BytesReadLessThanZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, FM_CHILD_FILE_LOOP_COUNT);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileSizeChanged(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoSize  = 2 * FM_CHILD_FILE_BLOCK_SIZE,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_BOOL_TRUE(FM_GlobalData.FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(FM_DigestFinal, 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 0);
+}
+
+void Test_FM_ChildFileInfoCmd_CachedCRC(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestCacheLookup), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_BOOL_TRUE(FM_GlobalData.FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_STUB_COUNT(FM_DigestCacheLookup, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_ParallelCRC(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoSize  = FM_CRC_WORKER_MIN_FILE_SIZE,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    os_fstat_t FileStatus = {.FileSize = FM_CRC_WORKER_MIN_FILE_SIZE};
+
+    FM_GlobalData.CrcWorkerCount = FM_CRC_WORKER_COUNT;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcImplSupported), true);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStatus, sizeof(FileStatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_BOOL_TRUE(FM_GlobalData.FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_STUB_COUNT(OS_OpenCreate, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(OS_read, FM_CRC_WORKER_MIN_FILE_SIZE / FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, 0);
+    UtAssert_STUB_COUNT(FM_CrcCombine, FM_CRC_WORKER_COUNT);
+    UtAssert_STUB_COUNT(FM_DigestFinal, 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_ParallelCRCFileChanged(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoSize  = FM_CRC_WORKER_MIN_FILE_SIZE,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    os_fstat_t FileStatus = {.FileSize = FM_CRC_WORKER_MIN_FILE_SIZE + FM_CHILD_FILE_BLOCK_SIZE};
+
+    FM_GlobalData.CrcWorkerCount = FM_CRC_WORKER_COUNT;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcImplSupported), true);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStatus, sizeof(FileStatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_BOOL_TRUE(FM_GlobalData.FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_STUB_COUNT(OS_read, (FM_CRC_WORKER_MIN_FILE_SIZE / FM_CHILD_FILE_BLOCK_SIZE) + 1);
+    UtAssert_STUB_COUNT(FM_DigestFinal, 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 0);
+}
+
+void Test_FM_ChildFileInfoCmd_ParallelCRCNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = FM_CRC_TYPE_CRC32C,
+                                        .FileInfoSize  = FM_CRC_WORKER_MIN_FILE_SIZE,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    FM_GlobalData.CrcWorkerCount = FM_CRC_WORKER_COUNT;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcImplSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_BOOL_FALSE(FM_GlobalData.FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_UINT32_EQ(FM_GlobalData.FileInfoPkt.Payload.CRC, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, FM_CRC_WORKER_COUNT + 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_ParallelCRCFileTooLarge(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoSize  = FM_CRC_WORKER_MIN_FILE_SIZE,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    os_fstat_t FileStatus = {.FileSize = (size_t)INT32_MAX + 1};
+
+    FM_GlobalData.CrcWorkerCount = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcImplSupported), true);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStatus, sizeof(FileStatus), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* The file is too large to split, so the CRC is computed in order */
+    UtAssert_BOOL_TRUE(FM_GlobalData.FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_SmallFileNotParallel(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoSize  = FM_CRC_WORKER_MIN_FILE_SIZE - 1,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    FM_GlobalData.CrcWorkerCount = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcImplSupported), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(FM_DigestInit, 1);
+    UtAssert_STUB_COUNT(FM_CrcCombine, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+}
+
+/* ****************
+ * ChildCreateDirectoryCmd Tests
+ * ***************/
+void Test_FM_ChildCreateDirectoryCmd_OSMkDirSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildCreateDirectoryCmd_OSMkDirNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteDirectoryCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryOpenNoSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryReadNoSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_StrCmpThisDirectoryZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_StrCmpParentDirectoryZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    os_dirent_t          direntry    = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_EMPTY_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_RemoveTheDirIsTrueRmDirSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(FM_DirIndexRemove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(FM_DirIndexRemove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_RMDIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_CursorClosed(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC, .Source1 = "dir"};
+
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Directory held open for paging is closed as well as the one opened here */
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 2);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+    UtAssert_STUB_COUNT(OS_rmdir, 1);
+}
+
+/* ****************
+ * ChildDirListFileCmd Tests
+ * ***************/
+void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_LIST_FILE_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+}
+
+/* ****************
+ * ChildDirListPktCmd Tests
+ * ***************/
+void Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_OS_ERR_EID);
+}
+
+void Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2", .DirListOffset = 1};
+    os_dirent_t direntry = {.FileName = "filename"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirListOffsetExceeded(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+
+    /* Unit under test doesn't really care if the entry name is empty */
+    memset(direntry, 0, sizeof(direntry));
+
+    /* Will fill the entire packet and have one more */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, sizeof(direntry) / sizeof(direntry[0]) + 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_UINT8_EQ(ReportPtr->LastPacket, false);
+
+    /* Directory is kept open for the next packet */
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.DirListCursor.DirName, sizeof(FM_GlobalData.DirListCursor.DirName), "source1",
+                          sizeof("source1"));
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListCursor.NextEntry, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListCursor.TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
+}
+
+void Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
+                                        .Source1     = "source1",
+                                        .Source2 = "source2_has_quite_a_long_name_to_make_path_length_longer_than_64"};
+    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_WARNING_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirStatNotSuccess(void)
+{
+    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source1/"};
+
+    memset(direntry, 0, sizeof(direntry));
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Without a directory time changes cannot be detected, the directory is not kept open */
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListPkt.Payload.LastPacket, false);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+}
+
+void Test_FM_ChildDirListPktCmd_CursorUsed(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source1/", .DirListOffset = 1};
+    os_dirent_t direntry[] = {{.FileName = "beta"}, {.FileName = FM_PARENT_DIRECTORY}, {.FileName = "gamma"}};
+
+    /* Previous packet listed the first entry */
+    UT_FM_DirListCursor_Setup("source1", 1, 3);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 2);
+    UtAssert_UINT8_EQ(ReportPtr->LastPacket, true);
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[0].EntryName, sizeof(ReportPtr->FileList[0].EntryName), "beta",
+                          sizeof("beta"));
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[1].EntryName, sizeof(ReportPtr->FileList[1].EntryName), "gamma",
+                          sizeof("gamma"));
+
+    /* Last entry was listed, the directory is closed */
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+}
+
+void Test_FM_ChildDirListPktCmd_CursorSkipsToOffset(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_DIR_LIST_PKT_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source1/",
+                                        .DirListOffset = FM_DIR_LIST_PKT_ENTRIES};
+    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+
+    memset(direntry, 0, sizeof(direntry));
+    snprintf(direntry[FM_DIR_LIST_PKT_ENTRIES].FileName, sizeof(direntry[0].FileName), "last");
+
+    /* Cursor is at the start, the requested page is one packet later */
+    UT_FM_DirListCursor_Setup("source1", 0, (2 * FM_DIR_LIST_PKT_ENTRIES) + 1);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), FM_DIR_LIST_PKT_ENTRIES + 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 1);
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[0].EntryName, sizeof(ReportPtr->FileList[0].EntryName), "last",
+                          sizeof("last"));
+
+    /* Directory ended before the counted entries, the listing ends with what was read */
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, FM_DIR_LIST_PKT_ENTRIES + 1);
+    UtAssert_UINT8_EQ(ReportPtr->LastPacket, true);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+}
+
+void Test_FM_ChildDirListPktCmd_CursorRewound(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source1/"};
+    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES];
+
+    memset(direntry, 0, sizeof(direntry));
+
+    /* Page requested again from the start after the cursor moved on */
+    UT_FM_DirListCursor_Setup("source1", FM_DIR_LIST_PKT_ENTRIES, FM_DIR_LIST_PKT_ENTRIES + 1);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.Payload.PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListPkt.Payload.LastPacket, false);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListCursor.NextEntry, FM_DIR_LIST_PKT_ENTRIES);
+}
+
+void Test_FM_ChildDirListPktCmd_StreamCursor(void)
+{
+    static os_dirent_t       direntry[(2 * FM_DIR_LIST_PKT_ENTRIES) + 2];
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_DIR_LIST_PKT_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source1/",
+                                        .DirListOffset = 1,
+                                        .PacketMode    = FM_DIR_LIST_PKT_STREAM};
+
+    /* Two full packets and one more entry after the offset */
+    memset(direntry, 0, sizeof(direntry));
+    UT_FM_DirListCursor_Setup("source1", 0, (2 * FM_DIR_LIST_PKT_ENTRIES) + 2);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, (2 * FM_DIR_LIST_PKT_ENTRIES) + 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketSequence, 2);
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, (2 * FM_DIR_LIST_PKT_ENTRIES) + 1);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, (2 * FM_DIR_LIST_PKT_ENTRIES) + 2);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 1);
+    UtAssert_UINT8_EQ(ReportPtr->LastPacket, true);
+}
+
+void Test_FM_ChildDirListPktCmd_StreamRead(void)
+{
+    static os_dirent_t       direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_LIST_PKT_CC,
+                                        .Source1     = "source1",
+                                        .Source2     = "source1/",
+                                        .PacketMode  = FM_DIR_LIST_PKT_STREAM};
+
+    /* The listing reads one full packet and one more entry */
+    memset(direntry, 0, sizeof(direntry));
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), (sizeof(direntry) / sizeof(direntry[0])) + 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Every entry was listed, there is nothing to continue */
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketSequence, 1);
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, FM_DIR_LIST_PKT_ENTRIES + 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 1);
+    UtAssert_UINT8_EQ(ReportPtr->LastPacket, true);
+}
+
+void UT_Handler_DirIndexHeader(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    FM_DirIndexHeader_t *HeaderPtr = UT_Hook_GetArgValueByName(Context, "HeaderPtr", FM_DirIndexHeader_t *);
+
+    memcpy(HeaderPtr, UserObj, sizeof(*HeaderPtr));
+}
+
+void Test_FM_ChildDirListPktCmd_IndexUsed(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+    FM_DirIndexHeader_t      Header = {.EntryCount = 3};
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode     = FM_GET_DIR_LIST_PKT_CC,
+                                        .Source1         = "source1",
+                                        .Source2         = "source1/",
+                                        .DirListOffset   = 1,
+                                        .GetSizeTimeMode = false};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexOpen), true);
+    UT_SetHandlerFunction(UT_KEY(FM_DirIndexOpen), UT_Handler_DirIndexHeader, &Header);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexRead), 2);
+    FM_GlobalData.DirListPkt.Payload.FileList[0].EntrySize = 99;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+    UtAssert_STUB_COUNT(FM_DirIndexBuild, 0);
+    UtAssert_STUB_COUNT(FM_DirIndexRead, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 2);
+    UtAssert_UINT8_EQ(ReportPtr->LastPacket, true);
+
+    /* Size, time and mode are left out when not commanded */
+    UtAssert_UINT32_EQ(ReportPtr->FileList[0].EntrySize, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_IndexStale(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source1/"};
+
+    /* A stale index is not opened, it is only rebuilt by command */
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexOpen), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_DirIndexBuild, 0);
+    UtAssert_STUB_COUNT(FM_DirIndexOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.Payload.TotalFiles, 0);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListPkt.Payload.LastPacket, true);
+}
+
+void Test_FM_ChildDirListPktCmd_IndexUnreadable(void)
+{
+    FM_DirIndexHeader_t Header = {.EntryCount = 5};
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source1/"};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexOpen), true);
+    UT_SetHandlerFunction(UT_KEY(FM_DirIndexOpen), UT_Handler_DirIndexHeader, &Header);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_DirIndexRead, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.Payload.TotalFiles, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListPkt.Payload.PacketFiles, 0);
+}
+
+/* ****************
+ * ChildDirListCursor Tests
+ * ***************/
+void Test_FM_ChildDirListCursorOpen_Nominal(void)
+{
+    FM_DirListCursor_t *CursorPtr = &FM_GlobalData.DirListCursor;
+    uint32              Now       = 100;
+
+    /* Arrange */
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListCursorOpen(FM_UT_OBJID_1, "dir", 5, 7));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(CursorPtr->DirId, FM_UT_OBJID_1));
+    UtAssert_UINT32_EQ(CursorPtr->DirTime, 5);
+    UtAssert_UINT32_EQ(CursorPtr->OpenTime, 100);
+    UtAssert_UINT32_EQ(CursorPtr->NextEntry, 0);
+    UtAssert_UINT32_EQ(CursorPtr->TotalFiles, 7);
+    UtAssert_STRINGBUF_EQ(CursorPtr->DirName, sizeof(CursorPtr->DirName), "dir", sizeof("dir"));
+}
+
+void Test_FM_ChildDirListCursorClose_Nominal(void)
+{
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListCursorClose());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+
+    /* Nothing left to close */
+    UtAssert_VOIDCALL(FM_ChildDirListCursorClose());
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+}
+
+void Test_FM_ChildDirListCursorExpire_NoCursor(void)
+{
+    /* Act/Assert */
+    UtAssert_UINT32_EQ(FM_ChildDirListCursorExpire(), 0);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+}
+
+void Test_FM_ChildDirListCursorExpire_Held(void)
+{
+    uint32 Now = 1;
+
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+
+    /* Act/Assert */
+    UtAssert_UINT32_EQ(FM_ChildDirListCursorExpire(), (FM_DIR_LIST_CURSOR_TTL - 1) * 1000);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], 'd');
+}
+
+void Test_FM_ChildDirListCursorExpire_Expired(void)
+{
+    uint32 Now = FM_DIR_LIST_CURSOR_TTL;
+
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+
+    /* Act/Assert */
+    UtAssert_UINT32_EQ(FM_ChildDirListCursorExpire(), 0);
     UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_UINT8_EQ(FM_GlobalData.DirListCursor.DirName[0], '\0');
+}
+
+void Test_FM_ChildDirListCursorValid_Nominal(void)
+{
+    uint32 Now = FM_DIR_LIST_CURSOR_TTL - 1;
+
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+
+    /* Act/Assert */
+    UtAssert_BOOL_TRUE(FM_ChildDirListCursorValid("dir"));
+}
+
+void Test_FM_ChildDirListCursorValid_OtherDirectory(void)
+{
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+
+    /* Act/Assert */
+    UtAssert_BOOL_FALSE(FM_ChildDirListCursorValid("dir2"));
+    UtAssert_STUB_COUNT(OS_stat, 0);
+
+    FM_GlobalData.DirListCursor.DirName[0] = '\0';
+    UtAssert_BOOL_FALSE(FM_ChildDirListCursorValid(""));
+}
+
+void Test_FM_ChildDirListCursorValid_Expired(void)
+{
+    uint32 Now = FM_DIR_LIST_CURSOR_TTL;
+
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+
+    /* Act/Assert */
+    UtAssert_BOOL_FALSE(FM_ChildDirListCursorValid("dir"));
+
+    /* Clock set back before the directory was counted */
+    FM_GlobalData.DirListCursor.OpenTime = Now + 1;
+    UtAssert_BOOL_FALSE(FM_ChildDirListCursorValid("dir"));
+}
+
+void Test_FM_ChildDirListCursorValid_DirectoryChanged(void)
+{
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    FM_GlobalData.DirListCursor.DirTime = 1;
+
+    /* Act/Assert */
+    UtAssert_BOOL_FALSE(FM_ChildDirListCursorValid("dir"));
+
+    FM_GlobalData.DirListCursor.DirTime = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+    UtAssert_BOOL_FALSE(FM_ChildDirListCursorValid("dir"));
+}
+
+/* ****************
+ * ChildDirListSortedCmd Tests
+ * ***************/
+void Test_FM_ChildDirListSortedCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_SORTED_CC, .Source1 = "dir", .Source2 = "dir/", .MaxEntries = 2};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListSortedCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_SORTED_OS_ERR_EID);
+}
+
+void Test_FM_ChildDirListSortedCmd_LargestMatching(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry  = {.CommandCode   = FM_GET_DIR_LIST_SORTED_CC,
+                                        .Source1       = "dir",
+                                        .Source2       = "dir/",
+                                        .Target        = "*.log",
+                                        .MaxEntries    = 2,
+                                        .SortKey       = FM_SORT_BY_SIZE,
+                                        .SortDirection = FM_SORT_DESCENDING};
+    os_dirent_t          direntry[]   = {{.FileName = FM_THIS_DIRECTORY},
+                              {.FileName = "a.log"},
+                              {.FileName = "b.txt"},
+                              {.FileName = "c.log"},
+                              {.FileName = "d.log"}};
+    os_fstat_t           filestatus[] = {{.FileSize = 10}, {.FileSize = 30}, {.FileSize = 20}};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 6, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListSortedCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Every matching entry is read to order by size */
+    UtAssert_STUB_COUNT(OS_stat, 3);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_SORTED_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 2);
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[0].EntryName, sizeof(ReportPtr->FileList[0].EntryName), "c.log",
+                          sizeof("c.log"));
+    UtAssert_UINT32_EQ(ReportPtr->FileList[0].EntrySize, 30);
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[1].EntryName, sizeof(ReportPtr->FileList[1].EntryName), "d.log",
+                          sizeof("d.log"));
+    UtAssert_UINT32_EQ(ReportPtr->FileList[1].EntrySize, 20);
+}
+
+void Test_FM_ChildDirListSortedCmd_FirstNames(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode     = FM_GET_DIR_LIST_SORTED_CC,
+                                        .Source1         = "dir",
+                                        .Source2         = "dir/",
+                                        .MaxEntries      = 2,
+                                        .SortKey         = FM_SORT_BY_NAME,
+                                        .SortDirection   = FM_SORT_ASCENDING,
+                                        .GetSizeTimeMode = true};
+    os_dirent_t          direntry[]  = {{.FileName = "c"}, {.FileName = "a"}, {.FileName = "b"}};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 4, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListSortedCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Only the listed entries are read */
+    UtAssert_STUB_COUNT(OS_stat, 2);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 2);
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[0].EntryName, sizeof(ReportPtr->FileList[0].EntryName), "a",
+                          sizeof("a"));
+    UtAssert_STRINGBUF_EQ(ReportPtr->FileList[1].EntryName, sizeof(ReportPtr->FileList[1].EntryName), "b",
+                          sizeof("b"));
+}
+
+void Test_FM_ChildDirListSortedCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_LIST_SORTED_CC,
+                                        .Source1     = "source1",
+                                        .Source2 = "source2_has_quite_a_long_name_to_make_path_length_longer_than_64",
+                                        .MaxEntries = 2};
+    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListSortedCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_SORTED_WARNING_EID);
+
+    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+/* ****************
+ * ChildPatternMatch Tests
+ * ***************/
+void Test_FM_ChildPatternMatch(void)
+{
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("", "any"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("name", "name"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("name", "names"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("names", "name"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*", "name"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*.log", "event.log"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("*.log", "event.log.gz"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("*.log*", "event.log.gz"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("ev?nt*", "event.log"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("ev?nt", "evnt"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("a*b*c", "axxbyybzc"));
+    UtAssert_BOOL_FALSE(FM_ChildPatternMatch("a*b*c", "axxbyybz"));
+    UtAssert_BOOL_TRUE(FM_ChildPatternMatch("**", ""));
+}
+
+/* ****************
+ * ChildDirListHeap Tests
+ * ***************/
+void Test_FM_ChildDirListBefore(void)
+{
+    FM_DirListEntry_t Entry1 = {.EntryName = "a", .EntrySize = 2, .ModifyTime = 5};
+    FM_DirListEntry_t Entry2 = {.EntryName = "b", .EntrySize = 1, .ModifyTime = 5};
+
+    UtAssert_BOOL_TRUE(FM_ChildDirListBefore(&Entry1, &Entry2, FM_SORT_BY_NAME, FM_SORT_ASCENDING));
+    UtAssert_BOOL_FALSE(FM_ChildDirListBefore(&Entry1, &Entry2, FM_SORT_BY_NAME, FM_SORT_DESCENDING));
+    UtAssert_BOOL_FALSE(FM_ChildDirListBefore(&Entry1, &Entry2, FM_SORT_BY_SIZE, FM_SORT_ASCENDING));
+    UtAssert_BOOL_TRUE(FM_ChildDirListBefore(&Entry1, &Entry2, FM_SORT_BY_SIZE, FM_SORT_DESCENDING));
+
+    /* Equal times are ordered by name */
+    UtAssert_BOOL_TRUE(FM_ChildDirListBefore(&Entry1, &Entry2, FM_SORT_BY_TIME, FM_SORT_ASCENDING));
+    UtAssert_BOOL_TRUE(FM_ChildDirListBefore(&Entry2, &Entry1, FM_SORT_BY_TIME, FM_SORT_DESCENDING));
+
+    /* Equal entries */
+    UtAssert_BOOL_FALSE(FM_ChildDirListBefore(&Entry1, &Entry1, FM_SORT_BY_TIME, FM_SORT_ASCENDING));
+}
+
+void Test_FM_ChildDirListHeap_Newest(void)
+{
+    FM_DirListEntry_t Heap[5];
+    FM_DirListEntry_t Entry;
+    uint32            HeapCount = 0;
+    uint32            i;
+
+    memset(Heap, 0, sizeof(Heap));
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* Times 0 to 49 in scrambled order, keep the newest 5 */
+    for (i = 0; i < 50; i++)
+    {
+        Entry.ModifyTime = (i * 17) % 50;
+        snprintf(Entry.EntryName, sizeof(Entry.EntryName), "file%u", (unsigned int)Entry.ModifyTime);
+        FM_ChildDirListHeapAdd(Heap, &HeapCount, 5, &Entry, FM_SORT_BY_TIME, FM_SORT_DESCENDING);
+    }
+
+    FM_ChildDirListHeapSort(Heap, HeapCount, FM_SORT_BY_TIME, FM_SORT_DESCENDING);
+
+    UtAssert_UINT32_EQ(HeapCount, 5);
+    for (i = 0; i < HeapCount; i++)
+    {
+        UtAssert_UINT32_EQ(Heap[i].ModifyTime, 49 - i);
+    }
+    UtAssert_STRINGBUF_EQ(Heap[0].EntryName, sizeof(Heap[0].EntryName), "file49", sizeof("file49"));
+}
+
+void Test_FM_ChildDirListHeap_NotFull(void)
+{
+    FM_DirListEntry_t Heap[5];
+    FM_DirListEntry_t Entry;
+    uint32            HeapCount = 0;
+
+    memset(Heap, 0, sizeof(Heap));
+    memset(&Entry, 0, sizeof(Entry));
+
+    Entry.EntrySize = 7;
+    FM_ChildDirListHeapAdd(Heap, &HeapCount, 5, &Entry, FM_SORT_BY_SIZE, FM_SORT_ASCENDING);
+    Entry.EntrySize = 3;
+    FM_ChildDirListHeapAdd(Heap, &HeapCount, 5, &Entry, FM_SORT_BY_SIZE, FM_SORT_ASCENDING);
+
+    /* A limit of zero keeps nothing */
+    FM_ChildDirListHeapAdd(Heap, &HeapCount, 0, &Entry, FM_SORT_BY_SIZE, FM_SORT_ASCENDING);
+
+    FM_ChildDirListHeapSort(Heap, HeapCount, FM_SORT_BY_SIZE, FM_SORT_ASCENDING);
+
+    UtAssert_UINT32_EQ(HeapCount, 2);
+    UtAssert_UINT32_EQ(Heap[0].EntrySize, 3);
+    UtAssert_UINT32_EQ(Heap[1].EntrySize, 7);
+}
+
+/* ****************
+ * ChildDirStatsCmd Tests
+ * ***************/
+void Test_FM_ChildDirStatsCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_STATS_CC, .Source1 = "dir", .Source2 = "dir/"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirStatsCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_STATS_OS_ERR_EID);
+}
+
+void Test_FM_ChildDirStatsCmd_Totals(void)
+{
+    FM_DirStatsPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry  = {.CommandCode = FM_GET_DIR_STATS_CC, .Source1 = "dir", .Source2 = "dir/"};
+    os_dirent_t          direntry[]   = {{.FileName = FM_THIS_DIRECTORY},
+                              {.FileName = "empty"},
+                              {.FileName = "big"},
+                              {.FileName = "sub"},
+                              {.FileName = "small"}};
+    os_fstat_t           filestatus[] = {{.FileTime = {.ticks = 200}, .FileSize = 0},
+                               {.FileTime = {.ticks = 300}, .FileSize = 5000},
+                               {.FileModeBits = OS_FILESTAT_MODE_DIR, .FileTime = {.ticks = 50}},
+                               {.FileTime = {.ticks = 100}, .FileSize = 3}};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 6, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirStatsCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 4);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_STATS_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirStatsPkt.Payload;
+    UtAssert_STRINGBUF_EQ(ReportPtr->DirName, sizeof(ReportPtr->DirName), "dir", sizeof("dir"));
+    UtAssert_UINT32_EQ(ReportPtr->TotalEntries, 4);
+    UtAssert_UINT32_EQ(ReportPtr->FileCount, 3);
+    UtAssert_UINT32_EQ(ReportPtr->DirCount, 1);
+    UtAssert_UINT32_EQ(ReportPtr->UnreadCount, 0);
+    UtAssert_UINT32_EQ(ReportPtr->TotalBytes, 5003);
+
+    /* Subdirectory time is not a file time */
+    UtAssert_UINT32_EQ(ReportPtr->OldestTime, OS_FILESTAT_TIME(filestatus[3]));
+    UtAssert_UINT32_EQ(ReportPtr->NewestTime, OS_FILESTAT_TIME(filestatus[1]));
+
+    UtAssert_UINT32_EQ(ReportPtr->LargestSize, 5000);
+    UtAssert_STRINGBUF_EQ(ReportPtr->LargestName, sizeof(ReportPtr->LargestName), "big", sizeof("big"));
+
+    /* 0 bytes in bin 0, 3 bytes in bin 2 (2-3), 5000 bytes in bin 13 (4096-8191) */
+    UtAssert_UINT32_EQ(ReportPtr->SizeHistogram[0], 1);
+    UtAssert_UINT32_EQ(ReportPtr->SizeHistogram[2], 1);
+    UtAssert_UINT32_EQ(ReportPtr->SizeHistogram[13], 1);
+    UtAssert_UINT32_EQ(ReportPtr->SizeHistogram[12], 0);
+}
+
+void Test_FM_ChildDirStatsCmd_LargestSizeBin(void)
+{
+    FM_DirStatsPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_STATS_CC, .Source1 = "dir", .Source2 = "dir/"};
+    os_dirent_t          direntry    = {.FileName = "huge"};
+    os_fstat_t           filestatus  = {.FileSize = 0xFFFFFFFF};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirStatsCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    ReportPtr = &FM_GlobalData.DirStatsPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->SizeHistogram[FM_DIR_STATS_SIZE_BINS - 1], 1);
+    UtAssert_UINT32_EQ(ReportPtr->LargestSize, 0xFFFFFFFF);
+}
+
+void Test_FM_ChildDirStatsCmd_EntriesNotRead(void)
+{
+    FM_DirStatsPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_STATS_CC, .Source1 = "dir", .Source2 = ""};
+    os_dirent_t          direntry[]  = {{.FileName = "gone"}, {.FileName = "longer"}};
+
+    /* Directory plus separator fills the path, so the second entry is too long */
+    memset(queue_entry.Source2, 'a', sizeof(queue_entry.Source2) - 5);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirStatsCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_STATS_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_STATS_CMD_INF_EID);
+
+    ReportPtr = &FM_GlobalData.DirStatsPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->TotalEntries, 2);
+    UtAssert_UINT32_EQ(ReportPtr->UnreadCount, 2);
+    UtAssert_UINT32_EQ(ReportPtr->FileCount, 0);
+    UtAssert_UINT32_EQ(ReportPtr->DirCount, 0);
+    UtAssert_UINT32_EQ(ReportPtr->SizeHistogram[0], 0);
+}
+
+/* ****************
+ * ChildDirChangesCmd Tests
+ * ***************/
+void UT_FM_DirTrack_Add(FM_DirTrack_t *TrackPtr, const char *Name, uint32 Size, uint32 Sequence, uint32 AddedSequence)
+{
+    FM_DirTrackEntry_t *EntryPtr = &TrackPtr->Entries[TrackPtr->EntryCount];
+
+    snprintf(EntryPtr->Name, sizeof(EntryPtr->Name), "%s", Name);
+    EntryPtr->Size          = Size;
+    EntryPtr->Sequence      = Sequence;
+    EntryPtr->AddedSequence = AddedSequence;
+
+    TrackPtr->EntryCount++;
+}
+
+void Test_FM_ChildDirChangesCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_CHANGES_CC, .Source1 = "dir", .Source2 = "dir/"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirChangesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_CHANGES_OS_ERR_EID);
+
+    /* Directory is not left tracked */
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.DirTrack[0].DirName, sizeof(FM_GlobalData.DirTrack[0].DirName), "", 1);
+}
+
+void Test_FM_ChildDirChangesCmd_FullListing(void)
+{
+    FM_DirChangesPkt_Payload_t *ReportPtr;
+    uint32                      Now = 1000;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry  = {.CommandCode = FM_GET_DIR_CHANGES_CC, .Source1 = "dir", .Source2 = "dir/"};
+    os_dirent_t          direntry[]   = {{.FileName = "c"}, {.FileName = FM_THIS_DIRECTORY}, {.FileName = "a"},
+                              {.FileName = "b"}};
+    os_fstat_t           filestatus[] = {{.FileSize = 30}, {.FileSize = 10}, {.FileSize = 20}};
+
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 5, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirChangesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 3);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_CHANGES_CMD_INF_EID);
+
+    /* Every entry is added by the first read, in name order */
+    ReportPtr = &FM_GlobalData.DirChangesPkt.Payload;
+    UtAssert_STRINGBUF_EQ(ReportPtr->DirName, sizeof(ReportPtr->DirName), "dir", sizeof("dir"));
+    UtAssert_UINT32_EQ(ReportPtr->Sequence, 1001);
+    UtAssert_BOOL_TRUE(ReportPtr->FullListing);
+    UtAssert_BOOL_FALSE(ReportPtr->Incomplete);
+    UtAssert_UINT32_EQ(ReportPtr->TotalChanges, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketChanges, 3);
+    UtAssert_STRINGBUF_EQ(ReportPtr->ChangeList[0].EntryName, OS_MAX_PATH_LEN, "a", sizeof("a"));
+    UtAssert_STRINGBUF_EQ(ReportPtr->ChangeList[2].EntryName, OS_MAX_PATH_LEN, "c", sizeof("c"));
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[0].EntrySize, 10);
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[2].EntrySize, 30);
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[1].ChangeType, FM_DIR_CHANGE_ADDED);
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[1].Sequence, 1001);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirTrack[0].EntryCount, 3);
+}
+
+void Test_FM_ChildDirChangesCmd_Delta(void)
+{
+    FM_DirChangesPkt_Payload_t *ReportPtr;
+    FM_DirTrack_t *             TrackPtr = &FM_GlobalData.DirTrack[0];
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_CHANGES_CC, .Source1 = "dir", .Source2 = "dir/", .SinceSequence = 1001};
+    os_dirent_t direntry[]   = {{.FileName = "same"}, {.FileName = "grown"}, {.FileName = "new"}};
+    os_fstat_t  filestatus[] = {{.FileSize = 1}, {.FileSize = 200}, {.FileSize = 3}};
+
+    /* Tracked before: "gone", "grown" and "same" */
+    snprintf(TrackPtr->DirName, sizeof(TrackPtr->DirName), "dir");
+    TrackPtr->Sequence    = 1001;
+    TrackPtr->RemovedBase = 1000;
+    TrackPtr->WatchFd     = -1;
+    UT_FM_DirTrack_Add(TrackPtr, "gone", 5, 1001, 1001);
+    UT_FM_DirTrack_Add(TrackPtr, "grown", 100, 1001, 1001);
+    UT_FM_DirTrack_Add(TrackPtr, "same", 1, 1001, 1001);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 4, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirChangesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    /* Same directory record is used again */
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+
+    ReportPtr = &FM_GlobalData.DirChangesPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->Sequence, 1002);
+    UtAssert_UINT32_EQ(ReportPtr->SinceSequence, 1001);
+    UtAssert_BOOL_FALSE(ReportPtr->FullListing);
+    UtAssert_UINT32_EQ(ReportPtr->TotalChanges, 3);
+    UtAssert_STRINGBUF_EQ(ReportPtr->ChangeList[0].EntryName, OS_MAX_PATH_LEN, "grown", sizeof("grown"));
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[0].ChangeType, FM_DIR_CHANGE_MODIFIED);
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[0].EntrySize, 200);
+    UtAssert_STRINGBUF_EQ(ReportPtr->ChangeList[1].EntryName, OS_MAX_PATH_LEN, "new", sizeof("new"));
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[1].ChangeType, FM_DIR_CHANGE_ADDED);
+    UtAssert_STRINGBUF_EQ(ReportPtr->ChangeList[2].EntryName, OS_MAX_PATH_LEN, "gone", sizeof("gone"));
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[2].ChangeType, FM_DIR_CHANGE_REMOVED);
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[2].Sequence, 1002);
+
+    /* Unchanged entry keeps its sequence number */
+    UtAssert_UINT32_EQ(TrackPtr->EntryCount, 3);
+    UtAssert_STRINGBUF_EQ(TrackPtr->Entries[2].Name, sizeof(TrackPtr->Entries[2].Name), "same", sizeof("same"));
+    UtAssert_UINT32_EQ(TrackPtr->Entries[2].Sequence, 1001);
+    UtAssert_UINT32_EQ(TrackPtr->RemovedCount, 1);
+}
+
+void Test_FM_ChildDirChangesCmd_NoChanges(void)
+{
+    FM_DirTrack_t *TrackPtr = &FM_GlobalData.DirTrack[0];
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_CHANGES_CC, .Source1 = "dir", .Source2 = "dir/", .SinceSequence = 1001};
+    os_dirent_t direntry   = {.FileName = "same"};
+    os_fstat_t  filestatus = {.FileSize = 1};
+
+    snprintf(TrackPtr->DirName, sizeof(TrackPtr->DirName), "dir");
+    TrackPtr->Sequence    = 1001;
+    TrackPtr->RemovedBase = 1000;
+    TrackPtr->WatchFd     = -1;
+    UT_FM_DirTrack_Add(TrackPtr, "same", 1, 1001, 1001);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirChangesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirChangesPkt.Payload.Sequence, 1001);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirChangesPkt.Payload.TotalChanges, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.DirChangesPkt.Payload.FullListing);
+}
+
+void Test_FM_ChildDirChangesCmd_EntriesNotTracked(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_CHANGES_CC, .Source1 = "dir", .Source2 = "dir/"};
+    os_dirent_t          direntry[]  = {{.FileName = "bad"}, {.FileName = "good"}};
+    os_fstat_t           filestatus  = {.FileSize = 7};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirChangesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_CHANGES_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_CHANGES_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirTrack[0].UntrackedCount, 1);
+    UtAssert_BOOL_TRUE(FM_GlobalData.DirChangesPkt.Payload.Incomplete);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirChangesPkt.Payload.TotalChanges, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.DirChangesPkt.Payload.ChangeList[0].EntryName, OS_MAX_PATH_LEN, "good",
+                          sizeof("good"));
+}
+
+void Test_FM_ChildDirTrackGet_ReuseAndReplace(void)
+{
+    uint32 Now = 5000;
+    uint32 i;
+
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+
+    /* Fill every record, then use the first again */
+    for (i = 0; i < FM_DIR_TRACK_DIRS; i++)
+    {
+        snprintf(UT_CmdBuf.GetDirChangesCmd.Payload.Directory, OS_MAX_PATH_LEN, "dir%u", (unsigned int)i);
+        UtAssert_ADDRESS_EQ(FM_ChildDirTrackGet(UT_CmdBuf.GetDirChangesCmd.Payload.Directory),
+                            &FM_GlobalData.DirTrack[i]);
+    }
+
+    FM_GlobalData.DirTrack[0].Sequence = 5003;
+    UtAssert_ADDRESS_EQ(FM_ChildDirTrackGet("dir0"), &FM_GlobalData.DirTrack[0]);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirTrack[0].Sequence, 5003);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, FM_DIR_TRACK_DIRS);
+
+    /* A new directory replaces the least recently used record */
+    Now = 6000;
+    if (FM_DIR_TRACK_DIRS > 1)
+    {
+        UtAssert_ADDRESS_EQ(FM_ChildDirTrackGet("other"), &FM_GlobalData.DirTrack[1]);
+        UtAssert_UINT32_EQ(FM_GlobalData.DirTrack[1].Sequence, 6000);
+        UtAssert_UINT32_EQ(FM_GlobalData.DirTrack[1].RemovedBase, 6000);
+        UtAssert_INT32_EQ(FM_GlobalData.DirTrack[1].WatchFd, -1);
+    }
+}
+
+void Test_FM_ChildDirTrackRemove_Ring(void)
+{
+    FM_DirTrack_t *TrackPtr = &FM_GlobalData.DirTrack[0];
+    char           Name[OS_MAX_FILE_NAME];
+    uint32         i;
+
+    TrackPtr->RemovedBase = 100;
+
+    /* Removing the same name again only updates the sequence number */
+    FM_ChildDirTrackRemove(TrackPtr, "file", 101);
+    FM_ChildDirTrackRemove(TrackPtr, "file", 102);
+    UtAssert_UINT32_EQ(TrackPtr->RemovedCount, 1);
+    UtAssert_UINT32_EQ(TrackPtr->Removed[0].Sequence, 102);
+
+    for (i = 1; i < FM_DIR_TRACK_REMOVED; i++)
+    {
+        snprintf(Name, sizeof(Name), "file%u", (unsigned int)i);
+        FM_ChildDirTrackRemove(TrackPtr, Name, 102 + i);
+    }
+    UtAssert_UINT32_EQ(TrackPtr->RemovedCount, FM_DIR_TRACK_REMOVED);
+    UtAssert_UINT32_EQ(TrackPtr->RemovedBase, 100);
+
+    /* The oldest removal is overwritten and no longer known */
+    FM_ChildDirTrackRemove(TrackPtr, "last", 500);
+    UtAssert_UINT32_EQ(TrackPtr->RemovedCount, FM_DIR_TRACK_REMOVED);
+    UtAssert_UINT32_EQ(TrackPtr->RemovedBase, 102);
+    UtAssert_STRINGBUF_EQ(TrackPtr->Removed[0].Name, sizeof(TrackPtr->Removed[0].Name), "last", sizeof("last"));
+}
+
+void Test_FM_ChildDirChangesReport_Removed(void)
+{
+    FM_DirChangesPkt_Payload_t *ReportPtr = &FM_GlobalData.DirChangesPkt.Payload;
+    FM_DirTrack_t *             TrackPtr  = &FM_GlobalData.DirTrack[0];
+    FM_ChildQueueEntry_t        CmdArgs   = {.Source1 = "dir", .SinceSequence = 10};
+
+    TrackPtr->Sequence    = 12;
+    TrackPtr->RemovedBase = 8;
+    UT_FM_DirTrack_Add(TrackPtr, "back", 4, 12, 12);
+    FM_ChildDirTrackRemove(TrackPtr, "back", 11);
+    FM_ChildDirTrackRemove(TrackPtr, "old", 9);
+    FM_ChildDirTrackRemove(TrackPtr, "gone", 12);
+
+    /* Removed entry that is back is only added, removal before the sequence is not listed */
+    UtAssert_VOIDCALL(FM_ChildDirChangesReport(TrackPtr, &CmdArgs));
+    UtAssert_BOOL_FALSE(ReportPtr->FullListing);
+    UtAssert_UINT32_EQ(ReportPtr->TotalChanges, 2);
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[0].ChangeType, FM_DIR_CHANGE_ADDED);
+    UtAssert_STRINGBUF_EQ(ReportPtr->ChangeList[1].EntryName, OS_MAX_PATH_LEN, "gone", sizeof("gone"));
+    UtAssert_UINT32_EQ(ReportPtr->ChangeList[1].ChangeType, FM_DIR_CHANGE_REMOVED);
+
+    /* Sequence older than the removals known, or newer than any, lists everything */
+    CmdArgs.SinceSequence = 7;
+    UtAssert_VOIDCALL(FM_ChildDirChangesReport(TrackPtr, &CmdArgs));
+    UtAssert_BOOL_TRUE(ReportPtr->FullListing);
+    UtAssert_UINT32_EQ(ReportPtr->TotalChanges, 1);
+
+    CmdArgs.SinceSequence = 13;
+    UtAssert_VOIDCALL(FM_ChildDirChangesReport(TrackPtr, &CmdArgs));
+    UtAssert_BOOL_TRUE(ReportPtr->FullListing);
+}
+
+void Test_FM_ChildDirChangesAdd_Offset(void)
+{
+    FM_DirChangesPkt_Payload_t ReportData;
+    FM_DirTrackEntry_t         Entry = {.Name = "entry", .Size = 9, .Sequence = 3};
+    uint32                     i;
+
+    memset(&ReportData, 0, sizeof(ReportData));
+    ReportData.FirstChange = 2;
+
+    for (i = 0; i < (FM_DIR_LIST_PKT_ENTRIES + 4); i++)
+    {
+        FM_ChildDirChangesAdd(&ReportData, &Entry, FM_DIR_CHANGE_MODIFIED);
+    }
+
+    /* Changes before the offset and after the packet is full are only counted */
+    UtAssert_UINT32_EQ(ReportData.TotalChanges, FM_DIR_LIST_PKT_ENTRIES + 4);
+    UtAssert_UINT32_EQ(ReportData.PacketChanges, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_UINT32_EQ(ReportData.ChangeList[0].EntrySize, 9);
+    UtAssert_UINT32_EQ(ReportData.ChangeList[0].Sequence, 3);
+    UtAssert_UINT32_EQ(ReportData.ChangeList[0].ChangeType, FM_DIR_CHANGE_MODIFIED);
+}
+
+/* ****************
+ * ChildBuildDirIndexCmd Tests
+ * ***************/
+void Test_FM_ChildBuildDirIndexCmd_Success(void)
+{
+    FM_DirIndexHeader_t Header = {.EntryCount = 4, .FileCount = 3, .TotalBytes = 300};
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_BUILD_DIR_INDEX_CC, .Source1 = "dir", .Source2 = "dir/"};
+
+    UT_SetHandlerFunction(UT_KEY(FM_DirIndexBuild), UT_Handler_DirIndexHeader, &Header);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildBuildDirIndexCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_DirIndexBuild, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_BUILD_DIR_INDEX_CMD_INF_EID);
+}
+
+void Test_FM_ChildBuildDirIndexCmd_BuildFailed(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_BUILD_DIR_INDEX_CC, .Source1 = "dir", .Source2 = "dir/"};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexBuild), OS_ERR_NAME_NOT_FOUND);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildBuildDirIndexCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_BUILD_DIR_INDEX_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildSetPermissionsCmd Tests
+ * ***************/
+void Test_FM_ChildSetPermissionsCmd_OSChmodSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_CMD_INF_EID);
+}
+
+void Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDirManifestCmd Tests
+ * ***************/
+void Test_FM_ChildDirManifestCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DIR_MANIFEST_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirManifestCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_OSOPENDIR_ERR_EID);
+}
+
+void Test_FM_ChildDirManifestCmd_ChildDirManifestInitFalse(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DIR_MANIFEST_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirManifestCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_OSCREAT_ERR_EID);
+}
+
+void Test_FM_ChildDirManifestCmd_ChildDirManifestInitTrue(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DIR_MANIFEST_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirManifestCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_CMD_INF_EID);
+}
+
+/* ****************
+ * ChildCompareFilesCmd Tests
+ * ***************/
+void Test_FM_ChildCompareFilesCmd_OSStat1NotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSSTAT_ERR_EID);
+}
+
+void Test_FM_ChildCompareFilesCmd_OSStat2NotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSSTAT_ERR_EID);
+}
+
+void Test_FM_ChildCompareFilesCmd_SizeDiffers(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry   = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+    os_fstat_t           filestatus[2] = {{.FileSize = 100}, {.FileSize = 200}};
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CompareFilesPkt.Payload.Result, FM_COMPARE_SIZE_DIFFERS);
+    UtAssert_UINT32_EQ(FM_GlobalData.CompareFilesPkt.Payload.FileSize1, 100);
+    UtAssert_UINT32_EQ(FM_GlobalData.CompareFilesPkt.Payload.FileSize2, 200);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.CompareFilesPkt.Payload.Filename2,
+                          sizeof(FM_GlobalData.CompareFilesPkt.Payload.Filename2), "file2", sizeof("file2"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_CMD_INF_EID);
+}
+
+void Test_FM_ChildCompareFilesCmd_OSOpenCreate1NotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSOPEN_ERR_EID);
+}
+
+void Test_FM_ChildCompareFilesCmd_OSOpenCreate2NotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSOPEN_ERR_EID);
+}
+
+void Test_FM_ChildCompareFilesCmd_Identical(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CompareFilesPkt.Payload.Result, FM_COMPARE_IDENTICAL);
+    UtAssert_UINT32_EQ(FM_GlobalData.CompareFilesPkt.Payload.FirstDiffOffset, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_CMD_INF_EID);
+}
+
+void Test_FM_ChildCompareFilesCmd_OSReadNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1", .Source2 = "file2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCompareFilesCmd(&queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSRD_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirectoryFilenameState(void)
+/* ****************
+ * ChildDirListFileInit Tests
+ * ***************/
+void Test_FM_ChildDirListFileInit_OSOpenCreateFail(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    osal_id_t   fileid;
+    const char *directory = "directory";
+    const char *filename  = "filename";
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename, FM_DIR_LIST_FORMAT_STANDARD));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_OpenFilenameState(void)
+void Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    osal_id_t   fileid;
+    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
+    const char *directory       = "directory";
+    const char *filename        = "filename";
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
+    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename, FM_DIR_LIST_FORMAT_STANDARD));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRHDR_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileInit_Success(void)
+{
+    /* Arrange */
+    osal_id_t   fileid;
+    const char *directory = "directory";
+    const char *filename  = "filename";
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildDirListFileInit(&fileid, directory, filename, FM_DIR_LIST_FORMAT_STANDARD));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    /* Placeholder statistics are buffered until the first entries are written */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, sizeof(FM_DirListFileStats_t));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Written, 0);
+}
+
+void UT_Handler_DirListFileSubType(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    *(uint32 *)UserObj = UT_Hook_GetArgValueByName(Context, "SubType", uint32);
+}
+
+void Test_FM_ChildDirListFileInit_CompactFormat(void)
+{
+    /* Arrange */
+    osal_id_t   fileid;
+    const char *directory = "directory";
+    const char *filename  = "filename";
+    uint32      subtype   = 0;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_FS_InitHeader), UT_Handler_DirListFileSubType, &subtype);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildDirListFileInit(&fileid, directory, filename, FM_DIR_LIST_FORMAT_COMPACT));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
+
+    UtAssert_UINT32_EQ(subtype, FM_DIR_LIST_COMPACT_FILE_SUBTYPE);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, sizeof(FM_DirListFileStats_t));
+}
+
+/* ****************
+ * ChildDirListFileLoop Tests
+ * ***************/
+void Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSRmNotSuccess(void)
+void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
-    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSrmSuccess(void)
+void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn(void)
+void Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    char        dirwithsep[OS_MAX_PATH_LEN];
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+
+    memset(dirwithsep, 0xFF, sizeof(dirwithsep));
+    dirwithsep[sizeof(dirwithsep) - 1] = '\0';
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), -1); /* default case */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", dirwithsep, "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WARNING_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
 }
 
-/* ****************
- * ChildDecompressFileCmd Tests
- * ***************/
+void Test_FM_ChildDirListFileLoop_AllEntriesWritten(void)
+{
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint32      entrycnt = 3001;
+    uint32      perblock = FM_CHILD_WRITE_BUFFER_SIZE / sizeof(FM_DirListEntry_t);
 
-void Test_FM_ChildDecompressFileCmd_FSDecompressSuccess(void)
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, entrycnt + 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* Full buffers of entries plus the statistics update */
+    UtAssert_STUB_COUNT(OS_write, ((entrycnt + perblock - 1) / perblock) + 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, entrycnt);
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, entrycnt);
+}
+
+void Test_FM_ChildDirListFileLoop_BufferWriteNotSuccess(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint32      perblock = FM_CHILD_WRITE_BUFFER_SIZE / sizeof(FM_DirListEntry_t);
 
-    FM_GlobalData.ChildCurrentCC = 1;
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    /* Listing stops at the entry that did not fit in the full buffer */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, perblock + 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRENTRY_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileLoop_NextFile(void)
+{
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint32      perfile  = (4096 - sizeof(CFE_FS_Header_t)) / sizeof(FM_DirListEntry_t);
+    uint32      entrycnt = perfile + 2;
+
+    FM_GlobalData.DirListFileMaxSize = 4096;
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    /* Second output file created and closed, the first one belongs to the caller */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Statistics updated in the buffer of each file, the total rewritten in the first file */
+    UtAssert_STUB_COUNT(OS_lseek, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, entrycnt);
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 2);
 }
 
-void Test_FM_ChildDecompressFileCmd_FSDecompressNotSuccess(void)
+void Test_FM_ChildDirListFileLoop_NextFileNotCreated(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint32      perfile  = (4096 - sizeof(CFE_FS_Header_t)) / sizeof(FM_DirListEntry_t);
+    uint32      entrycnt = perfile + 2;
 
-    FM_GlobalData.ChildCurrentCC = 1;
-    UT_SetDefaultReturnValue(UT_KEY(FM_Decompress_Impl), !CFE_SUCCESS);
+    FM_GlobalData.DirListFileMaxSize = 4096;
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    /* Listing stops at the entry that did not fit in the first file */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, perfile + 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, perfile);
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, perfile);
 }
 
-/* ****************
- * ChildConcatFilesCmd Tests
- * ***************/
-void Test_FM_ChildConcatFilesCmd_OSCpNotSuccess(void)
+void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "directory_nam"};
 
-    FM_GlobalData.ChildCurrentCC = 1;
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Placeholder statistics already written, so they must be rewritten in the file */
+    FM_GlobalData.ChildWriter.Written = sizeof(FM_DirListFileStats_t);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
+
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSOpenCreateSourceNotSuccess(void)
+void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "directory_nam"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t) - 1);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
+    /* Buffered entry is written after the directory has been read */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_SRC2_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRENTRY_ERR_EID);
+
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSOpenCreateTargetNotSuccess(void)
+void Test_FM_ChildDirListFileLoop_CompactFormat(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry   = {.FileName = "file"};
+    const uint8 expected[] = {4, 'f', 'i', 'l', 'e', 0, 0, 0};
+    size_t      offset     = sizeof(FM_DirListFileStats_t);
 
-    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_2);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, &FM_GlobalData.DirListFileStats, sizeof(FM_DirListFileStats_t));
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_COMPACT, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_TGT_ERR_EID);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
+
+    /* Eight bytes instead of a FM_DirListEntry_t structure */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Written, offset + sizeof(expected));
+    UtAssert_MemCmp(&FM_GlobalData.ChildWriter.Buffer[offset], expected, sizeof(expected), "Compact entry");
 }
 
-void Test_FM_ChildConcatFilesCmd_OSReadBytesZero(void)
+void Test_FM_ChildDirListFileLoop_Subdirectory(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t              direntry[]   = {{.FileName = "sub"}, {.FileName = "file"}};
+    os_fstat_t               filestatus[] = {{.FileModeBits = OS_FILESTAT_MODE_DIR}, {.FileSize = 10}};
+    const FM_DirListEntry_t *EntryPtr =
+        (const FM_DirListEntry_t *)&FM_GlobalData.ChildWriter.Buffer[sizeof(FM_DirListFileStats_t)];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
+
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_2);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, &FM_GlobalData.DirListFileStats, sizeof(FM_DirListFileStats_t));
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 1));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 0);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    /* Subdirectory opened after its own entry and closed at its end */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 4);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_stat, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 2);
+    UtAssert_STRINGBUF_EQ(EntryPtr[0].EntryName, sizeof(EntryPtr[0].EntryName), "sub", sizeof("sub"));
+    UtAssert_STRINGBUF_EQ(EntryPtr[1].EntryName, sizeof(EntryPtr[1].EntryName), "sub/file", sizeof("sub/file"));
+    UtAssert_UINT32_EQ(EntryPtr[1].EntrySize, 10);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSReadBytesLessThanZero(void)
+void Test_FM_ChildDirListFileLoop_SubdirectoryDepthLimit(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry[]   = {{.FileName = "sub"}, {.FileName = "deeper"}};
+    os_fstat_t  filestatus[] = {{.FileModeBits = OS_FILESTAT_MODE_DIR}, {.FileModeBits = OS_FILESTAT_MODE_DIR}};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestatus, sizeof(filestatus), false);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 1));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+    /* Second level directory is listed but not opened */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 4);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 2);
 }
 
-void Test_FM_ChildConcatFilesCmd_BytesWrittenNotEqualBytesRead(void)
+void Test_FM_ChildDirListFileLoop_SubdirectoryNotOpened(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry   = {.FileName = "sub"};
+    os_fstat_t  filestatus = {.FileModeBits = OS_FILESTAT_MODE_DIR};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), 0);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 1));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    /* The subdirectory entry itself is still written */
+    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
 }
 
-void Test_FM_ChildConcatFilesCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount(void)
+void Test_FM_ChildDirListFileLoop_SubdirectoryWriteNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry   = {.FileName = "sub"};
+    os_fstat_t  filestatus = {.FileModeBits = OS_FILESTAT_MODE_DIR};
+    uint32      perblock   = FM_CHILD_WRITE_BUFFER_SIZE / sizeof(FM_DirListEntry_t);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, -1);
+    /* Every entry is a subdirectory, each one is opened until the buffer write fails */
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 1));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+    /* Open subdirectory is closed after the error */
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_DirectoryRead)), perblock + 1);
 }
 
-/* ****************
- * ChildFileInfoCmd Tests
- * ***************/
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC(void)
+void Test_FM_ChildDirListFileLoop_StatsUpdatedInBuffer(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = FM_IGNORE_CRC,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    os_dirent_t                  direntry = {.FileName = "directory_nam"};
+    const FM_DirListFileStats_t *StatsPtr = (const FM_DirListFileStats_t *)FM_GlobalData.ChildWriter.Buffer;
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+
+    /* Placeholder statistics buffered by FM_ChildDirListFileInit */
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_2);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, &FM_GlobalData.DirListFileStats, sizeof(FM_DirListFileStats_t));
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false,
+                                              FM_DIR_LIST_FORMAT_STANDARD, 0));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    /* Statistics and both entries go out in one write without seeking back */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Written,
+                       sizeof(FM_DirListFileStats_t) + (2 * sizeof(FM_DirListEntry_t)));
+    UtAssert_UINT32_EQ(StatsPtr->DirEntries, 2);
+    UtAssert_UINT32_EQ(StatsPtr->FileEntries, 2);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
+/* ****************
+ * ChildDirListFileNext Tests
+ * ***************/
+void Test_FM_ChildDirListFileNext_Success(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_OPEN};
+    osal_id_t fileid;
+    char      nextname[OS_MAX_PATH_LEN];
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildDirListFileNext(&fileid, "dir", "fname", nextname, 2, FM_DIR_LIST_FORMAT_STANDARD));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STRINGBUF_EQ(nextname, sizeof(nextname), "fname.2", sizeof("fname.2"));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8(void)
+void Test_FM_ChildDirListFileNext_NameTooLong(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    osal_id_t fileid;
+    char      filename[OS_MAX_PATH_LEN];
+    char      nextname[OS_MAX_PATH_LEN];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    memset(filename, 'f', sizeof(filename));
+    filename[sizeof(filename) - 2] = '\0';
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileNext(&fileid, "dir", filename, nextname, 1, FM_DIR_LIST_FORMAT_STANDARD));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_NEXT_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16(void)
+/* ****************
+ * ChildDirListFileTotals Tests
+ * ***************/
+void Test_FM_ChildDirListFileTotals_Success(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
-
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildDirListFileTotals(FM_UT_OBJID_1, "fname", 3, 10));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
 
+    /* First file is still open, the second is opened again, the last is already complete */
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32(void)
+void Test_FM_ChildDirListFileTotals_OSOpenCreateFail(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileTotals(FM_UT_OBJID_1, "fname", 3, 10));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES(void)
+void Test_FM_ChildDirListFileTotals_OSWriteFail(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = -1,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileTotals(FM_UT_OBJID_1, "fname", 3, 10));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
+    /* Stops at the first file */
     UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_TYPE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero(void)
+/* ****************
+ * ChildDirManifestInit Tests
+ * ***************/
+void Test_FM_ChildDirManifestInit_OSOpenCreateFail(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    osal_id_t fileid;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirManifestInit(&fileid, "directory", "filename", CFE_ES_CrcType_CRC_32));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_OSCREAT_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_BytesReadLessThanZero(void)
+void Test_FM_ChildDirManifestInit_FSWriteHeaderNotSameSizeFSHeadert(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    osal_id_t fileid;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirManifestInit(&fileid, "directory", "filename", CFE_ES_CrcType_CRC_32));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
     UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_OSCREAT_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero(void)
+void Test_FM_ChildDirManifestInit_Success(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    osal_id_t fileid          = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t LocalFileHandle = FM_UT_OBJID_1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, 0);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0);
+    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildDirManifestInit(&fileid, "directory", "filename", CFE_ES_CrcType_CRC_32));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(fileid, LocalFileHandle));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.DirManifestStats.DirName, sizeof(FM_GlobalData.DirManifestStats.DirName),
+                          "directory", sizeof("directory"));
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.TypeCRC, CFE_ES_CrcType_CRC_32);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, sizeof(FM_DirManifestStats_t));
 }
 
 /* ****************
- * ChildCreateDirectoryCmd Tests
+ * ChildDirManifestLoop Tests
  * ***************/
-void Test_FM_ChildCreateDirectoryCmd_OSMkDirSuccess(void)
+void Test_FM_ChildDirManifestLoop_OSDirReadNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Source2 = "dir/", .Target = "fname"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_CMD_INF_EID);
 }
 
-void Test_FM_ChildCreateDirectoryCmd_OSMkDirNotSuccess(void)
+void Test_FM_ChildDirManifestLoop_OSDirEntryNameIsThisDirectory(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Source2 = "dir/", .Target = "fname"};
+    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.DirEntries, 0);
 }
 
-/* ****************
- * ChildDeleteDirectoryCmd Tests
- * ***************/
-void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryOpenNoSuccess(void)
+void Test_FM_ChildDirManifestLoop_EntryNotClosedFile(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Source2 = "dir/", .Target = "fname"};
+    os_dirent_t          direntry    = {.FileName = "subdir"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DIR_MANIFEST_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.DirEntries, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.FileEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.SkippedEntries, 1);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryReadNoSuccess(void)
+void Test_FM_ChildDirManifestLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Target = "fname"};
+    os_dirent_t          direntry    = {.FileName = "directory_nam"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    memset(queue_entry.Source2, 'a', sizeof(queue_entry.Source2) - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.DirEntries, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.SkippedEntries, 1);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_StrCmpThisDirectoryZero(void)
+void Test_FM_ChildDirManifestLoop_EntriesBufferedAndWritten(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
-    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Source2 = "dir/", .Target = "fname"};
+    os_dirent_t          direntry    = {.FileName = "file"};
+    uint32               entrycnt    = (FM_CHILD_WRITE_BUFFER_SIZE / sizeof(FM_DirManifestEntry_t)) + 1;
 
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestCacheLookup), true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_DigestCacheLookup, entrycnt);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, entrycnt / FM_CHILD_FILE_LOOP_COUNT);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+
+    /* Full buffer, remaining entry and updated statistics */
+    UtAssert_STUB_COUNT(OS_write, 3);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.DirEntries, entrycnt);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.FileEntries, entrycnt);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirManifestStats.SkippedEntries, 0);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_StrCmpParentDirectoryZero(void)
+void Test_FM_ChildDirManifestLoop_FlushNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
-    os_dirent_t          direntry    = {.FileName = FM_PARENT_DIRECTORY};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Source2 = "dir/", .Target = "fname"};
+    os_dirent_t          direntry    = {.FileName = "file"};
 
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestCacheLookup), true);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_EMPTY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_WRITE_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_RemoveTheDirIsTrueRmDirSuccess(void)
+void Test_FM_ChildDirManifestLoop_StatsWriteNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "dir", .Source2 = "dir/", .Target = "fname"};
+    os_dirent_t          direntry    = {.FileName = "file"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestCacheLookup), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+
+    /* Placeholder statistics already written, so they must be rewritten in the file */
+    FM_GlobalData.ChildWriter.Written = sizeof(FM_DirManifestStats_t);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDirManifestLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_WRITE_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess(void)
+/* ****************
+ * ChildDirManifestEntry Tests
+ * ***************/
+void Test_FM_ChildDirManifestEntry_FileNotClosed(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    FM_DirManifestEntry_t entry;
+    int32                 loopcount = 0;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+    memset(&entry, 0, sizeof(entry));
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirManifestEntry("dir/file", CFE_ES_CrcType_CRC_32, &entry, &loopcount));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+}
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_RMDIR_OS_ERR_EID);
+void Test_FM_ChildDirManifestEntry_OSStatNotSuccess(void)
+{
+    /* Arrange */
+    FM_DirManifestEntry_t entry;
+    int32                 loopcount = 0;
+
+    memset(&entry, 0, sizeof(entry));
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildDirManifestEntry("dir/file", CFE_ES_CrcType_CRC_32, &entry, &loopcount));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheLookup, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
 }
 
-/* ****************
- * ChildDirListFileCmd Tests
- * ***************/
-void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
+void Test_FM_ChildDirManifestEntry_CachedDigest(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_LIST_FILE_CC};
+    FM_DirManifestEntry_t entry;
+    int32                 loopcount = 0;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    memset(&entry, 0, sizeof(entry));
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestCacheLookup), true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildDirManifestEntry("dir/file", CFE_ES_CrcType_CRC_32, &entry, &loopcount));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+    UtAssert_STUB_COUNT(FM_DigestCacheLookup, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 0);
 }
 
-void Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse(void)
+void Test_FM_ChildDirManifestEntry_OSOpenCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+    FM_DirManifestEntry_t entry;
+    int32                 loopcount = 0;
+
+    memset(&entry, 0, sizeof(entry));
 
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
     UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirManifestEntry("dir/file", CFE_ES_CrcType_CRC_32, &entry, &loopcount));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(FM_DigestInit, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
     UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue(void)
+void Test_FM_ChildDirManifestEntry_BytesReadLessThanZero(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+    FM_DirManifestEntry_t entry;
+    int32                 loopcount = 0;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    memset(&entry, 0, sizeof(entry));
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildDirManifestEntry("dir/file", CFE_ES_CrcType_CRC_32, &entry, &loopcount));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_read, 1);
     UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+    UtAssert_STUB_COUNT(FM_DigestFinal, 0);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 0);
 }
 
-/* ****************
- * ChildDirListPktCmd Tests
- * ***************/
-void Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess(void)
+void Test_FM_ChildDirManifestEntry_BytesReadGreaterThanZero(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    FM_DirManifestEntry_t entry;
+    int32                 loopcount = FM_CHILD_FILE_LOOP_COUNT - 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    memset(&entry, 0, sizeof(entry));
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestFinal), 0x12345678);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildDirManifestEntry("dir/file", CFE_ES_CrcType_CRC_32, &entry, &loopcount));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_OS_ERR_EID);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(FM_DigestFinal, 1);
+    UtAssert_STUB_COUNT(FM_DigestCacheStore, 1);
+    UtAssert_UINT32_EQ(entry.CRC, 0x12345678);
+    UtAssert_INT32_EQ(loopcount, 0);
 }
 
-void Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess(void)
+/* ****************
+ * ChildCompareFilesLoop Tests
+ * ***************/
+void Test_FM_ChildCompareFilesLoop_OSreadNotSuccess(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    FM_ChildQueueEntry_t          queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1"};
+    FM_CompareFilesPkt_Payload_t *ReportPtr   = &FM_GlobalData.CompareFilesPkt.Payload;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_COMPARE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_BOOL_FALSE(FM_ChildCompareFilesLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry, ReportPtr));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_read, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COMPARE_FILES_OSRD_ERR_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory(void)
+void Test_FM_ChildCompareFilesLoop_ReadLengthsDiffer(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+    FM_ChildQueueEntry_t          queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1"};
+    FM_CompareFilesPkt_Payload_t *ReportPtr   = &FM_GlobalData.CompareFilesPkt.Payload;
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    /* First file has 16 bytes left, second file only 8, the common bytes match */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 8);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildCompareFilesLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry, ReportPtr));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+    UtAssert_STUB_COUNT(OS_read, 4);
+    UtAssert_UINT32_EQ(ReportPtr->Result, FM_COMPARE_SIZE_DIFFERS);
+    UtAssert_UINT32_EQ(ReportPtr->FirstDiffOffset, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory(void)
+void Test_FM_ChildCompareFilesLoop_ReadLengthsDifferDataDiffers(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+    FM_ChildQueueEntry_t          queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1"};
+    FM_CompareFilesPkt_Payload_t *ReportPtr   = &FM_GlobalData.CompareFilesPkt.Payload;
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    /* Read stub does not copy data when a return code is set, buffers keep these values */
+    FM_GlobalData.ChildCompareBuffer[0][3] = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 8);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildCompareFilesLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry, ReportPtr));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_UINT32_EQ(ReportPtr->Result, FM_COMPARE_DATA_DIFFERS);
+    UtAssert_UINT32_EQ(ReportPtr->FirstDiffOffset, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded(void)
+void Test_FM_ChildCompareFilesLoop_ShortReadIdentical(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2", .DirListOffset = 1};
-    os_dirent_t direntry = {.FileName = "filename"};
+    FM_ChildQueueEntry_t          queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1"};
+    FM_CompareFilesPkt_Payload_t *ReportPtr   = &FM_GlobalData.CompareFilesPkt.Payload;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    /* First file returns the block in two reads, second file in one */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_COMPARE_BLOCK_SIZE - 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_COMPARE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildCompareFilesLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry, ReportPtr));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
-    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_STUB_COUNT(OS_read, 5);
+    UtAssert_UINT32_EQ(ReportPtr->Result, FM_COMPARE_IDENTICAL);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListPktCmd_DirListOffsetExceeded(void)
+void Test_FM_ChildCompareFilesLoop_DataDiffers(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+    FM_ChildQueueEntry_t          queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1"};
+    FM_CompareFilesPkt_Payload_t *ReportPtr   = &FM_GlobalData.CompareFilesPkt.Payload;
 
-    /* Unit under test doesn't really care if the entry name is empty */
-    memset(direntry, 0, sizeof(direntry));
+    /* Read stub does not copy data when a return code is set, buffers keep these values */
+    FM_GlobalData.ChildCompareBuffer[1][5] = 1;
 
-    /* Will fill the entire packet and have one more */
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_COMPARE_BLOCK_SIZE);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_BOOL_TRUE(FM_ChildCompareFilesLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry, ReportPtr));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, sizeof(direntry) / sizeof(direntry[0]) + 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
-    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_UINT32_EQ(ReportPtr->Result, FM_COMPARE_DATA_DIFFERS);
+    UtAssert_UINT32_EQ(ReportPtr->FirstDiffOffset, 5);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+void Test_FM_ChildCompareFilesLoop_DataDiffersAfterTaskDelay(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
-                                        .Source1     = "source1",
-                                        .Source2 = "source2_has_quite_a_long_name_to_make_path_length_longer_than_64"};
-    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+    static uint8 ReadData[2 * (FM_CHILD_FILE_LOOP_COUNT + 1) * FM_CHILD_COMPARE_BLOCK_SIZE];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    FM_ChildQueueEntry_t          queue_entry = {.CommandCode = FM_COMPARE_FILES_CC, .Source1 = "file1"};
+    FM_CompareFilesPkt_Payload_t *ReportPtr   = &FM_GlobalData.CompareFilesPkt.Payload;
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    /* Reads alternate between the files, the last block read is from the second file */
+    memset(ReadData, 0, sizeof(ReadData));
+    ReadData[sizeof(ReadData) - FM_CHILD_COMPARE_BLOCK_SIZE + 7] = 1;
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_SetDataBuffer(UT_KEY(OS_read), ReadData, sizeof(ReadData), false);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_WARNING_EID);
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCompareFilesLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, &queue_entry, ReportPtr));
 
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
-    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 2 * (FM_CHILD_FILE_LOOP_COUNT + 1));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(ReportPtr->Result, FM_COMPARE_DATA_DIFFERS);
+    UtAssert_UINT32_EQ(ReportPtr->FirstDiffOffset, (FM_CHILD_FILE_LOOP_COUNT * FM_CHILD_COMPARE_BLOCK_SIZE) + 7);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-/* ****************
- * ChildSetPermissionsCmd Tests
- * ***************/
-void Test_FM_ChildSetPermissionsCmd_OSChmodSuccess(void)
+void Test_FM_ChildCompareFilesRead_ShortReads(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 8);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+    UtAssert_INT32_EQ(FM_ChildCompareFilesRead(FM_UT_OBJID_1, FM_GlobalData.ChildCompareBuffer[0]), 24);
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_chmod, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_read, 3);
 }
 
-void Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess(void)
+void Test_FM_ChildCompareFilesRead_OSreadNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+    UtAssert_INT32_EQ(FM_ChildCompareFilesRead(FM_UT_OBJID_1, FM_GlobalData.ChildCompareBuffer[0]), OS_ERROR);
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_chmod, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+    UtAssert_STUB_COUNT(OS_read, 2);
 }
 
 /* ****************
- * ChildDirListFileInit Tests
+ * ChildWriter Tests
  * ***************/
-void Test_FM_ChildDirListFileInit_OSOpenCreateFail(void)
+void Test_FM_ChildWriterInit(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    const char *directory = "directory";
-    const char *filename  = "filename";
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    FM_GlobalData.ChildWriter.Status = OS_ERROR;
+    FM_GlobalData.ChildWriter.Length = 1;
 
     /* Act */
-    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_VOIDCALL(FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(FM_GlobalData.ChildWriter.FileHandle, FM_UT_OBJID_1));
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriter.Status, OS_SUCCESS);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, 0);
 }
 
-void Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert(void)
+void Test_FM_ChildWriterWrite_Buffered(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
-    const char *directory       = "directory";
-    const char *filename        = "filename";
+    uint8 data[16] = {0};
 
-    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
 
     /* Act */
-    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_BOOL_TRUE(FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data)));
+    UtAssert_BOOL_TRUE(FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data)));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRHDR_ERR_EID);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, 2 * sizeof(data));
 }
 
-void Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst(void)
+void Test_FM_ChildWriterWrite_BufferFull(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    const char *directory       = "directory";
-    const char *filename        = "filename";
-    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
+    uint8 data[16] = {0};
 
-    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListFileStats_t) - 1);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
+    FM_GlobalData.ChildWriter.Length = FM_CHILD_WRITE_BUFFER_SIZE - 1;
 
     /* Act */
-    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UtAssert_BOOL_TRUE(FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data)));
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    /* Assert */
     UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRBLANK_ERR_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, sizeof(data));
 }
 
-void Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst(void)
+void Test_FM_ChildWriterWrite_RecordLargerThanBuffer(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    const char *directory = "directory";
-    const char *filename  = "filename";
+    static uint8 data[FM_CHILD_WRITE_BUFFER_SIZE + 1];
+
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(data) - 1);
 
     /* Act */
-    UtAssert_BOOL_TRUE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_BOOL_FALSE(FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data)));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
     UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriter.Status, OS_ERROR);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, 0);
 }
 
-/* ****************
- * ChildDirListFileLoop Tests
- * ***************/
-void Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess(void)
+void Test_FM_ChildWriterFlush_Empty(void)
 {
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_BOOL_TRUE(FM_ChildWriterFlush(&FM_GlobalData.ChildWriter));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
     UtAssert_STUB_COUNT(OS_write, 0);
-    UtAssert_STUB_COUNT(OS_lseek, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
-
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
 }
 
-void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
+void Test_FM_ChildWriterFlush_OSWriteNotSuccess(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+    uint8 data[16] = {0};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERR_INVALID_ID);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UtAssert_BOOL_FALSE(FM_ChildWriterFlush(&FM_GlobalData.ChildWriter));
 
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(OS_write, 0);
-    UtAssert_STUB_COUNT(OS_lseek, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+    /* Later records are discarded after a write failure */
+    UtAssert_BOOL_FALSE(FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data)));
+    UtAssert_BOOL_FALSE(FM_ChildWriterFlush(&FM_GlobalData.ChildWriter));
 
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriter.Status, OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, 0);
 }
 
-void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory(void)
+void Test_FM_ChildWriterUpdate_Buffered(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+    uint8 data[16]  = {0};
+    uint8 update[4] = {1, 2, 3, 4};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data));
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_BOOL_TRUE(FM_ChildWriterUpdate(&FM_GlobalData.ChildWriter, 8, update, sizeof(update)));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
     UtAssert_STUB_COUNT(OS_write, 0);
-    UtAssert_STUB_COUNT(OS_lseek, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Length, sizeof(data));
+    UtAssert_MemCmp(&FM_GlobalData.ChildWriter.Buffer[8], update, sizeof(update), "Buffered data replaced");
 }
 
-void Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void)
+void Test_FM_ChildWriterUpdate_AlreadyWritten(void)
 {
     /* Arrange */
-    char        dirwithsep[OS_MAX_PATH_LEN];
-    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint8 data[16]  = {0};
+    uint8 update[4] = {1, 2, 3, 4};
 
-    memset(dirwithsep, 0xFF, sizeof(dirwithsep));
-    dirwithsep[sizeof(dirwithsep) - 1] = '\0';
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data));
+    FM_ChildWriterFlush(&FM_GlobalData.ChildWriter);
+    FM_ChildWriterWrite(&FM_GlobalData.ChildWriter, data, sizeof(data));
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", dirwithsep, "fname", false));
+    UtAssert_BOOL_FALSE(FM_ChildWriterUpdate(&FM_GlobalData.ChildWriter, 0, update, sizeof(update)));
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
+    /* Data past the end of the buffer cannot be replaced either */
+    UtAssert_BOOL_FALSE(FM_ChildWriterUpdate(&FM_GlobalData.ChildWriter, 2 * sizeof(data), update, sizeof(update)));
 
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    /* Assert */
     UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(OS_lseek, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
-
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWriter.Written, sizeof(data));
 }
 
-void Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries(void)
+void Test_FM_ChildDirListCompactEntry_Nominal(void)
 {
-    os_dirent_t direntry = {.FileName = "directory_nam"};
-    uint32      entrycnt = FM_DIR_LIST_FILE_ENTRIES + 1;
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
-
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    /* Arrange */
+    FM_DirListEntry_t entry    = {.EntryName = "abc", .EntrySize = 300, .ModifyTime = 100, .Mode = 0};
+    uint8             buffer[FM_DIR_LIST_COMPACT_ENTRY_MAX];
+    uint32            lasttime = 0;
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    /* Name length, name, size 300, time difference +100 and mode 0 */
+    const uint8 expected1[] = {3, 'a', 'b', 'c', 0xAC, 0x02, 0xC8, 0x01, 0x00};
 
-    UtAssert_STUB_COUNT(OS_DirectoryRead, entrycnt + 1);
-    UtAssert_STUB_COUNT(OS_write, FM_DIR_LIST_FILE_ENTRIES + 1);
-    UtAssert_STUB_COUNT(OS_lseek, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+    /* Time difference -1 */
+    const uint8 expected2[] = {3, 'a', 'b', 'c', 0xAC, 0x02, 0x01, 0x00};
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, entrycnt);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, FM_DIR_LIST_FILE_ENTRIES);
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildDirListCompactEntry(buffer, &entry, &lasttime), sizeof(expected1));
+    UtAssert_MemCmp(buffer, expected1, sizeof(expected1), "First entry relative to zero");
+    UtAssert_UINT32_EQ(lasttime, 100);
+
+    entry.ModifyTime = 99;
+    UtAssert_UINT32_EQ(FM_ChildDirListCompactEntry(buffer, &entry, &lasttime), sizeof(expected2));
+    UtAssert_MemCmp(buffer, expected2, sizeof(expected2), "Older entry");
+    UtAssert_UINT32_EQ(lasttime, 99);
 }
 
-void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
+void Test_FM_ChildDirListCompactEntry_MaxValues(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = "directory_nam"};
+    FM_DirListEntry_t entry    = {.EntrySize = 0xFFFFFFFF, .ModifyTime = 0x80000000, .Mode = 0xFFFFFFFF};
+    uint8             buffer[FM_DIR_LIST_COMPACT_ENTRY_MAX];
+    uint32            lasttime = 0;
+    size_t            namelen  = OS_MAX_FILE_NAME - 1;
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t));
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    memset(entry.EntryName, 'n', namelen);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_UINT32_EQ(FM_ChildDirListCompactEntry(buffer, &entry, &lasttime), 1 + namelen + 15);
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(OS_write, 2);
-    UtAssert_STUB_COUNT(OS_lseek, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
-
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
+    UtAssert_UINT32_EQ(buffer[0], namelen);
+    UtAssert_UINT32_EQ(buffer[1 + namelen], 0xFF);
+    UtAssert_UINT32_EQ(buffer[1 + namelen + 4], 0x0F);
+    UtAssert_UINT32_EQ(buffer[1 + namelen + 9], 0x0F);
+    UtAssert_UINT32_EQ(buffer[1 + namelen + 14], 0x0F);
 }
 
-void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
+void Test_FM_ChildWriterUpdate_WriteNotSuccess(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint8 update[4] = {1, 2, 3, 4};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t) - 1);
+    FM_ChildWriterInit(&FM_GlobalData.ChildWriter, FM_UT_OBJID_1);
+    FM_GlobalData.ChildWriter.Status = OS_ERROR;
+    FM_GlobalData.ChildWriter.Length = sizeof(update);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_BOOL_FALSE(FM_ChildWriterUpdate(&FM_GlobalData.ChildWriter, 0, update, sizeof(update)));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRENTRY_ERR_EID);
-
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
 }
 
 /* ****************
@@ -2121,6 +5431,7 @@ void Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined(void)
 
     /* Assert */
     UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(FM_StatCacheGet, 0);
     UtAssert_UINT32_EQ(filetime, OS_FILESTAT_TIME(filestatus));
     UtAssert_UINT32_EQ(filesize, OS_FILESTAT_SIZE(filestatus));
     UtAssert_UINT32_EQ(filemode, OS_FILESTAT_MODE(filestatus));
@@ -2145,98 +5456,307 @@ void Test_FM_ChildLoop_CountSemTakeNotSuccess(void)
     UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
 }
 
+void Test_FM_ChildLoop_CursorTimeout(void)
+{
+    uint32 Now = 1;
+
+    /* Arrange */
+    UT_FM_DirListCursor_Setup("dir", 0, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_DirListCursorTime, &Now);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTimedWait), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+}
+
 void Test_FM_ChildLoop_ChildQCountEqualZero(void)
 {
     /* Act */
     UtAssert_VOIDCALL(FM_ChildLoop());
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildQueueCount = 1;
+    FM_GlobalData.ChildReadIndex  = FM_CHILD_QUEUE_DEPTH;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_QIDX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_CountSemTakeSuccessDefault(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildQueueCount    = 1;
+    FM_GlobalData.ChildReadIndex     = 0;
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = -1};
+
+    FM_GlobalData.ChildQueue[0] = queue_entry;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+}
+
+/* ****************
+ * ChildSleepStat Tests
+ * ***************/
+
+void Test_FM_ChildSleepStat_getSizeTimeModeFalse(void)
+{
+    /* Arrange */
+    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+    int32             FilesTillSleep = 1;
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, false), OS_SUCCESS);
+    UtAssert_INT32_EQ(DirListData.EntrySize, 0);
+    UtAssert_INT32_EQ(DirListData.ModifyTime, 0);
+    UtAssert_INT32_EQ(DirListData.Mode, 0);
+}
+
+void Test_FM_ChildSleepStat_FilesTillSleepPositive(void)
+{
+    /* Arrange */
+    FM_DirListEntry_t DirListData           = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+    int32             FilesTillSleep        = FM_CHILD_STAT_SLEEP_FILECOUNT + 1;
+    int32             FilesTillSleep_before = FilesTillSleep;
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true), OS_SUCCESS);
+    UtAssert_INT32_EQ(FilesTillSleep, FilesTillSleep_before - 1);
+}
+
+void Test_FM_ChildSleepStat_OSStatNotSuccess(void)
+{
+    /* Arrange */
+    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+    int32             FilesTillSleep = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true), OS_ERROR);
+    UtAssert_INT32_EQ(DirListData.EntrySize, 0);
+    UtAssert_INT32_EQ(FilesTillSleep, 0);
+}
+
+void Test_FM_ChildSleepStat_FilesTillSleepLTEQZero(void)
+{
+    /* Arrange */
+    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+    int32             FilesTillSleep = 0;
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_INT32_EQ(FilesTillSleep, FM_CHILD_STAT_SLEEP_FILECOUNT - 1);
+}
+
+/* ****************
+ * ChildScan Tests
+ * ***************/
+
+void Test_FM_ChildScanOpen_Success(void)
+{
+    /* Arrange */
+    FM_ChildScan_t scan;
+
+    memset(&scan, 0xFF, sizeof(scan));
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildScanOpen(&scan, "/dir", "/dir/"), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STRINGBUF_EQ(scan.Path, sizeof(scan.Path), "/dir/", sizeof("/dir/"));
+    UtAssert_UINT32_EQ(scan.PathLength, strlen("/dir/"));
+    UtAssert_NULL(scan.NativeDir);
+    UtAssert_BOOL_FALSE(scan.PathValid);
+}
+
+void Test_FM_ChildScanOpen_NotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildScan_t scan;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), OS_ERROR);
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildScanOpen(&scan, "/dir", "/dir/"), OS_ERROR);
+}
+
+void Test_FM_ChildScanRead_SkipsDotEntries(void)
+{
+    /* Arrange */
+    FM_ChildScan_t scan;
+    os_dirent_t    direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    FM_ChildScanOpen(&scan, "/dir", "/dir/");
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_ChildScanRead(&scan), !OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
 }
 
-void Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth(void)
+void Test_FM_ChildScanRead_Entry(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueueCount = 1;
-    FM_GlobalData.ChildReadIndex  = FM_CHILD_QUEUE_DEPTH;
+    FM_ChildScan_t scan;
+    os_dirent_t    direntry = {.FileName = "file"};
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    FM_ChildScanOpen(&scan, "/dir", "/dir/");
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_QIDX_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_INT32_EQ(FM_ChildScanRead(&scan), OS_SUCCESS);
+    UtAssert_BOOL_TRUE(scan.PathValid);
+    UtAssert_UINT32_EQ(scan.EntryType, FM_CHILD_SCAN_TYPE_UNKNOWN);
+    UtAssert_STRINGBUF_EQ(scan.Path, sizeof(scan.Path), "/dir/file", sizeof("/dir/file"));
 }
 
-void Test_FM_ChildLoop_CountSemTakeSuccessDefault(void)
+void Test_FM_ChildScanRead_PathTooLong(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueueCount    = 1;
-    FM_GlobalData.ChildReadIndex     = 0;
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = -1};
+    FM_ChildScan_t scan;
+    char           dirwithsep[OS_MAX_PATH_LEN];
+    os_dirent_t    direntry = {.FileName = "file"};
 
-    FM_GlobalData.ChildQueue[0] = queue_entry;
-    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+    memset(dirwithsep, 'a', sizeof(dirwithsep) - 3);
+    dirwithsep[sizeof(dirwithsep) - 3] = '\0';
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    FM_ChildScanOpen(&scan, "/dir", dirwithsep);
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_INT32_EQ(FM_ChildScanRead(&scan), OS_SUCCESS);
+    UtAssert_BOOL_FALSE(scan.PathValid);
+    UtAssert_UINT32_EQ(strlen(scan.Path), scan.PathLength);
 }
 
-/* ****************
- * ChildSleepStat Tests
- * ***************/
-
-void Test_FM_ChildSleepStat_getSizeTimeModeFalse(void)
+void Test_FM_ChildScanStat_PathNotValid(void)
 {
     /* Arrange */
+    FM_ChildScan_t    scan;
     FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
     int32             FilesTillSleep = 1;
 
+    memset(&scan, 0, sizeof(scan));
+
     /* Assert */
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, false));
+    UtAssert_INT32_EQ(FM_ChildScanStat(&scan, &DirListData, &FilesTillSleep), OS_ERR_NAME_TOO_LONG);
+    UtAssert_STUB_COUNT(OS_stat, 0);
     UtAssert_INT32_EQ(DirListData.EntrySize, 0);
-    UtAssert_INT32_EQ(DirListData.ModifyTime, 0);
-    UtAssert_INT32_EQ(DirListData.Mode, 0);
+    UtAssert_INT32_EQ(FilesTillSleep, 1);
 }
 
-void Test_FM_ChildSleepStat_FilesTillSleepPositive(void)
+void Test_FM_ChildScanStat_Success(void)
 {
     /* Arrange */
-    FM_DirListEntry_t DirListData           = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep        = FM_CHILD_STAT_SLEEP_FILECOUNT + 1;
-    int32             FilesTillSleep_before = FilesTillSleep;
+    FM_ChildScan_t    scan;
+    FM_DirListEntry_t DirListData;
+    int32             FilesTillSleep = 1;
+    os_fstat_t        fstat;
+
+    memset(&scan, 0, sizeof(scan));
+    memset(&fstat, 0, sizeof(fstat));
+    scan.PathValid = true;
+    fstat.FileSize = 5;
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &fstat, sizeof(fstat), false);
 
     /* Assert */
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true));
-    UtAssert_INT32_EQ(FilesTillSleep, FilesTillSleep_before - 1);
+    UtAssert_INT32_EQ(FM_ChildScanStat(&scan, &DirListData, &FilesTillSleep), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_INT32_EQ(DirListData.EntrySize, 5);
+    UtAssert_INT32_EQ(FilesTillSleep, 0);
 }
 
-void Test_FM_ChildSleepStat_FilesTillSleepLTEQZero(void)
+void Test_FM_ChildScanState(void)
 {
     /* Arrange */
-    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep = 0;
+    FM_ChildScan_t scan;
+
+    memset(&scan, 0, sizeof(scan));
+
+    /* Path not valid */
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, NULL), FM_NAME_IS_INVALID);
+
+    /* Entry type not known, state read by name */
+    scan.PathValid = true;
+    UT_SetDeferredRetcode(UT_KEY(FM_GetBatchFilenameState), 1, FM_NAME_IS_NOT_IN_USE);
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, NULL), FM_NAME_IS_NOT_IN_USE);
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+
+    /* Entry types known, no stat */
+    scan.EntryType = FM_CHILD_SCAN_TYPE_DIR;
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, NULL), FM_NAME_IS_DIRECTORY);
+
+    scan.EntryType = FM_CHILD_SCAN_TYPE_FILE;
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, NULL), FM_NAME_IS_FILE_CLOSED);
+
+    UT_SetDeferredRetcode(UT_KEY(FM_IsFileOpen), 1, true);
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, NULL), FM_NAME_IS_FILE_OPEN);
+
+    UtAssert_STUB_COUNT(FM_GetBatchFilenameState, 1);
+    UtAssert_STUB_COUNT(FM_IsFileOpen, 2);
+
+    /* With an open file set, OSAL is not searched */
+    UT_SetDeferredRetcode(UT_KEY(FM_OpenFileSetFind), 1, true);
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, &FM_GlobalData.ChildOpenFiles), FM_NAME_IS_FILE_OPEN);
+    UtAssert_UINT32_EQ(FM_ChildScanState(&scan, &FM_GlobalData.ChildOpenFiles), FM_NAME_IS_FILE_CLOSED);
+
+    UtAssert_STUB_COUNT(FM_OpenFileSetFind, 2);
+    UtAssert_STUB_COUNT(FM_IsFileOpen, 2);
+}
+
+void Test_FM_ChildScanRewindClose(void)
+{
+    /* Arrange */
+    FM_ChildScan_t scan;
+
+    FM_ChildScanOpen(&scan, "/dir", "/dir/");
 
     /* Assert */
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true));
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_INT32_EQ(FilesTillSleep, FM_CHILD_STAT_SLEEP_FILECOUNT - 1);
+    UtAssert_VOIDCALL(FM_ChildScanRewind(&scan));
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_VOIDCALL(FM_ChildScanClose(&scan));
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
 }
 
 /* * * * * * * * * * * * * *
@@ -2297,11 +5817,94 @@ void add_FM_ChildProcess_tests(void)
     UtTest_Add(Test_FM_ChildProcess_FMSetFilePermCC, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMSetFilePermCC");
 
+    UtTest_Add(Test_FM_ChildProcess_FMDirManifestCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMDirManifestCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMCompareFilesCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMCompareFilesCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMGetDirListSortedCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMGetDirListSortedCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMGetDirStatsCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMGetDirStatsCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMGetDirChangesCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMGetDirChangesCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMBuildDirIndexCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMBuildDirIndexCC");
+
     UtTest_Add(Test_FM_ChildProcess_DefaultSwitch, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_DefaultSwitch");
 
     UtTest_Add(Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth");
+
+    UtTest_Add(Test_FM_ChildProcess_DeferredVerifyFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_DeferredVerifyFail");
+
+    UtTest_Add(Test_FM_ChildProcess_DeferredVerifyPass, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_DeferredVerifyPass");
+}
+
+void add_FM_ChildCrcWorker_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCrcWorkerInit_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcWorkerInit_Success");
+
+    UtTest_Add(Test_FM_ChildCrcWorkerInit_CountSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcWorkerInit_CountSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCrcWorkerInit_MutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcWorkerInit_MutSemCreateNotSuccess");
+
+    /* Worker tasks are only created when parallel CRC is configured */
+    if (FM_CRC_WORKER_COUNT > 0)
+    {
+        UtTest_Add(Test_FM_ChildCrcWorkerInit_CreateChildTaskNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+                   "Test_FM_ChildCrcWorkerInit_CreateChildTaskNotSuccess");
+    }
+
+    UtTest_Add(Test_FM_ChildCrcWorkerTask_WorkerLoopCalled, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcWorkerTask_WorkerLoopCalled");
+
+    UtTest_Add(Test_FM_ChildCrcWorkerLoop_RunsSegments, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcWorkerLoop_RunsSegments");
+
+    UtTest_Add(Test_FM_ChildCrcRunSegments_AllSegments, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcRunSegments_AllSegments");
+
+    UtTest_Add(Test_FM_ChildCrcRunSegments_NoSegmentsLeft, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcRunSegments_NoSegmentsLeft");
+
+    UtTest_Add(Test_FM_ChildCrcSegment_OSOpenCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcSegment_OSOpenCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCrcSegment_OSlseekNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcSegment_OSlseekNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCrcSegment_OSreadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcSegment_OSreadNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCrcSegment_FileShorterThanSegment, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcSegment_FileShorterThanSegment");
+
+    UtTest_Add(Test_FM_ChildCrcSegment_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCrcSegment_Success");
+
+    UtTest_Add(Test_FM_ChildParallelCRC_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildParallelCRC_Success");
+
+    UtTest_Add(Test_FM_ChildParallelCRC_OSStatNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildParallelCRC_OSStatNotSuccess");
+
+    UtTest_Add(Test_FM_ChildParallelCRC_FileTooLarge, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildParallelCRC_FileTooLarge");
+
+    UtTest_Add(Test_FM_ChildParallelCRCJob_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildParallelCRCJob_Success");
+
+    UtTest_Add(Test_FM_ChildParallelCRCJob_SegmentNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildParallelCRCJob_SegmentNotSuccess");
 }
 
 void add_FM_ChildCopyCmd_tests(void)
@@ -2328,6 +5931,9 @@ void add_FM_ChildRenameCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildRenameCmd_OSRenameSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildRenameCmd_OSRenameSuccess");
+
+    UtTest_Add(Test_FM_ChildRenameCmd_IndexUpdated, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildRenameCmd_IndexUpdated");
 }
 
 void add_FM_ChildDeleteCmd_tests(void)
@@ -2376,6 +5982,9 @@ void add_FM_ChildDeleteAllFilesCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn");
+
+    UtTest_Add(Test_FM_ChildDeleteAllFilesCmd_OpenFileSetRefresh, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllFilesCmd_OpenFileSetRefresh");
 }
 
 void add_FM_ChildDecompressFileCmd_tests(void)
@@ -2439,6 +6048,31 @@ void add_FM_ChildFileInfoCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero");
+
+    UtTest_Add(Test_FM_ChildFileInfoCmd_FileSizeChanged, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_FileSizeChanged");
+
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CachedCRC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CachedCRC");
+
+    /* The parallel CRC path is only taken when CRC workers are configured */
+    if (FM_CRC_WORKER_COUNT > 0)
+    {
+        UtTest_Add(Test_FM_ChildFileInfoCmd_ParallelCRC, FM_Test_Setup, FM_Test_Teardown,
+                   "Test_FM_ChildFileInfoCmd_ParallelCRC");
+
+        UtTest_Add(Test_FM_ChildFileInfoCmd_ParallelCRCFileChanged, FM_Test_Setup, FM_Test_Teardown,
+                   "Test_FM_ChildFileInfoCmd_ParallelCRCFileChanged");
+
+        UtTest_Add(Test_FM_ChildFileInfoCmd_ParallelCRCNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+                   "Test_FM_ChildFileInfoCmd_ParallelCRCNotSuccess");
+    }
+
+    UtTest_Add(Test_FM_ChildFileInfoCmd_ParallelCRCFileTooLarge, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_ParallelCRCFileTooLarge");
+
+    UtTest_Add(Test_FM_ChildFileInfoCmd_SmallFileNotParallel, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_SmallFileNotParallel");
 }
 
 void add_FM_ChildCreateDirectoryCmd_tests(void)
@@ -2469,6 +6103,9 @@ void add_FM_ChildDeleteDirectoryCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDeleteDirectoryCmd_CursorClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteDirectoryCmd_CursorClosed");
 }
 
 void add_FM_ChildDirListFileCmd_tests(void)
@@ -2505,6 +6142,138 @@ void add_FM_ChildDirListPktCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_DirStatNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_DirStatNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_CursorUsed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_CursorUsed");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_CursorSkipsToOffset, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_CursorSkipsToOffset");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_CursorRewound, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_CursorRewound");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_IndexUsed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_IndexUsed");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_IndexStale, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_IndexStale");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_IndexUnreadable, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_IndexUnreadable");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_StreamCursor, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_StreamCursor");
+
+    UtTest_Add(Test_FM_ChildDirListPktCmd_StreamRead, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_StreamRead");
+}
+
+void add_FM_ChildDirListCursor_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirListCursorOpen_Nominal, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorOpen_Nominal");
+
+    UtTest_Add(Test_FM_ChildDirListCursorClose_Nominal, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorClose_Nominal");
+
+    UtTest_Add(Test_FM_ChildDirListCursorExpire_NoCursor, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorExpire_NoCursor");
+
+    UtTest_Add(Test_FM_ChildDirListCursorExpire_Held, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorExpire_Held");
+
+    UtTest_Add(Test_FM_ChildDirListCursorExpire_Expired, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorExpire_Expired");
+
+    UtTest_Add(Test_FM_ChildDirListCursorValid_Nominal, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorValid_Nominal");
+
+    UtTest_Add(Test_FM_ChildDirListCursorValid_OtherDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorValid_OtherDirectory");
+
+    UtTest_Add(Test_FM_ChildDirListCursorValid_Expired, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorValid_Expired");
+
+    UtTest_Add(Test_FM_ChildDirListCursorValid_DirectoryChanged, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCursorValid_DirectoryChanged");
+}
+
+void add_FM_ChildDirListSortedCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirListSortedCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListSortedCmd_OSDirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirListSortedCmd_LargestMatching, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListSortedCmd_LargestMatching");
+
+    UtTest_Add(Test_FM_ChildDirListSortedCmd_FirstNames, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListSortedCmd_FirstNames");
+
+    UtTest_Add(Test_FM_ChildDirListSortedCmd_PathAndEntryLengthGreaterMaxPathLength, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListSortedCmd_PathAndEntryLengthGreaterMaxPathLength");
+
+    UtTest_Add(Test_FM_ChildPatternMatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPatternMatch");
+
+    UtTest_Add(Test_FM_ChildDirListBefore, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDirListBefore");
+
+    UtTest_Add(Test_FM_ChildDirListHeap_Newest, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDirListHeap_Newest");
+
+    UtTest_Add(Test_FM_ChildDirListHeap_NotFull, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListHeap_NotFull");
+}
+
+void add_FM_ChildDirStatsCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirStatsCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirStatsCmd_OSDirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirStatsCmd_Totals, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDirStatsCmd_Totals");
+
+    UtTest_Add(Test_FM_ChildDirStatsCmd_LargestSizeBin, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirStatsCmd_LargestSizeBin");
+
+    UtTest_Add(Test_FM_ChildDirStatsCmd_EntriesNotRead, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirStatsCmd_EntriesNotRead");
+}
+
+void add_FM_ChildDirChangesCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirChangesCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirChangesCmd_OSDirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirChangesCmd_FullListing, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirChangesCmd_FullListing");
+
+    UtTest_Add(Test_FM_ChildDirChangesCmd_Delta, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDirChangesCmd_Delta");
+
+    UtTest_Add(Test_FM_ChildDirChangesCmd_NoChanges, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirChangesCmd_NoChanges");
+
+    UtTest_Add(Test_FM_ChildDirChangesCmd_EntriesNotTracked, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirChangesCmd_EntriesNotTracked");
+
+    UtTest_Add(Test_FM_ChildDirTrackGet_ReuseAndReplace, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirTrackGet_ReuseAndReplace");
+
+    UtTest_Add(Test_FM_ChildDirTrackRemove_Ring, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDirTrackRemove_Ring");
+
+    UtTest_Add(Test_FM_ChildDirChangesReport_Removed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirChangesReport_Removed");
+
+    UtTest_Add(Test_FM_ChildDirChangesAdd_Offset, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirChangesAdd_Offset");
+}
+
+void add_FM_ChildBuildDirIndexCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildBuildDirIndexCmd_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildBuildDirIndexCmd_Success");
+
+    UtTest_Add(Test_FM_ChildBuildDirIndexCmd_BuildFailed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildBuildDirIndexCmd_BuildFailed");
 }
 
 void add_FM_ChildSetPermissionsCmd_tests(void)
@@ -2516,6 +6285,42 @@ void add_FM_ChildSetPermissionsCmd_tests(void)
                "Test_FM_ChildSetPermissionsCmd_OSChmodSuccess");
 }
 
+void add_FM_ChildDirManifestCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirManifestCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestCmd_OSDirOpenNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirManifestCmd_ChildDirManifestInitFalse, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestCmd_ChildDirManifestInitFalse");
+
+    UtTest_Add(Test_FM_ChildDirManifestCmd_ChildDirManifestInitTrue, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestCmd_ChildDirManifestInitTrue");
+}
+
+void add_FM_ChildCompareFilesCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_OSStat1NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_OSStat1NotSuccess");
+
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_OSStat2NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_OSStat2NotSuccess");
+
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_SizeDiffers, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_SizeDiffers");
+
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_OSOpenCreate1NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_OSOpenCreate1NotSuccess");
+
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_OSOpenCreate2NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_OSOpenCreate2NotSuccess");
+
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_Identical, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_Identical");
+
+    UtTest_Add(Test_FM_ChildCompareFilesCmd_OSReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesCmd_OSReadNotSuccess");
+}
+
 void add_FM_ChildDirListFileInit_tests(void)
 {
     UtTest_Add(Test_FM_ChildDirListFileInit_OSOpenCreateFail, FM_Test_Setup, FM_Test_Teardown,
@@ -2524,11 +6329,11 @@ void add_FM_ChildDirListFileInit_tests(void)
     UtTest_Add(Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert");
 
-    UtTest_Add(Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst");
+    UtTest_Add(Test_FM_ChildDirListFileInit_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileInit_Success");
 
-    UtTest_Add(Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst");
+    UtTest_Add(Test_FM_ChildDirListFileInit_CompactFormat, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileInit_CompactFormat");
 }
 
 void add_FM_ChildDirListFileLoop_tests(void)
@@ -2545,14 +6350,180 @@ void add_FM_ChildDirListFileLoop_tests(void)
     UtTest_Add(Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen");
 
-    UtTest_Add(Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries");
+    UtTest_Add(Test_FM_ChildDirListFileLoop_AllEntriesWritten, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_AllEntriesWritten");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_BufferWriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_BufferWriteNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_NextFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_NextFile");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_NextFileNotCreated, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_NextFileNotCreated");
 
     UtTest_Add(Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength");
 
     UtTest_Add(Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_StatsUpdatedInBuffer, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_StatsUpdatedInBuffer");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_CompactFormat, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_CompactFormat");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_Subdirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_Subdirectory");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_SubdirectoryDepthLimit, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_SubdirectoryDepthLimit");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_SubdirectoryNotOpened, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_SubdirectoryNotOpened");
+
+    UtTest_Add(Test_FM_ChildDirListFileLoop_SubdirectoryWriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_SubdirectoryWriteNotSuccess");
+}
+
+void add_FM_ChildDirListFileNext_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirListFileNext_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileNext_Success");
+
+    UtTest_Add(Test_FM_ChildDirListFileNext_NameTooLong, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileNext_NameTooLong");
+}
+
+void add_FM_ChildDirListFileTotals_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirListFileTotals_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileTotals_Success");
+
+    UtTest_Add(Test_FM_ChildDirListFileTotals_OSOpenCreateFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileTotals_OSOpenCreateFail");
+
+    UtTest_Add(Test_FM_ChildDirListFileTotals_OSWriteFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileTotals_OSWriteFail");
+}
+
+void add_FM_ChildDirManifestInit_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirManifestInit_OSOpenCreateFail, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestInit_OSOpenCreateFail");
+
+    UtTest_Add(Test_FM_ChildDirManifestInit_FSWriteHeaderNotSameSizeFSHeadert, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestInit_FSWriteHeaderNotSameSizeFSHeadert");
+
+    UtTest_Add(Test_FM_ChildDirManifestInit_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestInit_Success");
+}
+
+void add_FM_ChildDirManifestLoop_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirManifestLoop_OSDirReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestLoop_OSDirReadNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirManifestLoop_OSDirEntryNameIsThisDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestLoop_OSDirEntryNameIsThisDirectory");
+
+    UtTest_Add(Test_FM_ChildDirManifestLoop_EntryNotClosedFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestLoop_EntryNotClosedFile");
+
+    UtTest_Add(Test_FM_ChildDirManifestLoop_PathLengthAndEntryLengthGreaterMaxPathLen, FM_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildDirManifestLoop_PathLengthAndEntryLengthGreaterMaxPathLen");
+
+    UtTest_Add(Test_FM_ChildDirManifestLoop_EntriesBufferedAndWritten, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestLoop_EntriesBufferedAndWritten");
+
+    UtTest_Add(Test_FM_ChildDirManifestLoop_FlushNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestLoop_FlushNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirManifestLoop_StatsWriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestLoop_StatsWriteNotSuccess");
+}
+
+void add_FM_ChildDirManifestEntry_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDirManifestEntry_FileNotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestEntry_FileNotClosed");
+
+    UtTest_Add(Test_FM_ChildDirManifestEntry_OSStatNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestEntry_OSStatNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirManifestEntry_CachedDigest, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestEntry_CachedDigest");
+
+    UtTest_Add(Test_FM_ChildDirManifestEntry_OSOpenCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestEntry_OSOpenCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirManifestEntry_BytesReadLessThanZero, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestEntry_BytesReadLessThanZero");
+
+    UtTest_Add(Test_FM_ChildDirManifestEntry_BytesReadGreaterThanZero, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirManifestEntry_BytesReadGreaterThanZero");
+}
+
+void add_FM_ChildCompareFilesLoop_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCompareFilesLoop_OSreadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesLoop_OSreadNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCompareFilesLoop_ReadLengthsDiffer, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesLoop_ReadLengthsDiffer");
+
+    UtTest_Add(Test_FM_ChildCompareFilesLoop_ReadLengthsDifferDataDiffers, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesLoop_ReadLengthsDifferDataDiffers");
+
+    UtTest_Add(Test_FM_ChildCompareFilesLoop_ShortReadIdentical, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesLoop_ShortReadIdentical");
+
+    UtTest_Add(Test_FM_ChildCompareFilesLoop_DataDiffers, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesLoop_DataDiffers");
+
+    UtTest_Add(Test_FM_ChildCompareFilesLoop_DataDiffersAfterTaskDelay, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesLoop_DataDiffersAfterTaskDelay");
+
+    UtTest_Add(Test_FM_ChildCompareFilesRead_ShortReads, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesRead_ShortReads");
+
+    UtTest_Add(Test_FM_ChildCompareFilesRead_OSreadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCompareFilesRead_OSreadNotSuccess");
+}
+
+void add_FM_ChildWriter_tests(void)
+{
+    UtTest_Add(Test_FM_ChildWriterInit, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildWriterInit");
+
+    UtTest_Add(Test_FM_ChildWriterWrite_Buffered, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterWrite_Buffered");
+
+    UtTest_Add(Test_FM_ChildWriterWrite_BufferFull, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterWrite_BufferFull");
+
+    UtTest_Add(Test_FM_ChildWriterWrite_RecordLargerThanBuffer, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterWrite_RecordLargerThanBuffer");
+
+    UtTest_Add(Test_FM_ChildWriterFlush_Empty, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildWriterFlush_Empty");
+
+    UtTest_Add(Test_FM_ChildWriterFlush_OSWriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterFlush_OSWriteNotSuccess");
+
+    UtTest_Add(Test_FM_ChildWriterUpdate_Buffered, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterUpdate_Buffered");
+
+    UtTest_Add(Test_FM_ChildWriterUpdate_AlreadyWritten, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterUpdate_AlreadyWritten");
+
+    UtTest_Add(Test_FM_ChildWriterUpdate_WriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterUpdate_WriteNotSuccess");
+
+    UtTest_Add(Test_FM_ChildDirListCompactEntry_Nominal, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCompactEntry_Nominal");
+
+    UtTest_Add(Test_FM_ChildDirListCompactEntry_MaxValues, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListCompactEntry_MaxValues");
 }
 
 void add_FM_ChildSizeTimeMode_tests(void)
@@ -2574,6 +6545,34 @@ void add_FM_ChildSleepStat_tests(void)
 
     UtTest_Add(Test_FM_ChildSleepStat_FilesTillSleepLTEQZero, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSleepStat_FilesTillSleepLTEQZero");
+
+    UtTest_Add(Test_FM_ChildSleepStat_OSStatNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSleepStat_OSStatNotSuccess");
+}
+
+void add_FM_ChildScan_tests(void)
+{
+    UtTest_Add(Test_FM_ChildScanOpen_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildScanOpen_Success");
+
+    UtTest_Add(Test_FM_ChildScanOpen_NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildScanOpen_NotSuccess");
+
+    UtTest_Add(Test_FM_ChildScanRead_SkipsDotEntries, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildScanRead_SkipsDotEntries");
+
+    UtTest_Add(Test_FM_ChildScanRead_Entry, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildScanRead_Entry");
+
+    UtTest_Add(Test_FM_ChildScanRead_PathTooLong, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildScanRead_PathTooLong");
+
+    UtTest_Add(Test_FM_ChildScanStat_PathNotValid, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildScanStat_PathNotValid");
+
+    UtTest_Add(Test_FM_ChildScanStat_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildScanStat_Success");
+
+    UtTest_Add(Test_FM_ChildScanState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildScanState");
+
+    UtTest_Add(Test_FM_ChildScanRewindClose, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildScanRewindClose");
 }
 
 void add_FM_ChildLoop_tests(void)
@@ -2581,6 +6580,8 @@ void add_FM_ChildLoop_tests(void)
     UtTest_Add(Test_FM_ChildLoop_CountSemTakeNotSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildLoop_CountSemTakeNotSuccess");
 
+    UtTest_Add(Test_FM_ChildLoop_CursorTimeout, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLoop_CursorTimeout");
+
     UtTest_Add(Test_FM_ChildLoop_ChildQCountEqualZero, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildLoop_ChildQCountEqualZero");
 
@@ -2605,6 +6606,7 @@ void UtTest_Setup(void)
     add_FM_ChildInit_tests();
     add_FM_ChildTask_tests();
     add_FM_ChildProcess_tests();
+    add_FM_ChildCrcWorker_tests();
     add_FM_ChildCopyCmd_tests();
     add_FM_ChildMoveCmd_tests();
     add_FM_ChildRenameCmd_tests();
@@ -2617,10 +6619,25 @@ void UtTest_Setup(void)
     add_FM_ChildDeleteDirectoryCmd_tests();
     add_FM_ChildDirListFileCmd_tests();
     add_FM_ChildDirListPktCmd_tests();
+    add_FM_ChildDirListCursor_tests();
+    add_FM_ChildDirListSortedCmd_tests();
+    add_FM_ChildDirStatsCmd_tests();
+    add_FM_ChildDirChangesCmd_tests();
+    add_FM_ChildBuildDirIndexCmd_tests();
     add_FM_ChildSetPermissionsCmd_tests();
+    add_FM_ChildDirManifestCmd_tests();
+    add_FM_ChildCompareFilesCmd_tests();
     add_FM_ChildDirListFileInit_tests();
     add_FM_ChildDirListFileLoop_tests();
+    add_FM_ChildDirListFileNext_tests();
+    add_FM_ChildDirListFileTotals_tests();
+    add_FM_ChildDirManifestInit_tests();
+    add_FM_ChildDirManifestLoop_tests();
+    add_FM_ChildDirManifestEntry_tests();
+    add_FM_ChildCompareFilesLoop_tests();
+    add_FM_ChildWriter_tests();
     add_FM_ChildSizeTimeMode_tests();
     add_FM_ChildSleepStat_tests();
+    add_FM_ChildScan_tests();
     add_FM_ChildLoop_tests();
 }
@@ -123,6 +123,236 @@ void Test_FM_GetOpenFilesData(void)
     UtAssert_STRINGBUF_EQ(files_entry.AppName, sizeof(files_entry.AppName), task_prop.name, sizeof(task_prop.name));
 }
 
+/* **************************
+ * Open Files Summary Tests
+ * *************************/
+void Test_FM_OpenFilesSummaryRefresh(void)
+{
+    osal_id_t id = OS_OBJECT_ID_UNDEFINED;
+
+    FM_GlobalData.OpenFilesSummary.Changed      = true;
+    FM_GlobalData.OpenFilesSummary.RequestCount = 2;
+    FM_GlobalData.OpenFilesSummary.NumOpenFiles = 5;
+
+    OS_OpenCreate(&id, NULL, 0, 0);
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+
+    UtAssert_VOIDCALL(FM_OpenFilesSummaryRefresh());
+
+    UtAssert_BOOL_FALSE(FM_GlobalData.OpenFilesSummary.Changed);
+    UtAssert_UINT32_EQ(FM_GlobalData.OpenFilesSummary.RequestCount, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.OpenFilesSummary.NumOpenFiles, 1);
+}
+
+/* Local time returned by OS_GetLocalTime, in seconds */
+static int64 UT_OpenFilesTime;
+
+static void UT_Handler_OS_GetLocalTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *TimePtr = OS_TimeFromTotalSeconds(UT_OpenFilesTime);
+}
+
+void Test_FM_OpenFilesSummaryRefresh_Age(void)
+{
+    FM_OpenFilesSummary_t *SummaryPtr = &FM_GlobalData.OpenFilesSummary;
+    osal_id_t              id         = OS_OBJECT_ID_UNDEFINED;
+    OS_file_prop_t         file_prop;
+
+    memset(&file_prop, 0, sizeof(file_prop));
+    strncpy(file_prop.Path, "/cf/log", sizeof(file_prop.Path));
+
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_OS_GetLocalTime, NULL);
+    OS_OpenCreate(&id, NULL, 0, 0);
+
+    /* First found open */
+    UT_OpenFilesTime = 100;
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UtAssert_VOIDCALL(FM_OpenFilesSummaryRefresh());
+    UtAssert_UINT32_EQ(SummaryPtr->Ages[0].FirstSeen, 100);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(SummaryPtr->Ages[0].ObjId, id));
+
+    /* Still open, not yet over the limit */
+    UT_OpenFilesTime = 100 + FM_OPEN_FILE_AGE_LIMIT - 1;
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UtAssert_VOIDCALL(FM_OpenFilesSummaryRefresh());
+    UtAssert_UINT32_EQ(SummaryPtr->Ages[0].FirstSeen, 100);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Over the limit is reported once */
+    UT_OpenFilesTime = 100 + FM_OPEN_FILE_AGE_LIMIT;
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+    UtAssert_VOIDCALL(FM_OpenFilesSummaryRefresh());
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_OPEN_FILE_AGE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_BOOL_TRUE(SummaryPtr->Ages[0].Reported);
+
+    UT_OpenFilesTime += 10;
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UtAssert_VOIDCALL(FM_OpenFilesSummaryRefresh());
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* A new stream starts again */
+    id = OS_ObjectIdFromInteger(OS_ObjectIdToInteger(id) + 1);
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UtAssert_VOIDCALL(FM_OpenFilesSummaryRefresh());
+    UtAssert_UINT32_EQ(SummaryPtr->Ages[0].FirstSeen, UT_OpenFilesTime);
+    UtAssert_BOOL_FALSE(SummaryPtr->Ages[0].Reported);
+}
+
+void Test_FM_GetOpenFilesCount(void)
+{
+    uint32 i;
+
+    FM_GlobalData.OpenFilesSummary.NumOpenFiles = 3;
+
+    /* Summary is reported until the refresh count is reached */
+    for (i = 1; i < FM_OPEN_FILES_REFRESH_HK; i++)
+    {
+        UtAssert_UINT32_EQ(FM_GetOpenFilesCount(), 3);
+    }
+
+    UtAssert_STUB_COUNT(OS_ForEachObject, 0);
+
+    UtAssert_UINT32_EQ(FM_GetOpenFilesCount(), 0);
+    UtAssert_STUB_COUNT(OS_ForEachObject, 1);
+
+    /* Child task changed the open files */
+    FM_GlobalData.OpenFilesSummary.NumOpenFiles = 3;
+    FM_GlobalData.OpenFilesSummary.Changed      = true;
+
+    UtAssert_UINT32_EQ(FM_GetOpenFilesCount(), 0);
+    UtAssert_STUB_COUNT(OS_ForEachObject, 2);
+    UtAssert_BOOL_FALSE(FM_GlobalData.OpenFilesSummary.Changed);
+}
+
+void Test_FM_GetOpenFilesCount_CountOnly(void)
+{
+    FM_OpenFilesSummary_t *SummaryPtr = &FM_GlobalData.OpenFilesSummary;
+    osal_id_t              id         = OS_OBJECT_ID_UNDEFINED;
+
+    SummaryPtr->Changed = true;
+
+    OS_OpenCreate(&id, NULL, 0, 0);
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+
+    /* Streams are counted and aged without looking up their names */
+    UtAssert_UINT32_EQ(FM_GetOpenFilesCount(), 1);
+    UtAssert_STUB_COUNT(OS_FDGetInfo, 0);
+    UtAssert_STUB_COUNT(OS_TaskGetInfo, 0);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(SummaryPtr->Ages[0].ObjId, id));
+    UtAssert_STRINGBUF_EQ(SummaryPtr->OpenFilesList[0].LogicalName, sizeof(SummaryPtr->OpenFilesList[0].LogicalName),
+                          "", 1);
+}
+
+void Test_FM_GetOpenFilesCount_AgeReported(void)
+{
+    FM_OpenFilesSummary_t *SummaryPtr = &FM_GlobalData.OpenFilesSummary;
+    osal_id_t              id         = OS_OBJECT_ID_UNDEFINED;
+    OS_file_prop_t         file_prop;
+
+    memset(&file_prop, 0, sizeof(file_prop));
+    strncpy(file_prop.Path, "/cf/log", sizeof(file_prop.Path));
+
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_OS_GetLocalTime, NULL);
+    OS_OpenCreate(&id, NULL, 0, 0);
+
+    SummaryPtr->NumOpenFiles      = 1;
+    SummaryPtr->Ages[0].ObjId     = id;
+    SummaryPtr->Ages[0].FirstSeen = 100;
+    SummaryPtr->Changed           = true;
+
+    /* Only the stream being reported is looked up */
+    UT_OpenFilesTime = 100 + FM_OPEN_FILE_AGE_LIMIT;
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+    UtAssert_UINT32_EQ(FM_GetOpenFilesCount(), 1);
+    UtAssert_STUB_COUNT(OS_FDGetInfo, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_OPEN_FILE_AGE_INF_EID);
+    UtAssert_BOOL_TRUE(SummaryPtr->Ages[0].Reported);
+}
+
+/* **************************
+ * IsFileOpen Tests
+ * *************************/
+void Test_FM_IsFileOpen(void)
+{
+    osal_id_t      id = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t      ids[2];
+    OS_file_prop_t file_prop;
+
+    memset(&file_prop, 0, sizeof(file_prop));
+
+    /* No objects */
+    UtAssert_BOOL_FALSE(FM_IsFileOpen("file"));
+
+    /* Stream open with another name */
+    OS_OpenCreate(&id, NULL, 0, 0);
+    strncpy(file_prop.Path, "other", sizeof(file_prop.Path));
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+    UtAssert_BOOL_FALSE(FM_IsFileOpen("file"));
+
+    /* Stream open with the same name */
+    strncpy(file_prop.Path, "file", sizeof(file_prop.Path));
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+    UtAssert_BOOL_TRUE(FM_IsFileOpen("file"));
+
+    /* Open state is not carried over to the next search */
+    UtAssert_BOOL_FALSE(FM_IsFileOpen("file"));
+
+    /* Streams after the one found are not read */
+    ids[0] = id;
+    ids[1] = id;
+    UT_ResetState(UT_KEY(OS_FDGetInfo));
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), ids, sizeof(ids), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+    UtAssert_BOOL_TRUE(FM_IsFileOpen("file"));
+    UtAssert_STUB_COUNT(OS_FDGetInfo, 1);
+}
+
+void Test_FM_OpenFileSet(void)
+{
+    osal_id_t        id[4];
+    OS_file_prop_t   file_prop[3];
+    FM_OpenFileSet_t set;
+
+    memset(file_prop, 0, sizeof(file_prop));
+
+    /* Three streams, one of them a second open of the same file, and an object that is not a stream */
+    OS_OpenCreate(&id[0], NULL, 0, 0);
+    OS_OpenCreate(&id[1], NULL, 0, 0);
+    OS_OpenCreate(&id[2], NULL, 0, 0);
+    id[3] = OS_OBJECT_ID_UNDEFINED;
+    strncpy(file_prop[0].Path, "/cf/a", sizeof(file_prop[0].Path));
+    strncpy(file_prop[1].Path, "/cf/b", sizeof(file_prop[1].Path));
+    strncpy(file_prop[2].Path, "/cf/a", sizeof(file_prop[2].Path));
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), file_prop, sizeof(file_prop), false);
+
+    UtAssert_VOIDCALL(FM_OpenFileSetLoad(&set));
+
+    UtAssert_UINT32_EQ(set.FileCount, 2);
+    UtAssert_STUB_COUNT(OS_ForEachObject, 1);
+    UtAssert_STUB_COUNT(OS_FDGetInfo, 3);
+
+    /* Lookups do not search OSAL */
+    UtAssert_BOOL_TRUE(FM_OpenFileSetFind(&set, "/cf/a"));
+    UtAssert_BOOL_TRUE(FM_OpenFileSetFind(&set, "/cf/b"));
+    UtAssert_BOOL_FALSE(FM_OpenFileSetFind(&set, "/cf/c"));
+    UtAssert_STUB_COUNT(OS_ForEachObject, 1);
+
+    /* Loading again starts from an empty set */
+    UtAssert_VOIDCALL(FM_OpenFileSetLoad(&set));
+    UtAssert_UINT32_EQ(set.FileCount, 0);
+    UtAssert_BOOL_FALSE(FM_OpenFileSetFind(&set, "/cf/a"));
+}
+
 /* **************************
  * GetFilenameState Tests
  * *************************/
@@ -187,6 +417,43 @@ void Test_FM_GetFilenameState(void)
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_OPEN);
+
+    /* File info queries report the size and time so they do not use the cache */
+    UtAssert_STUB_COUNT(FM_StatCacheGet, 6);
+    UtAssert_STUB_COUNT(OS_stat, 8);
+}
+
+void Test_FM_GetBatchFilenameState(void)
+{
+    char             filename[OS_MAX_FILE_NAME] = "/cf/a";
+    osal_id_t        id                         = OS_OBJECT_ID_UNDEFINED;
+    OS_file_prop_t   file_prop;
+    FM_OpenFileSet_t set;
+
+    memset(&file_prop, 0, sizeof(file_prop));
+
+    /* Not in the set */
+    FM_OpenFileSetLoad(&set);
+    UtAssert_UINT32_EQ(FM_GetBatchFilenameState(filename, sizeof(filename), &set), FM_NAME_IS_FILE_CLOSED);
+
+    /* In the set */
+    OS_OpenCreate(&id, NULL, 0, 0);
+    strncpy(file_prop.Path, filename, sizeof(file_prop.Path));
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
+    FM_OpenFileSetLoad(&set);
+    UtAssert_UINT32_EQ(FM_GetBatchFilenameState(filename, sizeof(filename), &set), FM_NAME_IS_FILE_OPEN);
+    UtAssert_STUB_COUNT(OS_ForEachObject, 2);
+
+    /* Without a set OSAL is searched */
+    UtAssert_UINT32_EQ(FM_GetBatchFilenameState(filename, sizeof(filename), NULL), FM_NAME_IS_FILE_CLOSED);
+    UtAssert_STUB_COUNT(OS_ForEachObject, 3);
+
+    /* File info is never stored */
+    FM_GlobalData.FileStatSize = 1;
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, !OS_SUCCESS);
+    UtAssert_UINT32_EQ(FM_GetBatchFilenameState(filename, sizeof(filename), &set), FM_NAME_IS_NOT_IN_USE);
+    UtAssert_UINT32_EQ(FM_GlobalData.FileStatSize, 1);
 }
 
 /* **************************
@@ -234,6 +501,63 @@ void Test_FM_VerifyFileState(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FNAME_ISOPEN_EID_OFFSET);
 }
 
+void Test_FM_VerifyFileState_Deferred(void)
+{
+    char filename[OS_MAX_FILE_NAME] = "Filename";
+
+    FM_GlobalData.DeferVerify = true;
+
+    /* Valid names are staged without an OS_stat */
+    UtAssert_BOOL_TRUE(FM_VerifyFileState(FM_FILE_EXISTS, filename, sizeof(filename), 10, "Cmd Text"));
+    UtAssert_BOOL_TRUE(FM_VerifyFileState(FM_FILE_NOEXIST, filename, sizeof(filename), 20, "Cmd Text"));
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerify[1].State, FM_FILE_NOEXIST);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerify[1].EventID, 20);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildVerify[1].Name, sizeof(FM_GlobalData.ChildVerify[1].Name), filename,
+                          sizeof(filename));
+
+    /* Invalid names are still rejected by the main task */
+    UtAssert_BOOL_FALSE(FM_VerifyFileState(FM_FILE_EXISTS, filename, 1, 0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FNAME_INVALID_EID_OFFSET);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, 2);
+
+    /* A check that does not fit is made right away */
+    FM_GlobalData.ChildVerifyCount = FM_CHILD_VERIFY_COUNT;
+    UtAssert_BOOL_TRUE(FM_VerifyFileState(FM_FILE_CLOSED, filename, sizeof(filename), 0, "Cmd Text"));
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, FM_CHILD_VERIFY_COUNT);
+}
+
+/* **************************
+ * VerifyDeferredFileState Tests
+ * *************************/
+void Test_FM_VerifyDeferredFileState(void)
+{
+    FM_ChildVerify_t verify;
+
+    memset(&verify, 0, sizeof(verify));
+    strncpy(verify.Name, "Filename", sizeof(verify.Name) - 1);
+    verify.CmdText = "Cmd Text";
+    verify.EventID = 10;
+    verify.State   = FM_FILE_EXISTS;
+
+    /* Checked even while deferral is enabled */
+    FM_GlobalData.DeferVerify = true;
+    UtAssert_BOOL_TRUE(FM_VerifyDeferredFileState(&verify));
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Same event as the main task check */
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, !OS_SUCCESS);
+    UtAssert_BOOL_FALSE(FM_VerifyDeferredFileState(&verify));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, 10 + FM_FNAME_DNE_EID_OFFSET);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, 0);
+}
+
 /* **************************
  * VerifyFileClosed Tests
  * *************************/
@@ -513,17 +837,28 @@ void Test_FM_VerifyChildTask(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_CHILD_BROKEN_EID_OFFSET);
 
-    /* ChildWriteIndex equal to FM_CHILD_QUEUE_DEPTH */
-    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH - 1;
-    FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH;
+    /* ChildWriteIndex equal to FM_CHILD_QUEUE_DEPTH, staged checks of the rejected command are dropped */
+    FM_GlobalData.ChildQueueCount  = FM_CHILD_QUEUE_DEPTH - 1;
+    FM_GlobalData.ChildWriteIndex  = FM_CHILD_QUEUE_DEPTH;
+    FM_GlobalData.ChildVerifyCount = 1;
     UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, FM_CHILD_BROKEN_EID_OFFSET);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, 0);
 
     /* Success */
     FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH - 1;
     UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[FM_CHILD_QUEUE_DEPTH - 1].VerifyCount, 0);
+
+    /* Success, staged checks move to the queue entry */
+    FM_GlobalData.ChildVerifyCount       = 2;
+    FM_GlobalData.ChildVerify[1].EventID = 20;
+    UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[FM_CHILD_QUEUE_DEPTH - 1].VerifyCount, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[FM_CHILD_QUEUE_DEPTH - 1].Verify[1].EventID, 20);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, 0);
 }
 
 /* **********************
@@ -602,6 +937,13 @@ void Test_FM_GetVolumeFreeSpace(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_OS_SYS_STAT_ERR_EID);
 }
 
+void UT_Handler_DirIndexEstimate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint64 *ByteCountPtr = UT_Hook_GetArgValueByName(Context, "ByteCountPtr", uint64 *);
+
+    *ByteCountPtr = 5678;
+}
+
 void Test_FM_GetDirectorySpaceEstimate(void)
 {
     /*
@@ -628,6 +970,7 @@ void Test_FM_GetDirectorySpaceEstimate(void)
     UtAssert_INT32_EQ(FM_GetDirectorySpaceEstimate("test", &blocks, &bytes), CFE_SUCCESS);
     UtAssert_ZERO(blocks); /* not reported via OS_stat, so left unchanged */
     UtAssert_UINT32_EQ(bytes, fstat.FileSize);
+    UtAssert_STUB_COUNT(FM_StatCacheGet, 0);
 
     /* Skip subdirectories */
     fstat.FileModeBits = OS_FILESTAT_MODE_DIR;
@@ -667,6 +1010,15 @@ void Test_FM_GetDirectorySpaceEstimate(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_DIRECTORY_ESTIMATE_ERR_EID);
     UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+
+    /* Current directory index, the directory is not read */
+    bytes = 0;
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirIndexEstimate), true);
+    UT_SetHandlerFunction(UT_KEY(FM_DirIndexEstimate), UT_Handler_DirIndexEstimate, NULL);
+    UtAssert_INT32_EQ(FM_GetDirectorySpaceEstimate("test", &blocks, &bytes), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(bytes, 5678);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
 }
 
 /*
@@ -676,9 +1028,22 @@ void UtTest_Setup(void)
 {
     UtTest_Add(Test_FM_VerifyOverwrite, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyOverwrite");
     UtTest_Add(Test_FM_GetOpenFilesData, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetOpenFilesData");
+    UtTest_Add(Test_FM_OpenFilesSummaryRefresh, FM_Test_Setup, FM_Test_Teardown, "Test_FM_OpenFilesSummaryRefresh");
+    UtTest_Add(Test_FM_OpenFilesSummaryRefresh_Age, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_OpenFilesSummaryRefresh_Age");
+    UtTest_Add(Test_FM_GetOpenFilesCount, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetOpenFilesCount");
+    UtTest_Add(Test_FM_GetOpenFilesCount_CountOnly, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesCount_CountOnly");
+    UtTest_Add(Test_FM_GetOpenFilesCount_AgeReported, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesCount_AgeReported");
+    UtTest_Add(Test_FM_IsFileOpen, FM_Test_Setup, FM_Test_Teardown, "Test_FM_IsFileOpen");
+    UtTest_Add(Test_FM_OpenFileSet, FM_Test_Setup, FM_Test_Teardown, "Test_FM_OpenFileSet");
     UtTest_Add(Test_FM_GetFilenameState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetFilenameState");
+    UtTest_Add(Test_FM_GetBatchFilenameState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetBatchFilenameState");
     UtTest_Add(Test_FM_VerifyNameValid, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyNameValid");
     UtTest_Add(Test_FM_VerifyFileState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileState");
+    UtTest_Add(Test_FM_VerifyFileState_Deferred, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileState_Deferred");
+    UtTest_Add(Test_FM_VerifyDeferredFileState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyDeferredFileState");
     UtTest_Add(Test_FM_VerifyFileClosed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileClosed");
     UtTest_Add(Test_FM_VerifyFileExists, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileExists");
     UtTest_Add(Test_FM_VerifyFileNoExist, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileNoExist");
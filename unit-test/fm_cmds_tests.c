@@ -34,6 +34,7 @@
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
+#include <stddef.h>
 #include <string.h>
 
 /*
@@ -1097,12 +1098,20 @@ void Test_FM_GetOpenFilesCmd_Success(void)
     char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "%%s command");
 
+    FM_GlobalData.OpenFilesSummary.NumOpenFiles = 1;
+    strncpy(FM_GlobalData.OpenFilesSummary.OpenFilesList[0].LogicalName, "/cf/file",
+            sizeof(FM_GlobalData.OpenFilesSummary.OpenFilesList[0].LogicalName));
+
     bool Result = FM_GetOpenFilesCmd(&UT_CmdBuf.Buf);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Assert */
     UtAssert_True(Result == true, "FM_GetOpenFilesCmd returned true");
+    UtAssert_STUB_COUNT(FM_OpenFilesSummaryRefresh, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.OpenFilesPkt.Payload.NumOpenFiles, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.OpenFilesPkt.Payload.OpenFilesList[0].LogicalName, OS_MAX_PATH_LEN,
+                          "/cf/file", sizeof("/cf/file"));
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
@@ -1422,6 +1431,78 @@ void Test_FM_GetDirListFileCmd_NoChildTask(void)
     UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
 }
 
+void Test_FM_GetDirListFileCmd_CompactFormat(void)
+{
+    FM_GetDirectoryToFile_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListFileCmd.Payload;
+
+    strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename) - 1);
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->ListFormat = FM_DIR_LIST_FORMAT_COMPACT;
+    CmdPtr->MaxDepth   = FM_DIR_LIST_MAX_DEPTH;
+
+    FM_GlobalData.ChildWriteIndex = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_GetDirListFileCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_LIST_FILE_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].ListFormat, FM_DIR_LIST_FORMAT_COMPACT);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].MaxDepth, FM_DIR_LIST_MAX_DEPTH);
+}
+
+void Test_FM_GetDirListFileCmd_InvalidFormat(void)
+{
+    FM_GetDirectoryToFile_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListFileCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->ListFormat = FM_DIR_LIST_FORMAT_COMPACT + 1;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirListFileCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_GetDirListFileCmd_InvalidDepth(void)
+{
+    FM_GetDirectoryToFile_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListFileCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->MaxDepth = FM_DIR_LIST_MAX_DEPTH + 1;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirListFileCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
 void add_FM_GetDirListFileCmd_tests(void)
 {
     UtTest_Add(Test_FM_GetDirListFileCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetDirListFileCmd_Success");
@@ -1437,6 +1518,15 @@ void add_FM_GetDirListFileCmd_tests(void)
 
     UtTest_Add(Test_FM_GetDirListFileCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_GetDirListFileCmd_NoChildTask");
+
+    UtTest_Add(Test_FM_GetDirListFileCmd_CompactFormat, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListFileCmd_CompactFormat");
+
+    UtTest_Add(Test_FM_GetDirListFileCmd_InvalidFormat, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListFileCmd_InvalidFormat");
+
+    UtTest_Add(Test_FM_GetDirListFileCmd_InvalidDepth, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListFileCmd_InvalidDepth");
 }
 
 /****************************/
@@ -1511,6 +1601,51 @@ void Test_FM_GetDirListPktCmd_NoChildTask(void)
     UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
 }
 
+void Test_FM_GetDirListPktCmd_StreamMode(void)
+{
+    FM_GetDirectoryToPkt_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListPktCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->PacketMode = FM_DIR_LIST_PKT_STREAM;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_GetDirListPktCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_LIST_PKT_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].PacketMode, FM_DIR_LIST_PKT_STREAM);
+}
+
+void Test_FM_GetDirListPktCmd_InvalidMode(void)
+{
+    FM_GetDirectoryToPkt_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListPktCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->PacketMode = FM_DIR_LIST_PKT_STREAM + 1;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirListPktCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_ARG_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
 void add_FM_GetDirListPktCmd_tests(void)
 {
     UtTest_Add(Test_FM_GetDirListPktCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetDirListPktCmd_Success");
@@ -1520,6 +1655,12 @@ void add_FM_GetDirListPktCmd_tests(void)
 
     UtTest_Add(Test_FM_GetDirListPktCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_GetDirListPktCmd_NoChildTask");
+
+    UtTest_Add(Test_FM_GetDirListPktCmd_StreamMode, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListPktCmd_StreamMode");
+
+    UtTest_Add(Test_FM_GetDirListPktCmd_InvalidMode, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListPktCmd_InvalidMode");
 }
 
 void UT_Handler_MonitorSpace(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -1991,6 +2132,847 @@ void add_FM_SetPermissionsCmd_tests(void)
                "Test_FM_SetPermissionsCmd_NoChildTask");
 }
 
+/****************************/
+/* Directory Manifest Tests */
+/****************************/
+
+void Test_FM_DirManifestCmd_Success(void)
+{
+    FM_DirManifest_Payload_t *CmdPtr;
+    bool                      Result;
+
+    CmdPtr = &UT_CmdBuf.DirManifestCmd.Payload;
+
+    strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename) - 1);
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->FileInfoCRC = CFE_ES_CrcType_CRC_32;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_DirManifestCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_DirManifestCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DIR_MANIFEST_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].FileInfoCRC, CFE_ES_CrcType_CRC_32);
+    UtAssert_STUB_COUNT(FM_AppendPathSep, 1);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+}
+
+void Test_FM_DirManifestCmd_SuccessDefaultPath(void)
+{
+    FM_DirManifest_Payload_t *CmdPtr;
+    bool                      Result;
+
+    CmdPtr = &UT_CmdBuf.DirManifestCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->Filename[0]                     = '\0';
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_DirManifestCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_DirManifestCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DIR_MANIFEST_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Target, sizeof(FM_GlobalData.ChildQueue[0].Target),
+                          FM_DIR_MANIFEST_FILE_DEFNAME, sizeof(FM_DIR_MANIFEST_FILE_DEFNAME));
+}
+
+void Test_FM_DirManifestCmd_SourceNotExist(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_DirManifestCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_DirManifestCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_DirManifestCmd_TargetFileOpen(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_DirManifestCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_DirManifestCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_DirManifestCmd_BadCRCType(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_DirManifestCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_DirManifestCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DIR_MANIFEST_TYPE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_DirManifestCmd_NoChildTask(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DigestIsSupported), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    Result = FM_DirManifestCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_DirManifestCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void add_FM_DirManifestCmd_tests(void)
+{
+    UtTest_Add(Test_FM_DirManifestCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirManifestCmd_Success");
+
+    UtTest_Add(Test_FM_DirManifestCmd_SuccessDefaultPath, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirManifestCmd_SuccessDefaultPath");
+
+    UtTest_Add(Test_FM_DirManifestCmd_SourceNotExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirManifestCmd_SourceNotExist");
+
+    UtTest_Add(Test_FM_DirManifestCmd_TargetFileOpen, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirManifestCmd_TargetFileOpen");
+
+    UtTest_Add(Test_FM_DirManifestCmd_BadCRCType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirManifestCmd_BadCRCType");
+
+    UtTest_Add(Test_FM_DirManifestCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirManifestCmd_NoChildTask");
+}
+
+/****************************/
+/* Compare Files Tests      */
+/****************************/
+
+void Test_FM_CompareFilesCmd_Success(void)
+{
+    FM_CompareFiles_Payload_t *CmdPtr;
+    bool                       Result;
+
+    CmdPtr = &UT_CmdBuf.CompareFilesCmd.Payload;
+
+    strncpy(CmdPtr->Source1, "src1", sizeof(CmdPtr->Source1) - 1);
+    strncpy(CmdPtr->Source2, "src2", sizeof(CmdPtr->Source2) - 1);
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_CompareFilesCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_CompareFilesCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_COMPARE_FILES_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Source1, sizeof(FM_GlobalData.ChildQueue[0].Source1), "src1",
+                          sizeof("src1"));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Source2, sizeof(FM_GlobalData.ChildQueue[0].Source2), "src2",
+                          sizeof("src2"));
+}
+
+void Test_FM_CompareFilesCmd_SourceFile1NotClosed(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result                       = FM_CompareFilesCmd(&UT_CmdBuf.Buf);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_CompareFilesCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_CompareFilesCmd_SourceFile2NotClosed(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDeferredRetcode(UT_KEY(FM_VerifyFileClosed), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result                       = FM_CompareFilesCmd(&UT_CmdBuf.Buf);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_CompareFilesCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_CompareFilesCmd_NoChildTask(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    Result                       = FM_CompareFilesCmd(&UT_CmdBuf.Buf);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_CompareFilesCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void add_FM_CompareFilesCmd_tests(void)
+{
+    UtTest_Add(Test_FM_CompareFilesCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CompareFilesCmd_Success");
+
+    UtTest_Add(Test_FM_CompareFilesCmd_SourceFile1NotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CompareFilesCmd_SourceFile1NotClosed");
+
+    UtTest_Add(Test_FM_CompareFilesCmd_SourceFile2NotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CompareFilesCmd_SourceFile2NotClosed");
+
+    UtTest_Add(Test_FM_CompareFilesCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CompareFilesCmd_NoChildTask");
+}
+
+/****************************/
+/* Dir List Sorted Tests  */
+/****************************/
+
+void Test_FM_GetDirListSortedCmd_Success(void)
+{
+    FM_GetDirListSorted_Payload_t *CmdPtr;
+    bool                           Result;
+
+    CmdPtr = &UT_CmdBuf.GetDirListSortedCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    strncpy(CmdPtr->Pattern, "*.log", sizeof(CmdPtr->Pattern) - 1);
+    CmdPtr->MaxEntries      = 10;
+    CmdPtr->SortKey         = FM_SORT_BY_TIME;
+    CmdPtr->SortDirection   = FM_SORT_DESCENDING;
+    CmdPtr->GetSizeTimeMode = 1;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result = FM_GetDirListSortedCmd(&UT_CmdBuf.Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == true, "FM_GetDirListSortedCmd returned true");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_LIST_SORTED_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].MaxEntries, 10);
+    UtAssert_UINT8_EQ(FM_GlobalData.ChildQueue[0].SortKey, FM_SORT_BY_TIME);
+    UtAssert_UINT8_EQ(FM_GlobalData.ChildQueue[0].SortDirection, FM_SORT_DESCENDING);
+    UtAssert_UINT8_EQ(FM_GlobalData.ChildQueue[0].GetSizeTimeMode, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Source1, sizeof(FM_GlobalData.ChildQueue[0].Source1), "dir",
+                          sizeof("dir"));
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Target, sizeof(FM_GlobalData.ChildQueue[0].Target), "*.log",
+                          sizeof("*.log"));
+}
+
+void Test_FM_GetDirListSortedCmd_FullPacket(void)
+{
+    FM_GetDirListSorted_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListSortedCmd.Payload;
+
+    FM_GlobalData.ChildWriteIndex = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Zero fills the packet */
+    CmdPtr->MaxEntries = 0;
+    UtAssert_BOOL_TRUE(FM_GetDirListSortedCmd(&UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].MaxEntries, FM_DIR_LIST_PKT_ENTRIES);
+
+    /* More than a packet holds is limited to a packet */
+    CmdPtr->MaxEntries = FM_DIR_LIST_PKT_ENTRIES + 1;
+    UtAssert_BOOL_TRUE(FM_GetDirListSortedCmd(&UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].MaxEntries, FM_DIR_LIST_PKT_ENTRIES);
+}
+
+void Test_FM_GetDirListSortedCmd_BadArgument(void)
+{
+    FM_GetDirListSorted_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirListSortedCmd.Payload;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Sort key */
+    CmdPtr->SortKey = FM_SORT_BY_SIZE + 1;
+    UtAssert_BOOL_FALSE(FM_GetDirListSortedCmd(&UT_CmdBuf.Buf));
+
+    /* Sort direction */
+    CmdPtr->SortKey       = FM_SORT_BY_SIZE;
+    CmdPtr->SortDirection = FM_SORT_DESCENDING + 1;
+    UtAssert_BOOL_FALSE(FM_GetDirListSortedCmd(&UT_CmdBuf.Buf));
+
+    /* Pattern not terminated */
+    CmdPtr->SortDirection = FM_SORT_ASCENDING;
+    memset(CmdPtr->Pattern, '*', sizeof(CmdPtr->Pattern));
+    UtAssert_BOOL_FALSE(FM_GetDirListSortedCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_GET_DIR_SORTED_ARG_ERR_EID);
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_GetDirListSortedCmd_SourceNotExist(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    Result                       = FM_GetDirListSortedCmd(&UT_CmdBuf.Buf);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_GetDirListSortedCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_GetDirListSortedCmd_NoChildTask(void)
+{
+    bool Result;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    Result                       = FM_GetDirListSortedCmd(&UT_CmdBuf.Buf);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_True(Result == false, "FM_GetDirListSortedCmd returned false");
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void add_FM_GetDirListSortedCmd_tests(void)
+{
+    UtTest_Add(Test_FM_GetDirListSortedCmd_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListSortedCmd_Success");
+
+    UtTest_Add(Test_FM_GetDirListSortedCmd_FullPacket, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListSortedCmd_FullPacket");
+
+    UtTest_Add(Test_FM_GetDirListSortedCmd_BadArgument, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListSortedCmd_BadArgument");
+
+    UtTest_Add(Test_FM_GetDirListSortedCmd_SourceNotExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListSortedCmd_SourceNotExist");
+
+    UtTest_Add(Test_FM_GetDirListSortedCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListSortedCmd_NoChildTask");
+}
+
+/****************************/
+/* Dir Stats Tests          */
+/****************************/
+
+void Test_FM_GetDirStatsCmd_Success(void)
+{
+    FM_GetDirStats_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirStatsCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_GetDirStatsCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_AppendPathSep, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_STATS_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Source1, sizeof(FM_GlobalData.ChildQueue[0].Source1), "dir",
+                          sizeof("dir"));
+}
+
+void Test_FM_GetDirStatsCmd_SourceNotExist(void)
+{
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirStatsCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_GetDirStatsCmd_NoChildTask(void)
+{
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirStatsCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void add_FM_GetDirStatsCmd_tests(void)
+{
+    UtTest_Add(Test_FM_GetDirStatsCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetDirStatsCmd_Success");
+
+    UtTest_Add(Test_FM_GetDirStatsCmd_SourceNotExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirStatsCmd_SourceNotExist");
+
+    UtTest_Add(Test_FM_GetDirStatsCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirStatsCmd_NoChildTask");
+}
+
+/****************************/
+/* Dir Changes Tests        */
+/****************************/
+
+void Test_FM_GetDirChangesCmd_Success(void)
+{
+    FM_GetDirChanges_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.GetDirChangesCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    CmdPtr->SinceSequence = 1000;
+    CmdPtr->ChangeOffset  = 20;
+
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_GetDirChangesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_AppendPathSep, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_CHANGES_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Source1, sizeof(FM_GlobalData.ChildQueue[0].Source1), "dir",
+                          sizeof("dir"));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].SinceSequence, 1000);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueue[0].DirListOffset, 20);
+}
+
+void Test_FM_GetDirChangesCmd_SourceNotExist(void)
+{
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirChangesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_GetDirChangesCmd_NoChildTask(void)
+{
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetDirChangesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void add_FM_GetDirChangesCmd_tests(void)
+{
+    UtTest_Add(Test_FM_GetDirChangesCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetDirChangesCmd_Success");
+
+    UtTest_Add(Test_FM_GetDirChangesCmd_SourceNotExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirChangesCmd_SourceNotExist");
+
+    UtTest_Add(Test_FM_GetDirChangesCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirChangesCmd_NoChildTask");
+}
+
+/****************************/
+/* Build Dir Index Tests    */
+/****************************/
+
+void Test_FM_BuildDirIndexCmd_Success(void)
+{
+    FM_BuildDirIndex_Payload_t *CmdPtr;
+
+    CmdPtr = &UT_CmdBuf.BuildDirIndexCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+
+    FM_GlobalData.DirIndexEnable            = true;
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_BuildDirIndexCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_AppendPathSep, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_BUILD_DIR_INDEX_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildQueue[0].Source1, sizeof(FM_GlobalData.ChildQueue[0].Source1), "dir",
+                          sizeof("dir"));
+}
+
+void Test_FM_BuildDirIndexCmd_SourceNotExist(void)
+{
+    FM_GlobalData.DirIndexEnable            = true;
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_BuildDirIndexCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_BuildDirIndexCmd_NoChildTask(void)
+{
+    FM_GlobalData.DirIndexEnable            = true;
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_BuildDirIndexCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void Test_FM_BuildDirIndexCmd_Disabled(void)
+{
+    FM_GlobalData.DirIndexEnable            = false;
+    FM_GlobalData.ChildWriteIndex           = 0;
+    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_BuildDirIndexCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_BUILD_DIR_INDEX_DISABLED_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+}
+
+void add_FM_BuildDirIndexCmd_tests(void)
+{
+    UtTest_Add(Test_FM_BuildDirIndexCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_BuildDirIndexCmd_Success");
+
+    UtTest_Add(Test_FM_BuildDirIndexCmd_SourceNotExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_BuildDirIndexCmd_SourceNotExist");
+
+    UtTest_Add(Test_FM_BuildDirIndexCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_BuildDirIndexCmd_NoChildTask");
+
+    UtTest_Add(Test_FM_BuildDirIndexCmd_Disabled, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_BuildDirIndexCmd_Disabled");
+}
+
+/****************************/
+/* Get Open Files Page Tests */
+/****************************/
+
+/* Length the latest telemetry packet was set to */
+static CFE_MSG_Size_t UT_OpenFilesPageSize;
+
+/* Clears the message like cFE does */
+static void UT_Handler_CFE_MSG_Init(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Message_t *MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", CFE_MSG_Message_t *);
+
+    memset(MsgPtr, 0, UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t));
+}
+
+static void UT_Handler_CFE_MSG_SetSize(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_OpenFilesPageSize = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t);
+}
+
+static void UT_OpenFilesPageAdd(const char *LogicalName, const char *AppName)
+{
+    FM_OpenFilesSummary_t *SummaryPtr = &FM_GlobalData.OpenFilesSummary;
+
+    strncpy(SummaryPtr->OpenFilesList[SummaryPtr->NumOpenFiles].LogicalName, LogicalName, OS_MAX_PATH_LEN - 1);
+    strncpy(SummaryPtr->OpenFilesList[SummaryPtr->NumOpenFiles].AppName, AppName, OS_MAX_API_NAME - 1);
+    SummaryPtr->NumOpenFiles++;
+}
+
+void Test_FM_GetOpenFilesPageCmd_Filter(void)
+{
+    FM_GetOpenFilesPage_Payload_t *CmdPtr    = &UT_CmdBuf.GetOpenFilesPageCmd.Payload;
+    FM_OpenFilesPagePkt_Payload_t *ReportPtr = &FM_GlobalData.OpenFilesPagePkt.Payload;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_Init), UT_Handler_CFE_MSG_Init, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetSize), UT_Handler_CFE_MSG_SetSize, NULL);
+
+    UT_OpenFilesPageAdd("/cf/log1", "DS");
+    UT_OpenFilesPageAdd("/ram/tmp", "DS");
+    UT_OpenFilesPageAdd("/cf/log2", "DS");
+    UT_OpenFilesPageAdd("/cf/fm", "FM");
+
+    strncpy(CmdPtr->AppName, "DS", sizeof(CmdPtr->AppName) - 1);
+    strncpy(CmdPtr->PathPrefix, "/cf/", sizeof(CmdPtr->PathPrefix) - 1);
+    CmdPtr->FileOffset = 1;
+
+    UtAssert_BOOL_TRUE(FM_GetOpenFilesPageCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_OpenFilesSummaryRefresh, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(ReportPtr->TotalOpenFiles, 4);
+    UtAssert_UINT32_EQ(ReportPtr->MatchingFiles, 2);
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 1);
+    UtAssert_STRINGBUF_EQ(ReportPtr->OpenFilesList[0].LogicalName, OS_MAX_PATH_LEN, "/cf/log2", sizeof("/cf/log2"));
+    UtAssert_UINT32_EQ(UT_OpenFilesPageSize,
+                       offsetof(FM_OpenFilesPagePkt_t, Payload.OpenFilesList) + sizeof(FM_OpenFilesPageEntry_t));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_OPEN_FILES_PAGE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_GetOpenFilesPageCmd_Limit(void)
+{
+    FM_GetOpenFilesPage_Payload_t *CmdPtr    = &UT_CmdBuf.GetOpenFilesPageCmd.Payload;
+    FM_OpenFilesPagePkt_Payload_t *ReportPtr = &FM_GlobalData.OpenFilesPagePkt.Payload;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_Init), UT_Handler_CFE_MSG_Init, NULL);
+
+    UT_OpenFilesPageAdd("/cf/log1", "DS");
+    UT_OpenFilesPageAdd("/ram/tmp", "SC");
+    UT_OpenFilesPageAdd("/cf/fm", "FM");
+
+    /* Empty filters match every file */
+    CmdPtr->MaxFiles = 2;
+
+    UtAssert_BOOL_TRUE(FM_GetOpenFilesPageCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(ReportPtr->MatchingFiles, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 2);
+    UtAssert_STRINGBUF_EQ(ReportPtr->OpenFilesList[1].AppName, OS_MAX_API_NAME, "SC", sizeof("SC"));
+
+    /* Offset past the matching files sends no files */
+    CmdPtr->FileOffset = 3;
+
+    UtAssert_BOOL_TRUE(FM_GetOpenFilesPageCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(ReportPtr->MatchingFiles, 3);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_GetOpenFilesPageCmd_OpenSecs(void)
+{
+    FM_GetOpenFilesPage_Payload_t *CmdPtr    = &UT_CmdBuf.GetOpenFilesPageCmd.Payload;
+    FM_OpenFilesPagePkt_Payload_t *ReportPtr = &FM_GlobalData.OpenFilesPagePkt.Payload;
+
+    UT_OpenFilesPageAdd("/cf/log1", "DS");
+    UT_OpenFilesPageAdd("/cf/log2", "DS");
+
+    FM_GlobalData.OpenFilesSummary.RefreshTime       = 1000;
+    FM_GlobalData.OpenFilesSummary.Ages[0].FirstSeen = 990;
+    FM_GlobalData.OpenFilesSummary.Ages[1].FirstSeen = 100;
+
+    /* Only the file open at least this long is listed */
+    CmdPtr->MinOpenSecs = 600;
+
+    UtAssert_BOOL_TRUE(FM_GetOpenFilesPageCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(ReportPtr->MatchingFiles, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 1);
+    UtAssert_STRINGBUF_EQ(ReportPtr->OpenFilesList[0].LogicalName, OS_MAX_PATH_LEN, "/cf/log2", sizeof("/cf/log2"));
+    UtAssert_UINT32_EQ(ReportPtr->OpenFilesList[0].OpenSecs, 900);
+}
+
+void Test_FM_GetOpenFilesPageCmd_BadArgs(void)
+{
+    FM_GetOpenFilesPage_Payload_t *CmdPtr = &UT_CmdBuf.GetOpenFilesPageCmd.Payload;
+
+    memset(CmdPtr->PathPrefix, 'a', sizeof(CmdPtr->PathPrefix));
+
+    UtAssert_BOOL_FALSE(FM_GetOpenFilesPageCmd(&UT_CmdBuf.Buf));
+
+    UtAssert_STUB_COUNT(FM_OpenFilesSummaryRefresh, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_OPEN_FILES_PAGE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void add_FM_GetOpenFilesPageCmd_tests(void)
+{
+    UtTest_Add(Test_FM_GetOpenFilesPageCmd_Filter, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesPageCmd_Filter");
+
+    UtTest_Add(Test_FM_GetOpenFilesPageCmd_Limit, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesPageCmd_Limit");
+
+    UtTest_Add(Test_FM_GetOpenFilesPageCmd_OpenSecs, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesPageCmd_OpenSecs");
+
+    UtTest_Add(Test_FM_GetOpenFilesPageCmd_BadArgs, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesPageCmd_BadArgs");
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -2014,4 +2996,11 @@ void UtTest_Setup(void)
     add_FM_MonitorFilesystemSpaceCmd_tests();
     add_FM_SetTableStateCmd_tests();
     add_FM_SetPermissionsCmd_tests();
+    add_FM_DirManifestCmd_tests();
+    add_FM_CompareFilesCmd_tests();
+    add_FM_GetDirListSortedCmd_tests();
+    add_FM_GetDirStatsCmd_tests();
+    add_FM_GetDirChangesCmd_tests();
+    add_FM_BuildDirIndexCmd_tests();
+    add_FM_GetOpenFilesPageCmd_tests();
 }
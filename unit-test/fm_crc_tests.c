@@ -0,0 +1,398 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Coverage Unit Test cases for the fm_crc implementations
+ */
+
+#include "cfe.h"
+#include "fm_crc.h"
+
+#include <string.h>
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Standard CRC catalogue check string and the expected results */
+static const char UT_CrcCheckString[] = "123456789";
+
+#define UT_CRC8_CHECK   0xF4
+#define UT_CRC16_CHECK  0xBB3D
+#define UT_CRC32_CHECK  0xCBF43926
+#define UT_CRC32C_CHECK 0xE3069283
+
+/*
+**********************************************************************************
+**          Reference (bit at a time) implementations
+**********************************************************************************
+*/
+
+static uint32 UT_ReferenceCRC(const uint8 *Data, size_t Length, uint32 TypeCRC)
+{
+    uint32 Crc = 0;
+    uint32 Bit;
+
+    if ((TypeCRC == CFE_ES_CrcType_CRC_32) || (TypeCRC == FM_CRC_TYPE_CRC32C))
+    {
+        Crc = 0xFFFFFFFF;
+    }
+
+    while (Length > 0)
+    {
+        if (TypeCRC == CFE_ES_CrcType_CRC_8)
+        {
+            Crc ^= *Data;
+            for (Bit = 0; Bit < 8; Bit++)
+            {
+                Crc = (Crc & 0x80) ? (((Crc << 1) ^ 0x07) & 0xFF) : ((Crc << 1) & 0xFF);
+            }
+        }
+        else
+        {
+            Crc ^= *Data;
+            for (Bit = 0; Bit < 8; Bit++)
+            {
+                if (TypeCRC == CFE_ES_CrcType_CRC_16)
+                {
+                    Crc = (Crc & 1) ? ((Crc >> 1) ^ 0xA001) : (Crc >> 1);
+                }
+                else if (TypeCRC == CFE_ES_CrcType_CRC_32)
+                {
+                    Crc = (Crc & 1) ? ((Crc >> 1) ^ 0xEDB88320) : (Crc >> 1);
+                }
+                else
+                {
+                    Crc = (Crc & 1) ? ((Crc >> 1) ^ 0x82F63B78) : (Crc >> 1);
+                }
+            }
+        }
+
+        Data++;
+        Length--;
+    }
+
+    if ((TypeCRC == CFE_ES_CrcType_CRC_32) || (TypeCRC == FM_CRC_TYPE_CRC32C))
+    {
+        Crc = ~Crc;
+    }
+
+    return Crc;
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_FM_CalculateCRC_CheckValues(void)
+{
+    FM_CrcInit();
+
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, CFE_ES_CrcType_CRC_8), UT_CRC8_CHECK);
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, CFE_ES_CrcType_CRC_16), UT_CRC16_CHECK);
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, CFE_ES_CrcType_CRC_32), UT_CRC32_CHECK);
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, FM_CRC_TYPE_CRC32C), UT_CRC32C_CHECK);
+}
+
+void Test_FM_CalculateCRC_ChainedBlocks(void)
+{
+    uint32 Crc;
+    uint32 TypeCRC;
+
+    FM_CrcInit();
+
+    for (TypeCRC = CFE_ES_CrcType_CRC_8; TypeCRC <= FM_CRC_TYPE_CRC32C; TypeCRC++)
+    {
+        Crc = FM_CalculateCRC(UT_CrcCheckString, 2, 0, TypeCRC);
+        Crc = FM_CalculateCRC(&UT_CrcCheckString[2], 7, Crc, TypeCRC);
+
+        UtAssert_UINT32_EQ(Crc, FM_CalculateCRC(UT_CrcCheckString, 9, 0, TypeCRC));
+    }
+}
+
+void Test_FM_CalculateCRC_MatchesReference(void)
+{
+    uint8  Data[100];
+    uint32 Index;
+    uint32 Offset;
+    uint32 Length;
+    uint32 TypeCRC;
+    bool   AllMatch = true;
+
+    for (Index = 0; Index < sizeof(Data); Index++)
+    {
+        Data[Index] = (uint8)((Index * 151) + 7);
+    }
+
+    FM_CrcInit();
+
+    /* Cover every alignment and every tail length of the slicing loop */
+    for (TypeCRC = CFE_ES_CrcType_CRC_8; TypeCRC <= FM_CRC_TYPE_CRC32C; TypeCRC++)
+    {
+        for (Offset = 0; Offset < 8; Offset++)
+        {
+            for (Length = 1; Length <= (sizeof(Data) - Offset); Length++)
+            {
+                if (FM_CalculateCRC(&Data[Offset], Length, 0, TypeCRC) !=
+                    UT_ReferenceCRC(&Data[Offset], Length, TypeCRC))
+                {
+                    AllMatch = false;
+                }
+            }
+        }
+    }
+
+    UtAssert_True(AllMatch, "Slicing CRC matches bitwise reference for all types, offsets and lengths");
+}
+
+void Test_FM_CalculateCRC_NoData(void)
+{
+    FM_CrcInit();
+
+    UtAssert_UINT32_EQ(FM_CalculateCRC(NULL, 9, 0x1234, CFE_ES_CrcType_CRC_16), 0x1234);
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 0, 0x1234, CFE_ES_CrcType_CRC_16), 0x1234);
+}
+
+void Test_FM_CalculateCRC_InvalidType(void)
+{
+    FM_CrcInit();
+
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, FM_IGNORE_CRC), 0);
+    UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, -1), 0);
+}
+
+void Test_FM_CrcInit_SelectsSupportedImpl(void)
+{
+    uint32 TypeCRC;
+
+    FM_CrcInit();
+
+    for (TypeCRC = CFE_ES_CrcType_CRC_8; TypeCRC <= FM_CRC_TYPE_CRC32C; TypeCRC++)
+    {
+        UtAssert_True(FM_CrcImplSupported(TypeCRC, FM_CrcGetImpl(TypeCRC)),
+                      "Selected implementation of CRC type %d is supported", (int)TypeCRC);
+        UtAssert_True(FM_CrcImplSupported(TypeCRC, FM_CRC_IMPL_TABLE),
+                      "Table implementation of CRC type %d is always supported", (int)TypeCRC);
+    }
+}
+
+void Test_FM_CrcSelectImpl_Unsupported(void)
+{
+    FM_CrcInit();
+
+    UtAssert_BOOL_TRUE(FM_CrcSelectImpl(CFE_ES_CrcType_CRC_32, FM_CRC_IMPL_TABLE));
+    UtAssert_BOOL_FALSE(FM_CrcSelectImpl(CFE_ES_CrcType_CRC_32, (FM_CrcImpl_t)-1));
+    UtAssert_INT32_EQ(FM_CrcGetImpl(CFE_ES_CrcType_CRC_32), FM_CRC_IMPL_TABLE);
+
+    /* Hardware implementations never cover the CRC-8 and CRC-16 algorithms or the wrong polynomial */
+    UtAssert_BOOL_FALSE(FM_CrcSelectImpl(CFE_ES_CrcType_CRC_16, FM_CRC_IMPL_PCLMUL));
+    UtAssert_BOOL_FALSE(FM_CrcSelectImpl(CFE_ES_CrcType_CRC_8, FM_CRC_IMPL_ARMV8));
+    UtAssert_BOOL_FALSE(FM_CrcSelectImpl(CFE_ES_CrcType_CRC_32, FM_CRC_IMPL_SSE42));
+    UtAssert_BOOL_FALSE(FM_CrcSelectImpl(FM_CRC_TYPE_CRC32C, FM_CRC_IMPL_PCLMUL));
+    UtAssert_INT32_EQ(FM_CrcGetImpl(CFE_ES_CrcType_CRC_16), FM_CRC_IMPL_TABLE);
+}
+
+void Test_FM_CalculateCRC_HardwareMatchesTable(void)
+{
+    static uint8 Data[4096 + 16];
+    FM_CrcImpl_t Impl;
+    uint32       TypeCRC;
+    uint32       Index;
+    uint32       Offset;
+    uint32       Length;
+    uint32       TableCrc;
+    uint32       ChainCrc;
+    bool         AllMatch;
+
+    for (Index = 0; Index < sizeof(Data); Index++)
+    {
+        Data[Index] = (uint8)((Index * 2654435761u) >> 13);
+    }
+
+    FM_CrcInit();
+
+    for (TypeCRC = CFE_ES_CrcType_CRC_32; TypeCRC <= FM_CRC_TYPE_CRC32C; TypeCRC++)
+    {
+        for (Impl = FM_CRC_IMPL_PCLMUL; Impl <= FM_CRC_IMPL_SSE42; Impl++)
+        {
+            if (FM_CrcImplSupported(TypeCRC, Impl) == false)
+            {
+                UtAssert_BOOL_FALSE(FM_CrcSelectImpl(TypeCRC, Impl));
+                UtPrintf("CRC type %d implementation %d not supported on this processor", (int)TypeCRC, (int)Impl);
+            }
+            else
+            {
+                AllMatch = true;
+
+                /* Cover unaligned starts, lengths around the fold thresholds and a full file block */
+                for (Offset = 0; Offset < 16; Offset++)
+                {
+                    for (Length = 0; Length <= (sizeof(Data) - 16); Length += ((Length < 300) ? 1 : 509))
+                    {
+                        FM_CrcSelectImpl(TypeCRC, FM_CRC_IMPL_TABLE);
+                        TableCrc = FM_CalculateCRC(&Data[Offset], Length, 0, TypeCRC);
+
+                        FM_CrcSelectImpl(TypeCRC, Impl);
+                        if (FM_CalculateCRC(&Data[Offset], Length, 0, TypeCRC) != TableCrc)
+                        {
+                            AllMatch = false;
+                        }
+
+                        /* Continuing from a previous block must also agree */
+                        ChainCrc = FM_CalculateCRC(&Data[Offset], Length / 2, 0, TypeCRC);
+                        ChainCrc = FM_CalculateCRC(&Data[Offset + (Length / 2)], Length - (Length / 2), ChainCrc,
+                                                   TypeCRC);
+                        if (ChainCrc != TableCrc)
+                        {
+                            AllMatch = false;
+                        }
+                    }
+                }
+
+                UtAssert_INT32_EQ(FM_CrcGetImpl(TypeCRC), Impl);
+                UtAssert_True(AllMatch, "CRC type %d implementation %d matches table implementation", (int)TypeCRC,
+                              (int)Impl);
+                UtAssert_UINT32_EQ(FM_CalculateCRC(UT_CrcCheckString, 9, 0, TypeCRC),
+                                   (TypeCRC == CFE_ES_CrcType_CRC_32) ? UT_CRC32_CHECK : UT_CRC32C_CHECK);
+            }
+        }
+    }
+}
+
+void Test_FM_CrcCombine_MatchesSequential(void)
+{
+    static uint8 Data[4096 + 16];
+    uint32       TypeCRC;
+    uint32       Index;
+    uint32       Split;
+    uint32       Crc1;
+    uint32       Crc2;
+    bool         AllMatch = true;
+
+    for (Index = 0; Index < sizeof(Data); Index++)
+    {
+        Data[Index] = (uint8)((Index * 2654435761u) >> 11);
+    }
+
+    FM_CrcInit();
+
+    for (TypeCRC = CFE_ES_CrcType_CRC_8; TypeCRC <= FM_CRC_TYPE_CRC32C; TypeCRC++)
+    {
+        /* Split points include empty blocks, odd lengths and power of two lengths */
+        for (Split = 0; Split <= sizeof(Data); Split += ((Split < 64) ? 1 : 255))
+        {
+            Crc1 = FM_CalculateCRC(Data, Split, 0, TypeCRC);
+            Crc2 = FM_CalculateCRC(&Data[Split], sizeof(Data) - Split, 0, TypeCRC);
+
+            if (FM_CrcCombine(Crc1, Crc2, sizeof(Data) - Split, TypeCRC) !=
+                FM_CalculateCRC(Data, sizeof(Data), 0, TypeCRC))
+            {
+                AllMatch = false;
+            }
+        }
+    }
+
+    UtAssert_True(AllMatch, "Combined CRC matches sequential CRC for all types and split points");
+}
+
+void Test_FM_CrcCombine_CheckValues(void)
+{
+    uint32 TypeCRC;
+    uint32 Crc1;
+    uint32 Crc2;
+    uint32 Crc3;
+    uint32 Combined;
+
+    FM_CrcInit();
+
+    /* Three segments combined left to right give the catalogue check value */
+    for (TypeCRC = CFE_ES_CrcType_CRC_8; TypeCRC <= FM_CRC_TYPE_CRC32C; TypeCRC++)
+    {
+        Crc1 = FM_CalculateCRC(UT_CrcCheckString, 4, 0, TypeCRC);
+        Crc2 = FM_CalculateCRC(&UT_CrcCheckString[4], 3, 0, TypeCRC);
+        Crc3 = FM_CalculateCRC(&UT_CrcCheckString[7], 2, 0, TypeCRC);
+
+        Combined = FM_CrcCombine(Crc1, Crc2, 3, TypeCRC);
+        Combined = FM_CrcCombine(Combined, Crc3, 2, TypeCRC);
+
+        UtAssert_UINT32_EQ(Combined, FM_CalculateCRC(UT_CrcCheckString, 9, 0, TypeCRC));
+    }
+
+    UtAssert_UINT32_EQ(Combined, UT_CRC32C_CHECK);
+}
+
+void Test_FM_CrcCombine_NoSecondBlock(void)
+{
+    UtAssert_UINT32_EQ(FM_CrcCombine(UT_CRC32_CHECK, 0, 0, CFE_ES_CrcType_CRC_32), UT_CRC32_CHECK);
+    UtAssert_UINT32_EQ(FM_CrcCombine(0x12345678, 0, 0, CFE_ES_CrcType_CRC_16), 0x5678);
+}
+
+void Test_FM_CrcCombine_InvalidType(void)
+{
+    UtAssert_UINT32_EQ(FM_CrcCombine(UT_CRC32_CHECK, UT_CRC32_CHECK, 9, FM_CRC_TYPE_XXHASH64), 0);
+    UtAssert_UINT32_EQ(FM_CrcCombine(UT_CRC32_CHECK, UT_CRC32_CHECK, 9, FM_IGNORE_CRC), 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_CalculateCRC_CheckValues, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CalculateCRC_CheckValues");
+
+    UtTest_Add(Test_FM_CalculateCRC_ChainedBlocks, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CalculateCRC_ChainedBlocks");
+
+    UtTest_Add(Test_FM_CalculateCRC_MatchesReference, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CalculateCRC_MatchesReference");
+
+    UtTest_Add(Test_FM_CalculateCRC_NoData, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CalculateCRC_NoData");
+
+    UtTest_Add(Test_FM_CalculateCRC_InvalidType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CalculateCRC_InvalidType");
+
+    UtTest_Add(Test_FM_CrcInit_SelectsSupportedImpl, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcInit_SelectsSupportedImpl");
+
+    UtTest_Add(Test_FM_CrcSelectImpl_Unsupported, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcSelectImpl_Unsupported");
+
+    UtTest_Add(Test_FM_CalculateCRC_HardwareMatchesTable, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CalculateCRC_HardwareMatchesTable");
+
+    UtTest_Add(Test_FM_CrcCombine_MatchesSequential, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcCombine_MatchesSequential");
+
+    UtTest_Add(Test_FM_CrcCombine_CheckValues, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcCombine_CheckValues");
+
+    UtTest_Add(Test_FM_CrcCombine_NoSecondBlock, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CrcCombine_NoSecondBlock");
+
+    UtTest_Add(Test_FM_CrcCombine_InvalidType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcCombine_InvalidType");
+}
@@ -0,0 +1,341 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Coverage Unit Test cases for the fm_digest implementations
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_crc.h"
+#include "fm_digest.h"
+
+#include <string.h>
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* FIPS 180-2 example message whose padding needs a second block */
+static const char UT_Sha256TwoBlockString[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+/* Compute a digest over a string in a single block */
+static uint32 UT_DigestString(uint32 TypeCRC, const char *String, uint8 *Digest, uint8 *DigestSize)
+{
+    FM_DigestContext_t Context;
+
+    FM_DigestInit(&Context, TypeCRC);
+    FM_DigestUpdate(&Context, String, strlen(String));
+
+    return FM_DigestFinal(&Context, Digest, DigestSize);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_FM_DigestIsSupported(void)
+{
+    UtAssert_BOOL_TRUE(FM_DigestIsSupported(CFE_ES_CrcType_CRC_8));
+    UtAssert_BOOL_TRUE(FM_DigestIsSupported(CFE_ES_CrcType_CRC_16));
+    UtAssert_BOOL_TRUE(FM_DigestIsSupported(CFE_ES_CrcType_CRC_32));
+    UtAssert_BOOL_TRUE(FM_DigestIsSupported(FM_CRC_TYPE_CRC32C));
+    UtAssert_BOOL_TRUE(FM_DigestIsSupported(FM_CRC_TYPE_XXHASH64));
+    UtAssert_BOOL_TRUE(FM_DigestIsSupported(FM_CRC_TYPE_SHA256));
+
+    UtAssert_BOOL_FALSE(FM_DigestIsSupported(FM_IGNORE_CRC));
+    UtAssert_BOOL_FALSE(FM_DigestIsSupported(-1));
+}
+
+void Test_FM_DigestFinal_Crc(void)
+{
+    const uint8 Expected32[] = {0x12, 0x34, 0x56, 0x78};
+    const uint8 Expected16[] = {0x56, 0x78};
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x12345678);
+
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_CRC32C, "123456789", Digest, &DigestSize), 0x12345678);
+    UtAssert_UINT32_EQ(DigestSize, sizeof(Expected32));
+    UtAssert_MemCmp(Digest, Expected32, sizeof(Expected32), "CRC-32C digest bytes");
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x5678);
+
+    UtAssert_UINT32_EQ(UT_DigestString(CFE_ES_CrcType_CRC_16, "123456789", Digest, &DigestSize), 0x5678);
+    UtAssert_UINT32_EQ(DigestSize, sizeof(Expected16));
+    UtAssert_MemCmp(Digest, Expected16, sizeof(Expected16), "CRC-16 digest bytes");
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 2);
+}
+
+void Test_FM_DigestUpdate_NoData(void)
+{
+    FM_DigestContext_t Context;
+    uint8              Digest[FM_MAX_DIGEST_SIZE];
+    uint8              DigestSize = 0;
+
+    FM_DigestInit(&Context, CFE_ES_CrcType_CRC_8);
+    FM_DigestUpdate(&Context, NULL, 9);
+    FM_DigestUpdate(&Context, "123456789", 0);
+
+    UtAssert_UINT32_EQ(FM_DigestFinal(&Context, Digest, &DigestSize), 0);
+    UtAssert_UINT32_EQ(DigestSize, 1);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 0);
+}
+
+void Test_FM_DigestFinal_Xxh64(void)
+{
+    const uint8 ExpectedEmpty[] = {0xEF, 0x46, 0xDB, 0x37, 0x51, 0xD8, 0xE9, 0x99};
+    const uint8 ExpectedAbc[]   = {0x44, 0xBC, 0x2C, 0xF5, 0xAD, 0x77, 0x09, 0x99};
+    const uint8 ExpectedCheck[] = {0x8C, 0xB8, 0x41, 0xDB, 0x40, 0xE6, 0xAE, 0x83};
+    const uint8 ExpectedFox[]   = {0x0B, 0x24, 0x2D, 0x36, 0x1F, 0xDA, 0x71, 0xBC};
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_XXHASH64, "", Digest, &DigestSize), 0xEF46DB37);
+    UtAssert_UINT32_EQ(DigestSize, sizeof(ExpectedEmpty));
+    UtAssert_MemCmp(Digest, ExpectedEmpty, sizeof(ExpectedEmpty), "xxHash64 of empty string");
+
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_XXHASH64, "abc", Digest, &DigestSize), 0x44BC2CF5);
+    UtAssert_MemCmp(Digest, ExpectedAbc, sizeof(ExpectedAbc), "xxHash64 of \"abc\"");
+
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_XXHASH64, "123456789", Digest, &DigestSize), 0x8CB841DB);
+    UtAssert_MemCmp(Digest, ExpectedCheck, sizeof(ExpectedCheck), "xxHash64 of \"123456789\"");
+
+    /* Long enough to use the stripe accumulators */
+    UtAssert_UINT32_EQ(
+        UT_DigestString(FM_CRC_TYPE_XXHASH64, "The quick brown fox jumps over the lazy dog", Digest, &DigestSize),
+        0x0B242D36);
+    UtAssert_MemCmp(Digest, ExpectedFox, sizeof(ExpectedFox), "xxHash64 of pangram");
+
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 0);
+}
+
+void Test_FM_DigestFinal_Sha256(void)
+{
+    const uint8 ExpectedEmpty[] = {0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4,
+                                   0xc8, 0x99, 0x6f, 0xb9, 0x24, 0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b,
+                                   0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55};
+    const uint8 ExpectedAbc[]   = {0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40,
+                                   0xde, 0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17,
+                                   0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+    const uint8 ExpectedTwo[]   = {0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26,
+                                   0x93, 0x0c, 0x3e, 0x60, 0x39, 0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff,
+                                   0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1};
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_SHA256, "", Digest, &DigestSize), 0xe3b0c442);
+    UtAssert_UINT32_EQ(DigestSize, sizeof(ExpectedEmpty));
+    UtAssert_MemCmp(Digest, ExpectedEmpty, sizeof(ExpectedEmpty), "SHA-256 of empty string");
+
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_SHA256, "abc", Digest, &DigestSize), 0xba7816bf);
+    UtAssert_MemCmp(Digest, ExpectedAbc, sizeof(ExpectedAbc), "SHA-256 of \"abc\"");
+
+    /* Padding spills into a second block */
+    UtAssert_UINT32_EQ(UT_DigestString(FM_CRC_TYPE_SHA256, UT_Sha256TwoBlockString, Digest, &DigestSize), 0x248d6a61);
+    UtAssert_MemCmp(Digest, ExpectedTwo, sizeof(ExpectedTwo), "SHA-256 of two block message");
+
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 0);
+}
+
+void Test_FM_DigestUpdate_ChunkedMatchesSingleBlock(void)
+{
+    FM_DigestContext_t Context;
+    uint8              Data[300];
+    uint8              Expected[FM_MAX_DIGEST_SIZE];
+    uint8              Digest[FM_MAX_DIGEST_SIZE];
+    uint8              DigestSize = 0;
+    uint32             TypeCRC;
+    uint32             Index;
+    uint32             Split;
+    uint32             Length;
+    bool               AllMatch = true;
+
+    for (Index = 0; Index < sizeof(Data); Index++)
+    {
+        Data[Index] = (uint8)((Index * 151) + 7);
+    }
+
+    /* File data arrives in blocks that do not line up with the stripe or block size */
+    for (TypeCRC = FM_CRC_TYPE_XXHASH64; TypeCRC <= FM_CRC_TYPE_SHA256; TypeCRC++)
+    {
+        FM_DigestInit(&Context, TypeCRC);
+        FM_DigestUpdate(&Context, Data, sizeof(Data));
+        FM_DigestFinal(&Context, Expected, &DigestSize);
+
+        for (Split = 1; Split < sizeof(Data); Split++)
+        {
+            FM_DigestInit(&Context, TypeCRC);
+            for (Index = 0; Index < sizeof(Data); Index += Split)
+            {
+                Length = ((sizeof(Data) - Index) < Split) ? (sizeof(Data) - Index) : Split;
+                FM_DigestUpdate(&Context, &Data[Index], Length);
+            }
+            FM_DigestFinal(&Context, Digest, &DigestSize);
+
+            if (memcmp(Digest, Expected, DigestSize) != 0)
+            {
+                AllMatch = false;
+            }
+        }
+    }
+
+    UtAssert_True(AllMatch, "Digest of chunked data matches digest of single block");
+}
+
+void Test_FM_DigestCacheLookup_Hit(void)
+{
+    const uint8 Stored[] = {0xCB, 0xF4, 0x39, 0x26};
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+    uint32      Crc        = 0;
+
+    FM_DigestCacheStore("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_32, 0xCBF43926, Stored, sizeof(Stored));
+
+    UtAssert_BOOL_TRUE(FM_DigestCacheLookup("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                            &DigestSize));
+    UtAssert_UINT32_EQ(Crc, 0xCBF43926);
+    UtAssert_UINT32_EQ(DigestSize, sizeof(Stored));
+    UtAssert_MemCmp(Digest, Stored, sizeof(Stored), "Cached digest bytes");
+}
+
+void Test_FM_DigestCacheLookup_Miss(void)
+{
+    const uint8 Stored[] = {0xCB, 0xF4, 0x39, 0x26};
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+    uint32      Crc        = 0;
+
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                             &DigestSize));
+
+    FM_DigestCacheStore("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_32, 0xCBF43926, Stored, sizeof(Stored));
+
+    /* Any change to name, size, time or algorithm must miss */
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file.da", 100, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                             &DigestSize));
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file.dat", 101, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                             &DigestSize));
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file.dat", 100, 5001, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                             &DigestSize));
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_16, &Crc, Digest,
+                                             &DigestSize));
+    UtAssert_UINT32_EQ(Crc, 0);
+}
+
+void Test_FM_DigestCacheStore_ReplacesSameFile(void)
+{
+    const uint8 Stored[] = {0x12, 0x34, 0x56, 0x78};
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+    uint32      Crc        = 0;
+    uint32      i;
+    uint32      Used = 0;
+
+    FM_DigestCacheStore("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_32, 0x11111111, Stored, sizeof(Stored));
+    FM_DigestCacheStore("/ram/file.dat", 200, 6000, CFE_ES_CrcType_CRC_32, 0x12345678, Stored, sizeof(Stored));
+
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file.dat", 100, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                             &DigestSize));
+    UtAssert_BOOL_TRUE(FM_DigestCacheLookup("/ram/file.dat", 200, 6000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                            &DigestSize));
+    UtAssert_UINT32_EQ(Crc, 0x12345678);
+
+    for (i = 0; i < FM_DIGEST_CACHE_ENTRIES; i++)
+    {
+        if (FM_GlobalData.DigestCache[i].Filename[0] != '\0')
+        {
+            Used++;
+        }
+    }
+
+    UtAssert_UINT32_EQ(Used, 1);
+}
+
+void Test_FM_DigestCacheStore_ReplacesLeastRecentlyUsed(void)
+{
+    const uint8 Stored[] = {0x12, 0x34, 0x56, 0x78};
+    char        Filename[OS_MAX_PATH_LEN];
+    uint8       Digest[FM_MAX_DIGEST_SIZE];
+    uint8       DigestSize = 0;
+    uint32      Crc        = 0;
+    uint32      i;
+
+    /* Fill the cache, then use the oldest entry so the second oldest is replaced */
+    for (i = 0; i < FM_DIGEST_CACHE_ENTRIES; i++)
+    {
+        snprintf(Filename, sizeof(Filename), "/ram/file%u.dat", (unsigned int)i);
+        FM_DigestCacheStore(Filename, i, 5000, CFE_ES_CrcType_CRC_32, i, Stored, sizeof(Stored));
+    }
+
+    UtAssert_BOOL_TRUE(FM_DigestCacheLookup("/ram/file0.dat", 0, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                            &DigestSize));
+
+    FM_DigestCacheStore("/ram/new.dat", 1, 5000, CFE_ES_CrcType_CRC_32, 99, Stored, sizeof(Stored));
+
+    UtAssert_BOOL_TRUE(FM_DigestCacheLookup("/ram/new.dat", 1, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                            &DigestSize));
+    UtAssert_BOOL_TRUE(FM_DigestCacheLookup("/ram/file0.dat", 0, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                            &DigestSize));
+
+    UtAssert_BOOL_FALSE(FM_DigestCacheLookup("/ram/file1.dat", 1, 5000, CFE_ES_CrcType_CRC_32, &Crc, Digest,
+                                             &DigestSize));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_DigestIsSupported, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestIsSupported");
+
+    UtTest_Add(Test_FM_DigestFinal_Crc, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinal_Crc");
+
+    UtTest_Add(Test_FM_DigestUpdate_NoData, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestUpdate_NoData");
+
+    UtTest_Add(Test_FM_DigestFinal_Xxh64, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinal_Xxh64");
+
+    UtTest_Add(Test_FM_DigestFinal_Sha256, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinal_Sha256");
+
+    UtTest_Add(Test_FM_DigestUpdate_ChunkedMatchesSingleBlock, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DigestUpdate_ChunkedMatchesSingleBlock");
+
+    UtTest_Add(Test_FM_DigestCacheLookup_Hit, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestCacheLookup_Hit");
+
+    UtTest_Add(Test_FM_DigestCacheLookup_Miss, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestCacheLookup_Miss");
+
+    UtTest_Add(Test_FM_DigestCacheStore_ReplacesSameFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DigestCacheStore_ReplacesSameFile");
+
+    UtTest_Add(Test_FM_DigestCacheStore_ReplacesLeastRecentlyUsed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DigestCacheStore_ReplacesLeastRecentlyUsed");
+}
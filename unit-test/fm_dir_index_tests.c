@@ -0,0 +1,765 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Coverage Unit Test cases for the fm_dir_index implementations
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_child.h"
+#include "fm_crc.h"
+#include "fm_dir_index.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Number of entries for a build that needs more than one merge pass */
+#define UT_DIR_INDEX_BUILD_ENTRIES ((2 * FM_DIR_INDEX_SORT_ENTRIES) + 100)
+
+/* In memory files standing in for the two work files and the index file */
+#define UT_DIR_INDEX_WORK0 0
+#define UT_DIR_INDEX_WORK1 1
+#define UT_DIR_INDEX_FILE  2
+#define UT_DIR_INDEX_FILES 3
+
+typedef struct
+{
+    size_t Size;
+    size_t Position;
+    uint8  Data[sizeof(FM_DirIndexHeader_t) + (UT_DIR_INDEX_BUILD_ENTRIES * sizeof(FM_DirListEntry_t))];
+} UT_DirIndexFile_t;
+
+static UT_DirIndexFile_t UT_DirIndexFiles[UT_DIR_INDEX_FILES];
+static uint32            UT_DirIndexScanCount;
+
+static UT_DirIndexFile_t *UT_DirIndexFileByName(const char *Path)
+{
+    uint32 Slot = UT_DIR_INDEX_FILE;
+
+    if (strstr(Path, ".wk0") != NULL)
+    {
+        Slot = UT_DIR_INDEX_WORK0;
+    }
+    else if (strstr(Path, ".wk1") != NULL)
+    {
+        Slot = UT_DIR_INDEX_WORK1;
+    }
+
+    return &UT_DirIndexFiles[Slot];
+}
+
+static UT_DirIndexFile_t *UT_DirIndexFileByHandle(osal_id_t FileHandle)
+{
+    return &UT_DirIndexFiles[OS_ObjectIdToInteger(FileHandle) - 1];
+}
+
+void UT_Handler_DirIndexOpenCreate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *        FileHandlePtr = UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t *);
+    const char *       Path          = UT_Hook_GetArgValueByName(Context, "path", const char *);
+    int32              Flags         = UT_Hook_GetArgValueByName(Context, "flags", int32);
+    UT_DirIndexFile_t *FilePtr       = UT_DirIndexFileByName(Path);
+
+    if (UT_Stub_GetInt32StatusCode(Context, NULL) == false)
+    {
+        if ((Flags & OS_FILE_FLAG_TRUNCATE) != 0)
+        {
+            FilePtr->Size = 0;
+        }
+
+        FilePtr->Position = 0;
+        *FileHandlePtr    = OS_ObjectIdFromInteger((FilePtr - UT_DirIndexFiles) + 1);
+    }
+}
+
+void UT_Handler_DirIndexLseek(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t FileHandle = UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t);
+    int32     Offset     = UT_Hook_GetArgValueByName(Context, "offset", int32);
+
+    if (UT_Stub_GetInt32StatusCode(Context, NULL) == false)
+    {
+        UT_DirIndexFileByHandle(FileHandle)->Position = Offset;
+        UT_Stub_SetReturnValue(FuncKey, Offset);
+    }
+}
+
+void UT_Handler_DirIndexRead(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t          FileHandle = UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t);
+    void *             Buffer     = UT_Hook_GetArgValueByName(Context, "buffer", void *);
+    size_t             Bytes      = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    UT_DirIndexFile_t *FilePtr    = UT_DirIndexFileByHandle(FileHandle);
+    int32              BytesRead  = 0;
+
+    if (UT_Stub_GetInt32StatusCode(Context, NULL) == false)
+    {
+        if (FilePtr->Position < FilePtr->Size)
+        {
+            BytesRead = FilePtr->Size - FilePtr->Position;
+
+            if ((size_t)BytesRead > Bytes)
+            {
+                BytesRead = Bytes;
+            }
+
+            memcpy(Buffer, &FilePtr->Data[FilePtr->Position], BytesRead);
+            FilePtr->Position += BytesRead;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, BytesRead);
+    }
+}
+
+void UT_Handler_DirIndexWrite(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t          FileHandle   = UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t);
+    const void *       Buffer       = UT_Hook_GetArgValueByName(Context, "buffer", const void *);
+    size_t             Bytes        = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    UT_DirIndexFile_t *FilePtr      = UT_DirIndexFileByHandle(FileHandle);
+    int32              BytesWritten = Bytes;
+
+    if (UT_Stub_GetInt32StatusCode(Context, NULL) == false)
+    {
+        memcpy(&FilePtr->Data[FilePtr->Position], Buffer, Bytes);
+        FilePtr->Position += Bytes;
+
+        if (FilePtr->Size < FilePtr->Position)
+        {
+            FilePtr->Size = FilePtr->Position;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, BytesWritten);
+    }
+}
+
+void UT_Handler_DirIndexRename(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const char *Path = UT_Hook_GetArgValueByName(Context, "old", const char *);
+
+    if (UT_Stub_GetInt32StatusCode(Context, NULL) == false)
+    {
+        memcpy(&UT_DirIndexFiles[UT_DIR_INDEX_FILE], UT_DirIndexFileByName(Path), sizeof(UT_DirIndexFile_t));
+    }
+}
+
+/* Directory and entries all report the modify time given in UserObj */
+void UT_Handler_DirIndexSizeTimeMode(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *FileSize = UT_Hook_GetArgValueByName(Context, "FileSize", uint32 *);
+    uint32 *FileTime = UT_Hook_GetArgValueByName(Context, "FileTime", uint32 *);
+    uint32 *FileMode = UT_Hook_GetArgValueByName(Context, "FileMode", uint32 *);
+
+    *FileSize = 50;
+    *FileTime = *(uint32 *)UserObj;
+    *FileMode = 0;
+}
+
+/* Entries are read in reverse name order so every run needs sorting */
+void UT_Handler_DirIndexScanRead(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    FM_ChildScan_t *ScanPtr = UT_Hook_GetArgValueByName(Context, "ScanPtr", FM_ChildScan_t *);
+
+    snprintf(OS_DIRENTRY_NAME(ScanPtr->DirEntry), sizeof(OS_DIRENTRY_NAME(ScanPtr->DirEntry)), "f%04lu",
+             (unsigned long)(UT_DIR_INDEX_BUILD_ENTRIES - UT_DirIndexScanCount));
+    UT_DirIndexScanCount++;
+}
+
+void UT_Handler_DirIndexScanStat(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    FM_DirListEntry_t *DirListData = UT_Hook_GetArgValueByName(Context, "DirListData", FM_DirListEntry_t *);
+
+    DirListData->EntrySize = 10;
+}
+
+/* Enable the index with the index file of name CRC 0, the CRC stub default, already listed */
+static void UT_DirIndexListSetup(void)
+{
+    FM_GlobalData.DirIndexEnable          = true;
+    FM_GlobalData.DirIndexList.Loaded     = true;
+    FM_GlobalData.DirIndexList.Count      = 1;
+    FM_GlobalData.DirIndexList.NameCrc[0] = 0;
+}
+
+static void UT_DirIndexFileSetup(void)
+{
+    memset(UT_DirIndexFiles, 0, sizeof(UT_DirIndexFiles));
+    UT_DirIndexScanCount = 0;
+
+    UT_DirIndexListSetup();
+
+    UT_SetHandlerFunction(UT_KEY(OS_OpenCreate), UT_Handler_DirIndexOpenCreate, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_lseek), UT_Handler_DirIndexLseek, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_read), UT_Handler_DirIndexRead, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_write), UT_Handler_DirIndexWrite, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_rename), UT_Handler_DirIndexRename, NULL);
+}
+
+/* Place an index of "/cf/dir" holding entries "a", "c" and "e" of 10 bytes each */
+static void UT_DirIndexFileInit(uint32 DirTime)
+{
+    UT_DirIndexFile_t * FilePtr = &UT_DirIndexFiles[UT_DIR_INDEX_FILE];
+    FM_DirIndexHeader_t Header;
+    FM_DirListEntry_t   Entry;
+    uint32              i;
+
+    memset(&Header, 0, sizeof(Header));
+    Header.Magic      = FM_DIR_INDEX_MAGIC;
+    Header.RecordSize = sizeof(FM_DirListEntry_t);
+    Header.DirTime    = DirTime;
+    Header.EntryCount = 3;
+    Header.FileCount  = 3;
+    Header.TotalBytes = 30;
+    strncpy(Header.DirName, "/cf/dir", sizeof(Header.DirName) - 1);
+
+    memcpy(FilePtr->Data, &Header, sizeof(Header));
+    FilePtr->Size = sizeof(Header);
+
+    for (i = 0; i < 3; i++)
+    {
+        memset(&Entry, 0, sizeof(Entry));
+        Entry.EntryName[0] = 'a' + (2 * i);
+        Entry.EntrySize    = 10;
+
+        memcpy(&FilePtr->Data[FilePtr->Size], &Entry, sizeof(Entry));
+        FilePtr->Size += sizeof(Entry);
+    }
+}
+
+static FM_DirIndexHeader_t *UT_DirIndexHeader(void)
+{
+    return (FM_DirIndexHeader_t *)UT_DirIndexFiles[UT_DIR_INDEX_FILE].Data;
+}
+
+static FM_DirListEntry_t *UT_DirIndexEntry(uint32 Index)
+{
+    uint8 *DataPtr = UT_DirIndexFiles[UT_DIR_INDEX_FILE].Data;
+
+    return (FM_DirListEntry_t *)&DataPtr[sizeof(FM_DirIndexHeader_t) + (Index * sizeof(FM_DirListEntry_t))];
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_FM_DirIndexName(void)
+{
+    char IndexName[OS_MAX_PATH_LEN];
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x1234abcd);
+
+    UtAssert_VOIDCALL(FM_DirIndexName("/cf/dir", IndexName));
+
+    UtAssert_STRINGBUF_EQ(IndexName, sizeof(IndexName), FM_DIR_INDEX_PATH "/1234abcd.idx", -1);
+}
+
+void Test_FM_DirIndexOpen_Current(void)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FM_DirIndexHeader_t Header;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+
+    UtAssert_BOOL_TRUE(FM_DirIndexOpen("/cf/dir", true, &FileHandle, &Header));
+
+    UtAssert_UINT32_EQ(Header.EntryCount, 3);
+    UtAssert_UINT32_EQ(OS_ObjectIdToInteger(FileHandle), UT_DIR_INDEX_FILE + 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+void Test_FM_DirIndexOpen_Stale(void)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FM_DirIndexHeader_t Header;
+    uint32              DirTime = 200;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+
+    UtAssert_BOOL_FALSE(FM_DirIndexOpen("/cf/dir", true, &FileHandle, &Header));
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Without the time check a stale index is still opened */
+    UtAssert_BOOL_TRUE(FM_DirIndexOpen("/cf/dir", false, &FileHandle, &Header));
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void Test_FM_DirIndexOpen_OtherDirectory(void)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FM_DirIndexHeader_t Header;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+
+    UtAssert_BOOL_FALSE(FM_DirIndexOpen("/cf/other", false, &FileHandle, &Header));
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void Test_FM_DirIndexOpen_NoFile(void)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FM_DirIndexHeader_t Header;
+
+    UT_DirIndexListSetup();
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    UtAssert_BOOL_FALSE(FM_DirIndexOpen("/cf/dir", false, &FileHandle, &Header));
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+void Test_FM_DirIndexOpen_NotKnown(void)
+{
+    osal_id_t           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FM_DirIndexHeader_t Header;
+
+    UT_DirIndexListSetup();
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x1234abcd);
+
+    /* A directory without a listed index file is not looked for */
+    UtAssert_BOOL_FALSE(FM_DirIndexOpen("/cf/dir", true, &FileHandle, &Header));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+}
+
+void Test_FM_DirIndexKnown(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x1234abcd);
+
+    /* Disabled index */
+    UtAssert_BOOL_FALSE(FM_DirIndexKnown("/cf/dir"));
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+
+    /* Index directory is read the first time, it does not exist */
+    FM_GlobalData.DirIndexEnable = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), OS_ERROR);
+
+    UtAssert_BOOL_FALSE(FM_DirIndexKnown("/cf/dir"));
+    UtAssert_BOOL_FALSE(FM_DirIndexKnown("/cf/dir"));
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_BOOL_TRUE(FM_GlobalData.DirIndexList.Loaded);
+
+    FM_GlobalData.DirIndexList.Count      = 1;
+    FM_GlobalData.DirIndexList.NameCrc[0] = 0x1234abcd;
+    UtAssert_BOOL_TRUE(FM_DirIndexKnown("/cf/dir"));
+
+    /* Every directory may have an index once some are not listed */
+    FM_GlobalData.DirIndexList.Count    = 0;
+    FM_GlobalData.DirIndexList.Overflow = true;
+    UtAssert_BOOL_TRUE(FM_DirIndexKnown("/cf/dir"));
+}
+
+void Test_FM_DirIndexListLoad(void)
+{
+    os_dirent_t direntry[] = {{.FileName = "0000abcd.idx"}, {.FileName = "0000abcd.wk0"}, {.FileName = "1234.idx"},
+                              {.FileName = "fm_dirlist.out"}, {.FileName = "ffffffff.idx"}};
+
+    FM_GlobalData.DirIndexList.Count = 5;
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 6, OS_ERROR);
+
+    UtAssert_VOIDCALL(FM_DirIndexListLoad());
+
+    /* Only index file names are listed */
+    UtAssert_BOOL_TRUE(FM_GlobalData.DirIndexList.Loaded);
+    UtAssert_BOOL_FALSE(FM_GlobalData.DirIndexList.Overflow);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.Count, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.NameCrc[0], 0x0000abcd);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.NameCrc[1], 0xffffffff);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+}
+
+void Test_FM_DirIndexRemove(void)
+{
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+
+    /* Index file of the same name belongs to another directory */
+    UtAssert_VOIDCALL(FM_DirIndexRemove("/cf/other"));
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.Count, 1);
+
+    UtAssert_VOIDCALL(FM_DirIndexRemove("/cf/dir"));
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.Count, 0);
+
+    /* No index file left to look for */
+    UtAssert_VOIDCALL(FM_DirIndexRemove("/cf/dir"));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+}
+
+void Test_FM_DirIndexBuild_Success(void)
+{
+    FM_DirIndexHeader_t Header;
+    uint32              DirTime = 100;
+    uint32              i;
+    bool                Sorted = true;
+
+    UT_DirIndexFileSetup();
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildScanRead), UT_Handler_DirIndexScanRead, NULL);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildScanStat), UT_Handler_DirIndexScanStat, NULL);
+    UT_SetDeferredRetcode(UT_KEY(FM_ChildScanRead), UT_DIR_INDEX_BUILD_ENTRIES + 1, OS_ERROR);
+    FM_GlobalData.DirIndexList.Count = 0;
+
+    UtAssert_INT32_EQ(FM_DirIndexBuild("/cf/dir", "/cf/dir/", &Header), OS_SUCCESS);
+
+    /* Index directory is made if needed and the new index is listed */
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.Count, 1);
+
+    UtAssert_UINT32_EQ(Header.DirTime, 100);
+    UtAssert_UINT32_EQ(Header.EntryCount, UT_DIR_INDEX_BUILD_ENTRIES);
+    UtAssert_UINT32_EQ(Header.FileCount, UT_DIR_INDEX_BUILD_ENTRIES);
+    UtAssert_UINT32_EQ(Header.TotalBytes, 10 * UT_DIR_INDEX_BUILD_ENTRIES);
+    UtAssert_STUB_COUNT(FM_ChildScanClose, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+
+    /* The index file holds the header and every entry in name order */
+    UtAssert_MemCmp(UT_DirIndexHeader(), &Header, sizeof(Header), "Index file header");
+    UtAssert_UINT32_EQ(UT_DirIndexFiles[UT_DIR_INDEX_FILE].Size,
+                       sizeof(Header) + (UT_DIR_INDEX_BUILD_ENTRIES * sizeof(FM_DirListEntry_t)));
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(0)->EntryName, sizeof(UT_DirIndexEntry(0)->EntryName), "f0001", -1);
+
+    for (i = 1; i < UT_DIR_INDEX_BUILD_ENTRIES; i++)
+    {
+        if (strcmp(UT_DirIndexEntry(i - 1)->EntryName, UT_DirIndexEntry(i)->EntryName) >= 0)
+        {
+            Sorted = false;
+        }
+    }
+
+    UtAssert_BOOL_TRUE(Sorted);
+}
+
+void Test_FM_DirIndexBuild_DirStatFailed(void)
+{
+    FM_DirIndexHeader_t Header;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_ChildSizeTimeMode), OS_ERROR);
+
+    UtAssert_INT32_EQ(FM_DirIndexBuild("/cf/dir", "/cf/dir/", &Header), OS_ERROR);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(FM_ChildScanOpen, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+}
+
+void Test_FM_DirIndexBuild_WriteFailed(void)
+{
+    FM_DirIndexHeader_t Header;
+
+    UT_DirIndexFileSetup();
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+
+    UtAssert_INT32_EQ(FM_DirIndexBuild("/cf/dir", "/cf/dir/", &Header), OS_ERROR);
+
+    /* Only the first work file was opened, the index is left alone */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(FM_ChildScanOpen, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_rename, 0);
+}
+
+void Test_FM_DirIndexBuild_ListFull(void)
+{
+    FM_DirIndexHeader_t Header;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+    UT_SetDefaultReturnValue(UT_KEY(FM_ChildScanRead), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x1234abcd);
+    FM_GlobalData.DirIndexList.Count = FM_DIR_INDEX_DIRS;
+
+    UtAssert_INT32_EQ(FM_DirIndexBuild("/cf/dir", "/cf/dir/", &Header), OS_SUCCESS);
+
+    /* The new index does not fit, every directory is looked for from now on */
+    UtAssert_UINT32_EQ(FM_GlobalData.DirIndexList.Count, FM_DIR_INDEX_DIRS);
+    UtAssert_BOOL_TRUE(FM_GlobalData.DirIndexList.Overflow);
+}
+
+void Test_FM_DirIndexFind(void)
+{
+    osal_id_t           FileHandle = OS_ObjectIdFromInteger(UT_DIR_INDEX_FILE + 1);
+    FM_DirListEntry_t   Entry;
+    uint32              Index = 0;
+    bool                Found = false;
+    FM_DirIndexHeader_t Header;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    memcpy(&Header, UT_DirIndexHeader(), sizeof(Header));
+
+    UtAssert_BOOL_TRUE(FM_DirIndexFind(FileHandle, &Header, "c", &Entry, &Index, &Found));
+    UtAssert_BOOL_TRUE(Found);
+    UtAssert_UINT32_EQ(Index, 1);
+    UtAssert_STRINGBUF_EQ(Entry.EntryName, sizeof(Entry.EntryName), "c", -1);
+
+    UtAssert_BOOL_TRUE(FM_DirIndexFind(FileHandle, &Header, "d", &Entry, &Index, &Found));
+    UtAssert_BOOL_FALSE(Found);
+    UtAssert_UINT32_EQ(Index, 2);
+
+    UtAssert_BOOL_TRUE(FM_DirIndexFind(FileHandle, &Header, "z", &Entry, &Index, &Found));
+    UtAssert_BOOL_FALSE(Found);
+    UtAssert_UINT32_EQ(Index, 3);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    UtAssert_BOOL_FALSE(FM_DirIndexFind(FileHandle, &Header, "c", &Entry, &Index, &Found));
+    UtAssert_BOOL_FALSE(Found);
+}
+
+void Test_FM_DirIndexShift(void)
+{
+    osal_id_t FileHandle = OS_ObjectIdFromInteger(UT_DIR_INDEX_FILE + 1);
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+
+    /* Opening a gap at 1 leaves "a", "c", "c", "e" */
+    UtAssert_BOOL_TRUE(FM_DirIndexShift(FileHandle, 1, 3, true));
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(1)->EntryName, sizeof(UT_DirIndexEntry(1)->EntryName), "c", -1);
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(2)->EntryName, sizeof(UT_DirIndexEntry(2)->EntryName), "c", -1);
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(3)->EntryName, sizeof(UT_DirIndexEntry(3)->EntryName), "e", -1);
+
+    /* Closing the gap again leaves "a", "c", "e" */
+    UtAssert_BOOL_TRUE(FM_DirIndexShift(FileHandle, 2, 4, false));
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(1)->EntryName, sizeof(UT_DirIndexEntry(1)->EntryName), "c", -1);
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(2)->EntryName, sizeof(UT_DirIndexEntry(2)->EntryName), "e", -1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    UtAssert_BOOL_FALSE(FM_DirIndexShift(FileHandle, 1, 3, true));
+}
+
+void Test_FM_DirIndexEstimate(void)
+{
+    uint64 ByteCount = 0;
+    uint32 DirTime   = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+
+    UtAssert_BOOL_TRUE(FM_DirIndexEstimate("/cf/dir", &ByteCount));
+    UtAssert_UINT32_EQ(ByteCount, 30);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    ByteCount = 0;
+    DirTime   = 200;
+
+    UtAssert_BOOL_FALSE(FM_DirIndexEstimate("/cf/dir", &ByteCount));
+    UtAssert_UINT32_EQ(ByteCount, 0);
+}
+
+void Test_FM_DirIndexPrepare(void)
+{
+    FM_DirIndexUpdate_t Update;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+
+    UtAssert_VOIDCALL(FM_DirIndexPrepare(&Update, "/cf/dir/d"));
+    UtAssert_BOOL_TRUE(Update.Indexed);
+    UtAssert_UINT32_EQ(Update.DirTime, 100);
+    UtAssert_STRINGBUF_EQ(Update.DirName, sizeof(Update.DirName), "/cf/dir", -1);
+    UtAssert_STRINGBUF_EQ(Update.EntryName, sizeof(Update.EntryName), "d", -1);
+
+    /* Entries of the root directory are never indexed */
+    UtAssert_VOIDCALL(FM_DirIndexPrepare(&Update, "/d"));
+    UtAssert_BOOL_FALSE(Update.Indexed);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+}
+
+void Test_FM_DirIndexCommit_Insert(void)
+{
+    FM_DirIndexUpdate_t Update;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+    FM_DirIndexPrepare(&Update, "/cf/dir/d");
+
+    DirTime = 200;
+
+    UtAssert_VOIDCALL(FM_DirIndexCommit(&Update));
+
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->DirTime, 200);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->EntryCount, 4);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->FileCount, 4);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->TotalBytes, 80);
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(2)->EntryName, sizeof(UT_DirIndexEntry(2)->EntryName), "d", -1);
+    UtAssert_UINT32_EQ(UT_DirIndexEntry(2)->EntrySize, 50);
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(3)->EntryName, sizeof(UT_DirIndexEntry(3)->EntryName), "e", -1);
+}
+
+void Test_FM_DirIndexCommit_Replace(void)
+{
+    FM_DirIndexUpdate_t Update;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+    FM_DirIndexPrepare(&Update, "/cf/dir/c");
+
+    UtAssert_VOIDCALL(FM_DirIndexCommit(&Update));
+
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->DirTime, 100);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->EntryCount, 3);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->FileCount, 3);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->TotalBytes, 70);
+    UtAssert_UINT32_EQ(UT_DirIndexEntry(1)->EntrySize, 50);
+}
+
+void Test_FM_DirIndexCommit_Remove(void)
+{
+    FM_DirIndexUpdate_t Update;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+    FM_DirIndexPrepare(&Update, "/cf/dir/c");
+
+    /* The directory is read again, then the removed entry is not found */
+    DirTime = 200;
+    UT_SetDeferredRetcode(UT_KEY(FM_ChildSizeTimeMode), 2, OS_ERROR);
+
+    UtAssert_VOIDCALL(FM_DirIndexCommit(&Update));
+
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->DirTime, 200);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->EntryCount, 2);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->FileCount, 2);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->TotalBytes, 20);
+    UtAssert_STRINGBUF_EQ(UT_DirIndexEntry(1)->EntryName, sizeof(UT_DirIndexEntry(1)->EntryName), "e", -1);
+}
+
+void Test_FM_DirIndexCommit_Stale(void)
+{
+    FM_DirIndexUpdate_t Update;
+    uint32              DirTime = 100;
+
+    UT_DirIndexFileSetup();
+    UT_DirIndexFileInit(100);
+    UT_SetHandlerFunction(UT_KEY(FM_ChildSizeTimeMode), UT_Handler_DirIndexSizeTimeMode, &DirTime);
+    FM_DirIndexPrepare(&Update, "/cf/dir/d");
+
+    /* Another application changed the directory since the index was checked */
+    Update.DirTime = 90;
+    DirTime        = 200;
+
+    UtAssert_VOIDCALL(FM_DirIndexCommit(&Update));
+
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->DirTime, 0);
+    UtAssert_UINT32_EQ(UT_DirIndexHeader()->EntryCount, 3);
+    UtAssert_STUB_COUNT(OS_close, 2);
+}
+
+void Test_FM_DirIndexCommit_NotIndexed(void)
+{
+    FM_DirIndexUpdate_t Update;
+
+    memset(&Update, 0, sizeof(Update));
+
+    UtAssert_VOIDCALL(FM_DirIndexCommit(&Update));
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_DirIndexName, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexName");
+
+    UtTest_Add(Test_FM_DirIndexOpen_Current, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexOpen_Current");
+
+    UtTest_Add(Test_FM_DirIndexOpen_Stale, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexOpen_Stale");
+
+    UtTest_Add(Test_FM_DirIndexOpen_OtherDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirIndexOpen_OtherDirectory");
+
+    UtTest_Add(Test_FM_DirIndexOpen_NoFile, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexOpen_NoFile");
+
+    UtTest_Add(Test_FM_DirIndexOpen_NotKnown, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexOpen_NotKnown");
+
+    UtTest_Add(Test_FM_DirIndexKnown, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexKnown");
+
+    UtTest_Add(Test_FM_DirIndexListLoad, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexListLoad");
+
+    UtTest_Add(Test_FM_DirIndexRemove, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexRemove");
+
+    UtTest_Add(Test_FM_DirIndexBuild_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexBuild_Success");
+
+    UtTest_Add(Test_FM_DirIndexBuild_DirStatFailed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirIndexBuild_DirStatFailed");
+
+    UtTest_Add(Test_FM_DirIndexBuild_WriteFailed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirIndexBuild_WriteFailed");
+
+    UtTest_Add(Test_FM_DirIndexBuild_ListFull, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexBuild_ListFull");
+
+    UtTest_Add(Test_FM_DirIndexFind, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexFind");
+
+    UtTest_Add(Test_FM_DirIndexShift, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexShift");
+
+    UtTest_Add(Test_FM_DirIndexEstimate, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexEstimate");
+
+    UtTest_Add(Test_FM_DirIndexPrepare, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexPrepare");
+
+    UtTest_Add(Test_FM_DirIndexCommit_Insert, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexCommit_Insert");
+
+    UtTest_Add(Test_FM_DirIndexCommit_Replace, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexCommit_Replace");
+
+    UtTest_Add(Test_FM_DirIndexCommit_Remove, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexCommit_Remove");
+
+    UtTest_Add(Test_FM_DirIndexCommit_Stale, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DirIndexCommit_Stale");
+
+    UtTest_Add(Test_FM_DirIndexCommit_NotIndexed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirIndexCommit_NotIndexed");
+}
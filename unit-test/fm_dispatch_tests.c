@@ -67,6 +67,7 @@ void Test_FM_ProcessCmd_NoopCmdCCReturn(void)
     length = sizeof(FM_NoopCmd_t);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_NoopCmd), true);
+    FM_GlobalData.ChildVerifyCount = 1;
 
     /* Act */
     UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
@@ -76,6 +77,7 @@ void Test_FM_ProcessCmd_NoopCmdCCReturn(void)
     UtAssert_STUB_COUNT(FM_NoopCmd, 1);
     UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
     UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyCount, 0);
 }
 
 void Test_FM_ProcessCmd_ResetCountersCCReturn(void)
@@ -503,6 +505,181 @@ void Test_FM_ProcessCmd_SetPermissionsCCReturn(void)
     UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
 }
 
+void Test_FM_ProcessCmd_DirManifestCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_DIR_MANIFEST_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_DirManifestCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirManifestCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_DirManifestCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_CompareFilesCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_COMPARE_FILES_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_CompareFilesCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CompareFilesCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_CompareFilesCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_GetDirListSortedCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_GET_DIR_LIST_SORTED_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_GetDirListSortedCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetDirListSortedCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_GetDirListSortedCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_GetDirStatsCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_GET_DIR_STATS_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_GetDirStatsCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetDirStatsCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_GetDirStatsCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_GetDirChangesCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_GET_DIR_CHANGES_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_GetDirChangesCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetDirChangesCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_GetDirChangesCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_BuildDirIndexCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_BUILD_DIR_INDEX_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_BuildDirIndexCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_BuildDirIndexCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_BuildDirIndexCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_GetOpenFilesPageCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    CFE_SB_Buffer_t   utbuf;
+    size_t            length;
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    fcn_code = FM_GET_OPEN_FILES_PAGE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_GetOpenFilesPageCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetOpenFilesPageCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(&utbuf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_GetOpenFilesPageCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
 void Test_FM_ProcessCmd_DefaultReturn(void)
 {
     /* Arrange */
@@ -581,6 +758,26 @@ void add_FM_ProcessCmd_tests(void)
     UtTest_Add(Test_FM_ProcessCmd_SetPermissionsCCReturn, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ProcessCmd_SetPermissionsCCReturn");
 
+    UtTest_Add(Test_FM_ProcessCmd_DirManifestCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_DirManifestCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_CompareFilesCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_CompareFilesCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_GetDirListSortedCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_GetDirListSortedCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_GetDirStatsCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_GetDirStatsCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_GetDirChangesCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_GetDirChangesCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_BuildDirIndexCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_BuildDirIndexCCReturn");
+    UtTest_Add(Test_FM_ProcessCmd_GetOpenFilesPageCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_GetOpenFilesPageCCReturn");
+
     UtTest_Add(Test_FM_ProcessCmd_DefaultReturn, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ProcessCmd_DefaultReturn");
 }
 
@@ -964,6 +1161,111 @@ void Test_FM_SetPermissionsVerifyDispatch(void)
     UtAssert_BOOL_TRUE(FM_SetPermissionsVerifyDispatch(&UT_CmdBuf.Buf));
 }
 
+void Test_FM_DirManifestVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DirManifestCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_DirManifestVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_DirManifestCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_DirManifestVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_CompareFilesVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_CompareFilesCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_CompareFilesVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_CompareFilesCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_CompareFilesVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_GetDirListSortedVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetDirListSortedCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_GetDirListSortedVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_GetDirListSortedCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_GetDirListSortedVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_GetDirStatsVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetDirStatsCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_GetDirStatsVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_GetDirStatsCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_GetDirStatsVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_GetDirChangesVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetDirChangesCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_GetDirChangesVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_GetDirChangesCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_GetDirChangesVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_BuildDirIndexVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_BuildDirIndexCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_BuildDirIndexVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_BuildDirIndexCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_BuildDirIndexVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_GetOpenFilesPageVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetOpenFilesPageCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_GetOpenFilesPageVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_GetOpenFilesPageCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_GetOpenFilesPageVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
 void Test_FM_SendHkVerifyDispatch(void)
 {
     size_t length;
@@ -1030,5 +1332,25 @@ void UtTest_Setup(void)
     UtTest_Add(Test_FM_SetPermissionsVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_SetPermissionsVerifyDispatch");
 
+    UtTest_Add(Test_FM_DirManifestVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_DirManifestVerifyDispatch");
+
+    UtTest_Add(Test_FM_CompareFilesVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_CompareFilesVerifyDispatch");
+
+    UtTest_Add(Test_FM_GetDirListSortedVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirListSortedVerifyDispatch");
+
+    UtTest_Add(Test_FM_GetDirStatsVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirStatsVerifyDispatch");
+
+    UtTest_Add(Test_FM_GetDirChangesVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetDirChangesVerifyDispatch");
+
+    UtTest_Add(Test_FM_BuildDirIndexVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_BuildDirIndexVerifyDispatch");
+    UtTest_Add(Test_FM_GetOpenFilesPageVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetOpenFilesPageVerifyDispatch");
+
     UtTest_Add(Test_FM_SendHkVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendHkVerifyDispatch");
 }
@@ -0,0 +1,345 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Coverage Unit Test cases for the fm_stat_cache implementations
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_events.h"
+#include "fm_stat_cache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Local time returned by OS_GetLocalTime, in milli-secs */
+static int64 UT_StatCacheTime;
+
+static void UT_Handler_OS_GetLocalTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    memset(TimePtr, 0, sizeof(*TimePtr));
+    TimePtr->ticks = UT_StatCacheTime * 10000;
+}
+
+/* Invalidates a name while OS_stat is running */
+static void UT_Handler_OS_stat_Invalidate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    os_fstat_t *FileStatusPtr = UT_Hook_GetArgValueByName(Context, "filestats", os_fstat_t *);
+
+    memset(FileStatusPtr, 0, sizeof(*FileStatusPtr));
+    FM_StatCacheInvalidate("/cf/other");
+}
+
+static void UT_StatCacheSetup(void)
+{
+    UT_StatCacheTime = 1000;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), UT_Handler_OS_GetLocalTime, NULL);
+
+    FM_GlobalData.StatCache.Mutex = FM_UT_OBJID_1;
+}
+
+static bool UT_StatCacheHasName(const char *Path)
+{
+    bool   Found = false;
+    uint32 i;
+
+    for (i = 0; i < FM_STAT_CACHE_ENTRIES; i++)
+    {
+        if (strcmp(FM_GlobalData.StatCache.Entries[i].Path, Path) == 0)
+        {
+            Found = true;
+        }
+    }
+
+    return Found;
+}
+
+static void UT_StatCacheAdd(const char *Path)
+{
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    FM_StatCacheGet(Path, &FileStatus);
+}
+
+/* ********************************
+ * Init Tests
+ * ********************************/
+void Test_FM_StatCacheInit_Success(void)
+{
+    FM_GlobalData.StatCache.Generation = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(FM_StatCacheInit());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.StatCache.Generation, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_StatCacheInit_MutexError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(FM_StatCacheInit());
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(FM_GlobalData.StatCache.Mutex));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_STAT_CACHE_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+/* ********************************
+ * Get Tests
+ * ********************************/
+void Test_FM_StatCacheGet_Off(void)
+{
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    FM_GlobalData.StatCache.Mutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf/file"));
+}
+
+void Test_FM_StatCacheGet_Hit(void)
+{
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    UT_StatCacheSetup();
+
+    FileStatus.FileSize = 100;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStatus, sizeof(FileStatus), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    UT_StatCacheTime += FM_STAT_CACHE_TTL_MS - 1;
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_UINT32_EQ(FileStatus.FileSize, 100);
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/cf/file"));
+}
+
+void Test_FM_StatCacheGet_Expired(void)
+{
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    UT_StatCacheSetup();
+
+    UT_StatCacheAdd("/cf/file");
+
+    /* Execute the function being tested */
+    UT_StatCacheTime += FM_STAT_CACHE_TTL_MS;
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+
+    /* Clock going backwards also expires the entry */
+    UT_StatCacheTime -= FM_STAT_CACHE_TTL_MS + 1;
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_stat, 3);
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/cf/file"));
+}
+
+void Test_FM_StatCacheGet_NotFound(void)
+{
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    UT_StatCacheSetup();
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_ERROR);
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf/file"));
+}
+
+void Test_FM_StatCacheGet_LongName(void)
+{
+    os_fstat_t FileStatus;
+    char       Path[OS_MAX_PATH_LEN + 1];
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    memset(Path, 'a', sizeof(Path) - 1);
+    Path[sizeof(Path) - 1] = '\0';
+    UT_StatCacheSetup();
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(FM_StatCacheGet(Path, &FileStatus), OS_SUCCESS);
+    UtAssert_INT32_EQ(FM_StatCacheGet(Path, &FileStatus), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void Test_FM_StatCacheGet_Replace(void)
+{
+    char   Path[OS_MAX_PATH_LEN];
+    uint32 i;
+
+    UT_StatCacheSetup();
+
+    for (i = 0; i < FM_STAT_CACHE_ENTRIES; i++)
+    {
+        snprintf(Path, sizeof(Path), "/cf/file%u", (unsigned int)i);
+        UT_StatCacheAdd(Path);
+    }
+
+    /* Finding the first name makes the second one least recently used */
+    UT_StatCacheAdd("/cf/file0");
+
+    /* Execute the function being tested */
+    UT_StatCacheAdd("/cf/new");
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_stat, FM_STAT_CACHE_ENTRIES + 1);
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/cf/new"));
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/cf/file0"));
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf/file1"));
+}
+
+void Test_FM_StatCacheGet_Invalidated(void)
+{
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    UT_StatCacheSetup();
+
+    UT_SetHandlerFunction(UT_KEY(OS_stat), UT_Handler_OS_stat_Invalidate, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(FM_StatCacheGet("/cf/file", &FileStatus), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(FM_GlobalData.StatCache.Generation, 1);
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf/file"));
+}
+
+/* ********************************
+ * Invalidate Tests
+ * ********************************/
+void Test_FM_StatCacheInvalidate_Names(void)
+{
+    UT_StatCacheSetup();
+
+    UT_StatCacheAdd("/cf/dir");
+    UT_StatCacheAdd("/cf/dir/file");
+    UT_StatCacheAdd("/cf/dirfile");
+    UT_StatCacheAdd("/cf");
+    UT_StatCacheAdd("/");
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(FM_StatCacheInvalidate("/cf/dir/"));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf/dir"));
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf/dir/file"));
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf"));
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/cf/dirfile"));
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/"));
+    UtAssert_UINT32_EQ(FM_GlobalData.StatCache.Generation, 1);
+}
+
+void Test_FM_StatCacheInvalidate_Root(void)
+{
+    UT_StatCacheSetup();
+
+    UT_StatCacheAdd("/cf");
+    UT_StatCacheAdd("/");
+    UT_StatCacheAdd("/ram");
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(FM_StatCacheInvalidate("/cf"));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/cf"));
+    UtAssert_BOOL_FALSE(UT_StatCacheHasName("/"));
+    UtAssert_BOOL_TRUE(UT_StatCacheHasName("/ram"));
+}
+
+void Test_FM_StatCacheInvalidate_Off(void)
+{
+    FM_GlobalData.StatCache.Mutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(FM_StatCacheInvalidate("/cf/file"));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.StatCache.Generation, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_StatCacheInit_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheInit_Success");
+    UtTest_Add(Test_FM_StatCacheInit_MutexError, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheInit_MutexError");
+    UtTest_Add(Test_FM_StatCacheGet_Off, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheGet_Off");
+    UtTest_Add(Test_FM_StatCacheGet_Hit, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheGet_Hit");
+    UtTest_Add(Test_FM_StatCacheGet_Expired, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheGet_Expired");
+    UtTest_Add(Test_FM_StatCacheGet_NotFound, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheGet_NotFound");
+    UtTest_Add(Test_FM_StatCacheGet_LongName, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheGet_LongName");
+    UtTest_Add(Test_FM_StatCacheGet_Replace, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheGet_Replace");
+    UtTest_Add(Test_FM_StatCacheGet_Invalidated, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_StatCacheGet_Invalidated");
+    UtTest_Add(Test_FM_StatCacheInvalidate_Names, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_StatCacheInvalidate_Names");
+    UtTest_Add(Test_FM_StatCacheInvalidate_Root, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheInvalidate_Root");
+    UtTest_Add(Test_FM_StatCacheInvalidate_Off, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StatCacheInvalidate_Off");
+}
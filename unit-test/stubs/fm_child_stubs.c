@@ -26,6 +26,67 @@
 #include "fm_child.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildBuildDirIndexCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildBuildDirIndexCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildBuildDirIndexCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildBuildDirIndexCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCompareFilesCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildCompareFilesCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildCompareFilesCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildCompareFilesCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCompareFilesLoop()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCompareFilesLoop(osal_id_t FileHandle1, osal_id_t FileHandle2, const FM_ChildQueueEntry_t *CmdArgs,
+                              FM_CompareFilesPkt_Payload_t *ReportPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCompareFilesLoop, bool);
+
+    UT_GenStub_AddParam(FM_ChildCompareFilesLoop, osal_id_t, FileHandle1);
+    UT_GenStub_AddParam(FM_ChildCompareFilesLoop, osal_id_t, FileHandle2);
+    UT_GenStub_AddParam(FM_ChildCompareFilesLoop, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildCompareFilesLoop, FM_CompareFilesPkt_Payload_t *, ReportPtr);
+
+    UT_GenStub_Execute(FM_ChildCompareFilesLoop, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCompareFilesLoop, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCompareFilesRead()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildCompareFilesRead(osal_id_t FileHandle, char *Buffer)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCompareFilesRead, int32);
+
+    UT_GenStub_AddParam(FM_ChildCompareFilesRead, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildCompareFilesRead, char *, Buffer);
+
+    UT_GenStub_Execute(FM_ChildCompareFilesRead, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCompareFilesRead, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildConcatFilesCmd()
@@ -50,6 +111,64 @@ void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
     UT_GenStub_Execute(FM_ChildCopyCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcRunSegments()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcRunSegments(void)
+{
+
+    UT_GenStub_Execute(FM_ChildCrcRunSegments, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcSegment()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcSegment(const char *Filename, uint32 TypeCRC, FM_CrcSegment_t *SegmentPtr)
+{
+    UT_GenStub_AddParam(FM_ChildCrcSegment, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildCrcSegment, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_ChildCrcSegment, FM_CrcSegment_t *, SegmentPtr);
+
+    UT_GenStub_Execute(FM_ChildCrcSegment, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcWorkerInit()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcWorkerInit(void)
+{
+
+    UT_GenStub_Execute(FM_ChildCrcWorkerInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcWorkerLoop()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcWorkerLoop(void)
+{
+
+    UT_GenStub_Execute(FM_ChildCrcWorkerLoop, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcWorkerTask()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcWorkerTask(void)
+{
+
+    UT_GenStub_Execute(FM_ChildCrcWorkerTask, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildCreateDirectoryCmd()
@@ -110,6 +229,140 @@ void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
     UT_GenStub_Execute(FM_ChildDeleteDirectoryCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirChangesAdd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirChangesAdd(FM_DirChangesPkt_Payload_t *ReportPtr, const FM_DirTrackEntry_t *EntryPtr, uint8 ChangeType)
+{
+    UT_GenStub_AddParam(FM_ChildDirChangesAdd, FM_DirChangesPkt_Payload_t *, ReportPtr);
+    UT_GenStub_AddParam(FM_ChildDirChangesAdd, const FM_DirTrackEntry_t *, EntryPtr);
+    UT_GenStub_AddParam(FM_ChildDirChangesAdd, uint8, ChangeType);
+
+    UT_GenStub_Execute(FM_ChildDirChangesAdd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirChangesCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirChangesCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirChangesCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirChangesCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirChangesReport()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirChangesReport(const FM_DirTrack_t *TrackPtr, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirChangesReport, const FM_DirTrack_t *, TrackPtr);
+    UT_GenStub_AddParam(FM_ChildDirChangesReport, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirChangesReport, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListBefore()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirListBefore(const FM_DirListEntry_t *Entry1, const FM_DirListEntry_t *Entry2, uint8 SortKey,
+                           uint8 SortDirection)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListBefore, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirListBefore, const FM_DirListEntry_t *, Entry1);
+    UT_GenStub_AddParam(FM_ChildDirListBefore, const FM_DirListEntry_t *, Entry2);
+    UT_GenStub_AddParam(FM_ChildDirListBefore, uint8, SortKey);
+    UT_GenStub_AddParam(FM_ChildDirListBefore, uint8, SortDirection);
+
+    UT_GenStub_Execute(FM_ChildDirListBefore, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListBefore, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListCompactEntry()
+ * ----------------------------------------------------
+ */
+size_t FM_ChildDirListCompactEntry(uint8 *Buffer, const FM_DirListEntry_t *EntryPtr, uint32 *LastTimePtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListCompactEntry, size_t);
+
+    UT_GenStub_AddParam(FM_ChildDirListCompactEntry, uint8 *, Buffer);
+    UT_GenStub_AddParam(FM_ChildDirListCompactEntry, const FM_DirListEntry_t *, EntryPtr);
+    UT_GenStub_AddParam(FM_ChildDirListCompactEntry, uint32 *, LastTimePtr);
+
+    UT_GenStub_Execute(FM_ChildDirListCompactEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListCompactEntry, size_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListCursorClose()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListCursorClose(void)
+{
+
+    UT_GenStub_Execute(FM_ChildDirListCursorClose, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListCursorExpire()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildDirListCursorExpire(void)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListCursorExpire, uint32);
+
+
+    UT_GenStub_Execute(FM_ChildDirListCursorExpire, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListCursorExpire, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListCursorOpen()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListCursorOpen(osal_id_t DirId, const char *Directory, uint32 DirTime, uint32 TotalFiles)
+{
+    UT_GenStub_AddParam(FM_ChildDirListCursorOpen, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildDirListCursorOpen, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDirListCursorOpen, uint32, DirTime);
+    UT_GenStub_AddParam(FM_ChildDirListCursorOpen, uint32, TotalFiles);
+
+    UT_GenStub_Execute(FM_ChildDirListCursorOpen, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListCursorValid()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirListCursorValid(const char *Directory)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListCursorValid, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirListCursorValid, const char *, Directory);
+
+    UT_GenStub_Execute(FM_ChildDirListCursorValid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListCursorValid, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildDirListFileCmd()
@@ -127,13 +380,14 @@ void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
  * Generated stub function for FM_ChildDirListFileInit()
  * ----------------------------------------------------
  */
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename)
+bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, uint8 ListFormat)
 {
     UT_GenStub_SetupReturnBuffer(FM_ChildDirListFileInit, bool);
 
     UT_GenStub_AddParam(FM_ChildDirListFileInit, osal_id_t *, FileHandlePtr);
     UT_GenStub_AddParam(FM_ChildDirListFileInit, const char *, Directory);
     UT_GenStub_AddParam(FM_ChildDirListFileInit, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirListFileInit, uint8, ListFormat);
 
     UT_GenStub_Execute(FM_ChildDirListFileInit, Basic, NULL);
 
@@ -146,7 +400,7 @@ bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, co
  * ----------------------------------------------------
  */
 void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 GetSizeTimeMode)
+                             const char *Filename, uint8 GetSizeTimeMode, uint8 ListFormat, uint8 MaxDepth)
 {
     UT_GenStub_AddParam(FM_ChildDirListFileLoop, osal_id_t, DirId);
     UT_GenStub_AddParam(FM_ChildDirListFileLoop, osal_id_t, FileHandle);
@@ -154,10 +408,105 @@ void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *
     UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, DirWithSep);
     UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, Filename);
     UT_GenStub_AddParam(FM_ChildDirListFileLoop, uint8, GetSizeTimeMode);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, uint8, ListFormat);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, uint8, MaxDepth);
 
     UT_GenStub_Execute(FM_ChildDirListFileLoop, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListFileNext()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirListFileNext(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, char *NextName,
+                             uint32 PartCount, uint8 ListFormat)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListFileNext, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirListFileNext, osal_id_t *, FileHandlePtr);
+    UT_GenStub_AddParam(FM_ChildDirListFileNext, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDirListFileNext, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirListFileNext, char *, NextName);
+    UT_GenStub_AddParam(FM_ChildDirListFileNext, uint32, PartCount);
+    UT_GenStub_AddParam(FM_ChildDirListFileNext, uint8, ListFormat);
+
+    UT_GenStub_Execute(FM_ChildDirListFileNext, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListFileNext, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListFileStats()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirListFileStats(osal_id_t FileHandle, const char *Filename, uint32 DirEntries, uint32 FileEntries)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListFileStats, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirListFileStats, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildDirListFileStats, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirListFileStats, uint32, DirEntries);
+    UT_GenStub_AddParam(FM_ChildDirListFileStats, uint32, FileEntries);
+
+    UT_GenStub_Execute(FM_ChildDirListFileStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListFileStats, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListFileTotals()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirListFileTotals(osal_id_t FileHandle, const char *Filename, uint32 PartCount, uint32 DirEntries)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListFileTotals, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirListFileTotals, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildDirListFileTotals, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirListFileTotals, uint32, PartCount);
+    UT_GenStub_AddParam(FM_ChildDirListFileTotals, uint32, DirEntries);
+
+    UT_GenStub_Execute(FM_ChildDirListFileTotals, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListFileTotals, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListHeapAdd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListHeapAdd(FM_DirListEntry_t *Heap, uint32 *HeapCount, uint32 HeapLimit,
+                            const FM_DirListEntry_t *Entry, uint8 SortKey, uint8 SortDirection)
+{
+    UT_GenStub_AddParam(FM_ChildDirListHeapAdd, FM_DirListEntry_t *, Heap);
+    UT_GenStub_AddParam(FM_ChildDirListHeapAdd, uint32 *, HeapCount);
+    UT_GenStub_AddParam(FM_ChildDirListHeapAdd, uint32, HeapLimit);
+    UT_GenStub_AddParam(FM_ChildDirListHeapAdd, const FM_DirListEntry_t *, Entry);
+    UT_GenStub_AddParam(FM_ChildDirListHeapAdd, uint8, SortKey);
+    UT_GenStub_AddParam(FM_ChildDirListHeapAdd, uint8, SortDirection);
+
+    UT_GenStub_Execute(FM_ChildDirListHeapAdd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListHeapSort()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListHeapSort(FM_DirListEntry_t *Heap, uint32 HeapCount, uint8 SortKey, uint8 SortDirection)
+{
+    UT_GenStub_AddParam(FM_ChildDirListHeapSort, FM_DirListEntry_t *, Heap);
+    UT_GenStub_AddParam(FM_ChildDirListHeapSort, uint32, HeapCount);
+    UT_GenStub_AddParam(FM_ChildDirListHeapSort, uint8, SortKey);
+    UT_GenStub_AddParam(FM_ChildDirListHeapSort, uint8, SortDirection);
+
+    UT_GenStub_Execute(FM_ChildDirListHeapSort, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildDirListPktCmd()
@@ -170,6 +519,200 @@ void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
     UT_GenStub_Execute(FM_ChildDirListPktCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListPktEntry()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListPktEntry(const FM_ChildQueueEntry_t *CmdArgs, const char *EntryName,
+                             FM_DirListPkt_Payload_t *ReportPtr, int32 *FilesTillSleep)
+{
+    UT_GenStub_AddParam(FM_ChildDirListPktEntry, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildDirListPktEntry, const char *, EntryName);
+    UT_GenStub_AddParam(FM_ChildDirListPktEntry, FM_DirListPkt_Payload_t *, ReportPtr);
+    UT_GenStub_AddParam(FM_ChildDirListPktEntry, int32 *, FilesTillSleep);
+
+    UT_GenStub_Execute(FM_ChildDirListPktEntry, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListPktNext()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListPktNext(FM_DirListPkt_Payload_t *ReportPtr, uint32 NextEntry)
+{
+    UT_GenStub_AddParam(FM_ChildDirListPktNext, FM_DirListPkt_Payload_t *, ReportPtr);
+    UT_GenStub_AddParam(FM_ChildDirListPktNext, uint32, NextEntry);
+
+    UT_GenStub_Execute(FM_ChildDirListPktNext, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListSortedCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListSortedCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirListSortedCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirListSortedCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirManifestCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirManifestCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirManifestCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirManifestCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirManifestEntry()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirManifestEntry(const char *Filename, uint32 TypeCRC, FM_DirManifestEntry_t *EntryPtr,
+                              int32 *LoopCountPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirManifestEntry, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirManifestEntry, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirManifestEntry, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_ChildDirManifestEntry, FM_DirManifestEntry_t *, EntryPtr);
+    UT_GenStub_AddParam(FM_ChildDirManifestEntry, int32 *, LoopCountPtr);
+
+    UT_GenStub_Execute(FM_ChildDirManifestEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirManifestEntry, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirManifestInit()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirManifestInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename, uint32 TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirManifestInit, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirManifestInit, osal_id_t *, FileHandlePtr);
+    UT_GenStub_AddParam(FM_ChildDirManifestInit, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDirManifestInit, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirManifestInit, uint32, TypeCRC);
+
+    UT_GenStub_Execute(FM_ChildDirManifestInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirManifestInit, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirManifestLoop()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirManifestLoop(osal_id_t DirId, osal_id_t FileHandle, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirManifestLoop, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildDirManifestLoop, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildDirManifestLoop, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirManifestLoop, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirStatsCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirStatsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirStatsCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirStatsCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirTrackChanged()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirTrackChanged(FM_DirTrack_t *TrackPtr, const char *Directory)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirTrackChanged, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirTrackChanged, FM_DirTrack_t *, TrackPtr);
+    UT_GenStub_AddParam(FM_ChildDirTrackChanged, const char *, Directory);
+
+    UT_GenStub_Execute(FM_ChildDirTrackChanged, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirTrackChanged, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirTrackGet()
+ * ----------------------------------------------------
+ */
+FM_DirTrack_t *FM_ChildDirTrackGet(const char *Directory)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirTrackGet, FM_DirTrack_t *);
+
+    UT_GenStub_AddParam(FM_ChildDirTrackGet, const char *, Directory);
+
+    UT_GenStub_Execute(FM_ChildDirTrackGet, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirTrackGet, FM_DirTrack_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirTrackRelease()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirTrackRelease(FM_DirTrack_t *TrackPtr)
+{
+    UT_GenStub_AddParam(FM_ChildDirTrackRelease, FM_DirTrack_t *, TrackPtr);
+
+    UT_GenStub_Execute(FM_ChildDirTrackRelease, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirTrackRemove()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirTrackRemove(FM_DirTrack_t *TrackPtr, const char *Name, uint32 Sequence)
+{
+    UT_GenStub_AddParam(FM_ChildDirTrackRemove, FM_DirTrack_t *, TrackPtr);
+    UT_GenStub_AddParam(FM_ChildDirTrackRemove, const char *, Name);
+    UT_GenStub_AddParam(FM_ChildDirTrackRemove, uint32, Sequence);
+
+    UT_GenStub_Execute(FM_ChildDirTrackRemove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirTrackScan()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildDirTrackScan(FM_DirTrack_t *TrackPtr, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirTrackScan, int32);
+
+    UT_GenStub_AddParam(FM_ChildDirTrackScan, FM_DirTrack_t *, TrackPtr);
+    UT_GenStub_AddParam(FM_ChildDirTrackScan, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirTrackScan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirTrackScan, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildFileInfoCmd()
@@ -219,6 +762,61 @@ void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
     UT_GenStub_Execute(FM_ChildMoveCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildParallelCRC()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildParallelCRC(const char *Filename, uint32 TypeCRC, uint32 *CrcPtr, uint32 *FileSizePtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildParallelCRC, int32);
+
+    UT_GenStub_AddParam(FM_ChildParallelCRC, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildParallelCRC, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_ChildParallelCRC, uint32 *, CrcPtr);
+    UT_GenStub_AddParam(FM_ChildParallelCRC, uint32 *, FileSizePtr);
+
+    UT_GenStub_Execute(FM_ChildParallelCRC, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildParallelCRC, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildParallelCRCJob()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildParallelCRCJob(const char *Filename, uint32 FileSize, uint32 TypeCRC, uint32 *CrcPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildParallelCRCJob, int32);
+
+    UT_GenStub_AddParam(FM_ChildParallelCRCJob, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildParallelCRCJob, uint32, FileSize);
+    UT_GenStub_AddParam(FM_ChildParallelCRCJob, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_ChildParallelCRCJob, uint32 *, CrcPtr);
+
+    UT_GenStub_Execute(FM_ChildParallelCRCJob, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildParallelCRCJob, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildPatternMatch()
+ * ----------------------------------------------------
+ */
+bool FM_ChildPatternMatch(const char *Pattern, const char *Name)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildPatternMatch, bool);
+
+    UT_GenStub_AddParam(FM_ChildPatternMatch, const char *, Pattern);
+    UT_GenStub_AddParam(FM_ChildPatternMatch, const char *, Name);
+
+    UT_GenStub_Execute(FM_ChildPatternMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildPatternMatch, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildProcess()
@@ -230,6 +828,17 @@ void FM_ChildProcess(void)
     UT_GenStub_Execute(FM_ChildProcess, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildQueueNext()
+ * ----------------------------------------------------
+ */
+void FM_ChildQueueNext(void)
+{
+
+    UT_GenStub_Execute(FM_ChildQueueNext, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildRenameCmd()
@@ -242,6 +851,99 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
     UT_GenStub_Execute(FM_ChildRenameCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildScanClose()
+ * ----------------------------------------------------
+ */
+void FM_ChildScanClose(FM_ChildScan_t *ScanPtr)
+{
+    UT_GenStub_AddParam(FM_ChildScanClose, FM_ChildScan_t *, ScanPtr);
+
+    UT_GenStub_Execute(FM_ChildScanClose, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildScanOpen()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildScanOpen(FM_ChildScan_t *ScanPtr, const char *Directory, const char *DirWithSep)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildScanOpen, int32);
+
+    UT_GenStub_AddParam(FM_ChildScanOpen, FM_ChildScan_t *, ScanPtr);
+    UT_GenStub_AddParam(FM_ChildScanOpen, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildScanOpen, const char *, DirWithSep);
+
+    UT_GenStub_Execute(FM_ChildScanOpen, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildScanOpen, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildScanRead()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildScanRead(FM_ChildScan_t *ScanPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildScanRead, int32);
+
+    UT_GenStub_AddParam(FM_ChildScanRead, FM_ChildScan_t *, ScanPtr);
+
+    UT_GenStub_Execute(FM_ChildScanRead, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildScanRead, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildScanRewind()
+ * ----------------------------------------------------
+ */
+void FM_ChildScanRewind(FM_ChildScan_t *ScanPtr)
+{
+    UT_GenStub_AddParam(FM_ChildScanRewind, FM_ChildScan_t *, ScanPtr);
+
+    UT_GenStub_Execute(FM_ChildScanRewind, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildScanStat()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildScanStat(FM_ChildScan_t *ScanPtr, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildScanStat, int32);
+
+    UT_GenStub_AddParam(FM_ChildScanStat, FM_ChildScan_t *, ScanPtr);
+    UT_GenStub_AddParam(FM_ChildScanStat, FM_DirListEntry_t *, DirListData);
+    UT_GenStub_AddParam(FM_ChildScanStat, int32 *, FilesTillSleep);
+
+    UT_GenStub_Execute(FM_ChildScanStat, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildScanStat, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildScanState()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildScanState(FM_ChildScan_t *ScanPtr, const FM_OpenFileSet_t *SetPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildScanState, uint32);
+
+    UT_GenStub_AddParam(FM_ChildScanState, FM_ChildScan_t *, ScanPtr);
+    UT_GenStub_AddParam(FM_ChildScanState, const FM_OpenFileSet_t *, SetPtr);
+
+    UT_GenStub_Execute(FM_ChildScanState, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildScanState, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildSetPermissionsCmd()
@@ -278,15 +980,19 @@ int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileT
  * Generated stub function for FM_ChildSleepStat()
  * ----------------------------------------------------
  */
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool GetSizeTimeMode)
+int32 FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
+                        bool GetSizeTimeMode)
 {
+    UT_GenStub_SetupReturnBuffer(FM_ChildSleepStat, int32);
+
     UT_GenStub_AddParam(FM_ChildSleepStat, const char *, Filename);
     UT_GenStub_AddParam(FM_ChildSleepStat, FM_DirListEntry_t *, DirListData);
     UT_GenStub_AddParam(FM_ChildSleepStat, int32 *, FilesTillSleep);
     UT_GenStub_AddParam(FM_ChildSleepStat, bool, GetSizeTimeMode);
 
     UT_GenStub_Execute(FM_ChildSleepStat, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildSleepStat, int32);
 }
 
 /*
@@ -299,3 +1005,85 @@ void FM_ChildTask(void)
 
     UT_GenStub_Execute(FM_ChildTask, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildVerifyCmd()
+ * ----------------------------------------------------
+ */
+bool FM_ChildVerifyCmd(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildVerifyCmd, bool);
+
+    UT_GenStub_AddParam(FM_ChildVerifyCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildVerifyCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildVerifyCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWriterFlush()
+ * ----------------------------------------------------
+ */
+bool FM_ChildWriterFlush(FM_ChildWriter_t *WriterPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildWriterFlush, bool);
+
+    UT_GenStub_AddParam(FM_ChildWriterFlush, FM_ChildWriter_t *, WriterPtr);
+
+    UT_GenStub_Execute(FM_ChildWriterFlush, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildWriterFlush, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWriterInit()
+ * ----------------------------------------------------
+ */
+void FM_ChildWriterInit(FM_ChildWriter_t *WriterPtr, osal_id_t FileHandle)
+{
+    UT_GenStub_AddParam(FM_ChildWriterInit, FM_ChildWriter_t *, WriterPtr);
+    UT_GenStub_AddParam(FM_ChildWriterInit, osal_id_t, FileHandle);
+
+    UT_GenStub_Execute(FM_ChildWriterInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWriterUpdate()
+ * ----------------------------------------------------
+ */
+bool FM_ChildWriterUpdate(FM_ChildWriter_t *WriterPtr, size_t Offset, const void *DataPtr, size_t DataLength)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildWriterUpdate, bool);
+
+    UT_GenStub_AddParam(FM_ChildWriterUpdate, FM_ChildWriter_t *, WriterPtr);
+    UT_GenStub_AddParam(FM_ChildWriterUpdate, size_t, Offset);
+    UT_GenStub_AddParam(FM_ChildWriterUpdate, const void *, DataPtr);
+    UT_GenStub_AddParam(FM_ChildWriterUpdate, size_t, DataLength);
+
+    UT_GenStub_Execute(FM_ChildWriterUpdate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildWriterUpdate, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWriterWrite()
+ * ----------------------------------------------------
+ */
+bool FM_ChildWriterWrite(FM_ChildWriter_t *WriterPtr, const void *DataPtr, size_t DataLength)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildWriterWrite, bool);
+
+    UT_GenStub_AddParam(FM_ChildWriterWrite, FM_ChildWriter_t *, WriterPtr);
+    UT_GenStub_AddParam(FM_ChildWriterWrite, const void *, DataPtr);
+    UT_GenStub_AddParam(FM_ChildWriterWrite, size_t, DataLength);
+
+    UT_GenStub_Execute(FM_ChildWriterWrite, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildWriterWrite, bool);
+}
@@ -49,6 +49,24 @@ void FM_AppendPathSep(char *Directory, uint32 BufferSize)
     UT_GenStub_Execute(FM_AppendPathSep, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetBatchFilenameState()
+ * ----------------------------------------------------
+ */
+uint32 FM_GetBatchFilenameState(const char *Filename, size_t BufferSize, const FM_OpenFileSet_t *SetPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetBatchFilenameState, uint32);
+
+    UT_GenStub_AddParam(FM_GetBatchFilenameState, const char *, Filename);
+    UT_GenStub_AddParam(FM_GetBatchFilenameState, size_t, BufferSize);
+    UT_GenStub_AddParam(FM_GetBatchFilenameState, const FM_OpenFileSet_t *, SetPtr);
+
+    UT_GenStub_Execute(FM_GetBatchFilenameState, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetBatchFilenameState, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetDirectorySpaceEstimate()
@@ -85,6 +103,21 @@ uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInf
     return UT_GenStub_GetReturnValue(FM_GetFilenameState, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetOpenFilesCount()
+ * ----------------------------------------------------
+ */
+uint32 FM_GetOpenFilesCount(void)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetOpenFilesCount, uint32);
+
+
+    UT_GenStub_Execute(FM_GetOpenFilesCount, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetOpenFilesCount, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetOpenFilesData()
@@ -130,6 +163,62 @@ void FM_InvokeChildTask(void)
     UT_GenStub_Execute(FM_InvokeChildTask, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_IsFileOpen()
+ * ----------------------------------------------------
+ */
+bool FM_IsFileOpen(const char *Filename)
+{
+    UT_GenStub_SetupReturnBuffer(FM_IsFileOpen, bool);
+
+    UT_GenStub_AddParam(FM_IsFileOpen, const char *, Filename);
+
+    UT_GenStub_Execute(FM_IsFileOpen, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_IsFileOpen, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_OpenFileSetFind()
+ * ----------------------------------------------------
+ */
+bool FM_OpenFileSetFind(const FM_OpenFileSet_t *SetPtr, const char *Filename)
+{
+    UT_GenStub_SetupReturnBuffer(FM_OpenFileSetFind, bool);
+
+    UT_GenStub_AddParam(FM_OpenFileSetFind, const FM_OpenFileSet_t *, SetPtr);
+    UT_GenStub_AddParam(FM_OpenFileSetFind, const char *, Filename);
+
+    UT_GenStub_Execute(FM_OpenFileSetFind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_OpenFileSetFind, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_OpenFileSetLoad()
+ * ----------------------------------------------------
+ */
+void FM_OpenFileSetLoad(FM_OpenFileSet_t *SetPtr)
+{
+    UT_GenStub_AddParam(FM_OpenFileSetLoad, FM_OpenFileSet_t *, SetPtr);
+
+    UT_GenStub_Execute(FM_OpenFileSetLoad, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_OpenFilesSummaryRefresh()
+ * ----------------------------------------------------
+ */
+void FM_OpenFilesSummaryRefresh(void)
+{
+
+    UT_GenStub_Execute(FM_OpenFilesSummaryRefresh, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_VerifyChildTask()
@@ -147,6 +236,22 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
     return UT_GenStub_GetReturnValue(FM_VerifyChildTask, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_VerifyDeferredFileState()
+ * ----------------------------------------------------
+ */
+bool FM_VerifyDeferredFileState(const FM_ChildVerify_t *VerifyPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_VerifyDeferredFileState, bool);
+
+    UT_GenStub_AddParam(FM_VerifyDeferredFileState, const FM_ChildVerify_t *, VerifyPtr);
+
+    UT_GenStub_Execute(FM_VerifyDeferredFileState, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_VerifyDeferredFileState, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_VerifyDirExists()
@@ -26,6 +26,38 @@
 #include "fm_cmds.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_BuildDirIndexCmd()
+ * ----------------------------------------------------
+ */
+bool FM_BuildDirIndexCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_BuildDirIndexCmd, bool);
+
+    UT_GenStub_AddParam(FM_BuildDirIndexCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_BuildDirIndexCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_BuildDirIndexCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CompareFilesCmd()
+ * ----------------------------------------------------
+ */
+bool FM_CompareFilesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_CompareFilesCmd, bool);
+
+    UT_GenStub_AddParam(FM_CompareFilesCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_CompareFilesCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_CompareFilesCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ConcatFilesCmd()
@@ -138,6 +170,38 @@ bool FM_DeleteFileCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_DeleteFileCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirManifestCmd()
+ * ----------------------------------------------------
+ */
+bool FM_DirManifestCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirManifestCmd, bool);
+
+    UT_GenStub_AddParam(FM_DirManifestCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_DirManifestCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirManifestCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetDirChangesCmd()
+ * ----------------------------------------------------
+ */
+bool FM_GetDirChangesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetDirChangesCmd, bool);
+
+    UT_GenStub_AddParam(FM_GetDirChangesCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetDirChangesCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetDirChangesCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetDirListFileCmd()
@@ -170,6 +234,38 @@ bool FM_GetDirListPktCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_GetDirListPktCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetDirListSortedCmd()
+ * ----------------------------------------------------
+ */
+bool FM_GetDirListSortedCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetDirListSortedCmd, bool);
+
+    UT_GenStub_AddParam(FM_GetDirListSortedCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetDirListSortedCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetDirListSortedCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetDirStatsCmd()
+ * ----------------------------------------------------
+ */
+bool FM_GetDirStatsCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetDirStatsCmd, bool);
+
+    UT_GenStub_AddParam(FM_GetDirStatsCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetDirStatsCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetDirStatsCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetFileInfoCmd()
@@ -202,6 +298,22 @@ bool FM_GetOpenFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_GetOpenFilesCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetOpenFilesPageCmd()
+ * ----------------------------------------------------
+ */
+bool FM_GetOpenFilesPageCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetOpenFilesPageCmd, bool);
+
+    UT_GenStub_AddParam(FM_GetOpenFilesPageCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetOpenFilesPageCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetOpenFilesPageCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_MonitorFilesystemSpaceCmd()
@@ -0,0 +1,126 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in fm_crc header
+ */
+
+#include "fm_crc.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CalculateCRC()
+ * ----------------------------------------------------
+ */
+uint32 FM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(FM_CalculateCRC, uint32);
+
+    UT_GenStub_AddParam(FM_CalculateCRC, const void *, DataPtr);
+    UT_GenStub_AddParam(FM_CalculateCRC, size_t, DataLength);
+    UT_GenStub_AddParam(FM_CalculateCRC, uint32, InputCRC);
+    UT_GenStub_AddParam(FM_CalculateCRC, uint32, TypeCRC);
+
+    UT_GenStub_Execute(FM_CalculateCRC, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_CalculateCRC, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CrcCombine()
+ * ----------------------------------------------------
+ */
+uint32 FM_CrcCombine(uint32 Crc1, uint32 Crc2, size_t Length2, uint32 TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(FM_CrcCombine, uint32);
+
+    UT_GenStub_AddParam(FM_CrcCombine, uint32, Crc1);
+    UT_GenStub_AddParam(FM_CrcCombine, uint32, Crc2);
+    UT_GenStub_AddParam(FM_CrcCombine, size_t, Length2);
+    UT_GenStub_AddParam(FM_CrcCombine, uint32, TypeCRC);
+
+    UT_GenStub_Execute(FM_CrcCombine, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_CrcCombine, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CrcGetImpl()
+ * ----------------------------------------------------
+ */
+FM_CrcImpl_t FM_CrcGetImpl(uint32 TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(FM_CrcGetImpl, FM_CrcImpl_t);
+
+    UT_GenStub_AddParam(FM_CrcGetImpl, uint32, TypeCRC);
+
+    UT_GenStub_Execute(FM_CrcGetImpl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_CrcGetImpl, FM_CrcImpl_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CrcImplSupported()
+ * ----------------------------------------------------
+ */
+bool FM_CrcImplSupported(uint32 TypeCRC, FM_CrcImpl_t Impl)
+{
+    UT_GenStub_SetupReturnBuffer(FM_CrcImplSupported, bool);
+
+    UT_GenStub_AddParam(FM_CrcImplSupported, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_CrcImplSupported, FM_CrcImpl_t, Impl);
+
+    UT_GenStub_Execute(FM_CrcImplSupported, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_CrcImplSupported, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CrcInit()
+ * ----------------------------------------------------
+ */
+void FM_CrcInit(void)
+{
+
+    UT_GenStub_Execute(FM_CrcInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_CrcSelectImpl()
+ * ----------------------------------------------------
+ */
+bool FM_CrcSelectImpl(uint32 TypeCRC, FM_CrcImpl_t Impl)
+{
+    UT_GenStub_SetupReturnBuffer(FM_CrcSelectImpl, bool);
+
+    UT_GenStub_AddParam(FM_CrcSelectImpl, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_CrcSelectImpl, FM_CrcImpl_t, Impl);
+
+    UT_GenStub_Execute(FM_CrcSelectImpl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_CrcSelectImpl, bool);
+}
@@ -0,0 +1,130 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in fm_digest header
+ */
+
+#include "fm_digest.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestCacheLookup()
+ * ----------------------------------------------------
+ */
+bool FM_DigestCacheLookup(const char *Filename, uint32 FileSize, uint32 FileTime, uint32 TypeCRC, uint32 *CrcPtr,
+                          uint8 *DigestPtr, uint8 *DigestSizePtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DigestCacheLookup, bool);
+
+    UT_GenStub_AddParam(FM_DigestCacheLookup, const char *, Filename);
+    UT_GenStub_AddParam(FM_DigestCacheLookup, uint32, FileSize);
+    UT_GenStub_AddParam(FM_DigestCacheLookup, uint32, FileTime);
+    UT_GenStub_AddParam(FM_DigestCacheLookup, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_DigestCacheLookup, uint32 *, CrcPtr);
+    UT_GenStub_AddParam(FM_DigestCacheLookup, uint8 *, DigestPtr);
+    UT_GenStub_AddParam(FM_DigestCacheLookup, uint8 *, DigestSizePtr);
+
+    UT_GenStub_Execute(FM_DigestCacheLookup, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DigestCacheLookup, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestCacheStore()
+ * ----------------------------------------------------
+ */
+void FM_DigestCacheStore(const char *Filename, uint32 FileSize, uint32 FileTime, uint32 TypeCRC, uint32 Crc,
+                         const uint8 *DigestPtr, uint8 DigestSize)
+{
+    UT_GenStub_AddParam(FM_DigestCacheStore, const char *, Filename);
+    UT_GenStub_AddParam(FM_DigestCacheStore, uint32, FileSize);
+    UT_GenStub_AddParam(FM_DigestCacheStore, uint32, FileTime);
+    UT_GenStub_AddParam(FM_DigestCacheStore, uint32, TypeCRC);
+    UT_GenStub_AddParam(FM_DigestCacheStore, uint32, Crc);
+    UT_GenStub_AddParam(FM_DigestCacheStore, const uint8 *, DigestPtr);
+    UT_GenStub_AddParam(FM_DigestCacheStore, uint8, DigestSize);
+
+    UT_GenStub_Execute(FM_DigestCacheStore, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestFinal()
+ * ----------------------------------------------------
+ */
+uint32 FM_DigestFinal(FM_DigestContext_t *ContextPtr, uint8 *DigestPtr, uint8 *DigestSizePtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DigestFinal, uint32);
+
+    UT_GenStub_AddParam(FM_DigestFinal, FM_DigestContext_t *, ContextPtr);
+    UT_GenStub_AddParam(FM_DigestFinal, uint8 *, DigestPtr);
+    UT_GenStub_AddParam(FM_DigestFinal, uint8 *, DigestSizePtr);
+
+    UT_GenStub_Execute(FM_DigestFinal, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DigestFinal, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestInit()
+ * ----------------------------------------------------
+ */
+void FM_DigestInit(FM_DigestContext_t *ContextPtr, uint32 TypeCRC)
+{
+    UT_GenStub_AddParam(FM_DigestInit, FM_DigestContext_t *, ContextPtr);
+    UT_GenStub_AddParam(FM_DigestInit, uint32, TypeCRC);
+
+    UT_GenStub_Execute(FM_DigestInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestIsSupported()
+ * ----------------------------------------------------
+ */
+bool FM_DigestIsSupported(uint32 TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DigestIsSupported, bool);
+
+    UT_GenStub_AddParam(FM_DigestIsSupported, uint32, TypeCRC);
+
+    UT_GenStub_Execute(FM_DigestIsSupported, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DigestIsSupported, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestUpdate()
+ * ----------------------------------------------------
+ */
+void FM_DigestUpdate(FM_DigestContext_t *ContextPtr, const void *DataPtr, size_t DataLength)
+{
+    UT_GenStub_AddParam(FM_DigestUpdate, FM_DigestContext_t *, ContextPtr);
+    UT_GenStub_AddParam(FM_DigestUpdate, const void *, DataPtr);
+    UT_GenStub_AddParam(FM_DigestUpdate, size_t, DataLength);
+
+    UT_GenStub_Execute(FM_DigestUpdate, Basic, NULL);
+}
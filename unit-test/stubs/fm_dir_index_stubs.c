@@ -0,0 +1,291 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in fm_dir_index header
+ */
+
+#include "fm_dir_index.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexBuild()
+ * ----------------------------------------------------
+ */
+int32 FM_DirIndexBuild(const char *Directory, const char *DirWithSep, FM_DirIndexHeader_t *HeaderPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexBuild, int32);
+
+    UT_GenStub_AddParam(FM_DirIndexBuild, const char *, Directory);
+    UT_GenStub_AddParam(FM_DirIndexBuild, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_DirIndexBuild, FM_DirIndexHeader_t *, HeaderPtr);
+
+    UT_GenStub_Execute(FM_DirIndexBuild, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexBuild, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexCommit()
+ * ----------------------------------------------------
+ */
+void FM_DirIndexCommit(const FM_DirIndexUpdate_t *UpdatePtr)
+{
+    UT_GenStub_AddParam(FM_DirIndexCommit, const FM_DirIndexUpdate_t *, UpdatePtr);
+
+    UT_GenStub_Execute(FM_DirIndexCommit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexEstimate()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexEstimate(const char *Directory, uint64 *ByteCountPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexEstimate, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexEstimate, const char *, Directory);
+    UT_GenStub_AddParam(FM_DirIndexEstimate, uint64 *, ByteCountPtr);
+
+    UT_GenStub_Execute(FM_DirIndexEstimate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexEstimate, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexFind()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexFind(osal_id_t FileHandle, const FM_DirIndexHeader_t *HeaderPtr, const char *EntryName,
+                     FM_DirListEntry_t *EntryPtr, uint32 *IndexPtr, bool *FoundPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexFind, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexFind, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_DirIndexFind, const FM_DirIndexHeader_t *, HeaderPtr);
+    UT_GenStub_AddParam(FM_DirIndexFind, const char *, EntryName);
+    UT_GenStub_AddParam(FM_DirIndexFind, FM_DirListEntry_t *, EntryPtr);
+    UT_GenStub_AddParam(FM_DirIndexFind, uint32 *, IndexPtr);
+    UT_GenStub_AddParam(FM_DirIndexFind, bool *, FoundPtr);
+
+    UT_GenStub_Execute(FM_DirIndexFind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexFind, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexKnown()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexKnown(const char *Directory)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexKnown, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexKnown, const char *, Directory);
+
+    UT_GenStub_Execute(FM_DirIndexKnown, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexKnown, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexListLoad()
+ * ----------------------------------------------------
+ */
+void FM_DirIndexListLoad(void)
+{
+
+    UT_GenStub_Execute(FM_DirIndexListLoad, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexMergePass()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexMergePass(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 EntryCount, uint32 RunLength)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexMergePass, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexMergePass, osal_id_t, SourceHandle);
+    UT_GenStub_AddParam(FM_DirIndexMergePass, osal_id_t, TargetHandle);
+    UT_GenStub_AddParam(FM_DirIndexMergePass, uint32, EntryCount);
+    UT_GenStub_AddParam(FM_DirIndexMergePass, uint32, RunLength);
+
+    UT_GenStub_Execute(FM_DirIndexMergePass, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexMergePass, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexName()
+ * ----------------------------------------------------
+ */
+void FM_DirIndexName(const char *Directory, char *IndexName)
+{
+    UT_GenStub_AddParam(FM_DirIndexName, const char *, Directory);
+    UT_GenStub_AddParam(FM_DirIndexName, char *, IndexName);
+
+    UT_GenStub_Execute(FM_DirIndexName, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexOpen()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexOpen(const char *Directory, bool CheckTime, osal_id_t *FileHandlePtr, FM_DirIndexHeader_t *HeaderPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexOpen, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexOpen, const char *, Directory);
+    UT_GenStub_AddParam(FM_DirIndexOpen, bool, CheckTime);
+    UT_GenStub_AddParam(FM_DirIndexOpen, osal_id_t *, FileHandlePtr);
+    UT_GenStub_AddParam(FM_DirIndexOpen, FM_DirIndexHeader_t *, HeaderPtr);
+
+    UT_GenStub_Execute(FM_DirIndexOpen, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexOpen, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexPrepare()
+ * ----------------------------------------------------
+ */
+void FM_DirIndexPrepare(FM_DirIndexUpdate_t *UpdatePtr, const char *Path)
+{
+    UT_GenStub_AddParam(FM_DirIndexPrepare, FM_DirIndexUpdate_t *, UpdatePtr);
+    UT_GenStub_AddParam(FM_DirIndexPrepare, const char *, Path);
+
+    UT_GenStub_Execute(FM_DirIndexPrepare, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexRead()
+ * ----------------------------------------------------
+ */
+uint32 FM_DirIndexRead(osal_id_t FileHandle, uint32 Index, uint32 Count, FM_DirListEntry_t *EntryPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexRead, uint32);
+
+    UT_GenStub_AddParam(FM_DirIndexRead, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_DirIndexRead, uint32, Index);
+    UT_GenStub_AddParam(FM_DirIndexRead, uint32, Count);
+    UT_GenStub_AddParam(FM_DirIndexRead, FM_DirListEntry_t *, EntryPtr);
+
+    UT_GenStub_Execute(FM_DirIndexRead, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexRead, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexRemove()
+ * ----------------------------------------------------
+ */
+void FM_DirIndexRemove(const char *Directory)
+{
+    UT_GenStub_AddParam(FM_DirIndexRemove, const char *, Directory);
+
+    UT_GenStub_Execute(FM_DirIndexRemove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexRunPeek()
+ * ----------------------------------------------------
+ */
+FM_DirListEntry_t *FM_DirIndexRunPeek(osal_id_t FileHandle, FM_DirIndexRun_t *RunPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexRunPeek, FM_DirListEntry_t *);
+
+    UT_GenStub_AddParam(FM_DirIndexRunPeek, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_DirIndexRunPeek, FM_DirIndexRun_t *, RunPtr);
+
+    UT_GenStub_Execute(FM_DirIndexRunPeek, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexRunPeek, FM_DirListEntry_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexShift()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexShift(osal_id_t FileHandle, uint32 First, uint32 EntryCount, bool Insert)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexShift, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexShift, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_DirIndexShift, uint32, First);
+    UT_GenStub_AddParam(FM_DirIndexShift, uint32, EntryCount);
+    UT_GenStub_AddParam(FM_DirIndexShift, bool, Insert);
+
+    UT_GenStub_Execute(FM_DirIndexShift, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexShift, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexWrite()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexWrite(osal_id_t FileHandle, uint32 Index, uint32 Count, const FM_DirListEntry_t *EntryPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexWrite, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexWrite, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_DirIndexWrite, uint32, Index);
+    UT_GenStub_AddParam(FM_DirIndexWrite, uint32, Count);
+    UT_GenStub_AddParam(FM_DirIndexWrite, const FM_DirListEntry_t *, EntryPtr);
+
+    UT_GenStub_Execute(FM_DirIndexWrite, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexWrite, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DirIndexWriteRun()
+ * ----------------------------------------------------
+ */
+bool FM_DirIndexWriteRun(osal_id_t FileHandle, uint32 Index, uint32 Count)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DirIndexWriteRun, bool);
+
+    UT_GenStub_AddParam(FM_DirIndexWriteRun, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_DirIndexWriteRun, uint32, Index);
+    UT_GenStub_AddParam(FM_DirIndexWriteRun, uint32, Count);
+
+    UT_GenStub_Execute(FM_DirIndexWriteRun, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DirIndexWriteRun, bool);
+}
@@ -26,6 +26,54 @@
 #include "fm_dispatch.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_BuildDirIndexVerifyDispatch()
+ * ----------------------------------------------------
+ */
+bool FM_BuildDirIndexVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_BuildDirIndexVerifyDispatch, bool);
+
+    UT_GenStub_AddParam(FM_BuildDirIndexVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_BuildDirIndexVerifyDispatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_BuildDirIndexVerifyDispatch, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetDirChangesVerifyDispatch()
+ * ----------------------------------------------------
+ */
+bool FM_GetDirChangesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetDirChangesVerifyDispatch, bool);
+
+    UT_GenStub_AddParam(FM_GetDirChangesVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetDirChangesVerifyDispatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetDirChangesVerifyDispatch, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetOpenFilesPageVerifyDispatch()
+ * ----------------------------------------------------
+ */
+bool FM_GetOpenFilesPageVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetOpenFilesPageVerifyDispatch, bool);
+
+    UT_GenStub_AddParam(FM_GetOpenFilesPageVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetOpenFilesPageVerifyDispatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetOpenFilesPageVerifyDispatch, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_IsValidCmdPktLength()
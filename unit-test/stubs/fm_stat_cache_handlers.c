@@ -0,0 +1,41 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+
+/*
+ * Includes
+ */
+#include "osapi.h"
+#include "cfe.h"
+#include "utstubs.h"
+
+/*------------------------------------------------------------*/
+void UT_DefaultHandler_FM_StatCacheGet(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const char *Path          = UT_Hook_GetArgValueByName(Context, "Path", const char *);
+    os_fstat_t *FileStatusPtr = UT_Hook_GetArgValueByName(Context, "FileStatusPtr", os_fstat_t *);
+    int32       Status;
+
+    /* Unless a status is given, pass the call on to OS_stat so tests can set it up as before */
+    if (!UT_Stub_GetInt32StatusCode(Context, &Status))
+    {
+        Status = OS_stat(Path, FileStatusPtr);
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
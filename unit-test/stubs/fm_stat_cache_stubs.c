@@ -0,0 +1,69 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in fm_stat_cache header
+ */
+
+#include "fm_stat_cache.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_FM_StatCacheGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_StatCacheGet()
+ * ----------------------------------------------------
+ */
+int32 FM_StatCacheGet(const char *Path, os_fstat_t *FileStatusPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_StatCacheGet, int32);
+
+    UT_GenStub_AddParam(FM_StatCacheGet, const char *, Path);
+    UT_GenStub_AddParam(FM_StatCacheGet, os_fstat_t *, FileStatusPtr);
+
+    UT_GenStub_Execute(FM_StatCacheGet, Basic, UT_DefaultHandler_FM_StatCacheGet);
+
+    return UT_GenStub_GetReturnValue(FM_StatCacheGet, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_StatCacheInit()
+ * ----------------------------------------------------
+ */
+void FM_StatCacheInit(void)
+{
+
+    UT_GenStub_Execute(FM_StatCacheInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_StatCacheInvalidate()
+ * ----------------------------------------------------
+ */
+void FM_StatCacheInvalidate(const char *Path)
+{
+    UT_GenStub_AddParam(FM_StatCacheInvalidate, const char *, Path);
+
+    UT_GenStub_Execute(FM_StatCacheInvalidate, Basic, NULL);
+}
@@ -60,6 +60,13 @@ typedef union
     FM_MonitorFilesystemSpaceCmd_t GetFreeSpaceCmd;
     FM_SetTableStateCmd_t          SetTableStateCmd;
     FM_SetPermissionsCmd_t         SetPermissionsCmd;
+    FM_DirManifestCmd_t            DirManifestCmd;
+    FM_CompareFilesCmd_t           CompareFilesCmd;
+    FM_GetDirListSortedCmd_t       GetDirListSortedCmd;
+    FM_GetDirStatsCmd_t            GetDirStatsCmd;
+    FM_GetDirChangesCmd_t          GetDirChangesCmd;
+    FM_BuildDirIndexCmd_t          BuildDirIndexCmd;
+    FM_GetOpenFilesPageCmd_t       GetOpenFilesPageCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;